@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 4, 2014
  * Description:        Runs a simple game to demonstrate MyFirstEngine.
- * Last Modified:      March 25, 2014
- * Last Modification:  Testing mouse and keyboard input.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Flat objects use planar mode.
  ******************************************************************************/
 
 #include "MyFirstEngine.h"
@@ -113,8 +113,8 @@ protected:
             m_oFrameList[ui] = Frame::ZERO;
             m_oFrameList[ui].framePixels = m_oTexture.Size() / 2;
             m_oFrameList[ui].slicePixels = m_oTexture.Size() / 2;
-            m_oFrameList[ui].sliceLocation.x = ( ui / 2 ) * ( m_oTexture.Size().x / 2 );
-            m_oFrameList[ui].sliceLocation.y = ( ui % 2 ) * ( m_oTexture.Size().y / 2 );
+            m_oFrameList[ui].sliceLocation.x() = ( ui / 2 ) * ( m_oTexture.Size().x() / 2 );
+            m_oFrameList[ui].sliceLocation.y() = ( ui % 2 ) * ( m_oTexture.Size().y() / 2 );
         }
         m_oSprite.UpdateTextureMatrix();
         m_oSprite.SetDisplaySize( 40, 80 );
@@ -200,6 +200,13 @@ private:
         m_aoQuads[6] = Quad( Color::ColorWheel::VIOLET, Point2D( 160, 160 ) );
         m_aoQuads[7] = Quad( Color::ColorWheel::MEGAMAN_BLUE, Point2D( 80, 80 ) );
 
+        // Only the first few quads rotate out of the XY plane
+        for( unsigned int ui = 5; ui < 8; ++ui )
+        {
+            m_aoQuads[ui].SetPlanar();
+        }
+        m_oSprite.SetPlanar();
+
         // printable ascii frames
         for( unsigned int ui = 0; ui < 95; ++ui )
         {
@@ -0,0 +1,19 @@
+/******************************************************************************
+ * File:               QuadVertexDouble.glsl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Double-precision vertex shader for a solid Quad.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#version 410
+
+uniform dmat4 u_dm4ModelViewProjection;
+
+in vec2 i_v2Position;
+
+void main()
+{
+    gl_Position = vec4( u_dm4ModelViewProjection * vec4( i_v2Position, 0.0, 1.0 ));
+}
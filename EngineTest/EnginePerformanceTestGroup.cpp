@@ -0,0 +1,583 @@
+/******************************************************************************
+ * File:               EnginePerformanceTestGroup.cpp
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares the HTML character table and frame arena
+ *                      against the character map and heap allocations they
+ *                      replaced, measures drawable object sizes and copies,
+ *                      checks planar model matrices against the 3D ones, and
+ *                      reports how long each takes.  Timings are only
+ *                      meaningful in release builds.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added planar model matrix test.
+ ******************************************************************************/
+
+#include "EnginePerformanceTestGroup.h"
+#include "MathLibrary.h"
+#include "MyFirstEngine.h"
+#include "PerformanceTest.h"
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Space;
+
+// Sprites need a texture, which is never loaded.  Destroying a texture asks
+// OpenGL whether it was, so this one is left for the process to clean up.
+static MyFirstEngine::Texture& UnloadedTexture()
+{
+    static MyFirstEngine::Texture* const sc_poTexture =
+        new MyFirstEngine::Texture( "" );
+    return *sc_poTexture;
+}
+
+// Millions of copies per second, assigning the given object over every
+// element of a vector of the given size
+template< typename T >
+static double CopyRate( const T& ac_roObject, unsigned int a_uiCount )
+{
+    const unsigned int cuiRepeats = ITERATIONS / a_uiCount;
+    std::vector< T > oCopies( a_uiCount, ac_roObject );
+    std::clock_t iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        std::fill( oCopies.begin(), oCopies.end(), ac_roObject );
+    }
+    double dSeconds = SecondsSince( iStart );
+    return double( a_uiCount ) * cuiRepeats / 1e6 /
+           std::max( dSeconds, 1.0 / CLOCKS_PER_SEC );
+}
+
+// True if the two model matrices put every point on the XY plane in the same
+// place.  The z row can differ, since planar mode ignores the z scale.
+static bool SamePlacement( const Transform3D& ac_roExpected,
+                           const Transform3D& ac_roActual )
+{
+    const unsigned int cauiRows[] = { 0, 1, 3 };
+    double dScale = 0;
+    for( unsigned int i = 0; i < 12; ++i )
+    {
+        dScale = std::max( dScale,
+                           std::abs( ac_roExpected[ cauiRows[i/4] ][i%4] ) );
+    }
+    for( unsigned int i = 0; i < 12; ++i )
+    {
+        if( std::abs( ac_roExpected[ cauiRows[i/4] ][i%4] -
+                      ac_roActual[ cauiRows[i/4] ][i%4] ) > 1e-12 * dScale )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Put a planar copy of the given object, which must have a z scale of 1,
+// through every combination of before and after transforms, rotating and
+// moving both copies each time so that every cached matrix is rebuilt.
+// Returns a description of the first mismatch, or an empty string.
+template< typename T >
+static std::string PlanarMismatch( const T& ac_roObject,
+                                   const char* ac_pcName )
+{
+    const Transform3D caoBefore[] =
+    {
+        Transform3D::Identity(),
+        Rotation( 0.4, Point3D( 1, 1, 0 ) ) * Translation( 1, -2, 3 )
+    };
+    const Transform3D caoAfter[] =
+    {
+        Transform3D::Identity(),
+        Translation( -3, 0.5, 2 ) * Scaling( 2 )
+    };
+    T oSolid( ac_roObject );
+    T oPlanar( ac_roObject );
+    oPlanar.SetPlanar();
+    for( unsigned int i = 0; i < 8; ++i )
+    {
+        // Alternate between setting the planar angle directly and setting a
+        // rotation about the z-axis, which should stay planar
+        double dAngle = i * 0.9 - 2.5;
+        oSolid.SetRotation( dAngle, Point3D::Unit(2) );
+        if( 0 == i % 2 )
+        {
+            oPlanar.SetPlanarAngle( dAngle );
+        }
+        else
+        {
+            oPlanar.SetRotation( Rotation3D( dAngle, Point3D::Unit(2) ) );
+        }
+        oSolid.SetPosition( i * 1.5, -2.0 * i, 0.25 * i );
+        oPlanar.SetPosition( i * 1.5, -2.0 * i, 0.25 * i );
+        oSolid.SetBeforeTransform( caoBefore[ i % 2 ] );
+        oPlanar.SetBeforeTransform( caoBefore[ i % 2 ] );
+        oSolid.SetAfterTransform( caoAfter[ ( i / 2 ) % 2 ] );
+        oPlanar.SetAfterTransform( caoAfter[ ( i / 2 ) % 2 ] );
+        std::ostringstream oOut;
+        if( !oPlanar.IsPlanar() )
+        {
+            oOut << "Rotating a planar " << ac_pcName
+                 << " about the z-axis left planar mode";
+            return oOut.str();
+        }
+        Point2D oExpected( std::cos( dAngle ), std::sin( dAngle ) );
+        if( ( oPlanar.GetPlanarRotation() - oExpected ).Magnitude() > 1e-12 )
+        {
+            oOut << "Planar " << ac_pcName << " rotation is "
+                 << oPlanar.GetPlanarRotation() << " instead of " << oExpected;
+            return oOut.str();
+        }
+        if( !SamePlacement( oSolid.GetModelMatrix(),
+                            oPlanar.GetModelMatrix() ) )
+        {
+            oOut << "Planar " << ac_pcName << " model matrix "
+                 << ( 0 == i % 2 ? "without" : "with" ) << " a before and "
+                 << ( 0 == ( i / 2 ) % 2 ? "without" : "with" )
+                 << " an after transform differs from 3D";
+            return oOut.str();
+        }
+    }
+
+    // Leaving planar mode should keep the same rotation
+    oPlanar.SetPlanar( false );
+    if( oPlanar.IsPlanar() ||
+        !SamePlacement( oSolid.GetModelMatrix(), oPlanar.GetModelMatrix() ) )
+    {
+        return std::string( "Leaving planar mode changed the " ) + ac_pcName;
+    }
+    return std::string();
+}
+
+// Millions of model matrices recomputed per second
+template< typename T >
+static double ComposeRate( const T& ac_roObject )
+{
+    T oObject( ac_roObject );
+    volatile double dSum = 0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int i = 0; i < ITERATIONS; ++i )
+    {
+        oObject.UpdateModelMatrix();
+        dSum += oObject.GetModelMatrix()[3][0];
+    }
+    return ITERATIONS / 1e6 /
+           std::max( SecondsSince( iStart ), 1.0 / CLOCKS_PER_SEC );
+}
+
+EnginePerformanceTestGroup::EnginePerformanceTestGroup()
+    : UnitTestGroup("Engine performance tests")
+{
+    AddTest( "HTML character table against the character map", HTMLLookup );
+    AddTest( "Frame arena allocations against the heap", FrameArenaUse );
+    AddTest( "Drawable object sizes and copies", DrawableCopies );
+    AddTest( "Planar model matrices against 3D", PlanarModelMatrix );
+}
+
+UnitTest::Result EnginePerformanceTestGroup::HTMLLookup()
+{
+    // Every HTML name should find the constant with the same name
+#define HTML_NAME( name ) { #name, HTML::name }
+    static const struct { const char* pcName; char cCharacter; } sc_aoNames[] =
+    {
+        HTML_NAME( quot ), HTML_NAME( amp ), HTML_NAME( apos ),
+        HTML_NAME( lt ), HTML_NAME( gt ), HTML_NAME( euro ),
+        HTML_NAME( sbquo ), HTML_NAME( fnof ), HTML_NAME( bdquo ),
+        HTML_NAME( hellip ), HTML_NAME( circ ), HTML_NAME( dagger ),
+        HTML_NAME( Dagger ), HTML_NAME( permil ), HTML_NAME( Scaron ),
+        HTML_NAME( lsaquo ), HTML_NAME( OElig ), { "Zscaron", HTML::Zcaron },
+        HTML_NAME( lsquo ), HTML_NAME( rsquo ), HTML_NAME( ldquo ),
+        HTML_NAME( rdquo ), HTML_NAME( bull ), HTML_NAME( ndash ),
+        HTML_NAME( mdash ), HTML_NAME( tilde ), HTML_NAME( trade ),
+        HTML_NAME( scaron ), HTML_NAME( rsaquo ), HTML_NAME( oelig ),
+        HTML_NAME( zcaron ), HTML_NAME( Yuml ), HTML_NAME( nbsp ),
+        HTML_NAME( iexcl ), HTML_NAME( cent ), HTML_NAME( pound ),
+        HTML_NAME( curren ), HTML_NAME( yen ), HTML_NAME( brvbar ),
+        HTML_NAME( sect ), HTML_NAME( uml ), HTML_NAME( copy ),
+        HTML_NAME( ordf ), HTML_NAME( laquo ), HTML_NAME( not ),
+        HTML_NAME( shy ), HTML_NAME( reg ), HTML_NAME( macr ),
+        HTML_NAME( deg ), HTML_NAME( plusmn ), HTML_NAME( sup2 ),
+        HTML_NAME( sup3 ), HTML_NAME( acute ), HTML_NAME( micro ),
+        HTML_NAME( para ), HTML_NAME( middot ), HTML_NAME( cedil ),
+        HTML_NAME( sup1 ), HTML_NAME( ordm ), HTML_NAME( raquo ),
+        HTML_NAME( frac14 ), HTML_NAME( frac12 ), HTML_NAME( frac34 ),
+        HTML_NAME( iquest ), HTML_NAME( Agrave ), HTML_NAME( Aacute ),
+        HTML_NAME( Acirc ), HTML_NAME( Atilde ), HTML_NAME( Auml ),
+        HTML_NAME( Aring ), HTML_NAME( AElig ), HTML_NAME( Ccedil ),
+        HTML_NAME( Egrave ), HTML_NAME( Eacute ), HTML_NAME( Ecirc ),
+        HTML_NAME( Euml ), HTML_NAME( Igrave ), HTML_NAME( Iacute ),
+        HTML_NAME( Icirc ), HTML_NAME( Iuml ), HTML_NAME( ETH ),
+        HTML_NAME( Ntilde ), HTML_NAME( Ograve ), HTML_NAME( Oacute ),
+        HTML_NAME( Ocirc ), HTML_NAME( Otilde ), HTML_NAME( Ouml ),
+        HTML_NAME( times ), HTML_NAME( Oslash ), HTML_NAME( Ugrave ),
+        HTML_NAME( Uacute ), HTML_NAME( Ucirc ), HTML_NAME( Uuml ),
+        HTML_NAME( Yacute ), HTML_NAME( THORN ), HTML_NAME( szlig ),
+        HTML_NAME( agrave ), HTML_NAME( aacute ), HTML_NAME( acirc ),
+        HTML_NAME( atilde ), HTML_NAME( auml ), HTML_NAME( aring ),
+        HTML_NAME( aelig ), HTML_NAME( ccedil ), HTML_NAME( egrave ),
+        HTML_NAME( eacute ), HTML_NAME( ecirc ), HTML_NAME( euml ),
+        HTML_NAME( igrave ), HTML_NAME( iacute ), HTML_NAME( icirc ),
+        HTML_NAME( iuml ), HTML_NAME( eth ), HTML_NAME( ntilde ),
+        HTML_NAME( ograve ), HTML_NAME( oacute ), HTML_NAME( ocirc ),
+        HTML_NAME( otilde ), HTML_NAME( ouml ), HTML_NAME( divide ),
+        HTML_NAME( oslash ), HTML_NAME( ugrave ), HTML_NAME( uacute ),
+        HTML_NAME( ucirc ), HTML_NAME( uuml ), HTML_NAME( yacute ),
+        HTML_NAME( thorn ), HTML_NAME( yuml )
+    };
+#undef HTML_NAME
+    const unsigned int cuiNames = sizeof( sc_aoNames ) / sizeof( *sc_aoNames );
+    for( unsigned int i = 0; i < cuiNames; ++i )
+    {
+        char cCharacter = 0;
+        if( !HTML::Find( sc_aoNames[i].pcName, cCharacter ) ||
+            sc_aoNames[i].cCharacter != cCharacter )
+        {
+            return UnitTest::Fail( std::string( "Didn't find " ) +
+                                   sc_aoNames[i].pcName );
+        }
+    }
+
+    // Numbers and single characters stand for themselves
+    for( unsigned int ui = 0; ui < 256; ++ui )
+    {
+        std::ostringstream oDecimal, oHex, oUpperHex;
+        oDecimal << "#" << ui;
+        oHex << "x" << std::hex << ui;
+        oUpperHex << "#X00" << std::hex << std::uppercase << ui;
+        const char acSingle[] = { (char)ui, '\0' };
+        char cDecimal = 0, cHex = 0, cUpperHex = 0, cSingle = 0;
+        if( !HTML::Find( oDecimal.str().c_str(), cDecimal ) ||
+            !HTML::Find( oHex.str().c_str(), cHex ) ||
+            !HTML::Find( oUpperHex.str().c_str(), cUpperHex ) ||
+            ( 0 < ui && !HTML::Find( acSingle, cSingle ) ) ||
+            (char)ui != cDecimal || (char)ui != cHex ||
+            (char)ui != cUpperHex || ( 0 < ui && (char)ui != cSingle ) )
+        {
+            return UnitTest::Fail( std::string( "Didn't parse " ) +
+                                   oDecimal.str().c_str() );
+        }
+    }
+
+    // Anything else isn't found, and leaves the character alone
+    static const char* const sc_apcMissing[] =
+    {
+        "", "#256", "x100", "#x", "##", "#3a", "#-1", "xg", "x 1",
+        "#999999999999", "nosuch", "ampx", "am", "AMP", "Zscaronn"
+    };
+    for( unsigned int i = 0;
+         i < sizeof( sc_apcMissing ) / sizeof( char* ); ++i )
+    {
+        char cCharacter = '?';
+        if( HTML::Find( sc_apcMissing[i], cCharacter ) || '?' != cCharacter )
+        {
+            return UnitTest::Fail( std::string( "Shouldn't have found " ) +
+                                   sc_apcMissing[i] );
+        }
+    }
+    char cNull = '?';
+    if( HTML::Find( nullptr, cNull ) || HTML::ParseNumber( "amp", cNull ) )
+    {
+        return UnitTest::Fail( "Found a character that isn't there" );
+    }
+
+    // Time building the character map, which used to happen before the first
+    // lookup, and check that it agrees with the table
+    std::clock_t iStart = std::clock();
+    const MyFirstEngine::CharacterMap& croMap = HTML::Map();
+    double dBuild = SecondsSince( iStart );
+    for( unsigned int i = 0; i < cuiNames; ++i )
+    {
+        if( croMap[ sc_aoNames[i].pcName ] != sc_aoNames[i].cCharacter ||
+            croMap[ "#38" ] != HTML::amp || croMap[ "x26" ] != HTML::amp )
+        {
+            return UnitTest::Fail( "Map doesn't match the table" );
+        }
+    }
+
+    // Time looking up names and numbers each way
+    static const char* const sc_apcSymbols[] =
+    {
+        "amp", "hearts", "nbsp", "copy", "eacute", "#38", "x26", "#169", "&"
+    };
+    const unsigned int cuiSymbols = sizeof( sc_apcSymbols ) / sizeof( char* );
+    const unsigned int cuiRepeats = ITERATIONS / 10;
+    const double cdLookups = double( cuiSymbols ) * cuiRepeats / 1e6;
+    const double cdMinimum = 1.0 / CLOCKS_PER_SEC;
+    volatile unsigned int uiSum = 0;
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiSymbols; ++i )
+        {
+            if( croMap.Has( sc_apcSymbols[i] ) )
+            {
+                uiSum += (unsigned char)croMap[ sc_apcSymbols[i] ];
+            }
+        }
+    }
+    double dMap = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiSymbols; ++i )
+        {
+            char cCharacter = 0;
+            if( HTML::Find( sc_apcSymbols[i], cCharacter ) )
+            {
+                uiSum += (unsigned char)cCharacter;
+            }
+        }
+    }
+    double dTable = SecondsSince( iStart );
+    std::ostringstream oOut;
+    oOut << "Building the map: " << dBuild * 1000 << " ms, table: none; "
+         << "millions of lookups per second, map/table - "
+         << cdLookups / std::max( dMap, cdMinimum ) << "/"
+         << cdLookups / std::max( dTable, cdMinimum );
+    return UnitTest::Pass( oOut.str() );
+}
+
+UnitTest::Result EnginePerformanceTestGroup::FrameArenaUse()
+{
+    typedef MyFirstEngine::GameEngine::FrameArena FrameArena;
+
+    // Allocations are aligned, and markers give back what came after them
+    FrameArena oArena( 1024 );
+    oArena.Allocate( 1, 1 );
+    double* pdAligned = oArena.Allocate< double >( 3 );
+    void* pvSixteen = oArena.Allocate( 24 );
+    const std::size_t cuiUsed = oArena.Used();
+    char* pcMarked = nullptr;
+    {
+        FrameArena::Marker oMarker( oArena );
+        pcMarked = static_cast< char* >( oArena.Allocate( 100, 1 ) );
+        oArena.Allocate( 2000 );    // past the end of the first block
+    }
+    if( 0 != reinterpret_cast< std::size_t >( pdAligned ) % __alignof( double )
+        || 0 != reinterpret_cast< std::size_t >( pvSixteen ) % 16 ||
+        cuiUsed != oArena.Used() || oArena.HighWater() < cuiUsed + 2100 ||
+        pcMarked != oArena.Allocate( 100, 1 ) )
+    {
+        return UnitTest::Fail( "Arena allocations aren't laid out right" );
+    }
+
+    // Resetting reuses the memory, and a frame that needed several blocks
+    // gets a single block big enough for all of it next time
+    const std::size_t cuiHighWater = oArena.HighWater();
+    const std::size_t cuiCapacity = oArena.Capacity();
+    oArena.Reset();
+    FrameArena::Marker oStale( oArena );
+    oArena.Reset();
+    oArena.Allocate( 8 );
+    oStale.Release();
+    for( unsigned int i = 0; i < 10; ++i )
+    {
+        oArena.Allocate( 100 );
+    }
+    if( cuiCapacity <= 1024 || cuiHighWater != oArena.PeakHighWater() ||
+        0 != oArena.LastHighWater() || cuiCapacity != oArena.Capacity() ||
+        0 == oArena.Used() )
+    {
+        return UnitTest::Fail( "Arena didn't reset right" );
+    }
+    oArena.Reset();
+    void* pvStart = oArena.Allocate( 1, 1 );
+    oArena.Reset();
+    if( pvStart != oArena.Allocate( 1, 1 ) )
+    {
+        return UnitTest::Fail( "Arena didn't reuse its memory" );
+    }
+
+    // Standard containers work with arena allocators
+    {
+        typedef FrameArena::Allocator< int > IntAllocator;
+        std::vector< int, IntAllocator > oVector( ( IntAllocator( oArena ) ) );
+        typedef std::map< int, int, std::less< int >,
+                          FrameArena::Allocator< std::pair< const int,
+                                                            int > > > IntMap;
+        std::less< int > oLess;
+        IntMap oMap( oLess, IntMap::allocator_type( oArena ) );
+        for( int i = 0; i < 1000; ++i )
+        {
+            oVector.push_back( i );
+            oMap[ i % 100 ] += i;
+        }
+        if( 1000 != oVector.size() || 999 != oVector.back() ||
+            100 != oMap.size() || 4500 != oMap[ 0 ] || 5490 != oMap[ 99 ] ||
+            oArena.Used() < 1000 * sizeof( int ) )
+        {
+            return UnitTest::Fail( "Containers didn't work in the arena" );
+        }
+    }
+
+    // Time a frame's worth of small temporary allocations each way
+    const unsigned int cuiPerFrame = 256;
+    const unsigned int cuiFrames = ITERATIONS / 100;
+    const double cdAllocations = double( cuiPerFrame ) * cuiFrames / 1e6;
+    const double cdMinimum = 1.0 / CLOCKS_PER_SEC;
+    std::vector< Transform3D* > oHeap( cuiPerFrame );
+    volatile double dSum = 0.0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int f = 0; f < cuiFrames; ++f )
+    {
+        for( unsigned int i = 0; i < cuiPerFrame; ++i )
+        {
+            oHeap[i] = new Transform3D( Transform3D::Identity() );
+        }
+        for( unsigned int i = 0; i < cuiPerFrame; ++i )
+        {
+            dSum += ( *oHeap[i] )[0][0];
+            delete oHeap[i];
+        }
+    }
+    double dHeap = SecondsSince( iStart );
+    FrameArena oFrames;
+    iStart = std::clock();
+    for( unsigned int f = 0; f < cuiFrames; ++f )
+    {
+        oFrames.Reset();
+        for( unsigned int i = 0; i < cuiPerFrame; ++i )
+        {
+            oHeap[i] = new( oFrames.Allocate< Transform3D >() )
+                Transform3D( Transform3D::Identity() );
+        }
+        for( unsigned int i = 0; i < cuiPerFrame; ++i )
+        {
+            dSum += ( *oHeap[i] )[0][0];
+        }
+    }
+    double dArena = SecondsSince( iStart );
+
+    // Time building a temporary vector each frame
+    iStart = std::clock();
+    for( unsigned int f = 0; f < cuiFrames; ++f )
+    {
+        std::vector< double > oVector;
+        for( unsigned int i = 0; i < cuiPerFrame; ++i )
+        {
+            oVector.push_back( i );
+        }
+        dSum += oVector.back();
+    }
+    double dHeapVector = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int f = 0; f < cuiFrames; ++f )
+    {
+        oFrames.Reset();
+        std::vector< double, FrameArena::Allocator< double > >
+            oVector( ( FrameArena::Allocator< double >( oFrames ) ) );
+        for( unsigned int i = 0; i < cuiPerFrame; ++i )
+        {
+            oVector.push_back( i );
+        }
+        dSum += oVector.back();
+    }
+    double dArenaVector = SecondsSince( iStart );
+    std::ostringstream oOut;
+    oOut << "Millions of allocations per second, heap/arena - "
+         << cdAllocations / std::max( dHeap, cdMinimum ) << "/"
+         << cdAllocations / std::max( dArena, cdMinimum ) << "; millions of "
+         << "vector appends per second - "
+         << cdAllocations / std::max( dHeapVector, cdMinimum ) << "/"
+         << cdAllocations / std::max( dArenaVector, cdMinimum )
+         << "; high water per frame - " << oFrames.LastHighWater() << " bytes";
+    return UnitTest::Pass( oOut.str() );
+}
+
+UnitTest::Result EnginePerformanceTestGroup::DrawableCopies()
+{
+    using MyFirstEngine::AnimatedSprite;
+    using MyFirstEngine::Drawable;
+    using MyFirstEngine::Frame;
+    using MyFirstEngine::Quad;
+    using MyFirstEngine::Sprite;
+
+    const Color::ColorVector coColor( Color::VGA::GREEN );
+    const Rotation3D coRotation( 0.6, Point3D( 1.0, 2.0, -2.0 ) );
+    const Point3D coPosition( 1.0, 2.0, 3.0 );
+    const Quad coQuad( coColor, Point2D( 2.0 ), coPosition, coRotation );
+    const Sprite coSprite( UnloadedTexture(), Point2D( 2.0 ), coPosition,
+                           coRotation, coColor );
+    const AnimatedSprite coAnimated( UnloadedTexture(), Frame::Array::EMPTY,
+                                     12.0, 0, Point2D( 2.0 ), coPosition,
+                                     coRotation, coColor );
+
+    // Copies get their own color and rotation instead of sharing them
+    AnimatedSprite oCopy( coAnimated );
+    oCopy.SetColor( Color::ColorVector( Color::WHITE ) );
+    oCopy.SetRotation( Rotation3D::None() );
+    if( coAnimated.GetColor() != coColor ||
+        coAnimated.GetRotation() != coRotation ||
+        oCopy.GetColor() == coColor || oCopy.GetRotation() == coRotation ||
+        oCopy.GetPosition() != coPosition )
+    {
+        return UnitTest::Fail( "Copy shares members with the original" );
+    }
+
+    const unsigned int cuiCount = 1000;
+    const double cdQuad = CopyRate( coQuad, cuiCount );
+    const double cdSprite = CopyRate( coSprite, cuiCount );
+    const double cdAnimated = CopyRate( coAnimated, cuiCount );
+    std::ostringstream oOut;
+    oOut << "Bytes - rotation: " << sizeof( Rotation3D ) << ", color: "
+         << sizeof( Color::ColorVector ) << ", drawable: "
+         << sizeof( Drawable ) << ", quad: " << sizeof( Quad )
+         << ", sprite: " << sizeof( Sprite ) << ", animated sprite: "
+         << sizeof( AnimatedSprite ) << "; millions of copies per second, "
+         << "quad/sprite/animated sprite - " << cdQuad << "/" << cdSprite
+         << "/" << cdAnimated;
+    return UnitTest::Pass( oOut.str() );
+}
+
+UnitTest::Result EnginePerformanceTestGroup::PlanarModelMatrix()
+{
+    using MyFirstEngine::Frame;
+    using MyFirstEngine::Quad;
+    using MyFirstEngine::Sprite;
+
+    // A quad, and a sprite whose frame has a display area offset from its
+    // center, both starting out rotated about the z-axis
+    const Frame::Array coFrames( Frame( IntPoint2D( 64, 32 ),
+                                        IntPoint2D( 0, 0 ),
+                                        IntPoint2D( 3, -5 ) ) );
+    const Rotation3D coRotation( 0.6, Point3D::Unit(2) );
+    const Point3D coPosition( 1.0, 2.0, 3.0 );
+    Quad oQuad( Color::ColorVector( Color::WHITE ), Point2D( 1.0 ),
+                coPosition, coRotation );
+    Sprite oSprite( UnloadedTexture(), coFrames, Point2D( 1.0 ), coPosition,
+                    coRotation );
+    oQuad.SetScale( 2.0, 3.0, 1.0 );
+    oSprite.SetScale( 0.5, 0.25, 1.0 );
+
+    // Turning planar mode on should keep the rotation about the z-axis
+    Quad oPlanarQuad( oQuad );
+    oPlanarQuad.SetPlanar();
+    if( !oPlanarQuad.IsPlanar() ||
+        std::abs( oPlanarQuad.GetPlanarAngle() - 0.6 ) > 1e-12 ||
+        !SamePlacement( oQuad.GetModelMatrix(),
+                        oPlanarQuad.GetModelMatrix() ) )
+    {
+        return UnitTest::Fail( "SetPlanar changed the quad's placement" );
+    }
+    std::string oMismatch = PlanarMismatch( oQuad, "quad" );
+    if( oMismatch.empty() )
+    {
+        oMismatch = PlanarMismatch( oSprite, "sprite" );
+    }
+    if( !oMismatch.empty() )
+    {
+        return UnitTest::Fail( oMismatch );
+    }
+
+    // Time recomputing each model matrix
+    Sprite oPlanarSprite( oSprite );
+    oPlanarSprite.SetPlanar();
+    std::ostringstream oOut;
+    oOut << "Millions of model matrices per second, 3D/planar - quad: "
+         << ComposeRate( oQuad ) << "/" << ComposeRate( oPlanarQuad )
+         << ", sprite: " << ComposeRate( oSprite ) << "/"
+         << ComposeRate( oPlanarSprite );
+    return UnitTest::Pass( oOut.str() );
+}
@@ -0,0 +1,34 @@
+/******************************************************************************
+ * File:               EnginePerformanceTestGroup.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares the HTML character table and frame arena
+ *                      against the character map and heap allocations they
+ *                      replaced, measures drawable object sizes and copies,
+ *                      checks planar model matrices against the 3D ones, and
+ *                      reports how long each takes.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added planar model matrix test.
+ ******************************************************************************/
+
+#ifndef ENGINE_PERFORMANCE_TEST_GROUP__H
+#define ENGINE_PERFORMANCE_TEST_GROUP__H
+
+#include "UnitTestGroup.h"
+
+class EnginePerformanceTestGroup : public UnitTestGroup
+{
+public:
+
+    EnginePerformanceTestGroup();
+
+private:
+
+    static UnitTest::Result HTMLLookup();
+    static UnitTest::Result FrameArenaUse();
+    static UnitTest::Result DrawableCopies();
+    static UnitTest::Result PlanarModelMatrix();
+
+};
+
+#endif  // ENGINE_PERFORMANCE_TEST_GROUP__H
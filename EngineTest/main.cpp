@@ -0,0 +1,27 @@
+/******************************************************************************
+ * File:               main.cpp
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Runs the unit test groups that need MyFirstEngine.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#include "UnitTester.h"
+#include "EnginePerformanceTestGroup.h"
+#include <conio.h>
+#include <iostream>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+    // set up
+    UnitTester oTester;
+    oTester.AddTestGroup( EnginePerformanceTestGroup() );
+
+    // run
+    oTester( std::cout );
+	std::cout << std::endl << std::endl << "Press any key to exit...";
+	_getch();
+    return 0;
+}
@@ -0,0 +1,242 @@
+/******************************************************************************
+ * File:               AffineTransform.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Transforms that don't project, stored without the
+ *                      constant last column of a homogeneous transform matrix.
+ *                      Since this library uses row vectors, an affine
+ *                      transform maps point p to p*L + t, where L is the
+ *                      linear part (the top rows) and t is the translation
+ *                      (the bottom row), so storage is (N+1)xN.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Documented what Inverse() returns on failure.
+ ******************************************************************************/
+
+#ifndef AFFINE_TRANSFORM__H
+#define AFFINE_TRANSFORM__H
+
+#include "Matrix.h"
+#include "PointVector.h"
+#include "Transform.h"
+#include "ImExportMacro.h"
+
+// explicit instantiations
+EXTERN_T_INST template class IMEXPORT_T_INST Math::Matrix< double, 3, 2 >;
+EXTERN_T_INST template class IMEXPORT_T_INST Math::Matrix< double, 4, 3 >;
+
+namespace Plane
+{
+
+// Represents a 2D transform that doesn't project.  Composing two of these
+// takes 12 multiplications instead of the 27 needed for 3x3 transforms.
+class IMEXPORT_CLASS AffineTransform : protected Math::Matrix< double, 3, 2 >
+{
+public:
+
+    // simplify typing
+    typedef Math::Matrix< double, 3, 2 > BaseType;
+
+    // Default is the identity transform
+    AffineTransform();
+    AffineTransform( const PointTransform& ac_roLinear,
+                     const Point& ac_roTranslation = Point::Origin() );
+    AffineTransform( const double (&ac_raadData)[ 3 ][ 2 ] );
+
+    // Drop the last column of a homogeneous transform - only use this on
+    // transforms that don't project
+    explicit AffineTransform( const Transform& ac_roTransform );
+
+    // Equality and inequality checks
+    bool operator==( const AffineTransform& ac_roTransform ) const;
+    bool operator!=( const AffineTransform& ac_roTransform ) const;
+
+    // Row access - rows 0 and 1 are the linear part, row 2 is the translation
+    using BaseType::operator[];
+    using BaseType::At;
+
+    // Get/set parts
+    PointTransform GetLinear() const;
+    Point GetTranslation() const;
+    AffineTransform& SetLinear( const PointTransform& ac_roLinear );
+    AffineTransform& SetTranslation( const Point& ac_roTranslation );
+
+    // Composition - as with transform matrices, A * B performs transform A,
+    // then transform B
+    AffineTransform operator*( const AffineTransform& ac_roTransform ) const;
+    AffineTransform& operator*=( const AffineTransform& ac_roTransform );
+    Transform operator*( const Transform& ac_roTransform ) const;
+
+    // Inversion - if not invertable, the first version returns false without
+    // changing the parameter, the second returns zeroes like Matrix::Inverse()
+    // and AffineInverse(), and Invert() returns false without changing this
+    bool Inverse( AffineTransform& a_roTransform ) const;
+    AffineTransform Inverse() const;
+    bool Invert();
+
+    // Cheaper inversion for transforms known to be only rotation and
+    // translation
+    AffineTransform RigidInverse() const;
+
+    // Apply this transform to a point (rotated, scaled, and translated) or a
+    // direction (rotated and scaled, but not translated)
+    Point AppliedTo( const Point& ac_roPoint ) const;
+    Point& ApplyTo( Point& a_roPoint ) const;
+    Point AppliedToDirection( const Point& ac_roDirection ) const;
+    Point& ApplyToDirection( Point& a_roDirection ) const;
+
+    // Turn into full homogeneous transform, for combining with projections
+    Transform MakeTransform() const;
+    void MakeTransform( Transform& a_roTransform ) const;
+
+    // Transform that does nothing
+    static const AffineTransform& Identity();
+
+};  // class Plane::AffineTransform
+
+// Affine versions of the transform factory functions in Transform.h
+IMEXPORT AffineTransform
+    AffineScaling( double a_dFactor,
+                   const Point& ac_roOrigin = Point::Origin() );
+IMEXPORT AffineTransform
+    AffineScaling( double a_dX, double a_dY,
+                   const Point& ac_roOrigin = Point::Origin() );
+IMEXPORT AffineTransform
+    AffineScaling( const Point& ac_roFactor,
+                   const Point& ac_roOrigin = Point::Origin() );
+IMEXPORT AffineTransform AffineTranslation( double a_dX, double a_dY );
+IMEXPORT AffineTransform AffineTranslation( const Point& ac_roTranslation );
+IMEXPORT AffineTransform
+    AffineRotation( double a_dRadians,
+                    const Point& ac_roOrigin = Point::Origin(),
+                    bool a_bClockwise = false );
+IMEXPORT AffineTransform
+    AffineDegreeRotation( double a_dDegrees,
+                          const Point& ac_roOrigin = Point::Origin(),
+                          bool a_bClockwise = false );
+
+}   // namespace Plane
+typedef Plane::AffineTransform Affine2D;
+
+// Full transform followed by affine transform
+IMEXPORT Transform2D operator*( const Transform2D& ac_roTransform,
+                                const Plane::AffineTransform& ac_roAffine );
+
+namespace Space
+{
+
+// Represents a 3D transform that doesn't project.  Composing two of these
+// takes 36 multiplications instead of the 64 needed for 4x4 transforms.
+class IMEXPORT_CLASS AffineTransform : protected Math::Matrix< double, 4, 3 >
+{
+public:
+
+    // simplify typing
+    typedef Math::Matrix< double, 4, 3 > BaseType;
+
+    // Default is the identity transform
+    AffineTransform();
+    AffineTransform( const PointTransform& ac_roLinear,
+                     const Point& ac_roTranslation = Point::Origin() );
+    AffineTransform( const double (&ac_raadData)[ 4 ][ 3 ] );
+
+    // Drop the last column of a homogeneous transform - only use this on
+    // transforms that don't project
+    explicit AffineTransform( const Transform& ac_roTransform );
+
+    // Equality and inequality checks
+    bool operator==( const AffineTransform& ac_roTransform ) const;
+    bool operator!=( const AffineTransform& ac_roTransform ) const;
+
+    // Row access - rows 0 to 2 are the linear part, row 3 is the translation
+    using BaseType::operator[];
+    using BaseType::At;
+
+    // Get/set parts
+    PointTransform GetLinear() const;
+    Point GetTranslation() const;
+    AffineTransform& SetLinear( const PointTransform& ac_roLinear );
+    AffineTransform& SetTranslation( const Point& ac_roTranslation );
+
+    // Composition - as with transform matrices, A * B performs transform A,
+    // then transform B
+    AffineTransform operator*( const AffineTransform& ac_roTransform ) const;
+    AffineTransform& operator*=( const AffineTransform& ac_roTransform );
+    Transform operator*( const Transform& ac_roTransform ) const;
+
+    // Inversion - if not invertable, the first version returns false without
+    // changing the parameter, the second returns zeroes like Matrix::Inverse()
+    // and AffineInverse(), and Invert() returns false without changing this
+    bool Inverse( AffineTransform& a_roTransform ) const;
+    AffineTransform Inverse() const;
+    bool Invert();
+
+    // Cheaper inversion for transforms known to be only rotation and
+    // translation
+    AffineTransform RigidInverse() const;
+
+    // Apply this transform to a point (rotated, scaled, and translated) or a
+    // direction (rotated and scaled, but not translated)
+    Point AppliedTo( const Point& ac_roPoint ) const;
+    Point& ApplyTo( Point& a_roPoint ) const;
+    Point AppliedToDirection( const Point& ac_roDirection ) const;
+    Point& ApplyToDirection( Point& a_roDirection ) const;
+
+    // Turn into full homogeneous transform, for combining with projections
+    Transform MakeTransform() const;
+    void MakeTransform( Transform& a_roTransform ) const;
+
+    // Transform that does nothing
+    static const AffineTransform& Identity();
+
+};  // class Space::AffineTransform
+
+// Affine versions of the transform factory functions in Transform.h
+IMEXPORT AffineTransform
+    AffineScaling( double a_dFactor,
+                   const Point& ac_roOrigin = Point::Origin() );
+IMEXPORT AffineTransform
+    AffineScaling( double a_dX, double a_dY, double a_dZ,
+                   const Point& ac_roOrigin = Point::Origin() );
+IMEXPORT AffineTransform
+    AffineScaling( const Point& ac_roFactor,
+                   const Point& ac_roOrigin = Point::Origin() );
+IMEXPORT AffineTransform
+    AffineTranslation( double a_dX, double a_dY, double a_dZ );
+IMEXPORT AffineTransform AffineTranslation( const Point& ac_roTranslation );
+IMEXPORT AffineTransform
+    AffineRotation( double a_dRadians,
+                    const Point& ac_roAxis = Point::Unit(2),
+                    const Point& ac_roOrigin = Point::Origin(),
+                    bool a_bClockwise = false );
+IMEXPORT AffineTransform
+    AffineRotation( double a_dYaw, double a_dPitch, double a_dRoll,
+                    const Point& ac_roOrigin = Point::Origin(),
+                    bool a_bClockwise = false );
+IMEXPORT AffineTransform
+    AffineDegreeRotation( double a_dDegrees,
+                          const Point& ac_roAxis = Point::Unit(2),
+                          const Point& ac_roOrigin = Point::Origin(),
+                          bool a_bClockwise = false );
+IMEXPORT AffineTransform
+    AffineDegreeRotation( double a_dYaw, double a_dPitch, double a_dRoll,
+                          const Point& ac_roOrigin = Point::Origin(),
+                          bool a_bClockwise = false );
+
+}   // namespace Space
+typedef Space::AffineTransform Affine3D;
+
+// Full transform followed by affine transform
+IMEXPORT Transform3D operator*( const Transform3D& ac_roTransform,
+                                const Space::AffineTransform& ac_roAffine );
+
+// Affine transforms are stored as bare element arrays
+static_assert( sizeof( Affine2D ) == 6 * sizeof( double ),
+               "Affine2D must be a bare array of six doubles" );
+static_assert( sizeof( Affine3D ) == 12 * sizeof( double ),
+               "Affine3D must be a bare array of twelve doubles" );
+
+#ifdef INLINE_IMPLEMENTATION
+#include "../Implementations/AffineTransform.inl"
+#endif
+
+#endif  // AFFINE_TRANSFORM__H
@@ -0,0 +1,100 @@
+/******************************************************************************
+ * File:               Atom.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Interned strings.  Every distinct string is stored once
+ *                      in a process-wide pool and identified by a 32-bit ID,
+ *                      so atoms copy, compare, and hash as integers and names
+ *                      used by several tables share the same memory.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef ATOM__H
+#define ATOM__H
+
+#include "DumbString.h"
+#include <cstddef>  // for size_t
+#include <functional>   // for hash
+
+#include "ImExportMacro.h"
+
+namespace Utility
+{
+
+// Handle to a string in the intern pool.  Strings are never removed from the
+// pool, so an atom's characters stay valid and unchanged for the life of the
+// program.  Interning and finding are safe to do from several threads at once.
+// Atoms are ordered by ID, which is the order they were first interned, not
+// alphabetical order.
+class IMEXPORT_CLASS Atom
+{
+public:
+
+    // The empty string, which always has ID 0
+    Atom() : m_uiID( 0 ) {}
+
+    // Intern the given characters, adding them to the pool if they're new
+    Atom( const char* ac_pcName );
+    explicit Atom( const DumbStringView& ac_roName );
+
+    // Interned properties
+    unsigned int ID() const { return m_uiID; }
+    const char* CString() const;
+    std::size_t Size() const;
+    bool IsEmpty() const { return ( 0 == m_uiID ); }
+
+    // Integer comparisons
+    bool operator==( const Atom& ac_roAtom ) const
+    { return m_uiID == ac_roAtom.m_uiID; }
+    bool operator!=( const Atom& ac_roAtom ) const
+    { return m_uiID != ac_roAtom.m_uiID; }
+    bool operator<( const Atom& ac_roAtom ) const
+    { return m_uiID < ac_roAtom.m_uiID; }
+    bool operator>( const Atom& ac_roAtom ) const
+    { return m_uiID > ac_roAtom.m_uiID; }
+    bool operator<=( const Atom& ac_roAtom ) const
+    { return m_uiID <= ac_roAtom.m_uiID; }
+    bool operator>=( const Atom& ac_roAtom ) const
+    { return m_uiID >= ac_roAtom.m_uiID; }
+
+    // Look for already-interned characters without adding them to the pool.
+    // Returns false, leaving the atom unchanged, if they haven't been interned.
+    static bool Find( const DumbStringView& ac_roName, Atom& a_roAtom );
+
+    // The atom with the given ID - throws std::out_of_range if there isn't one
+    static Atom FromID( unsigned int a_uiID );
+
+    // Number of strings interned so far, including the empty string
+    static unsigned int Count();
+
+private:
+
+    unsigned int m_uiID;
+
+};  // class Atom
+
+}   // namespace Utility
+
+namespace std
+{
+
+template<>
+struct hash< Utility::Atom >
+{
+    typedef size_t result_type;
+    typedef Utility::Atom argument_type;
+    size_t operator()( const Utility::Atom& ac_roAtom ) const
+    { return ac_roAtom.ID(); }
+};
+
+}   // namespace std
+
+static_assert( sizeof( Utility::Atom ) == sizeof( unsigned int ),
+               "Atom must be a bare ID" );
+
+#ifdef INLINE_IMPLEMENTATION
+#include "../Implementations/Atom.inl"
+#endif
+
+#endif  // ATOM__H
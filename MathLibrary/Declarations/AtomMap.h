@@ -0,0 +1,72 @@
+/******************************************************************************
+ * File:               AtomMap.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Flat map from atoms to values.  Keys and values are
+ *                      kept in separate arrays sorted by atom ID, so finding
+ *                      a key is a binary search over packed integers.
+ *                      Adding or removing a key shifts the ones after it, so
+ *                      this suits tables that are built once and read often.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef ATOM_MAP__H
+#define ATOM_MAP__H
+
+#include "Atom.h"
+#include "DynamicArray.h"
+
+namespace Utility
+{
+
+template< typename T >
+class AtomMap
+{
+public:
+
+    // Number of keys
+    unsigned int Size() const { return m_oKeys.Size(); }
+    bool IsEmpty() const { return m_oKeys.IsEmpty(); }
+
+    // Look up values - Find returns null if the key isn't in the map, and At
+    // throws std::out_of_range
+    bool Has( Atom a_oKey ) const;
+    T* Find( Atom a_oKey );
+    const T* Find( Atom a_oKey ) const;
+    T& At( Atom a_oKey );
+    const T& At( Atom a_oKey ) const;
+
+    // Value for the given key, adding a default value if the key is new
+    T& operator[]( Atom a_oKey );
+
+    // Remove the given key - returns false if it wasn't in the map
+    bool Remove( Atom a_oKey );
+
+    // Remove all keys, keeping the memory
+    AtomMap& Clear();
+
+    // Make room for at least the given number of keys
+    AtomMap& Reserve( unsigned int a_uiCapacity );
+
+    // Entries in order of key ID - throws std::out_of_range for a bad index
+    Atom KeyAt( unsigned int a_uiIndex ) const { return m_oKeys[ a_uiIndex ]; }
+    T& ValueAt( unsigned int a_uiIndex ) { return m_oValues[ a_uiIndex ]; }
+    const T& ValueAt( unsigned int a_uiIndex ) const
+    { return m_oValues[ a_uiIndex ]; }
+
+private:
+
+    // Index of the first key with an ID no less than the given one
+    unsigned int LowerBound( Atom a_oKey ) const;
+
+    DynamicArray< Atom > m_oKeys;
+    DynamicArray< T > m_oValues;
+
+};  // class AtomMap
+
+}   // namespace Utility
+
+#include "../Implementations/AtomMap.inl"
+
+#endif  // ATOM_MAP__H
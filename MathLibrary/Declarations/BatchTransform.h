@@ -0,0 +1,157 @@
+/******************************************************************************
+ * File:               BatchTransform.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Functions for transforming whole arrays of 3D points at
+ *                      once, such as particle positions or collision hulls,
+ *                      and for updating whole arrays of quaternions and
+ *                      transforms.
+ *                      Each point function takes interleaved x,y,z triples
+ *                      (the layout of a Point3D array) or separate x, y, and z
+ *                      arrays, in float or double.  The transform is converted
+ *                      to the element type once, the points are processed
+ *                      several at a time with SSE2 or AVX when the processor
+ *                      supports it, and very large batches are split across
+ *                      threads with OpenMP.
+ *                      Input and output may be the same arrays.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Documented threaded transform products.
+ ******************************************************************************/
+
+#ifndef BATCH_TRANSFORM__H
+#define BATCH_TRANSFORM__H
+
+#include "PointVector.h"
+#include "Quaternion.h"
+#include "Transform.h"
+#include "ImExportMacro.h"
+
+namespace Space
+{
+
+// Transform points - rotated, scaled, and translated.  If the transform
+// projects (its last column isn't 0,0,0,1), the results are divided by the
+// homogeneous coordinate.
+IMEXPORT void TransformPoints( const Transform& ac_roTransform,
+                               const Point* ac_paoIn, Point* a_paoOut,
+                               unsigned int a_uiCount );
+IMEXPORT void TransformPoints( const Transform& ac_roTransform,
+                               const double* ac_pdIn, double* a_pdOut,
+                               unsigned int a_uiCount );
+IMEXPORT void TransformPoints( const Transform& ac_roTransform,
+                               const float* ac_pfIn, float* a_pfOut,
+                               unsigned int a_uiCount );
+IMEXPORT void TransformPoints( const Transform& ac_roTransform,
+                               const double* ac_pdInX, const double* ac_pdInY,
+                               const double* ac_pdInZ, double* a_pdOutX,
+                               double* a_pdOutY, double* a_pdOutZ,
+                               unsigned int a_uiCount );
+IMEXPORT void TransformPoints( const Transform& ac_roTransform,
+                               const float* ac_pfInX, const float* ac_pfInY,
+                               const float* ac_pfInZ, float* a_pfOutX,
+                               float* a_pfOutY, float* a_pfOutZ,
+                               unsigned int a_uiCount );
+
+// Transform directions - rotated and scaled, but not translated.  The last
+// row and column of the transform are ignored.
+IMEXPORT void TransformDirections( const Transform& ac_roTransform,
+                                   const Point* ac_paoIn, Point* a_paoOut,
+                                   unsigned int a_uiCount );
+IMEXPORT void TransformDirections( const Transform& ac_roTransform,
+                                   const double* ac_pdIn, double* a_pdOut,
+                                   unsigned int a_uiCount );
+IMEXPORT void TransformDirections( const Transform& ac_roTransform,
+                                   const float* ac_pfIn, float* a_pfOut,
+                                   unsigned int a_uiCount );
+IMEXPORT void TransformDirections( const Transform& ac_roTransform,
+                                   const double* ac_pdInX,
+                                   const double* ac_pdInY,
+                                   const double* ac_pdInZ, double* a_pdOutX,
+                                   double* a_pdOutY, double* a_pdOutZ,
+                                   unsigned int a_uiCount );
+IMEXPORT void TransformDirections( const Transform& ac_roTransform,
+                                   const float* ac_pfInX,
+                                   const float* ac_pfInY,
+                                   const float* ac_pfInZ, float* a_pfOutX,
+                                   float* a_pfOutY, float* a_pfOutZ,
+                                   unsigned int a_uiCount );
+
+// Rotate points about the origin.  The quaternion is turned into a rotation
+// matrix once, which is much cheaper than applying it to each point.
+IMEXPORT void RotatePoints( const Quaternion& ac_roRotation,
+                            const Point* ac_paoIn, Point* a_paoOut,
+                            unsigned int a_uiCount );
+IMEXPORT void RotatePoints( const Quaternion& ac_roRotation,
+                            const double* ac_pdIn, double* a_pdOut,
+                            unsigned int a_uiCount );
+IMEXPORT void RotatePoints( const Quaternion& ac_roRotation,
+                            const float* ac_pfIn, float* a_pfOut,
+                            unsigned int a_uiCount );
+IMEXPORT void RotatePoints( const Quaternion& ac_roRotation,
+                            const double* ac_pdInX, const double* ac_pdInY,
+                            const double* ac_pdInZ, double* a_pdOutX,
+                            double* a_pdOutY, double* a_pdOutZ,
+                            unsigned int a_uiCount );
+IMEXPORT void RotatePoints( const Quaternion& ac_roRotation,
+                            const float* ac_pfInX, const float* ac_pfInY,
+                            const float* ac_pfInZ, float* a_pfOutX,
+                            float* a_pfOutY, float* a_pfOutZ,
+                            unsigned int a_uiCount );
+
+// Interpolate, normalize, or multiply whole arrays of quaternions, such as the
+// rotations of every object turning toward a target this frame.  SlerpMany
+// gives the same results as Quaternion::SlerpFast and MultiplyMany the same
+// as operator*, several quaternions at a time.  Output may overlap input.
+IMEXPORT void SlerpMany( const Quaternion* ac_paoFrom,
+                         const Quaternion* ac_paoTo, double a_dProgress,
+                         Quaternion* a_paoOut, unsigned int a_uiCount );
+IMEXPORT void SlerpMany( const Quaternion* ac_paoFrom,
+                         const Quaternion* ac_paoTo,
+                         const double* ac_pdProgress,
+                         Quaternion* a_paoOut, unsigned int a_uiCount );
+IMEXPORT void NormalizeMany( Quaternion* a_paoQuaternions,
+                             unsigned int a_uiCount );
+IMEXPORT void MultiplyMany( const Quaternion* ac_paoLeft,
+                            const Quaternion* ac_paoRight,
+                            Quaternion* a_paoOut, unsigned int a_uiCount );
+
+// Multiply whole arrays of transforms, such as every model matrix by the
+// view-projection matrix, without the per-call overhead of operator*.  Either
+// side can be one transform shared by every product.  Results are identical
+// to operator*, and the output may be the same array as either input.
+// Batches of 8192 or more are split across threads.
+IMEXPORT void MultiplyMany( const Transform* ac_paoLeft,
+                            const Transform* ac_paoRight,
+                            Transform* a_paoOut, unsigned int a_uiCount );
+IMEXPORT void MultiplyMany( const Transform* ac_paoLeft,
+                            const Transform& ac_roRight,
+                            Transform* a_paoOut, unsigned int a_uiCount );
+IMEXPORT void MultiplyMany( const Transform& ac_roLeft,
+                            const Transform* ac_paoRight,
+                            Transform* a_paoOut, unsigned int a_uiCount );
+IMEXPORT void MultiplyMany( const FloatTransform* ac_paoLeft,
+                            const FloatTransform* ac_paoRight,
+                            FloatTransform* a_paoOut, unsigned int a_uiCount );
+IMEXPORT void MultiplyMany( const FloatTransform* ac_paoLeft,
+                            const FloatTransform& ac_roRight,
+                            FloatTransform* a_paoOut, unsigned int a_uiCount );
+IMEXPORT void MultiplyMany( const FloatTransform& ac_roLeft,
+                            const FloatTransform* ac_paoRight,
+                            FloatTransform* a_paoOut, unsigned int a_uiCount );
+
+// Compose a hierarchy of local transforms into world transforms, where
+// a_paoWorld[i] = ac_paoLocal[i] * a_paoWorld[ ac_puiParent[i] ].  Parents
+// must come before their children, so a parent index that isn't less than
+// the node's own index marks a root, whose world transform is its local one.
+IMEXPORT void ComposeHierarchy( const Transform* ac_paoLocal,
+                                const unsigned int* ac_puiParent,
+                                Transform* a_paoWorld,
+                                unsigned int a_uiCount );
+
+}   // namespace Space
+
+#ifdef INLINE_IMPLEMENTATION
+#include "../Implementations/BatchTransform.inl"
+#endif
+
+#endif  // BATCH_TRANSFORM__H
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       December 11, 2013
  * Description:        Vector for representing RGBA colors.
- * Last Modified:      February 27, 2014
- * Last Modification:  Adding functions.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added batch color conversion and blending.
  ******************************************************************************/
 
 #ifndef COLOR_VECTOR__H
@@ -25,14 +25,9 @@ public:
     typedef Vector< float, SIZE, IS_ROW_VECTOR > BaseType;
     typedef BaseType::BaseType RootType;
 
-    // destructor
-    virtual ~ColorVector();
-
     // Constructors that forward to base class constructors
     ColorVector();
-    ColorVector( const ColorVector& ac_roVector );
     ColorVector( const RootType& ac_roMatrix );
-    ColorVector( ColorVector&& a_rroVector );
     template< typename U, unsigned int Q, bool t_bOtherIsRow >
     ColorVector( const Vector< U, Q, t_bOtherIsRow >& ac_roVector,
                  float a_fFill = 1.0f );
@@ -97,15 +92,78 @@ public:
     ColorVector& BlueChannel( Channel a_ucBlue );
 
     // rgba value access
-    float& r; // m_aaData[0][0]
-    float& g; // m_aaData[0][1]
-    float& b; // m_aaData[0][2]
-    float& a; // m_aaData[0][3]
+    float& r() { return m_aaData[0][0]; }
+    float& g() { return m_aaData[0][1]; }
+    float& b() { return m_aaData[0][2]; }
+    float& a() { return m_aaData[0][3]; }
+    const float& r() const { return m_aaData[0][0]; }
+    const float& g() const { return m_aaData[0][1]; }
+    const float& b() const { return m_aaData[0][2]; }
+    const float& a() const { return m_aaData[0][3]; }
 
 };
 
+// Batch operations on whole arrays of colors, for vertex colors and pixels.
+// Each gives the same results as doing the same thing one color at a time,
+// using SSE2 or AVX when the processor supports it.  Outputs may be the same
+// array as an input of the same type, but shouldn't otherwise overlap one.
+
+// Convert to and from hex values, exactly as the Hex conversion operator and
+// the ColorVector( const Hex& ) constructor do.
+IMEXPORT void ToHex( const ColorVector* ac_paoColors, Hex* a_paoHex,
+                     unsigned int a_uiCount );
+IMEXPORT void ToColors( const Hex* ac_paoHex, ColorVector* a_paoColors,
+                        unsigned int a_uiCount );
+
+// Multiply red, green, and blue by alpha.  Hex channels are rounded to the
+// nearest value.
+IMEXPORT void Premultiply( const ColorVector* ac_paoColors,
+                           ColorVector* a_paoResult, unsigned int a_uiCount );
+IMEXPORT void Premultiply( const Hex* ac_paoHex, Hex* a_paoResult,
+                           unsigned int a_uiCount );
+
+// Multiply every channel of every color by the tint's.  Hex channels are
+// rounded to the nearest value.
+IMEXPORT void Tint( const ColorVector* ac_paoColors,
+                    const ColorVector& ac_roTint,
+                    ColorVector* a_paoResult, unsigned int a_uiCount );
+IMEXPORT void Tint( const Hex* ac_paoHex, const Hex& ac_rTint,
+                    Hex* a_paoResult, unsigned int a_uiCount );
+
+// Linear interpolation, from + ( to - from ) * weight.  The hex version takes
+// the weight out of 255 and computes
+// ( from * ( 255 - weight ) + to * weight ) / 255, rounded.
+IMEXPORT void Lerp( const ColorVector* ac_paoFrom,
+                    const ColorVector* ac_paoTo, float a_fWeight,
+                    ColorVector* a_paoResult, unsigned int a_uiCount );
+IMEXPORT void Lerp( const Hex* ac_paoFrom, const Hex* ac_paoTo,
+                    Channel a_ucWeight, Hex* a_paoResult,
+                    unsigned int a_uiCount );
+
+// Draw premultiplied colors over others: source + destination * ( 1 - source
+// alpha ), for every channel
+IMEXPORT void BlendOver( const ColorVector* ac_paoSource,
+                         const ColorVector* ac_paoDestination,
+                         ColorVector* a_paoResult, unsigned int a_uiCount );
+
+// Convert between 8-bit sRGB-encoded colors and linear floating-point ones
+// using lookup tables instead of pow.  Decoding is exact.  Encoding picks
+// the nearest sRGB value, so decoding and re-encoding gives back the same
+// hex values.  Alpha is never encoded.  The tables are built the first time
+// either function is called.
+IMEXPORT void SrgbToLinear( const Hex* ac_paoHex, ColorVector* a_paoColors,
+                            unsigned int a_uiCount );
+IMEXPORT void LinearToSrgb( const ColorVector* ac_paoColors, Hex* a_paoHex,
+                            unsigned int a_uiCount );
+
 }   // namespace Color
 
+// A color is just its four channel floats
+static_assert( sizeof( Color::ColorVector ) == 4 * sizeof( float ),
+               "ColorVector must be a bare array of four floats" );
+static_assert( sizeof( Color::Hex ) == 4 * sizeof( Color::Channel ),
+               "Hex must be four packed channels" );
+
 // Always include template function implementations with this header
 #include "../Implementations/ColorVector_Templates.inl"
 #ifdef INLINE_IMPLEMENTATION
@@ -0,0 +1,97 @@
+/******************************************************************************
+ * File:               ConjugateGradient.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Iterative solver for sparse symmetric positive-definite
+ *                      systems, like the ones constraint and relaxation
+ *                      solvers build.  Each iteration costs one sparse
+ *                      product and a few passes over the vectors, so a solve
+ *                      that converges in K iterations costs O(K * non-zeros)
+ *                      instead of the O(N^3) of factoring a dense matrix.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Documented failed Jacobi preconditioning.
+ ******************************************************************************/
+
+#ifndef CONJUGATE_GRADIENT__H
+#define CONJUGATE_GRADIENT__H
+
+#include "DenseVector.h"
+#include "SparseMatrix.h"
+#include "Vector.h"
+#include <type_traits>  // for is_floating_point
+
+namespace Math
+{
+
+// Ways to precondition the system before iterating
+enum Preconditioner
+{
+    PRECONDITIONER_NONE,
+
+    // Scale by the inverse of the diagonal.  Costs one multiply per element
+    // per iteration and usually cuts the iteration count a lot when diagonal
+    // elements vary in size.
+    PRECONDITIONER_JACOBI
+};
+
+// Preconditioned conjugate-gradient solver for A*x = b, where A is symmetric
+// positive definite.  Keeps its settings and the statistics of the last solve
+// between calls.  Vector updates and products split across OpenMP threads
+// once the system is big enough.
+template< typename T >
+class ConjugateGradient
+{
+    static_assert( std::is_floating_point< T >::value,
+                   "ConjugateGradient needs floating-point elements" );
+
+public:
+
+    ConjugateGradient( unsigned int a_uiMaxIterations = 1000,
+                       T a_tTolerance = T( 1e-6 ),
+                       Preconditioner a_ePreconditioner =
+                           PRECONDITIONER_JACOBI );
+
+    // Settings.  Solving stops once |b - A*x| <= tolerance * |b|.
+    unsigned int MaxIterations() const { return m_uiMaxIterations; }
+    ConjugateGradient& SetMaxIterations( unsigned int a_uiMaxIterations );
+    T Tolerance() const { return m_tTolerance; }
+    ConjugateGradient& SetTolerance( T a_tTolerance );
+    Preconditioner GetPreconditioner() const { return m_ePreconditioner; }
+    ConjugateGradient& SetPreconditioner( Preconditioner a_ePreconditioner );
+
+    // Solve A*x = b.  If x already has the right size, it is used as the
+    // starting guess, which saves iterations when solving a system that
+    // changes a little every frame; otherwise the guess is zero.  Returns
+    // false if the tolerance wasn't reached, leaving the last iterate in x,
+    // or if A turned out not to be positive definite.  If Jacobi
+    // preconditioning finds a diagonal element that isn't positive, x is set
+    // to zero and the residual to 1 without iterating.  Throws
+    // std::invalid_argument if the sizes don't match.
+    bool Solve( const SparseMatrix< T >& ac_roMatrix,
+                const DenseVector< T >& ac_roRight,
+                DenseVector< T >& a_roResult );
+    template< unsigned int N, bool t_bIsRow >
+    bool Solve( const SparseMatrix< T >& ac_roMatrix,
+                const Vector< T, N, t_bIsRow >& ac_roRight,
+                Vector< T, N, t_bIsRow >& a_roResult );
+
+    // Statistics of the last solve
+    unsigned int Iterations() const { return m_uiIterations; }
+    T Residual() const { return m_tResidual; } // |b - A*x| / |b|
+
+private:
+
+    unsigned int m_uiMaxIterations;
+    T m_tTolerance;
+    Preconditioner m_ePreconditioner;
+    unsigned int m_uiIterations;
+    T m_tResidual;
+
+};
+
+}   // namespace Math
+
+// Always include template function implementations with this header
+#include "../Implementations/ConjugateGradient.inl"
+
+#endif  // CONJUGATE_GRADIENT__H
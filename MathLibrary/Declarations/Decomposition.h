@@ -0,0 +1,216 @@
+/******************************************************************************
+ * File:               Decomposition.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Matrix decompositions that factor a matrix once and then
+ *                      solve for any number of right-hand sides in O(N^2)
+ *                      each, instead of inverting the matrix again every time.
+ *                      LU works for any invertable square matrix, QR gives
+ *                      least-squares solutions and pseudo-inverses for
+ *                      non-square matrices, and Cholesky is twice as fast as
+ *                      LU for symmetric positive-definite matrices.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Rank test allows for rounding error.
+ ******************************************************************************/
+
+#ifndef DECOMPOSITION__H
+#define DECOMPOSITION__H
+
+#include "Functions.h"
+
+namespace Math
+{
+
+// Forward declare matrix type
+template< typename T, unsigned int M, unsigned int N >
+class Matrix;
+
+// P*A = L*U with partial pivoting, where L is unit lower triangular and U is
+// upper triangular.
+template< typename T, unsigned int N >
+class LU
+{
+public:
+
+    typedef typename InverseOf< T >::Type InverseT;
+
+    // Factor the given matrix
+    LU( const T (&ac_raaMatrix)[ N ][ N ] );
+    LU( const Matrix< T, N, N >& ac_roMatrix );
+
+    // False if the matrix was singular, in which case nothing can be solved
+    bool IsInvertable() const { return m_bInvertable; }
+
+    // Determinant of the original matrix, or 0 if it was singular
+    T Determinant() const;
+
+    // Solve A*X = B for X.  If A is singular, returns false without changing
+    // the result.  The result may be the same matrix as B.
+    template< typename U, unsigned int P >
+    bool Solve( const Matrix< U, N, P >& ac_roRight,
+                Matrix< InverseT, N, P >& a_roResult ) const;
+
+    // Solve X*A = B for X, which is B * A^-1 as computed by Matrix::operator/.
+    // If A is singular, returns false without changing the result.  The result
+    // may be the same matrix as B.
+    template< typename U, unsigned int P >
+    bool Divide( const Matrix< U, P, N >& ac_roLeft,
+                 Matrix< InverseT, P, N >& a_roResult ) const;
+
+    // A^-1.  If A is singular, returns false without changing the result.
+    bool Inverse( Matrix< InverseT, N, N >& a_roInverse ) const;
+    bool Inverse( InverseT (&a_raaInverse)[ N ][ N ] ) const;
+
+private:
+
+    // Factor the given row-major element array
+    template< typename U >
+    void Factor( const U* ac_pMatrix );
+
+    // Solve A*X = B for row-major NxP arrays
+    void Solve( const InverseT* ac_pRight, InverseT* a_pResult,
+                unsigned int a_uiColumns ) const;
+
+    // L below the diagonal (its unit diagonal is implied) and U on and above
+    InverseT m_aaLU[ N ][ N ];
+
+    // m_auiPivot[i] is the row of A that ended up in row i
+    unsigned int m_auiPivot[ N ];
+
+    // Sign of the row permutation
+    InverseT m_tSign;
+
+    bool m_bInvertable;
+
+};
+
+// A = Q*R using Householder reflections, where Q is an orthogonal MxM matrix
+// and R is upper triangular.  Solving through Q and R never forms A^T * A, so
+// least-squares solutions lose half as many digits to rounding as the normal
+// equations do.  Only matrices with at least as many rows as columns can have
+// full column rank; for wider matrices, factor the transpose instead.
+template< typename T, unsigned int M, unsigned int N >
+class QR
+{
+public:
+
+    typedef typename InverseOf< T >::Type InverseT;
+
+    // Factor the given matrix
+    QR( const Matrix< T, M, N >& ac_roMatrix );
+
+    // True if the columns of A are linearly independent to within rounding
+    // error, which is required for everything else to succeed
+    bool IsFullRank() const;
+
+    // Least-squares solution of A*X = B, minimizing the squared error of each
+    // column of X.  If A isn't full rank, returns false without changing the
+    // result.
+    template< typename U, unsigned int P >
+    bool Solve( const Matrix< U, M, P >& ac_roRight,
+                Matrix< InverseT, N, P >& a_roResult ) const;
+
+    // X = B * A^+, where A^+ = ( A^T * A )^-1 * A^T is the pseudo-inverse.
+    // If A isn't full rank, returns false without changing the result.
+    template< typename U, unsigned int P >
+    bool Divide( const Matrix< U, P, N >& ac_roLeft,
+                 Matrix< InverseT, P, M >& a_roResult ) const;
+
+    // Pseudo-inverse A^+, the left inverse of A.  If A isn't full rank,
+    // returns false without changing the result.
+    bool LeftInverse( Matrix< InverseT, N, M >& a_roInverse ) const;
+
+private:
+
+    // Number of Householder reflections
+    static const unsigned int K = ( M < N ? M : N );
+
+    // R above the diagonal and Householder vectors on and below it
+    InverseT m_aaQR[ M ][ N ];
+
+    // Diagonal of R
+    InverseT m_aRDiagonal[ N ];
+
+};
+
+// A = L*L^T for symmetric positive-definite A, where L is lower triangular.
+// Only the lower triangle of A is read.
+template< typename T, unsigned int N >
+class Cholesky
+{
+public:
+
+    typedef typename InverseOf< T >::Type InverseT;
+
+    // Factor the given matrix
+    Cholesky( const Matrix< T, N, N >& ac_roMatrix );
+
+    // False if the matrix wasn't positive definite, in which case nothing can
+    // be solved
+    bool IsPositiveDefinite() const { return m_bPositiveDefinite; }
+
+    // Determinant of the original matrix, or 0 if it wasn't positive definite
+    InverseT Determinant() const;
+
+    // Solve A*X = B for X.  If A isn't positive definite, returns false
+    // without changing the result.  The result may be the same matrix as B.
+    template< typename U, unsigned int P >
+    bool Solve( const Matrix< U, N, P >& ac_roRight,
+                Matrix< InverseT, N, P >& a_roResult ) const;
+
+    // Solve X*A = B for X.  Since A is symmetric, this is the transpose of
+    // solving A*X^T = B^T.  The result may be the same matrix as B.
+    template< typename U, unsigned int P >
+    bool Divide( const Matrix< U, P, N >& ac_roLeft,
+                 Matrix< InverseT, P, N >& a_roResult ) const;
+
+    // A^-1.  If A isn't positive definite, returns false without changing the
+    // result.
+    bool Inverse( Matrix< InverseT, N, N >& a_roInverse ) const;
+
+private:
+
+    // Solve A*x = b in place for one vector spaced the given number of
+    // elements apart
+    void Solve( InverseT* a_pVector, unsigned int a_uiStride ) const;
+
+    // L on and below the diagonal
+    InverseT m_aaL[ N ][ N ];
+
+    bool m_bPositiveDefinite;
+
+};
+
+// Picks the decomposition for Matrix::operator/, computing X = A * B^-1 for an
+// MxN matrix A and PxN matrix B.  Returns false without changing the result
+// if B has no inverse or pseudo-inverse.  Non-square matrices small enough for
+// the closed-form inverse of B^T * B or B * B^T use the normal equations, the
+// same as Matrix::Inverse.  Larger ones use QR - of B if it's tall, or of B^T
+// if it's wide.
+template< typename T, unsigned int M, unsigned int N, unsigned int P >
+struct MatrixDivision
+{
+    typedef typename InverseOf< T >::Type InverseT;
+    static bool Divide( const Matrix< T, M, N >& ac_roLeft,
+                        const Matrix< T, P, N >& ac_roRight,
+                        Matrix< InverseT, M, P >& a_roResult );
+};
+
+// Square matrices up to 4x4 multiply by the closed-form inverse, which is
+// faster than substitution at that size and exact for matrices with small
+// integer elements.  Larger ones use LU.
+template< typename T, unsigned int M, unsigned int N >
+struct MatrixDivision< T, M, N, N >
+{
+    typedef typename InverseOf< T >::Type InverseT;
+    static bool Divide( const Matrix< T, M, N >& ac_roLeft,
+                        const Matrix< T, N, N >& ac_roRight,
+                        Matrix< InverseT, M, N >& a_roResult );
+};
+
+}   // namespace Math
+
+// Always include template function implementations with this header
+#include "../Implementations/Decomposition.inl"
+
+#endif  // DECOMPOSITION__H
@@ -0,0 +1,223 @@
+/******************************************************************************
+ * File:               DenseMatrix.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Matrix with dimensions set at runtime, for problems too
+ *                      big for the fixed-size Matrix template.  Elements are
+ *                      one aligned row-major array on the heap.  Products use
+ *                      a cache-blocked kernel that packs blocks of both
+ *                      operands, computes small tiles of the result in SIMD
+ *                      registers, and splits the rows of large products
+ *                      across OpenMP threads.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  DenseBuffer can release its space.
+ ******************************************************************************/
+
+#ifndef DENSE_MATRIX__H
+#define DENSE_MATRIX__H
+
+#include "ElementKernels.h"
+#include "Functions.h"
+#include "Matrix.h"
+#include "MatrixProduct.h"
+#include "SimdRegister.h"
+#include <stdexcept>
+#include <type_traits>  // for enable_if, is_arithmetic, and is_scalar
+
+namespace Math
+{
+
+// Element arrays start on a 32-byte boundary, so rows of an AVX-width multiple
+// of columns never split a register across cache lines.
+const unsigned int DENSE_ALIGNMENT = 32;
+
+// Block sizes for products, in elements.  A packed block of
+// DENSE_BLOCK_ROWS x DENSE_BLOCK_DEPTH left-hand elements stays in L2 cache
+// while it is multiplied by a packed DENSE_BLOCK_DEPTH x DENSE_BLOCK_COLUMNS
+// right-hand panel, one DENSE_TILE_ROWS x ( 2 * register width ) tile of the
+// result at a time.
+const unsigned int DENSE_TILE_ROWS = 4;
+const unsigned int DENSE_BLOCK_ROWS = 64;       // multiple of DENSE_TILE_ROWS
+const unsigned int DENSE_BLOCK_DEPTH = 256;
+const unsigned int DENSE_BLOCK_COLUMNS = 2048;  // multiple of any tile width
+
+// Panels with fewer multiply-adds than this aren't worth starting threads for
+const double DENSE_THREAD_WORK = 64.0 * 64.0 * 64.0;
+
+// Uninitialized aligned scratch space that frees itself
+template< typename T >
+class DenseBuffer
+{
+public:
+    DenseBuffer( unsigned int a_uiSize );
+    ~DenseBuffer();
+    T* Data() { return m_pData; }
+    T* Release();   // stop owning the space and return it
+    static T* Allocate( unsigned int a_uiSize );
+    static void Free( T* a_pData );
+private:
+    DenseBuffer( const DenseBuffer& ac_roBuffer );
+    DenseBuffer& operator=( const DenseBuffer& ac_roBuffer );
+    T* m_pData;
+};
+
+// Multiply an M x K row-major array by a K x N one.  The result must not
+// overlap either operand.  Float and double use the widest registers the
+// processor supports; every other type multiplies one element at a time.
+// Each result element sums its terms in the same order as a plain triple
+// loop, so, as with MatrixProduct, results match one exactly as long as the
+// library is built with SSE2 scalar floating point.
+template< typename T >
+struct DenseProduct
+{
+    static void Multiply( const T* ac_pLeft, const T* ac_pRight,
+                          T* a_pResult, unsigned int a_uiRows,
+                          unsigned int a_uiDepth, unsigned int a_uiColumns );
+};
+template<>
+struct DenseProduct< double >
+{
+    static void Multiply( const double* ac_pdLeft, const double* ac_pdRight,
+                          double* a_pdResult, unsigned int a_uiRows,
+                          unsigned int a_uiDepth, unsigned int a_uiColumns );
+};
+template<>
+struct DenseProduct< float >
+{
+    static void Multiply( const float* ac_pfLeft, const float* ac_pfRight,
+                          float* a_pfResult, unsigned int a_uiRows,
+                          unsigned int a_uiDepth, unsigned int a_uiColumns );
+};
+
+// Matrix of arithmetic values with dimensions set at runtime.  Operations on
+// matrices with mismatched dimensions throw std::invalid_argument.
+template< typename T >
+class DenseMatrix
+{
+    static_assert( std::is_arithmetic< T >::value,
+                   "DenseMatrix elements must be arithmetic values" );
+
+public:
+
+    // simplify typing
+    typedef typename InverseOf< T >::Type InverseT;
+    typedef DenseMatrix< InverseT > InverseType;
+
+    // Construct with all elements set to the given value
+    DenseMatrix();
+    DenseMatrix( unsigned int a_uiRows, unsigned int a_uiColumns,
+                 const T& ac_rFill = T( 0 ) );
+
+    // Construct with row-major data
+    DenseMatrix( const T* ac_pData, unsigned int a_uiRows,
+                 unsigned int a_uiColumns );
+
+    // Construct from a fixed-size matrix
+    template< unsigned int M, unsigned int N >
+    DenseMatrix( const Matrix< T, M, N >& ac_roMatrix );
+
+    // Copy and destroy
+    DenseMatrix( const DenseMatrix& ac_roMatrix );
+    DenseMatrix& operator=( const DenseMatrix& ac_roMatrix );
+    ~DenseMatrix();
+
+    // Dimensions
+    unsigned int Rows() const { return m_uiRows; }
+    unsigned int Columns() const { return m_uiColumns; }
+    unsigned int Size() const { return m_uiRows * m_uiColumns; }
+    bool IsSquare() const { return m_uiRows == m_uiColumns; }
+
+    // Change dimensions, discarding the old elements
+    DenseMatrix& SetSize( unsigned int a_uiRows, unsigned int a_uiColumns,
+                          const T& ac_rFill = T( 0 ) );
+
+    // Set all elements to the given value
+    DenseMatrix& Fill( const T& ac_rFill );
+
+    // Equality and inequality checks
+    bool operator==( const DenseMatrix& ac_roMatrix ) const;
+    bool operator!=( const DenseMatrix& ac_roMatrix ) const;
+
+    // Array access
+    T* operator[]( unsigned int a_uiRow );
+    const T* operator[]( unsigned int a_uiRow ) const;
+    T& At( unsigned int a_uiRow, unsigned int a_uiColumn );
+    const T& At( unsigned int a_uiRow, unsigned int a_uiColumn ) const;
+
+    // Unchecked access to all elements as one row-major array
+    T* Data() { return m_pData; }
+    const T* Data() const { return m_pData; }
+
+    // Transpose
+    DenseMatrix Transpose() const;
+
+    // Determinant - return 0 if non-square matrix
+    T Determinant() const;
+
+    // Inverse
+    bool Inverse( InverseType& a_roMatrix ) const;  // !invertable = !change
+    InverseType Inverse() const;    // if !invertable, return zeroes
+    InverseType Inverse( bool& a_rbInvertable ) const;  // as above
+
+    // Factor P*A = L*U with partial pivoting, storing L below the diagonal
+    // (its unit diagonal is implied) and U on and above it.  a_puiPivot[i]
+    // is the row of this matrix that ended up in row i, and a_rSign is the
+    // sign of the permutation.  Returns false if the matrix is singular or
+    // not square.
+    bool Decompose( InverseType& a_roLU, unsigned int* a_puiPivot,
+                    InverseT& a_rSign ) const;
+
+    // Matrix multiplication
+    DenseMatrix operator*( const DenseMatrix& ac_roMatrix ) const;
+    DenseMatrix& operator*=( const DenseMatrix& ac_roMatrix );
+
+    // Matrix addition and subtraction
+    DenseMatrix operator-() const;
+    DenseMatrix& operator+=( const DenseMatrix& ac_roMatrix );
+    DenseMatrix operator+( const DenseMatrix& ac_roMatrix ) const;
+    DenseMatrix& operator-=( const DenseMatrix& ac_roMatrix );
+    DenseMatrix operator-( const DenseMatrix& ac_roMatrix ) const;
+
+    // Scalar multiplication and division
+    template< typename U >
+    typename std::enable_if< std::is_scalar< U >::value, DenseMatrix& >::type
+        operator*=( const U& ac_rScalar );
+    template< typename U >
+    typename std::enable_if< std::is_scalar< U >::value, DenseMatrix >::type
+        operator*( const U& ac_rScalar ) const;
+    template< typename U >
+    typename std::enable_if< std::is_scalar< U >::value, DenseMatrix& >::type
+        operator/=( const U& ac_rScalar );
+    template< typename U >
+    typename std::enable_if< std::is_scalar< U >::value, DenseMatrix >::type
+        operator/( const U& ac_rScalar ) const;
+
+    // Zero and identity matrices of the given sizes
+    static DenseMatrix Zero( unsigned int a_uiRows,
+                             unsigned int a_uiColumns );
+    static DenseMatrix Identity( unsigned int a_uiSize );
+
+private:
+
+    // Throw if the given matrix doesn't have the same dimensions as this one
+    void CheckSameSize( const DenseMatrix& ac_roMatrix ) const;
+
+    unsigned int m_uiRows;
+    unsigned int m_uiColumns;
+    T* m_pData;
+
+};
+
+}   // namespace Math
+
+// Scalar multiplication in the other direction
+template< typename U, typename T >
+typename std::enable_if< std::is_scalar< U >::value,
+                         Math::DenseMatrix< T > >::type
+    operator*( const U& ac_rScalar, const Math::DenseMatrix< T >& ac_roMatrix );
+
+// Always include template function implementations with this header
+#include "../Implementations/DenseMatrix.inl"
+#include "../Implementations/DenseMatrix_Product.inl"
+
+#endif  // DENSE_MATRIX__H
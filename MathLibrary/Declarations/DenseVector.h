@@ -0,0 +1,133 @@
+/******************************************************************************
+ * File:               DenseVector.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Vector with a size set at runtime, for the right-hand
+ *                      sides and solutions of systems too big for the
+ *                      fixed-size Vector template.  Elements are one aligned
+ *                      array on the heap, like DenseMatrix.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef DENSE_VECTOR__H
+#define DENSE_VECTOR__H
+
+#include "DenseMatrix.h"
+#include "ElementKernels.h"
+#include "Functions.h"
+#include "Vector.h"
+#include <stdexcept>
+#include <type_traits>  // for enable_if, is_arithmetic, and is_scalar
+
+namespace Math
+{
+
+// Vector of arithmetic values with a size set at runtime.  There is no row or
+// column form - matrices multiply it from whichever side they need to.
+// Operations on vectors of different sizes throw std::invalid_argument.
+template< typename T >
+class DenseVector
+{
+    static_assert( std::is_arithmetic< T >::value,
+                   "DenseVector elements must be arithmetic values" );
+
+public:
+
+    // simplify typing
+    typedef typename InverseOf< T >::Type InverseT;
+
+    // Construct with all elements set to the given value
+    DenseVector();
+    explicit DenseVector( unsigned int a_uiSize, const T& ac_rFill = T( 0 ) );
+
+    // Construct with data
+    DenseVector( const T* ac_pData, unsigned int a_uiSize );
+
+    // Construct from a fixed-size vector
+    template< unsigned int N, bool t_bIsRow >
+    DenseVector( const Vector< T, N, t_bIsRow >& ac_roVector );
+
+    // Copy and destroy
+    DenseVector( const DenseVector& ac_roVector );
+    DenseVector& operator=( const DenseVector& ac_roVector );
+    ~DenseVector();
+
+    // Copy into a fixed-size vector, which must have the same size
+    template< unsigned int N, bool t_bIsRow >
+    void AssignTo( Vector< T, N, t_bIsRow >& a_roVector ) const;
+
+    // Size
+    unsigned int Size() const { return m_uiSize; }
+
+    // Change size, discarding the old elements
+    DenseVector& SetSize( unsigned int a_uiSize, const T& ac_rFill = T( 0 ) );
+
+    // Set all elements to the given value
+    DenseVector& Fill( const T& ac_rFill );
+
+    // Equality and inequality checks
+    bool operator==( const DenseVector& ac_roVector ) const;
+    bool operator!=( const DenseVector& ac_roVector ) const;
+
+    // Element access
+    T& operator[]( unsigned int a_uiIndex );
+    const T& operator[]( unsigned int a_uiIndex ) const;
+
+    // Unchecked access to all elements
+    T* Data() { return m_pData; }
+    const T* Data() const { return m_pData; }
+
+    // Dot product
+    T Dot( const DenseVector& ac_roVector ) const;
+
+    // Length
+    InverseT Magnitude() const;
+    T MagnitudeSquared() const;
+
+    // Vector addition and subtraction
+    DenseVector operator-() const;
+    DenseVector& operator+=( const DenseVector& ac_roVector );
+    DenseVector operator+( const DenseVector& ac_roVector ) const;
+    DenseVector& operator-=( const DenseVector& ac_roVector );
+    DenseVector operator-( const DenseVector& ac_roVector ) const;
+
+    // Scalar multiplication and division
+    template< typename U >
+    typename std::enable_if< std::is_scalar< U >::value, DenseVector& >::type
+        operator*=( const U& ac_rScalar );
+    template< typename U >
+    typename std::enable_if< std::is_scalar< U >::value, DenseVector >::type
+        operator*( const U& ac_rScalar ) const;
+    template< typename U >
+    typename std::enable_if< std::is_scalar< U >::value, DenseVector& >::type
+        operator/=( const U& ac_rScalar );
+    template< typename U >
+    typename std::enable_if< std::is_scalar< U >::value, DenseVector >::type
+        operator/( const U& ac_rScalar ) const;
+
+    // Zero vector of the given size
+    static DenseVector Zero( unsigned int a_uiSize );
+
+private:
+
+    // Throw if the given vector doesn't have the same size as this one
+    void CheckSameSize( const DenseVector& ac_roVector ) const;
+
+    unsigned int m_uiSize;
+    T* m_pData;
+
+};
+
+}   // namespace Math
+
+// Scalar multiplication in the other direction
+template< typename U, typename T >
+typename std::enable_if< std::is_scalar< U >::value,
+                         Math::DenseVector< T > >::type
+    operator*( const U& ac_rScalar, const Math::DenseVector< T >& ac_roVector );
+
+// Always include template function implementations with this header
+#include "../Implementations/DenseVector.inl"
+
+#endif  // DENSE_VECTOR__H
@@ -3,8 +3,13 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 10, 2014
  * Description:        Simple non-template string to avoid DLL-compile warnings.
- * Last Modified:      February 24, 2014
- * Last Modification:  Moved into Utility namespace from MyFirstEngine project.
+ *                      Short strings are kept in an internal buffer instead
+ *                      of on the heap, and hashes are cached until the string
+ *                      changes.  DumbStringView looks at characters without
+ *                      copying them, for lookups that shouldn't allocate.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added short string buffer, cached hash, moves, and
+ *                      string views.
  ******************************************************************************/
 
 #ifndef DUMB_STRING__H
@@ -21,6 +26,8 @@
 namespace Utility
 {
 
+class DumbStringView;
+
 // A simple String structure.  This doesn't implement everything std::string
 // does, but it won't result in warnings when compiling a DLL
 class IMEXPORT_CLASS DumbString
@@ -29,21 +36,35 @@ class IMEXPORT_CLASS DumbString
 {
 public:
 
+    // Strings shorter than this don't need heap memory
+    static const std::size_t LOCAL_CAPACITY = 48;
+
     // Constructors
     DumbString();
     DumbString( std::size_t a_uiSize );
     DumbString( const DumbString& ac_roString );
+    DumbString( DumbString&& a_rroString );
     DumbString( const char* ac_pcData );
     DumbString( char a_cCharacter );
     DumbString( std::istream& a_roInput );
+    explicit DumbString( const DumbStringView& ac_roView );
 
     // Destructor
     virtual ~DumbString();
 
     // Operators
-    char& operator[]( std::size_t a_uiIndex ) { return m_pcData[ a_uiIndex ]; }
+    char& operator[]( std::size_t a_uiIndex )
+    {
+        if( 0 == m_uiCapacity )
+        {
+            GrowTo( m_uiSize ); // take a copy of borrowed characters
+        }
+        m_uiHash = 0;
+        return m_pcData[ a_uiIndex ];
+    }
     const char& operator[]( std::size_t a_uiIndex ) const { return m_pcData[ a_uiIndex ]; }
     DumbString& operator=( const DumbString& ac_roString );
+    DumbString& operator=( DumbString&& a_rroString );
     DumbString& operator=( const char* ac_pcData );
     DumbString& operator=( char a_cCharacter );
     DumbString& operator+=( const DumbString& ac_roString );
@@ -54,7 +75,7 @@ public:
     DumbString operator+( char a_cCharacter ) const;
     operator const char*() const { return m_pcData; }
 
-    // Get simple properties
+    // Get simple properties - capacity is zero for borrowed strings
     std::size_t Size() const { return m_uiSize; }
     std::size_t Capacity() const { return m_uiCapacity; }
     const char* CString() const { return m_pcData; }
@@ -76,23 +97,90 @@ public:
     static DumbString LoadFrom( const char* ac_pcFileName,
                                 const char* ac_pcErrorMessage = nullptr );
 
+    // A string that uses the viewed characters instead of copying them, for
+    // looking up keys in containers without allocating memory.  It must not
+    // outlive the characters, and if the view wasn't null-terminated, neither
+    // is the borrowed string's CString().  Copies own their characters.
+    static const DumbString Borrow( const DumbStringView& ac_roView );
+
+    // Hash and comparison shared by strings and views
+    static std::size_t HashCharacters( const char* ac_pcData,
+                                       std::size_t a_uiSize );
+    static int CompareCharacters( const char* ac_pcFirst,
+                                  std::size_t a_uiFirstSize,
+                                  const char* ac_pcSecond,
+                                  std::size_t a_uiSecondSize );
+
 private:
 
-    // Expand capacity to fit a string of the given size
-    void GrowTo( std::size_t a_uiSize );
+    // Borrow the viewed characters
+    DumbString( const DumbStringView& ac_roView, bool a_bBorrow );
+
+    // Expand capacity to fit a string of the given size, keeping the current
+    // characters unless told otherwise
+    void GrowTo( std::size_t a_uiSize, bool a_bKeepData = true );
+
+    // Replace or add to the characters
+    void Assign( const char* ac_pcData, std::size_t a_uiSize );
+    void Append( const char* ac_pcData, std::size_t a_uiSize );
+
+    // Take another string's characters, leaving it empty
+    void Steal( DumbString& a_roString );
+
+    // Free heap memory, if any, and go back to being empty
+    void Release();
 
     // Calculate the int-aligned capacity needed for a string of the given size
     static std::size_t RequiredCapacity( std::size_t a_uiSize );
 
-    // Data
+    // Data - points to the local buffer for short strings
     char* m_pcData;
     std::size_t m_uiSize;
     std::size_t m_uiCapacity;
+    mutable std::size_t m_uiHash;   // zero until calculated
+    char m_acLocal[ LOCAL_CAPACITY ];
 
 };  // class DumbString
 DumbString operator+( const char* ac_pcData, const DumbString& ac_roString );
 DumbString operator+( const char a_cCharacter, const DumbString& ac_roString );
 
+// Characters belonging to something else, which don't have to be
+// null-terminated.  Views hash and compare the same way as DumbStrings, so
+// strings can be looked up by view with DumbString::Borrow.  The characters
+// must outlive the view.
+class IMEXPORT_CLASS DumbStringView
+    : public Hashable, public Comparable< DumbStringView >
+{
+public:
+
+    // Constructors
+    DumbStringView();
+    DumbStringView( const char* ac_pcData );
+    DumbStringView( const char* ac_pcData, std::size_t a_uiSize );
+    DumbStringView( const DumbString& ac_roString );
+
+    // Destructor
+    virtual ~DumbStringView() {}
+
+    // Get simple properties
+    const char& operator[]( std::size_t a_uiIndex ) const
+    { return m_pcData[ a_uiIndex ]; }
+    std::size_t Size() const { return m_uiSize; }
+    const char* Data() const { return m_pcData; }
+    bool IsEmpty() const { return ( 0 == m_uiSize ); }
+
+    // Implement abstract functions from parent classes
+    int Compare( const DumbStringView& ac_roView ) const;
+    std::size_t Hash() const;
+
+private:
+
+    const char* m_pcData;
+    std::size_t m_uiSize;
+    mutable std::size_t m_uiHash;   // zero until calculated
+
+};  // class DumbStringView
+
 }   // namespace Utility
 
 namespace std
@@ -100,6 +188,8 @@ namespace std
 
 template<>
 struct hash< Utility::DumbString > : public hash< Utility::Hashable > {};
+template<>
+struct hash< Utility::DumbStringView > : public hash< Utility::Hashable > {};
 
 }   // namespace std
 
@@ -3,8 +3,15 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 11, 2014
  * Description:        Class representing an array that can be resized.
- * Last Modified:      March 20, 2014
- * Last Modification:  Moving implementations to separate inl file.
+ *                      Storage grows by half again whenever it fills up, so
+ *                      appending one element at a time takes amortized
+ *                      constant time, and shrinking keeps the memory for
+ *                      reuse.  Elements only exist up to the size - the rest
+ *                      of the capacity is raw memory.  Elements that are
+ *                      trivially copyable are copied and moved in bulk with
+ *                      memcpy instead of one at a time.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added capacity, appending, moves, and bulk copies.
  ******************************************************************************/
 
 #ifndef DYNAMIC_ARRAY__H
@@ -20,6 +27,12 @@ class DynamicArray
 {
 public:
 
+    // True if elements can be copied and moved as raw bytes and don't need
+    // their destructors called
+    static const bool IS_TRIVIAL = __has_trivial_copy( T ) &&
+                                   __has_trivial_assign( T ) &&
+                                   __has_trivial_destructor( T );
+
     // default constructor
     DynamicArray( unsigned int a_uiSize = 0 );
     DynamicArray( unsigned int a_uiSize, const T& ac_rFill );
@@ -31,24 +44,65 @@ public:
     // copy construct
     DynamicArray( const DynamicArray& ac_roArray );
 
+    // move construct, taking the other array's memory and leaving it empty
+    DynamicArray( DynamicArray&& a_rroArray );
+
     // destroy
     virtual ~DynamicArray();
 
-    // copy assign
+    // copy assign, reusing this array's memory if there's enough of it
     DynamicArray& operator=( const DynamicArray& ac_roArray );
 
+    // move assign, taking the other array's memory and leaving it empty
+    DynamicArray& operator=( DynamicArray&& a_rroArray );
+
     // assign size of 1
     DynamicArray& operator=( const T& ac_rData );
 
-    // access array elements
+    // access array elements - throws std::out_of_range for a bad index
     T& operator[]( unsigned int a_uiIndex );
     const T& operator[]( unsigned int a_uiIndex ) const;
 
+    // unchecked access, for inner loops that have already checked the size
+    T& Unchecked( unsigned int a_uiIndex ) { return m_paData[ a_uiIndex ]; }
+    const T& Unchecked( unsigned int a_uiIndex ) const
+    { return m_paData[ a_uiIndex ]; }
+    T* Data() { return m_paData; }
+    const T* Data() const { return m_paData; }
+
     // manage array size
     unsigned int Size() const { return m_uiSize; }
+    bool IsEmpty() const { return 0 == m_uiSize; }
     DynamicArray& SetSize( unsigned int a_uiSize );
     DynamicArray& SetSize( unsigned int a_uiSize, const T& ac_rFill );
 
+    // manage memory - the number of elements there's room for, making room
+    // for at least the given number, and giving back any memory not in use
+    unsigned int Capacity() const { return m_uiCapacity; }
+    DynamicArray& Reserve( unsigned int a_uiCapacity );
+    DynamicArray& ShrinkToFit();
+
+    // remove all elements, keeping the memory
+    DynamicArray& Clear();
+
+    // add an element to the end.  The new element may be a copy of one
+    // already in the array.
+    DynamicArray& PushBack( const T& ac_rData );
+    DynamicArray& PushBack( T&& a_rrData );
+
+    // construct an element at the end from the given constructor arguments
+    T& EmplaceBack();
+    template< typename A1 >
+    T& EmplaceBack( A1&& a_rrArgument1 );
+    template< typename A1, typename A2 >
+    T& EmplaceBack( A1&& a_rrArgument1, A2&& a_rrArgument2 );
+    template< typename A1, typename A2, typename A3 >
+    T& EmplaceBack( A1&& a_rrArgument1, A2&& a_rrArgument2,
+                    A3&& a_rrArgument3 );
+
+    // remove the last element - throws std::out_of_range if empty
+    DynamicArray& PopBack();
+
     // set all elements to the given value
     DynamicArray& Fill( const T& ac_rFill );
 
@@ -60,8 +114,33 @@ public:
 
 protected:
 
+    // raw memory for the given number of elements, or null for none
+    static T* Allocate( unsigned int a_uiCapacity );
+    static void Free( T* a_paData );
+
+    // construct elements in raw memory, or destroy them and leave raw memory
+    static void CopyConstruct( T* a_paTarget, const T* ac_paSource,
+                               unsigned int a_uiCount );
+    static void Relocate( T* a_paTarget, T* a_paSource,
+                          unsigned int a_uiCount );
+    static void Destroy( T* a_paData, unsigned int a_uiCount );
+
+    // capacity to grow to when at least the given capacity is needed
+    unsigned int GrownCapacity( unsigned int a_uiMinimum ) const;
+
+    // move the elements to new memory with the given capacity
+    void Reallocate( unsigned int a_uiCapacity );
+
+    // Appending to a full array happens in three steps so that the new
+    // element can be constructed from another element in the array before
+    // the array moves: find where the new element goes in new memory;
+    // construct it there; then move the rest of the elements over.
+    T* AppendSlot( T*& a_rpaNewData );
+    T& FinishAppend( T* a_paNewData );
+
     T* m_paData;
     unsigned int m_uiSize;
+    unsigned int m_uiCapacity;
 
 };  // class DynamicArray
 
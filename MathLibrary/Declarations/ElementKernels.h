@@ -0,0 +1,112 @@
+/******************************************************************************
+ * File:               ElementKernels.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Kernels for element-wise operations on raw matrix
+ *                      element arrays.  A matrix's elements are one contiguous
+ *                      row-major array, so these loop straight over it with a
+ *                      single index - no row and column arithmetic and no
+ *                      bounds checks.  Float and double arrays are processed
+ *                      with SSE2 registers whenever the compiler is already
+ *                      generating SSE2 code, and give exactly the same
+ *                      results as the one-element-at-a-time loops.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef ELEMENT_KERNELS__H
+#define ELEMENT_KERNELS__H
+
+#include "SimdRegister.h"
+
+// These kernels are inlined into client code without checking what the
+// processor supports, so only use SSE2 where the compiler already requires it
+// (x64, or /arch:SSE2 on x86).
+#if defined SIMD_REGISTER_SSE2 && \
+    ( defined _M_X64 || ( defined _M_IX86_FP && _M_IX86_FP >= 2 ) )
+#define ELEMENT_KERNELS_SSE2
+#endif
+
+namespace Math
+{
+
+// One element at a time.  Each result is converted back to type T, exactly as
+// the compound assignment operators and expression nodes do.  Results may be
+// written over either operand, but Transpose needs a separate result array.
+template< typename T >
+struct ScalarElementKernels
+{
+    static void Add( const T* ac_pLeft, const T* ac_pRight, T* a_pResult,
+                     unsigned int a_uiCount );
+    static void Subtract( const T* ac_pLeft, const T* ac_pRight, T* a_pResult,
+                          unsigned int a_uiCount );
+    template< typename U >
+    static void Multiply( const T* ac_pElements, const U& ac_rScalar,
+                          T* a_pResult, unsigned int a_uiCount );
+    template< typename U >
+    static void Divide( const T* ac_pElements, const U& ac_rScalar,
+                        T* a_pResult, unsigned int a_uiCount );
+    static void Negate( const T* ac_pElements, T* a_pResult,
+                        unsigned int a_uiCount );
+    static bool Equal( const T* ac_pLeft, const T* ac_pRight,
+                       unsigned int a_uiCount );
+    static bool NotEqual( const T* ac_pLeft, const T* ac_pRight,
+                          unsigned int a_uiCount );
+    static void Fill( T* a_pResult, const T& ac_rValue,
+                      unsigned int a_uiCount );
+    static void Copy( const T* ac_pElements, T* a_pResult,
+                      unsigned int a_uiCount );
+    static void Transpose( const T* ac_pElements, unsigned int a_uiRows,
+                           unsigned int a_uiColumns, T* a_pResult );
+};
+
+// Whole registers at a time for the arithmetic and comparisons, finishing off
+// any remainder one element at a time.  Scalars that don't convert exactly to
+// the element type go through the one-element loops, since the registers can
+// only hold the converted value.
+template< typename R >
+struct SimdElementKernels
+    : public ScalarElementKernels< typename R::ElementType >
+{
+    typedef typename R::ElementType ElementType;
+    typedef ScalarElementKernels< ElementType > ScalarType;
+    static void Add( const ElementType* ac_pLeft,
+                     const ElementType* ac_pRight, ElementType* a_pResult,
+                     unsigned int a_uiCount );
+    static void Subtract( const ElementType* ac_pLeft,
+                          const ElementType* ac_pRight,
+                          ElementType* a_pResult, unsigned int a_uiCount );
+    template< typename U >
+    static void Multiply( const ElementType* ac_pElements,
+                          const U& ac_rScalar, ElementType* a_pResult,
+                          unsigned int a_uiCount );
+    template< typename U >
+    static void Divide( const ElementType* ac_pElements, const U& ac_rScalar,
+                        ElementType* a_pResult, unsigned int a_uiCount );
+    static void Negate( const ElementType* ac_pElements,
+                        ElementType* a_pResult, unsigned int a_uiCount );
+    static bool Equal( const ElementType* ac_pLeft,
+                       const ElementType* ac_pRight, unsigned int a_uiCount );
+    static bool NotEqual( const ElementType* ac_pLeft,
+                          const ElementType* ac_pRight,
+                          unsigned int a_uiCount );
+};
+
+// Picks the kernels for the element type at compile time
+template< typename T >
+struct ElementKernels : public ScalarElementKernels< T > {};
+#ifdef ELEMENT_KERNELS_SSE2
+template<>
+struct ElementKernels< float >
+    : public SimdElementKernels< SseFloatRegister > {};
+template<>
+struct ElementKernels< double >
+    : public SimdElementKernels< SseDoubleRegister > {};
+#endif
+
+}   // namespace Math
+
+// Always include template function implementations with this header
+#include "../Implementations/ElementKernels.inl"
+
+#endif  // ELEMENT_KERNELS__H
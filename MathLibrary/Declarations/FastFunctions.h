@@ -0,0 +1,82 @@
+/******************************************************************************
+ * File:               FastFunctions.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Branch-free approximations of common math functions,
+ *                      for hot paths that call them for every object or
+ *                      vertex.  Each function is a fixed sequence of
+ *                      multiplies and adds (plus a division or square root
+ *                      for atan2 and acos) with no table lookups, so the same
+ *                      code runs on one double at a time or on SSE2/AVX
+ *                      registers.  The array versions process whole arrays
+ *                      with the widest registers the processor supports and
+ *                      give exactly the same results as the one-value
+ *                      versions.  Error bounds were measured against the
+ *                      standard library over the ranges given.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Documented Rsqrt( 0 ).
+ ******************************************************************************/
+
+#ifndef FAST_FUNCTIONS__H
+#define FAST_FUNCTIONS__H
+
+#include "Functions.h"
+#include "SimdRegister.h"
+#include "ImExportMacro.h"
+
+namespace Math
+{
+
+namespace Fast
+{
+
+// Sine and cosine, within 4e-16 of std::sin and std::cos for |x| < 1e6.
+// Beyond that, the reduction to [-PI/4,PI/4] loses precision.
+double Sin( double a_dRadians );
+double Cos( double a_dRadians );
+void SinCos( double a_dRadians, double& a_rdSin, double& a_rdCos );
+
+// Arctangent of y/x in (-PI,PI], within 2 ULP (5e-16) of std::atan2.
+// Atan2( 0, 0 ) is 0.
+double Atan2( double a_dY, double a_dX );
+
+// Arccosine in [0,PI] for x in [-1,1], within 5e-16 of std::acos
+double Acos( double a_dX );
+
+// 1/sqrt(x) for x > 0 by Newton's method from a bit-pattern estimate, within
+// a relative error of 4e-11.  Rsqrt( 0 ) is a large finite number instead of
+// infinity, so scaling a zero vector by it leaves zeroes instead of NaN.
+double Rsqrt( double a_dX );
+
+// e^x, within a relative error of 2 ULP (5e-16) of std::exp.  Inputs outside
+// [-708,709] are clamped to that range instead of under/overflowing.
+double Exp( double a_dX );
+
+// The same functions over whole arrays.  Output may be the same array as
+// input.
+IMEXPORT void Sin( const double* ac_pdRadians, double* a_pdOut,
+                   unsigned int a_uiCount );
+IMEXPORT void Cos( const double* ac_pdRadians, double* a_pdOut,
+                   unsigned int a_uiCount );
+IMEXPORT void SinCos( const double* ac_pdRadians, double* a_pdSin,
+                      double* a_pdCos, unsigned int a_uiCount );
+IMEXPORT void Atan2( const double* ac_pdY, const double* ac_pdX,
+                     double* a_pdOut, unsigned int a_uiCount );
+IMEXPORT void Acos( const double* ac_pdX, double* a_pdOut,
+                    unsigned int a_uiCount );
+IMEXPORT void Rsqrt( const double* ac_pdX, double* a_pdOut,
+                     unsigned int a_uiCount );
+IMEXPORT void Exp( const double* ac_pdX, double* a_pdOut,
+                   unsigned int a_uiCount );
+
+}   // namespace Fast
+
+}   // namespace Math
+
+// Always include template and inline function implementations with this header
+#include "../Implementations/FastFunctions_Templates.inl"
+#ifdef INLINE_IMPLEMENTATION
+#include "../Implementations/FastFunctions.inl"
+#endif
+
+#endif  // FAST_FUNCTIONS__H
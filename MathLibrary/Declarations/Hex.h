@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       December 16, 2013
  * Description:        A union for representing color hex values.
- * Last Modified:      February 25, 2014
- * Last Modification:  Changed how constructor handles float parameters.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added ChannelFromFloat.
  ******************************************************************************/
 
 #ifndef HEX__H
@@ -26,6 +26,25 @@ namespace Color
 typedef uint8_t Channel;
 typedef uint32_t FourChannelInt;
 
+// Convert a channel value in [0, 1] to the nearest 8-bit value, rounding
+// halves down and clamping values outside the range.  Gives the same results
+// as clamping and calling Math::Round, without the double-precision ceil and
+// floor calls.  The batch conversions in ColorVector.h round the same way.
+inline Channel ChannelFromFloat( float a_fValue )
+{
+    float fScaled = a_fValue * 0xFF;
+    if( !( fScaled > 0.0f ) )   // also catches NaN
+    {
+        return 0x00;
+    }
+    if( fScaled >= 255.0f )
+    {
+        return 0xFF;
+    }
+    Channel ucResult = (Channel)fScaled;
+    return ( fScaled - ucResult > 0.5f ? ucResult + 1 : ucResult );
+}
+
 // Convenient union for representing color hex values
 // Cast to uint32_t for arithmatic operations.
 union Hex
@@ -66,18 +85,8 @@ union Hex
     Hex( Channel a_r, Channel a_g, Channel a_b, Channel a_a = 0xFF )
         : a( a_a ), r( a_r ), g( a_g ), b( a_b ) {}
     Hex( float a_r, float a_g, float a_b, float a_a = 1.0 )
-        : a( a_a < 0.0 ? 0
-            : a_a > 1.0 ? 0xFF
-            : (Channel)Math::Round( a_a * 0xFF ) ),
-          r( a_r < 0.0 ? 0
-            : a_r > 1.0 ? 0xFF
-            : (Channel)Math::Round( a_r * 0xFF ) ),
-          g( a_g < 0.0 ? 0
-            : a_g > 1.0 ? 0xFF
-            : (Channel)Math::Round( a_g * 0xFF ) ),
-          b( a_b < 0.0 ? 0
-            : a_b > 1.0 ? 0xFF
-            : (Channel)Math::Round( a_b * 0xFF ) ) {}
+        : a( ChannelFromFloat( a_a ) ), r( ChannelFromFloat( a_r ) ),
+          g( ChannelFromFloat( a_g ) ), b( ChannelFromFloat( a_b ) ) {}
     Hex( FourChannelInt a_i ) : i( a_i ) {}
     Hex& operator=( FourChannelInt a_i )
     {
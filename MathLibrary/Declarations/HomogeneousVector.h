@@ -8,8 +8,8 @@
  *                      transformed vector = original vector * transform matrix,
  *                      instead of transform matrix * original vector as it
  *                      would be if column vectors were used.
- * Last Modified:      February 10, 2014
- * Last Modification:  Templatizing PointVector.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Replaced coordinate reference members with accessors.
  ******************************************************************************/
 
 #ifndef HOMOGENEOUS_VECTOR__H
@@ -34,13 +34,8 @@ public:
     typedef BaseType::BaseType RootType;
     typedef PointVector< double > PointType;
 
-    // destructor
-    virtual ~HomogeneousVector();
-
     // Constructors that forward to base class constructors
     HomogeneousVector();
-    HomogeneousVector( const HomogeneousVector& ac_roVector );
-    HomogeneousVector( HomogeneousVector&& a_rroVector );
     HomogeneousVector( const RootType& ac_roMatrix );
     template< typename U, unsigned int Q, bool t_bOtherIsRow >
     HomogeneousVector( const Vector< U, Q, t_bOtherIsRow >& ac_roVector,
@@ -104,10 +99,14 @@ public:
     static const HomogeneousVector& Origin();
 
     // public access to X, Y, Z, and H coordinates
-    double& x;
-    double& y;
-    double& z;
-    double& h;
+    double& x() { return m_aaData[0][0]; }
+    double& y() { return m_aaData[0][1]; }
+    double& z() { return m_aaData[0][2]; }
+    double& h() { return m_aaData[0][3]; }
+    const double& x() const { return m_aaData[0][0]; }
+    const double& y() const { return m_aaData[0][1]; }
+    const double& z() const { return m_aaData[0][2]; }
+    const double& h() const { return m_aaData[0][3]; }
 
 };  // HomogeneousVector
 typedef HomogeneousVector HVector;
@@ -132,13 +131,8 @@ public:
     typedef BaseType::BaseType RootType;
     typedef PointVector< double > PointType;
 
-    // destructor
-    virtual ~HomogeneousVector();
-
     // Constructors that forward to base class constructors
     HomogeneousVector();
-    HomogeneousVector( const HomogeneousVector& ac_roVector );
-    HomogeneousVector( HomogeneousVector&& a_rroVector );
     HomogeneousVector( const RootType& ac_roMatrix );
     template< typename U, unsigned int Q, bool t_bOtherIsRow >
     HomogeneousVector( const Vector< U, Q, t_bOtherIsRow >& ac_roVector,
@@ -206,9 +200,12 @@ public:
     static const HomogeneousVector& Origin();
 
     // public access to X, Y, and H coordinates
-    double& x;
-    double& y;
-    double& h;
+    double& x() { return m_aaData[0][0]; }
+    double& y() { return m_aaData[0][1]; }
+    double& h() { return m_aaData[0][2]; }
+    const double& x() const { return m_aaData[0][0]; }
+    const double& y() const { return m_aaData[0][1]; }
+    const double& h() const { return m_aaData[0][2]; }
 
 };  // HomogeneousVector
 typedef HomogeneousVector HVector;
@@ -3,15 +3,18 @@
  * Author:             Elizabeth Lowry
  * Date Created:       November 18, 2013
  * Description:        Base class for matrices of numeric type.
- * Last Modified:      February 24, 2014
- * Last Modification:  MostDerivedAddress moved to Utility namespace.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added flat element access.
  ******************************************************************************/
 
 #ifndef MATRIX__H
 #define MATRIX__H
 
+#include "ElementKernels.h"
 #include "Functions.h"
-#include "MostDerivedAddress.h"
+#include "MatrixExpression.h"
+#include "MatrixInverse.h"
+#include "MatrixProduct.h"
 #include <iostream>
 #include <type_traits>  // for enable_if and is_scalar
 
@@ -23,8 +26,12 @@ template< typename T, unsigned int N, bool t_bIsRow/* = true*/ >
 class Vector;
 
 // Represents a matrix of values of a set type with set dimensions.
+// There are no virtual functions, no reference members, and no user-defined
+// copy constructor, assignment operator, or destructor anywhere in the
+// hierarchy, so a matrix (or vector, point, or transform) is laid out exactly
+// like its element array and can be memcpy'd or uploaded to a GL buffer as-is.
 template< typename T, unsigned int M, unsigned int N = M >
-class Matrix : public Utility::MostDerivedAddress
+class Matrix
 {
 public:
 
@@ -36,17 +43,14 @@ public:
     typedef Matrix< InverseT, N, M > InverseType;
     typedef Matrix< T, N, M > TransposeType;
 
-    // destructor
-    virtual ~Matrix();
-    
-    // Construct/assign from a differently-sized/typed matrix
+    // Construct/assign from a differently-sized/typed matrix - copying a matrix
+    // of the same type uses the implicit (trivial) copy constructor and
+    // assignment operator.
     template< typename U, unsigned int P, unsigned int Q >
     Matrix( const Matrix< U, P, Q >& ac_roMatrix,
             const T& ac_rFill = DefaultValue< T >() );
     template< typename U, unsigned int P, unsigned int Q >
     Matrix& operator=( const Matrix< U, P, Q >& ac_roMatrix );
-    Matrix& operator=( const Matrix& ac_roMatrix )
-    { return operator=< T, M, N >( ac_roMatrix ); }
 
     // Construct/assign all values equal to parameter
     Matrix( const T& ac_rFill = DefaultValue< T >() );
@@ -98,6 +102,11 @@ public:
     T& At( unsigned int a_uiRow, unsigned int a_uiColumn );
     const T& At( unsigned int a_uiRow, unsigned int a_uiColumn ) const;
 
+    // Unchecked access to all M*N elements as one row-major array, for loops
+    // that already know their indices are in range
+    T* Data();
+    const T* Data() const;
+
     // Get row/column vectors - redefine non-virtually in child classes to
     // return correct type, since return type is concrete and not a pointer or
     // reference.
@@ -222,6 +231,11 @@ public:
 
 protected:
 
+    // Other sizes and types of matrix need access to the element array so
+    // multiplication can run directly over the raw data
+    template< typename U, unsigned int P, unsigned int Q >
+    friend class Matrix;
+
     // if not invertable by given method, change nothing & return false
     bool LeftInverse( InverseType& a_roMatrix ) const;
     bool RightInverse( InverseType& a_roMatrix ) const;
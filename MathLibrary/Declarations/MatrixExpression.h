@@ -0,0 +1,221 @@
+/******************************************************************************
+ * File:               MatrixExpression.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Expression templates for element-wise matrix math.
+ *                      Each node computes one element on request, so a whole
+ *                      chain of operations runs as a single loop over the
+ *                      destination's elements with no temporary matrices.
+ *                      The Matrix and Vector operators evaluate through these
+ *                      nodes; to fuse a longer chain, wrap its operands with
+ *                      Lazy():
+ *                        Matrix< double, 4 > m = Lazy( a ) + Lazy( b ) * s - c;
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef MATRIX_EXPRESSION__H
+#define MATRIX_EXPRESSION__H
+
+#include "Functions.h"
+#include <type_traits>  // for enable_if and is_scalar
+
+namespace Math
+{
+
+// Forward declare matrix type
+template< typename T, unsigned int M, unsigned int N >
+class Matrix;
+
+// Leaf node - the elements of an existing matrix, in row-major order
+template< typename T >
+class ElementArray
+{
+public:
+    explicit ElementArray( const T* ac_cpData );
+    T operator[]( unsigned int a_uiIndex ) const;
+private:
+    const T* m_cpData;
+};
+
+// Element-wise sum and difference of two expressions
+template< typename T, typename L, typename R >
+class ElementSum
+{
+public:
+    ElementSum( const L& ac_roLeft, const R& ac_roRight );
+    T operator[]( unsigned int a_uiIndex ) const;
+private:
+    L m_oLeft;
+    R m_oRight;
+};
+template< typename T, typename L, typename R >
+class ElementDifference
+{
+public:
+    ElementDifference( const L& ac_roLeft, const R& ac_roRight );
+    T operator[]( unsigned int a_uiIndex ) const;
+private:
+    L m_oLeft;
+    R m_oRight;
+};
+
+// Scalar multiplication, division, and modulo.  As with the compound
+// assignment operators, each result element is converted back to type T.
+template< typename T, typename E, typename U >
+class ElementProduct
+{
+public:
+    ElementProduct( const E& ac_roElements, const U& ac_rScalar );
+    T operator[]( unsigned int a_uiIndex ) const;
+private:
+    E m_oElements;
+    U m_uScalar;
+};
+template< typename T, typename E, typename U >
+class ElementQuotient
+{
+public:
+    ElementQuotient( const E& ac_roElements, const U& ac_rScalar );
+    T operator[]( unsigned int a_uiIndex ) const;
+private:
+    E m_oElements;
+    U m_uScalar;
+};
+template< typename T, typename E, typename U >
+class ElementModulo
+{
+public:
+    ElementModulo( const E& ac_roElements, const U& ac_rScalar );
+    T operator[]( unsigned int a_uiIndex ) const;
+private:
+    E m_oElements;
+    U m_uScalar;
+};
+
+// Negation
+template< typename T, typename E >
+class ElementNegation
+{
+public:
+    explicit ElementNegation( const E& ac_roElements );
+    T operator[]( unsigned int a_uiIndex ) const;
+private:
+    E m_oElements;
+};
+
+// Linear interpolation, a + ( b - a ) * progress
+template< typename T, typename L, typename R >
+class ElementInterpolation
+{
+public:
+    ElementInterpolation( const L& ac_roPointA, const R& ac_roPointB,
+                          float a_fProgress );
+    T operator[]( unsigned int a_uiIndex ) const;
+private:
+    L m_oPointA;
+    R m_oPointB;
+    float m_fProgress;
+};
+
+// An element-wise expression with the dimensions of an MxN matrix.  Nothing
+// is computed until the expression is assigned to or converted into a matrix.
+template< typename E, typename T, unsigned int M, unsigned int N >
+class MatrixExpression
+{
+public:
+
+    // simplify typing
+    typedef Matrix< T, M, N > MatrixType;
+
+    explicit MatrixExpression( const E& ac_roElements );
+
+    // Compute a single element, by row-major index
+    T operator[]( unsigned int a_uiIndex ) const;
+
+    // Evaluate into a matrix in a single loop.  Every element of the result
+    // depends only on the same element of each operand, so it's safe to
+    // assign the expression to one of its own operands.
+    operator MatrixType() const;
+    MatrixType Evaluate() const;
+    MatrixType& AssignTo( MatrixType& a_roMatrix ) const;
+
+    // Treat the same elements as a matrix of different dimensions, such as a
+    // row vector as a column vector
+    template< unsigned int P, unsigned int Q >
+    MatrixExpression< E, T, P, Q > Reshaped() const;
+
+    // Addition and subtraction
+    template< typename F >
+    MatrixExpression< ElementSum< T, E, F >, T, M, N >
+        operator+( const MatrixExpression< F, T, M, N >& ac_roOther ) const;
+    MatrixExpression< ElementSum< T, E, ElementArray< T > >, T, M, N >
+        operator+( const MatrixType& ac_roMatrix ) const;
+    template< typename F >
+    MatrixExpression< ElementDifference< T, E, F >, T, M, N >
+        operator-( const MatrixExpression< F, T, M, N >& ac_roOther ) const;
+    MatrixExpression< ElementDifference< T, E, ElementArray< T > >, T, M, N >
+        operator-( const MatrixType& ac_roMatrix ) const;
+
+    // Scalar multiplication, division, and modulo
+    MatrixExpression< ElementNegation< T, E >, T, M, N > operator-() const;
+    template< typename U >
+    typename std::enable_if< std::is_scalar< U >::value,
+                             MatrixExpression< ElementProduct< T, E, U >,
+                                               T, M, N > >::type
+        operator*( const U& ac_rScalar ) const;
+    template< typename U >
+    typename std::enable_if< std::is_scalar< U >::value,
+                             MatrixExpression< ElementQuotient< T, E, U >,
+                                               T, M, N > >::type
+        operator/( const U& ac_rScalar ) const;
+    template< typename U >
+    typename std::enable_if< std::is_scalar< U >::value,
+                             MatrixExpression< ElementModulo< T, E, U >,
+                                               T, M, N > >::type
+        operator%( const U& ac_rScalar ) const;
+
+private:
+
+    // Other expressions need access to the element node to build on it
+    template< typename F, typename U, unsigned int P, unsigned int Q >
+    friend class MatrixExpression;
+
+    E m_oElements;
+
+};
+
+// Start an expression from an existing matrix
+template< typename T, unsigned int M, unsigned int N >
+MatrixExpression< ElementArray< T >, T, M, N >
+    Lazy( const Matrix< T, M, N >& ac_roMatrix );
+
+// Linear interpolation between two matrices as an expression
+template< typename T, unsigned int M, unsigned int N >
+MatrixExpression< ElementInterpolation< T, ElementArray< T >,
+                                        ElementArray< T > >, T, M, N >
+    Interpolation( const Matrix< T, M, N >& ac_roPointA,
+                   const Matrix< T, M, N >& ac_roPointB,
+                   float a_fProgress = 0.5f );
+
+// Linear interpolation between two matrices in a single loop, instead of the
+// three temporaries the general version in Functions.h would create
+template< typename T, unsigned int M, unsigned int N >
+Matrix< T, M, N > Interpolate( const Matrix< T, M, N >& ac_roPointA,
+                               const Matrix< T, M, N >& ac_roPointB,
+                               float a_fProgress = 0.5f );
+
+}   // namespace Math
+
+// Expression scalar multiplication in the other direction
+template< typename U, typename E, typename T, unsigned int M, unsigned int N >
+typename std::enable_if<
+    std::is_scalar< U >::value,
+    Math::MatrixExpression< Math::ElementProduct< T, E, U >, T, M, N > >::type
+    operator*( const U& ac_rScalar,
+               const Math::MatrixExpression< E, T, M, N >& ac_roExpression );
+
+// Always include template function implementations with this header
+#include "../Implementations/MatrixExpression.inl"
+
+#endif  // MATRIX_EXPRESSION__H
@@ -0,0 +1,110 @@
+/******************************************************************************
+ * File:               MatrixInverse.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Kernels for determinants and inverses of raw matrix
+ *                      element arrays.  Up to 4x4 uses closed-form cofactor
+ *                      expansions, larger matrices use LU decomposition with
+ *                      partial pivoting.  Also has fast paths for inverting
+ *                      affine and rigid transforms.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Determinant and inverse delegate to LU decomposition.
+ ******************************************************************************/
+
+#ifndef MATRIX_INVERSE__H
+#define MATRIX_INVERSE__H
+
+#include "Decomposition.h"
+#include "Functions.h"
+
+namespace Math
+{
+
+// General case is a non-square matrix, which has no determinant or true
+// inverse.
+template< typename T, unsigned int M, unsigned int N >
+struct MatrixInverse
+{
+    typedef typename InverseOf< T >::Type InverseT;
+
+    // Returns 0 for non-square matrices
+    static T Determinant( const T (&ac_raaMatrix)[ M ][ N ] );
+
+    // If the matrix isn't invertable, returns false without changing the
+    // result array.  Always returns false for non-square matrices.
+    static bool Invert( const T (&ac_raaMatrix)[ M ][ N ],
+                        InverseT (&a_raaInverse)[ N ][ M ] );
+};
+
+// Square matrices larger than 4x4 use LU decomposition with partial pivoting,
+// which is O(N^3) instead of the O(N!) of recursive cofactor expansion.  To
+// solve against the same matrix more than once, keep an LU< T, N > instead.
+template< typename T, unsigned int N >
+struct MatrixInverse< T, N, N >
+{
+    typedef typename InverseOf< T >::Type InverseT;
+
+    static T Determinant( const T (&ac_raaMatrix)[ N ][ N ] );
+    static bool Invert( const T (&ac_raaMatrix)[ N ][ N ],
+                        InverseT (&a_raaInverse)[ N ][ N ] );
+};
+
+// Closed-form small cases
+template< typename T >
+struct MatrixInverse< T, 1, 1 >
+{
+    typedef typename InverseOf< T >::Type InverseT;
+    static T Determinant( const T (&ac_raaMatrix)[ 1 ][ 1 ] );
+    static bool Invert( const T (&ac_raaMatrix)[ 1 ][ 1 ],
+                        InverseT (&a_raaInverse)[ 1 ][ 1 ] );
+};
+template< typename T >
+struct MatrixInverse< T, 2, 2 >
+{
+    typedef typename InverseOf< T >::Type InverseT;
+    static T Determinant( const T (&ac_raaMatrix)[ 2 ][ 2 ] );
+    static bool Invert( const T (&ac_raaMatrix)[ 2 ][ 2 ],
+                        InverseT (&a_raaInverse)[ 2 ][ 2 ] );
+};
+template< typename T >
+struct MatrixInverse< T, 3, 3 >
+{
+    typedef typename InverseOf< T >::Type InverseT;
+    static T Determinant( const T (&ac_raaMatrix)[ 3 ][ 3 ] );
+    static bool Invert( const T (&ac_raaMatrix)[ 3 ][ 3 ],
+                        InverseT (&a_raaInverse)[ 3 ][ 3 ] );
+};
+template< typename T >
+struct MatrixInverse< T, 4, 4 >
+{
+    typedef typename InverseOf< T >::Type InverseT;
+    static T Determinant( const T (&ac_raaMatrix)[ 4 ][ 4 ] );
+    static bool Invert( const T (&ac_raaMatrix)[ 4 ][ 4 ],
+                        InverseT (&a_raaInverse)[ 4 ][ 4 ] );
+};
+
+// Inverses of NxN homogeneous transforms that don't project, meaning their
+// last column is ( 0, ..., 0, 1 ).  With row vectors, such a transform maps
+// p to p*L + t, where L is the upper-left (N-1)x(N-1) block and t is the last
+// row, so its inverse maps p to p*L^-1 - t*L^-1 and only L has to be inverted.
+template< typename T, unsigned int N >
+struct TransformInverse
+{
+    typedef typename InverseOf< T >::Type InverseT;
+
+    // If L isn't invertable, returns false without changing the result array.
+    static bool Affine( const T (&ac_raaTransform)[ N ][ N ],
+                        InverseT (&a_raaInverse)[ N ][ N ] );
+
+    // For transforms that are known to be only rotation and translation, L is
+    // orthogonal, so L^-1 is just L transposed.
+    static void Rigid( const T (&ac_raaTransform)[ N ][ N ],
+                       InverseT (&a_raaInverse)[ N ][ N ] );
+};
+
+}   // namespace Math
+
+// Always include template function implementations with this header
+#include "../Implementations/MatrixInverse.inl"
+
+#endif  // MATRIX_INVERSE__H
@@ -0,0 +1,116 @@
+/******************************************************************************
+ * File:               MatrixProduct.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Kernels for multiplying raw matrix element arrays.
+ *                      Square 2x2, 3x3, and 4x4 products are fully unrolled,
+ *                      and 4x4 float and double products use SSE2 or AVX when
+ *                      the processor supports it.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef MATRIX_PRODUCT__H
+#define MATRIX_PRODUCT__H
+
+#include "ImExportMacro.h"
+
+namespace Math
+{
+
+// Instruction sets the 4x4 kernels know how to use, from least to most capable
+enum SimdLevel
+{
+    SIMD_NONE,
+    SIMD_SSE2,
+    SIMD_AVX
+};
+
+// Best instruction set supported by both the processor and the operating
+// system.  Detected once and cached.
+IMEXPORT SimdLevel DetectedSimdLevel();
+
+// Unrolled products of square element arrays.  Terms are summed left to right
+// starting from column 0, which is the order the SIMD kernels use too, so
+// results are bit-identical as long as the library is built with SSE2 scalar
+// floating point (/arch:SSE2 or x64) instead of x87.
+// a_raaResult must not be the same array as either operand.
+template< typename T >
+void UnrolledProduct( const T (&ac_raaLeft)[ 2 ][ 2 ],
+                      const T (&ac_raaRight)[ 2 ][ 2 ],
+                      T (&a_raaResult)[ 2 ][ 2 ] );
+template< typename T >
+void UnrolledProduct( const T (&ac_raaLeft)[ 3 ][ 3 ],
+                      const T (&ac_raaRight)[ 3 ][ 3 ],
+                      T (&a_raaResult)[ 3 ][ 3 ] );
+template< typename T >
+void UnrolledProduct( const T (&ac_raaLeft)[ 4 ][ 4 ],
+                      const T (&ac_raaRight)[ 4 ][ 4 ],
+                      T (&a_raaResult)[ 4 ][ 4 ] );
+
+// 4x4 products using the best available instruction set, capped at the given
+// level.  Lowering the cap is only useful for testing the fallback paths.
+IMEXPORT void SimdProduct( const double (&ac_raadLeft)[ 4 ][ 4 ],
+                           const double (&ac_raadRight)[ 4 ][ 4 ],
+                           double (&a_raadResult)[ 4 ][ 4 ],
+                           SimdLevel a_eMaxLevel = SIMD_AVX );
+IMEXPORT void SimdProduct( const float (&ac_raafLeft)[ 4 ][ 4 ],
+                           const float (&ac_raafRight)[ 4 ][ 4 ],
+                           float (&a_raafResult)[ 4 ][ 4 ],
+                           SimdLevel a_eMaxLevel = SIMD_AVX );
+
+// Picks the fastest kernel for the given dimensions at compile time.  The
+// general case loops straight over the element arrays, without building row
+// and column vectors.
+template< typename T, unsigned int M, unsigned int N, unsigned int P >
+struct MatrixProduct
+{
+    static void Multiply( const T (&ac_raaLeft)[ M ][ N ],
+                          const T (&ac_raaRight)[ N ][ P ],
+                          T (&a_raaResult)[ M ][ P ] );
+};
+template< typename T >
+struct MatrixProduct< T, 2, 2, 2 >
+{
+    static void Multiply( const T (&ac_raaLeft)[ 2 ][ 2 ],
+                          const T (&ac_raaRight)[ 2 ][ 2 ],
+                          T (&a_raaResult)[ 2 ][ 2 ] );
+};
+template< typename T >
+struct MatrixProduct< T, 3, 3, 3 >
+{
+    static void Multiply( const T (&ac_raaLeft)[ 3 ][ 3 ],
+                          const T (&ac_raaRight)[ 3 ][ 3 ],
+                          T (&a_raaResult)[ 3 ][ 3 ] );
+};
+template< typename T >
+struct MatrixProduct< T, 4, 4, 4 >
+{
+    static void Multiply( const T (&ac_raaLeft)[ 4 ][ 4 ],
+                          const T (&ac_raaRight)[ 4 ][ 4 ],
+                          T (&a_raaResult)[ 4 ][ 4 ] );
+};
+template<>
+struct MatrixProduct< double, 4, 4, 4 >
+{
+    static void Multiply( const double (&ac_raadLeft)[ 4 ][ 4 ],
+                          const double (&ac_raadRight)[ 4 ][ 4 ],
+                          double (&a_raadResult)[ 4 ][ 4 ] );
+};
+template<>
+struct MatrixProduct< float, 4, 4, 4 >
+{
+    static void Multiply( const float (&ac_raafLeft)[ 4 ][ 4 ],
+                          const float (&ac_raafRight)[ 4 ][ 4 ],
+                          float (&a_raafResult)[ 4 ][ 4 ] );
+};
+
+}   // namespace Math
+
+// Always include template function implementations with this header
+#include "../Implementations/MatrixProduct_Templates.inl"
+#ifdef INLINE_IMPLEMENTATION
+#include "../Implementations/MatrixProduct.inl"
+#endif
+
+#endif  // MATRIX_PRODUCT__H
@@ -8,8 +8,8 @@
  *                      transformed point = original point * transform matrix,
  *                      instead of transform matrix * original point as it
  *                      would be if column vectors were used.
- * Last Modified:      February 12, 2014
- * Last Modification:  Refactoring.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Zero, unit, and origin points are returned by value.
  ******************************************************************************/
 
 #ifndef POINT_VECTOR__H
@@ -36,13 +36,8 @@ public:
     typedef Vector< T, 2 > BaseType;
     typedef BaseType::BaseType RootType;
 
-    // destructor
-    virtual ~PointVector();
-
     // Constructors that forward to base class constructors
     PointVector();
-    PointVector( const PointVector& ac_roVector );
-    PointVector( PointVector&& a_rroVector );
     PointVector( const RootType& ac_roMatrix );
     template< typename U, unsigned int Q, bool t_bOtherIsRow >
     PointVector( const Vector< U, Q, t_bOtherIsRow >& ac_roVector,
@@ -68,12 +63,19 @@ public:
     PointVector( const HomogeneousVector& ac_roVector );
     PointVector& operator=( const HomogeneousVector& ac_roVector );
 
-    // Origin of the coordinate system
-    static const PointVector& Origin();
+    // Zero, unit, and origin points - these hide the base class versions so
+    // that default arguments of type const Point& don't convert a vector into
+    // a temporary point on every call.  They're built on the spot instead of
+    // being kept in function-local statics.
+    static PointVector Zero();
+    static PointVector Unit( unsigned int a_uiAxis );
+    static PointVector Origin();
 
     // public access to X and Y coordinates
-    T& x;
-    T& y;
+    T& x() { return m_aaData[0][0]; }
+    T& y() { return m_aaData[0][1]; }
+    const T& x() const { return m_aaData[0][0]; }
+    const T& y() const { return m_aaData[0][1]; }
 
 };   // Plane::PointVector
 typedef PointVector< double > Point;
@@ -103,13 +105,8 @@ public:
     typedef Vector< T, 3 > BaseType;
     typedef BaseType::BaseType RootType;
 
-    // destructor
-    virtual ~PointVector();
-
     // Constructors that forward to base class constructors
     PointVector();
-    PointVector( const PointVector& ac_roVector );
-    PointVector( PointVector&& a_rroVector );
     PointVector( const RootType& ac_roMatrix );
     template< typename U, unsigned int Q, bool t_bOtherIsRow >
     PointVector( const Vector< U, Q, t_bOtherIsRow >& ac_roVector,
@@ -135,13 +132,21 @@ public:
     PointVector( const HomogeneousVector& ac_roVector );
     PointVector& operator=( const HomogeneousVector& ac_roVector );
 
-    // Origin of the coordinate system
-    static const PointVector& Origin();
+    // Zero, unit, and origin points - these hide the base class versions so
+    // that default arguments of type const Point& don't convert a vector into
+    // a temporary point on every call.  They're built on the spot instead of
+    // being kept in function-local statics.
+    static PointVector Zero();
+    static PointVector Unit( unsigned int a_uiAxis );
+    static PointVector Origin();
 
     // public access to X, Y, and Z coordinates
-    T& x;
-    T& y;
-    T& z;
+    T& x() { return m_aaData[0][0]; }
+    T& y() { return m_aaData[0][1]; }
+    T& z() { return m_aaData[0][2]; }
+    const T& x() const { return m_aaData[0][0]; }
+    const T& y() const { return m_aaData[0][1]; }
+    const T& z() const { return m_aaData[0][2]; }
 
 };   // Space::PointVector
 typedef PointVector< double > Point;
@@ -162,5 +167,11 @@ EXTERN_T_INST template class IMEXPORT_T_INST Plane::PointVector< int >;
 EXTERN_T_INST template class IMEXPORT_T_INST Space::PointVector< double >;
 EXTERN_T_INST template class IMEXPORT_T_INST Space::PointVector< int >;
 
+// Points are stored as bare coordinate arrays
+static_assert( sizeof( Point2D ) == 2 * sizeof( double ),
+               "Point2D must be a bare array of two doubles" );
+static_assert( sizeof( Point3D ) == 3 * sizeof( double ),
+               "Point3D must be a bare array of three doubles" );
+
 
 #endif // POINT_VECTOR__H
\ No newline at end of file
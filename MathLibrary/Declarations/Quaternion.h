@@ -6,13 +6,14 @@
  *                      For a rotation of A radians about a normalized axis
  *                      {{Bx,By,Bz}}, the resulting quaternion {{w,x,y,z}} would
  *                      be {{cos(A/2),sin(A/2)Bx,sin(A/2)By,sin(A/2)Bz}}.
- * Last Modified:      March 5, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added SetFast.
  ******************************************************************************/
 
 #ifndef QUATERNION__H
 #define QUATERNION__H
 
+#include "AffineTransform.h"
 #include "PointVector.h"
 #include "Transform.h"
 #include "Vector.h"
@@ -22,25 +23,30 @@
 namespace Space
 {
 
+// Terms of the polynomial SlerpFast uses to approximate each weight, from
+// Eberly's paper:  u[i] = 1/((i+1)(2i+3)) and v[i] = (i+1)/(2i+3), with the
+// last pair scaled to make up for the terms left off.
+const unsigned int SLERP_FAST_TERMS = 8;
+const double SLERP_FAST_CORRECTION = 1.85298109240830;
+const double SLERP_FAST_U[ SLERP_FAST_TERMS ] =
+    { 1.0 / 3, 1.0 / 10, 1.0 / 21, 1.0 / 36, 1.0 / 55, 1.0 / 78, 1.0 / 105,
+      SLERP_FAST_CORRECTION / 136 };
+const double SLERP_FAST_V[ SLERP_FAST_TERMS ] =
+    { 1.0 / 3, 2.0 / 5, 3.0 / 7, 4.0 / 9, 5.0 / 11, 6.0 / 13, 7.0 / 15,
+      SLERP_FAST_CORRECTION * 8 / 17 };
+
 // Represents a quaternion
 class IMEXPORT_CLASS Quaternion : protected Math::Vector< double, 4 >
 {
 public:
 
     // Constructors
-    Quaternion( const Quaternion& ac_roQuaternion );
     Quaternion( double a_dAngle = 0.0,
                 const Point3D& ac_roAxis = Point3D::Unit(2) );
     Quaternion( double a_dYaw, double a_dPitch, double a_dRoll = 0.0 );
     Quaternion( const Point3D& ac_roForward,
                 const Point3D& ac_roUp = Point3D::Zero() );
 
-    // Destructor
-    virtual ~Quaternion();
-
-    // Assignment
-    Quaternion& operator=( const Quaternion& ac_roQuaternion );
-
     // Equality and inequality checks
     bool operator==( const Quaternion& ac_roQuaternion ) const;
     bool operator!=( const Quaternion& ac_roQuaternion ) const;
@@ -91,6 +97,12 @@ public:
                      const Point3D& ac_roUp = Point3D::Zero() );
     Quaternion& Set( double a_dYaw, double a_dPitch, double a_dRoll = 0.0 );
 
+    // Set entire quaternion with Math::Fast::SinCos and Vector::NormalizeFast
+    // instead of the standard library, for rotations rebuilt every frame.
+    Quaternion& SetFast( double a_dAngle,
+                         const Point3D& ac_roAxis = Point3D::Unit(2) );
+    Quaternion& SetFast( double a_dYaw, double a_dPitch, double a_dRoll );
+
     // Apply this rotation to the given point
     Point3D AppliedTo( const Point3D& ac_roPoint ) const;
     Point3D& ApplyTo( Point3D& a_roPoint ) const;
@@ -106,7 +118,9 @@ public:
     // Keep the quaternion Normalized
     Quaternion& Normalize();
 
-    // Spherical linear interpolation
+    // Spherical linear interpolation, the shorter way around.  Rotations less
+    // than about 3.6 degrees apart are interpolated linearly and normalized,
+    // since dividing by the sine of such a small angle loses precision.
     Quaternion Slerped( const Quaternion& ac_roQuaternion,
                         double a_dProgress = 0.5f ) const;
     Quaternion& Slerp( const Quaternion& ac_roQuaternion,
@@ -118,11 +132,21 @@ public:
                        double a_dRadiansPerSecond, double a_dSeconds,
                        bool a_bClamp = true );
 
+    // Spherical linear interpolation without trig functions, using a
+    // polynomial approximation of the interpolation weights (Eberly, "A Fast
+    // and Accurate Algorithm for Computing SLERP").  For progress in [0,1],
+    // each weight is within 2e-5 of the exact one; the result is normalized.
+    Quaternion SlerpedFast( const Quaternion& ac_roQuaternion,
+                            double a_dProgress = 0.5 ) const;
+    Quaternion& SlerpFast( const Quaternion& ac_roQuaternion,
+                           double a_dProgress = 0.5 );
+
     // Turn into transform
     Transform3D MakeTransform() const;
     void MakeTransform( Transform3D& a_roTransform ) const;
     PointTransform3D MakePointTransform() const;
     void MakePointTransform( PointTransform3D& a_roTransform ) const;
+    Affine3D MakeAffineTransform() const;
 
     // Rotation by PI radians about the given axis (default is z-axis)
     static const Quaternion& Half( unsigned int a_uiAxis = 2 );
@@ -142,17 +166,39 @@ protected:
     Quaternion( const BaseType& ac_roVector );
     Quaternion& operator=( const BaseType& ac_roVector );
 
-    // references to members
-    double& w;  // m_aaData[0][0]
-    double& x;  // m_aaData[0][1]
-    double& y;  // m_aaData[0][2]
-    double& z;  // m_aaData[0][3]
+    // element access
+    double& w() { return m_aaData[0][0]; }
+    double& x() { return m_aaData[0][1]; }
+    double& y() { return m_aaData[0][2]; }
+    double& z() { return m_aaData[0][3]; }
+    const double& w() const { return m_aaData[0][0]; }
+    const double& x() const { return m_aaData[0][1]; }
+    const double& y() const { return m_aaData[0][2]; }
+    const double& z() const { return m_aaData[0][3]; }
 
 };  // class Quaternion
 
+// Scale, then rotate, then translate.  Builds the transform directly from the
+// components instead of multiplying scale, rotation, and translation matrices.
+IMEXPORT AffineTransform ComposeTRS( const Point& ac_roScale,
+                                     const Quaternion& ac_roRotation,
+                                     const Point& ac_roPosition );
+IMEXPORT AffineTransform& ComposeTRS( const Point& ac_roScale,
+                                      const Quaternion& ac_roRotation,
+                                      const Point& ac_roPosition,
+                                      AffineTransform& a_roTransform );
+IMEXPORT Transform& ComposeTRS( const Point& ac_roScale,
+                                const Quaternion& ac_roRotation,
+                                const Point& ac_roPosition,
+                                Transform& a_roTransform );
+
 }   // namespace Space
 typedef Space::Quaternion Rotation3D;
 
+// A quaternion is just its four elements
+static_assert( sizeof( Rotation3D ) == 4 * sizeof( double ),
+               "Quaternion must be a bare array of four doubles" );
+
 // Quaternion scalar multiplication and division in the other direction
 template< typename T >
 typename std::enable_if< std::is_scalar< T >::value, Space::Quaternion >::type
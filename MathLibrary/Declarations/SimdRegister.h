@@ -0,0 +1,311 @@
+/******************************************************************************
+ * File:               SimdRegister.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Register types and operations for writing a kernel once
+ *                      and running it with SSE2, AVX, or plain scalars.  Each
+ *                      type has the same static functions, so a kernel
+ *                      templated on the register type compiles to the same
+ *                      arithmetic at every width, and a one-wide scalar
+ *                      version can finish off any remainder with exactly the
+ *                      same results.  Registers are passed by reference, since
+ *                      32-bit builds can't pass more than three by value.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added Subtract to the AVX float register.
+ ******************************************************************************/
+
+#ifndef SIMD_REGISTER__H
+#define SIMD_REGISTER__H
+
+#include <cmath>
+#include <cstring>  // for memcpy
+
+// Same instruction set conditions as MatrixProduct.inl - AVX intrinsics only
+// from Visual Studio 2010 SP1 on, and only ever called after checking that
+// the processor supports them.
+#if defined _M_IX86 || defined _M_X64
+#define SIMD_REGISTER_SSE2
+#include <emmintrin.h>
+#if defined _MSC_FULL_VER && _MSC_FULL_VER >= 160040219
+#define SIMD_REGISTER_AVX
+#include <immintrin.h>
+#endif
+#endif
+
+namespace Math
+{
+
+// Bit patterns used by the double-precision types.  Adding and then
+// subtracting ROUNDING_CONSTANT rounds any value less than 2^51 in magnitude to
+// the nearest integer, and leaves that integer in the low bits of the sum.
+const double ROUNDING_CONSTANT = 6755399441055744.0;    // 1.5 * 2^52
+const long long RSQRT_MAGIC = 0x5FE6EB50C7B537A9LL;
+const long long EXPONENT_BIAS = 1023;
+const int EXPONENT_SHIFT = 52;
+
+// Plain doubles, one at a time
+struct ScalarDoubleRegister
+{
+    typedef double ElementType;
+    typedef double Type;
+    typedef bool Mask;
+    static const unsigned int WIDTH = 1;
+    static Type Set( double a_dValue ) { return a_dValue; }
+    static Type Load( const double* ac_pdData ) { return *ac_pdData; }
+    static void Store( double* a_pdData, const Type& ac_rdValue )
+    { *a_pdData = ac_rdValue; }
+    static Type Add( const Type& ac_rdA, const Type& ac_rdB )
+    { return ac_rdA + ac_rdB; }
+    static Type Subtract( const Type& ac_rdA, const Type& ac_rdB )
+    { return ac_rdA - ac_rdB; }
+    static Type Multiply( const Type& ac_rdA, const Type& ac_rdB )
+    { return ac_rdA * ac_rdB; }
+    static Type Divide( const Type& ac_rdA, const Type& ac_rdB )
+    { return ac_rdA / ac_rdB; }
+    static Type Sqrt( const Type& ac_rdA ) { return std::sqrt( ac_rdA ); }
+    static Type Abs( const Type& ac_rdA ) { return std::abs( ac_rdA ); }
+    static Type Min( const Type& ac_rdA, const Type& ac_rdB )
+    { return ( ac_rdA < ac_rdB ? ac_rdA : ac_rdB ); }
+    static Type Max( const Type& ac_rdA, const Type& ac_rdB )
+    { return ( ac_rdA > ac_rdB ? ac_rdA : ac_rdB ); }
+    // A with its sign flipped wherever the sign bit of B is set
+    static Type FlipSign( const Type& ac_rdA, const Type& ac_rdSign )
+    {
+        long long llA, llSign;
+        std::memcpy( &llA, &ac_rdA, sizeof( double ) );
+        std::memcpy( &llSign, &ac_rdSign, sizeof( double ) );
+        llA ^= ( llSign & ( 1LL << 63 ) );
+        double dResult;
+        std::memcpy( &dResult, &llA, sizeof( double ) );
+        return dResult;
+    }
+    static Mask Greater( const Type& ac_rdA, const Type& ac_rdB )
+    { return ac_rdA > ac_rdB; }
+    static bool AllEqual( const Type& ac_rdA, const Type& ac_rdB )
+    { return ac_rdA == ac_rdB; }
+    static Type Select( const Mask& ac_rbMask,
+                        const Type& ac_rdIfTrue, const Type& ac_rdIfFalse )
+    { return ( ac_rbMask ? ac_rdIfTrue : ac_rdIfFalse ); }
+    // Starting guess for 1/sqrt(A), within about 3.5%
+    static Type RsqrtEstimate( const Type& ac_rdA )
+    {
+        long long llBits;
+        std::memcpy( &llBits, &ac_rdA, sizeof( double ) );
+        llBits = RSQRT_MAGIC - ( llBits >> 1 );
+        double dResult;
+        std::memcpy( &dResult, &llBits, sizeof( double ) );
+        return dResult;
+    }
+    // 2^N, given N + ROUNDING_CONSTANT for an integer N in [-1022,1023]
+    static Type PowerOfTwo( const Type& ac_rdRounded )
+    {
+        long long llBits;
+        std::memcpy( &llBits, &ac_rdRounded, sizeof( double ) );
+        llBits = ( llBits + EXPONENT_BIAS ) << EXPONENT_SHIFT;
+        double dResult;
+        std::memcpy( &dResult, &llBits, sizeof( double ) );
+        return dResult;
+    }
+    static void Finish() {}
+};
+
+// Plain values of any arithmetic type, one at a time, for kernels that only
+// need the basic arithmetic.  Results are converted back to T, as they would
+// be by the compound assignment operators.
+template< typename T >
+struct ScalarRegister
+{
+    typedef T ElementType;
+    typedef T Type;
+    static const unsigned int WIDTH = 1;
+    static Type Set( const T& ac_rValue ) { return ac_rValue; }
+    static Type Load( const T* ac_pData ) { return *ac_pData; }
+    static void Store( T* a_pData, const Type& ac_rValue )
+    { *a_pData = ac_rValue; }
+    static Type Add( const Type& ac_rA, const Type& ac_rB )
+    { return T( ac_rA + ac_rB ); }
+    static Type Subtract( const Type& ac_rA, const Type& ac_rB )
+    { return T( ac_rA - ac_rB ); }
+    static Type Multiply( const Type& ac_rA, const Type& ac_rB )
+    { return T( ac_rA * ac_rB ); }
+    static Type Divide( const Type& ac_rA, const Type& ac_rB )
+    { return T( ac_rA / ac_rB ); }
+    static void Finish() {}
+};
+
+#ifdef SIMD_REGISTER_SSE2
+
+// 64-bit integer constants for SSE2 - _mm_set1_epi64x isn't available to
+// 32-bit builds
+inline __m128i SimdInt64( long long a_llValue )
+{
+    return _mm_set_epi32( (int)( a_llValue >> 32 ), (int)a_llValue,
+                          (int)( a_llValue >> 32 ), (int)a_llValue );
+}
+
+// Integer parts of the double-precision operations, shared with AVX (which
+// has no 256-bit integer instructions)
+inline __m128d SseRsqrtEstimate( const __m128d& ac_roA )
+{
+    return _mm_castsi128_pd(
+        _mm_sub_epi64( SimdInt64( RSQRT_MAGIC ),
+                       _mm_srli_epi64( _mm_castpd_si128( ac_roA ), 1 ) ) );
+}
+inline __m128d SsePowerOfTwo( const __m128d& ac_roRounded )
+{
+    return _mm_castsi128_pd(
+        _mm_slli_epi64( _mm_add_epi64( _mm_castpd_si128( ac_roRounded ),
+                                       SimdInt64( EXPONENT_BIAS ) ),
+                        EXPONENT_SHIFT ) );
+}
+
+struct SseFloatRegister
+{
+    typedef float ElementType;
+    typedef __m128 Type;
+    static const unsigned int WIDTH = 4;
+    static Type Set( float a_fValue ) { return _mm_set1_ps( a_fValue ); }
+    static Type Load( const float* ac_pfData )
+    { return _mm_loadu_ps( ac_pfData ); }
+    static void Store( float* a_pfData, const Type& ac_roValue )
+    { _mm_storeu_ps( a_pfData, ac_roValue ); }
+    static Type Add( const Type& ac_roA, const Type& ac_roB )
+    { return _mm_add_ps( ac_roA, ac_roB ); }
+    static Type Subtract( const Type& ac_roA, const Type& ac_roB )
+    { return _mm_sub_ps( ac_roA, ac_roB ); }
+    static Type Multiply( const Type& ac_roA, const Type& ac_roB )
+    { return _mm_mul_ps( ac_roA, ac_roB ); }
+    static Type Divide( const Type& ac_roA, const Type& ac_roB )
+    { return _mm_div_ps( ac_roA, ac_roB ); }
+    static bool AllEqual( const Type& ac_roA, const Type& ac_roB )
+    { return 0xF == _mm_movemask_ps( _mm_cmpeq_ps( ac_roA, ac_roB ) ); }
+    static void Finish() {}
+};
+struct SseDoubleRegister
+{
+    typedef double ElementType;
+    typedef __m128d Type;
+    typedef __m128d Mask;
+    static const unsigned int WIDTH = 2;
+    static Type Set( double a_dValue ) { return _mm_set1_pd( a_dValue ); }
+    static Type Load( const double* ac_pdData )
+    { return _mm_loadu_pd( ac_pdData ); }
+    static void Store( double* a_pdData, const Type& ac_roValue )
+    { _mm_storeu_pd( a_pdData, ac_roValue ); }
+    static Type Add( const Type& ac_roA, const Type& ac_roB )
+    { return _mm_add_pd( ac_roA, ac_roB ); }
+    static Type Subtract( const Type& ac_roA, const Type& ac_roB )
+    { return _mm_sub_pd( ac_roA, ac_roB ); }
+    static Type Multiply( const Type& ac_roA, const Type& ac_roB )
+    { return _mm_mul_pd( ac_roA, ac_roB ); }
+    static Type Divide( const Type& ac_roA, const Type& ac_roB )
+    { return _mm_div_pd( ac_roA, ac_roB ); }
+    static Type Sqrt( const Type& ac_roA ) { return _mm_sqrt_pd( ac_roA ); }
+    static Type Abs( const Type& ac_roA )
+    { return _mm_andnot_pd( _mm_set1_pd( -0.0 ), ac_roA ); }
+    static Type Min( const Type& ac_roA, const Type& ac_roB )
+    { return _mm_min_pd( ac_roA, ac_roB ); }
+    static Type Max( const Type& ac_roA, const Type& ac_roB )
+    { return _mm_max_pd( ac_roA, ac_roB ); }
+    static Type FlipSign( const Type& ac_roA, const Type& ac_roSign )
+    { return _mm_xor_pd( ac_roA, _mm_and_pd( _mm_set1_pd( -0.0 ),
+                                             ac_roSign ) ); }
+    static Mask Greater( const Type& ac_roA, const Type& ac_roB )
+    { return _mm_cmpgt_pd( ac_roA, ac_roB ); }
+    static bool AllEqual( const Type& ac_roA, const Type& ac_roB )
+    { return 0x3 == _mm_movemask_pd( _mm_cmpeq_pd( ac_roA, ac_roB ) ); }
+    static Type Select( const Mask& ac_roMask,
+                        const Type& ac_roIfTrue, const Type& ac_roIfFalse )
+    { return _mm_or_pd( _mm_and_pd( ac_roMask, ac_roIfTrue ),
+                        _mm_andnot_pd( ac_roMask, ac_roIfFalse ) ); }
+    static Type RsqrtEstimate( const Type& ac_roA )
+    { return SseRsqrtEstimate( ac_roA ); }
+    static Type PowerOfTwo( const Type& ac_roRounded )
+    { return SsePowerOfTwo( ac_roRounded ); }
+    static void Finish() {}
+};
+
+#endif  // SIMD_REGISTER_SSE2
+
+#ifdef SIMD_REGISTER_AVX
+
+struct AvxFloatRegister
+{
+    typedef float ElementType;
+    typedef __m256 Type;
+    static const unsigned int WIDTH = 8;
+    static Type Set( float a_fValue ) { return _mm256_set1_ps( a_fValue ); }
+    static Type Load( const float* ac_pfData )
+    { return _mm256_loadu_ps( ac_pfData ); }
+    static void Store( float* a_pfData, const Type& ac_roValue )
+    { _mm256_storeu_ps( a_pfData, ac_roValue ); }
+    static Type Add( const Type& ac_roA, const Type& ac_roB )
+    { return _mm256_add_ps( ac_roA, ac_roB ); }
+    static Type Subtract( const Type& ac_roA, const Type& ac_roB )
+    { return _mm256_sub_ps( ac_roA, ac_roB ); }
+    static Type Multiply( const Type& ac_roA, const Type& ac_roB )
+    { return _mm256_mul_ps( ac_roA, ac_roB ); }
+    static Type Divide( const Type& ac_roA, const Type& ac_roB )
+    { return _mm256_div_ps( ac_roA, ac_roB ); }
+    static void Finish() { _mm256_zeroupper(); }
+};
+struct AvxDoubleRegister
+{
+    typedef double ElementType;
+    typedef __m256d Type;
+    typedef __m256d Mask;
+    static const unsigned int WIDTH = 4;
+    static Type Set( double a_dValue ) { return _mm256_set1_pd( a_dValue ); }
+    static Type Load( const double* ac_pdData )
+    { return _mm256_loadu_pd( ac_pdData ); }
+    static void Store( double* a_pdData, const Type& ac_roValue )
+    { _mm256_storeu_pd( a_pdData, ac_roValue ); }
+    static Type Add( const Type& ac_roA, const Type& ac_roB )
+    { return _mm256_add_pd( ac_roA, ac_roB ); }
+    static Type Subtract( const Type& ac_roA, const Type& ac_roB )
+    { return _mm256_sub_pd( ac_roA, ac_roB ); }
+    static Type Multiply( const Type& ac_roA, const Type& ac_roB )
+    { return _mm256_mul_pd( ac_roA, ac_roB ); }
+    static Type Divide( const Type& ac_roA, const Type& ac_roB )
+    { return _mm256_div_pd( ac_roA, ac_roB ); }
+    static Type Sqrt( const Type& ac_roA ) { return _mm256_sqrt_pd( ac_roA ); }
+    static Type Abs( const Type& ac_roA )
+    { return _mm256_andnot_pd( _mm256_set1_pd( -0.0 ), ac_roA ); }
+    static Type Min( const Type& ac_roA, const Type& ac_roB )
+    { return _mm256_min_pd( ac_roA, ac_roB ); }
+    static Type Max( const Type& ac_roA, const Type& ac_roB )
+    { return _mm256_max_pd( ac_roA, ac_roB ); }
+    static Type FlipSign( const Type& ac_roA, const Type& ac_roSign )
+    { return _mm256_xor_pd( ac_roA, _mm256_and_pd( _mm256_set1_pd( -0.0 ),
+                                                   ac_roSign ) ); }
+    static Mask Greater( const Type& ac_roA, const Type& ac_roB )
+    { return _mm256_cmp_pd( ac_roA, ac_roB, _CMP_GT_OQ ); }
+    static Type Select( const Mask& ac_roMask,
+                        const Type& ac_roIfTrue, const Type& ac_roIfFalse )
+    { return _mm256_blendv_pd( ac_roIfFalse, ac_roIfTrue, ac_roMask ); }
+    // AVX has no 256-bit integer instructions, so these work on each half
+    static Type RsqrtEstimate( const Type& ac_roA )
+    {
+        return Join( SseRsqrtEstimate( _mm256_castpd256_pd128( ac_roA ) ),
+                     SseRsqrtEstimate( _mm256_extractf128_pd( ac_roA, 1 ) ) );
+    }
+    static Type PowerOfTwo( const Type& ac_roRounded )
+    {
+        return Join(
+            SsePowerOfTwo( _mm256_castpd256_pd128( ac_roRounded ) ),
+            SsePowerOfTwo( _mm256_extractf128_pd( ac_roRounded, 1 ) ) );
+    }
+    static void Finish() { _mm256_zeroupper(); }
+private:
+    static Type Join( const __m128d& ac_roLow, const __m128d& ac_roHigh )
+    {
+        return _mm256_insertf128_pd( _mm256_castpd128_pd256( ac_roLow ),
+                                     ac_roHigh, 1 );
+    }
+};
+
+#endif  // SIMD_REGISTER_AVX
+
+}   // namespace Math
+
+#endif  // SIMD_REGISTER__H
@@ -0,0 +1,200 @@
+/******************************************************************************
+ * File:               SparseMatrix.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Matrix that stores only its non-zero elements, in
+ *                      compressed sparse row (CSR) form: each row's column
+ *                      indices and values are contiguous and sorted by
+ *                      column, and an offset array marks where each row
+ *                      starts.  Built from lists of (row, column, value)
+ *                      triplets.  Products with vectors split rows across
+ *                      OpenMP threads.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Builder entries now append with PushBack.
+ ******************************************************************************/
+
+#ifndef SPARSE_MATRIX__H
+#define SPARSE_MATRIX__H
+
+#include "DenseMatrix.h"
+#include "DenseVector.h"
+#include "DynamicArray.h"
+#include "Functions.h"
+#include "Matrix.h"
+#include "Vector.h"
+#include <stdexcept>
+#include <type_traits>  // for is_arithmetic
+
+namespace Math
+{
+
+// Products with fewer stored elements than this aren't worth starting threads
+// for.  Rows are handed out SPARSE_ROW_CHUNK at a time, since rows can have
+// very different numbers of elements.
+const unsigned int SPARSE_THREAD_WORK = 32768;
+const unsigned int SPARSE_ROW_CHUNK = 256;
+
+// One element of a sparse matrix
+template< typename T >
+struct SparseEntry
+{
+    SparseEntry() : uiRow( 0 ), uiColumn( 0 ), tValue( 0 ) {}
+    SparseEntry( unsigned int a_uiRow, unsigned int a_uiColumn,
+                 const T& ac_rValue )
+        : uiRow( a_uiRow ), uiColumn( a_uiColumn ), tValue( ac_rValue ) {}
+    unsigned int uiRow;
+    unsigned int uiColumn;
+    T tValue;
+};
+
+// Forward declare so the builder can build one
+template< typename T >
+class SparseMatrix;
+
+// Collects triplets in any order for building a sparse matrix.  Triplets for
+// the same element are added together when the matrix is built, the way
+// finite-element and constraint assembly expects.
+template< typename T >
+class SparseBuilder
+{
+public:
+
+    SparseBuilder( unsigned int a_uiRows, unsigned int a_uiColumns,
+                   unsigned int a_uiCapacity = 0 );
+
+    // Dimensions of the matrix being built
+    unsigned int Rows() const { return m_uiRows; }
+    unsigned int Columns() const { return m_uiColumns; }
+
+    // Number of triplets added so far
+    unsigned int Count() const { return m_oEntries.Size(); }
+
+    // Make room for at least the given number of triplets
+    SparseBuilder& Reserve( unsigned int a_uiCapacity );
+
+    // Add a triplet.  Throws std::out_of_range if the element is outside the
+    // matrix.
+    SparseBuilder& Add( unsigned int a_uiRow, unsigned int a_uiColumn,
+                        const T& ac_rValue );
+
+    // Forget all triplets, keeping the dimensions and the memory
+    SparseBuilder& Clear();
+
+    // Sort and combine the triplets into a matrix
+    SparseMatrix< T > Build() const;
+
+private:
+
+    unsigned int m_uiRows;
+    unsigned int m_uiColumns;
+    Utility::DynamicArray< SparseEntry< T > > m_oEntries;
+
+};
+
+// Matrix of arithmetic values with dimensions set at runtime, storing only
+// elements that were given values.  Operations with mismatched dimensions
+// throw std::invalid_argument.
+template< typename T >
+class SparseMatrix
+{
+    static_assert( std::is_arithmetic< T >::value,
+                   "SparseMatrix elements must be arithmetic values" );
+
+public:
+
+    // Empty matrix with no stored elements
+    SparseMatrix();
+    SparseMatrix( unsigned int a_uiRows, unsigned int a_uiColumns );
+
+    // Build from triplets in any order, adding together triplets for the same
+    // element.  Throws std::out_of_range if any triplet is outside the matrix.
+    SparseMatrix( unsigned int a_uiRows, unsigned int a_uiColumns,
+                  const SparseEntry< T >* ac_poEntries,
+                  unsigned int a_uiCount );
+
+    // Store the non-zero elements of a dense matrix
+    template< unsigned int M, unsigned int N >
+    SparseMatrix( const Matrix< T, M, N >& ac_roMatrix );
+    SparseMatrix( const DenseMatrix< T >& ac_roMatrix );
+
+    // Copy and destroy
+    SparseMatrix( const SparseMatrix& ac_roMatrix );
+    SparseMatrix& operator=( const SparseMatrix& ac_roMatrix );
+    ~SparseMatrix();
+
+    // Dimensions
+    unsigned int Rows() const { return m_uiRows; }
+    unsigned int Columns() const { return m_uiColumns; }
+    bool IsSquare() const { return m_uiRows == m_uiColumns; }
+
+    // Number of stored elements
+    unsigned int NonZeros() const { return m_puiRowStart[ m_uiRows ]; }
+
+    // Raw CSR arrays.  The elements of row i are at indices RowStarts()[i] up
+    // to RowStarts()[i+1] of ColumnIndices() and Values().
+    const unsigned int* RowStarts() const { return m_puiRowStart; }
+    const unsigned int* ColumnIndices() const { return m_puiColumn; }
+    T* Values() { return m_pValue; }
+    const T* Values() const { return m_pValue; }
+
+    // Element at the given row and column, or 0 if it isn't stored.  Throws
+    // std::out_of_range if the element is outside the matrix.
+    T At( unsigned int a_uiRow, unsigned int a_uiColumn ) const;
+
+    // Diagonal elements, including zeroes for ones that aren't stored
+    DenseVector< T > Diagonal() const;
+
+    // Transpose
+    SparseMatrix Transpose() const;
+
+    // All elements, including zeroes
+    DenseMatrix< T > ToDense() const;
+
+    // Compute this * x for a column vector x with one element per column of
+    // this matrix, writing one element per row to the result.  The result
+    // must not overlap x.  Unchecked, for solvers that have already checked.
+    void Multiply( const T* ac_pVector, T* a_pResult ) const;
+
+    // Compute this * x, checking sizes
+    DenseVector< T > operator*( const DenseVector< T >& ac_roVector ) const;
+    template< unsigned int N, bool t_bIsRow >
+    DenseVector< T >
+        operator*( const Vector< T, N, t_bIsRow >& ac_roVector ) const;
+    template< unsigned int M, unsigned int N, bool t_bIsRow >
+    void Multiply( const Vector< T, N, t_bIsRow >& ac_roVector,
+                   Vector< T, M, t_bIsRow >& a_roResult ) const;
+
+    // Scalar multiplication and division of the stored elements
+    template< typename U >
+    typename std::enable_if< std::is_scalar< U >::value, SparseMatrix& >::type
+        operator*=( const U& ac_rScalar );
+    template< typename U >
+    typename std::enable_if< std::is_scalar< U >::value, SparseMatrix& >::type
+        operator/=( const U& ac_rScalar );
+
+private:
+
+    // Allocate arrays for the given dimensions and number of elements
+    void Allocate( unsigned int a_uiRows, unsigned int a_uiColumns,
+                   unsigned int a_uiNonZeros );
+
+    // Free arrays
+    void Free();
+
+    // Throw if the given vector size doesn't match the number of columns
+    void CheckColumns( unsigned int a_uiSize ) const;
+
+    unsigned int m_uiRows;
+    unsigned int m_uiColumns;
+    unsigned int* m_puiRowStart;    // m_uiRows + 1 offsets
+    unsigned int* m_puiColumn;
+    T* m_pValue;
+
+};
+
+}   // namespace Math
+
+// Always include template function implementations with this header
+#include "../Implementations/SparseMatrix.inl"
+
+#endif  // SPARSE_MATRIX__H
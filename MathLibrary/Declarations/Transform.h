@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       January 5, 2014
  * Description:        Functions for creating transform matrices.
- * Last Modified:      February 10, 2014
- * Last Modification:  Templatizing PointVector.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added single-precision transform types.
  ******************************************************************************/
 
 #ifndef TRANSFORM__H
@@ -18,6 +18,8 @@
 EXTERN_T_INST template class IMEXPORT_T_INST Math::Matrix< double, 2 >;
 EXTERN_T_INST template class IMEXPORT_T_INST Math::Matrix< double, 3 >;
 EXTERN_T_INST template class IMEXPORT_T_INST Math::Matrix< double, 4 >;
+EXTERN_T_INST template class IMEXPORT_T_INST Math::Matrix< float, 3 >;
+EXTERN_T_INST template class IMEXPORT_T_INST Math::Matrix< float, 4 >;
 
 namespace Plane
 {
@@ -30,11 +32,27 @@ typedef Matrix< double, 3 > Transform;
 typedef Transform HomogeneousTransform;
 typedef Transform HVectorTransform;
 
+// Single-precision transform for uploading to shaders that don't use doubles
+typedef Matrix< float, 3 > FloatTransform;
+
 // Make a transformation that performs the given transformation about a point
 IMEXPORT Transform
    TransformationAbout( const Transform& ac_roTransform,
                         const Point& ac_roOrigin = Point::Origin() );
 
+// Invert a transform that doesn't project, meaning its last column is zero
+// except for a one in the bottom corner.  Only the upper-left block has to be
+// inverted, so this is much cheaper than the general Inverse().  If the
+// transform isn't invertable, the first version returns false without
+// changing the result and the second returns a zero matrix.
+IMEXPORT bool AffineInverse( const Transform& ac_roTransform,
+                             Transform& a_roInverse );
+IMEXPORT Transform AffineInverse( const Transform& ac_roTransform );
+
+// Invert a transform that is known to be only rotation and translation by
+// transposing the rotation and running the negated translation through it.
+IMEXPORT Transform RigidInverse( const Transform& ac_roTransform );
+
 // Scale
 IMEXPORT PointTransform PointScaling( double a_dFactor );
 IMEXPORT Transform
@@ -79,6 +97,7 @@ typedef Plane::PointTransform PointTransform2D;
 typedef Plane::Transform Transform2D;
 typedef Transform2D HomogeneousTransform2D;
 typedef Transform2D HVectorTransform2D;
+typedef Plane::FloatTransform FloatTransform2D;
 
 namespace Space
 {
@@ -91,11 +110,27 @@ typedef Matrix< double, 4 > Transform;
 typedef Transform HomogeneousTransform;
 typedef Transform HVectorTransform;
 
+// Single-precision transform for uploading to shaders that don't use doubles
+typedef Matrix< float, 4 > FloatTransform;
+
 // Make a transformation that performs the given transformation about a point
 IMEXPORT Transform
    TransformationAbout( const Transform& ac_roTransform,
                         const Point& ac_roOrigin = Point::Origin() );
 
+// Invert a transform that doesn't project, meaning its last column is zero
+// except for a one in the bottom corner.  Only the upper-left block has to be
+// inverted, so this is much cheaper than the general Inverse().  If the
+// transform isn't invertable, the first version returns false without
+// changing the result and the second returns a zero matrix.
+IMEXPORT bool AffineInverse( const Transform& ac_roTransform,
+                             Transform& a_roInverse );
+IMEXPORT Transform AffineInverse( const Transform& ac_roTransform );
+
+// Invert a transform that is known to be only rotation and translation by
+// transposing the rotation and running the negated translation through it.
+IMEXPORT Transform RigidInverse( const Transform& ac_roTransform );
+
 // Scale
 IMEXPORT PointTransform PointScaling( double a_dFactor );
 IMEXPORT Transform
@@ -203,6 +238,18 @@ typedef Space::PointTransform PointTransform3D;
 typedef Space::Transform Transform3D;
 typedef Transform2D HomogeneousTransform3D;
 typedef Transform2D HVectorTransform3D;
+typedef Space::FloatTransform FloatTransform3D;
+
+// Transforms are stored as bare element arrays, so they can be handed straight
+// to glUniformMatrix* or copied into a GL buffer
+static_assert( sizeof( Transform2D ) == 9 * sizeof( double ),
+               "Transform2D must be a bare array of nine doubles" );
+static_assert( sizeof( Transform3D ) == 16 * sizeof( double ),
+               "Transform3D must be a bare array of sixteen doubles" );
+static_assert( sizeof( FloatTransform2D ) == 9 * sizeof( float ),
+               "FloatTransform2D must be a bare array of nine floats" );
+static_assert( sizeof( FloatTransform3D ) == 16 * sizeof( float ),
+               "FloatTransform3D must be a bare array of sixteen floats" );
 
 #ifdef INLINE_IMPLEMENTATION
 #include "../Implementations/Transform.inl"
@@ -3,13 +3,14 @@
  * Author:             Elizabeth Lowry
  * Date Created:       November 25, 2013
  * Description:        Base class for vectors of numeric type.
- * Last Modified:      February 12, 2014
- * Last Modification:  Refactoring.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Unit vectors are returned by value.
  ******************************************************************************/
 
 #ifndef VECTOR__H
 #define VECTOR__H
 
+#include "FastFunctions.h"
 #include "Functions.h"
 #include "Matrix.h"
 #include <type_traits>  // for enable_if and is_scalar
@@ -34,9 +35,6 @@ public:
     typedef Vector< T, N, !t_bIsRow > TransposeType;
     typedef Vector< InverseT, N, t_bIsRow > NormalType;
 
-    // destructor
-    virtual ~Vector();
-
     // Constructors that forward to base class constructors
     Vector();
     template< typename U, unsigned int P, unsigned int Q >
@@ -57,8 +55,6 @@ public:
             const T& ac_rFill = DefaultValue< T >() );
     template< typename U, unsigned int Q, bool t_bOtherIsRow >
     Vector& operator=( const Vector< U, Q, t_bOtherIsRow >& ac_roVector );
-    Vector& operator=( const Vector& ac_roMatrix )
-    { return operator=< T, N, t_bIsRow >( ac_roMatrix ); }
 
     // Assign to arrays
     template< typename U, unsigned int P >
@@ -116,10 +112,13 @@ public:
     Vector Cross( const Vector& ac_roVector = Zero() ) const;
     Vector Cross( const TransposeType& ac_roVector ) const;
 
-    // Normalization
+    // Normalization.  Normalize turns a zero vector into NaNs, while
+    // NormalizeFast, which uses Fast::Rsqrt instead of sqrt and division,
+    // leaves it as zeroes.
     InverseT Magnitude() const;
     T MagnitudeSquared() const; // for efficiency in complex calculations
     Vector& Normalize();
+    Vector& NormalizeFast();
     NormalType Normal() const;
 
     // Matrix multiplication and division overrides so the operators won't be
@@ -177,9 +176,10 @@ public:
     Vector operator-( const Vector& ac_roVector ) const;
     Vector operator-( const TransposeType& ac_roVector ) const;
 
-    // constant references to zero and unit vectors
+    // constant reference to the zero vector, and unit vectors built on the
+    // spot, which costs less than checking whether a table has been filled
     static const Vector& Zero();
-    static const Vector& Unit( unsigned int a_uiAxis );
+    static Vector Unit( unsigned int a_uiAxis );
 
     static const unsigned int IS_ROW_VECTOR = t_bIsRow;
     static const unsigned int SIZE = N;
@@ -0,0 +1,216 @@
+/******************************************************************************
+ * File:               VertexData.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compact element types for large vertex and instance
+ *                      buffers: 16-bit half floats and 8- or 16-bit
+ *                      normalized integers, packed into small fixed-size
+ *                      vectors that can be uploaded as-is.  A Half2 texture
+ *                      coordinate is a quarter the size of a Point2D, and a
+ *                      NormalizedShort4 normal is a sixth the size of a
+ *                      Point3D plus padding.
+ *                      Array functions convert whole buffers at once with
+ *                      SSE2 when the processor supports it, giving exactly
+ *                      the same results as converting one element at a time.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef VERTEX_DATA__H
+#define VERTEX_DATA__H
+
+#include "ColorVector.h"
+#include "PointVector.h"
+#include "Vector.h"
+#include "ImExportMacro.h"
+#include <cstdint>
+
+namespace Math
+{
+
+// IEEE 754 half-precision float: 1 sign bit, 5 exponent bits, 10 mantissa
+// bits.  Converting from float or double rounds to the nearest half, ties to
+// even, so values above 65520 become infinity and values below 2^-25 become
+// zero.  NaN stays NaN.  Converting back to float is exact.
+class Half
+{
+public:
+
+    Half() : m_usBits( 0 ) {}
+    Half( float a_fValue );
+    Half( double a_dValue );
+    operator float() const;
+
+    // Raw bits
+    uint16_t Bits() const { return m_usBits; }
+    static Half FromBits( uint16_t a_usBits );
+
+    // Bitwise comparison, so NaN equals NaN and -0 doesn't equal 0
+    bool operator==( const Half& ac_roHalf ) const
+    { return m_usBits == ac_roHalf.m_usBits; }
+    bool operator!=( const Half& ac_roHalf ) const
+    { return m_usBits != ac_roHalf.m_usBits; }
+
+private:
+
+    uint16_t m_usBits;
+
+};
+
+// How each packed element type converts to and from floating point.
+// Unsigned normalized integers cover [0,1] and signed ones cover [-1,1], the
+// way OpenGL reads them with normalization turned on.  Values are clamped to
+// that range and rounded to the nearest integer, halves away from zero; NaN
+// becomes zero.
+template< typename T >
+struct PackedElement;
+template<>
+struct PackedElement< Half >
+{
+    static Half Encode( float a_fValue ) { return Half( a_fValue ); }
+    static Half Encode( double a_dValue ) { return Half( a_dValue ); }
+    static float Decode( Half a_oValue ) { return (float)a_oValue; }
+    static double DecodeDouble( Half a_oValue ) { return (float)a_oValue; }
+};
+template< typename T, int t_iMax, bool t_bIsSigned >
+struct NormalizedElement
+{
+    static const int MAX = t_iMax;
+    static const bool IS_SIGNED = t_bIsSigned;
+    static T Encode( float a_fValue );
+    static T Encode( double a_dValue );
+    static float Decode( T a_tValue );
+    static double DecodeDouble( T a_tValue );
+};
+template<>
+struct PackedElement< uint8_t >
+    : public NormalizedElement< uint8_t, 0xFF, false > {};
+template<>
+struct PackedElement< uint16_t >
+    : public NormalizedElement< uint16_t, 0xFFFF, false > {};
+template<>
+struct PackedElement< int16_t >
+    : public NormalizedElement< int16_t, 0x7FFF, true > {};
+
+// Fixed-size vector of packed elements with no padding, for interleaving
+// into vertex structs or filling whole buffers
+template< typename T, unsigned int N >
+class PackedVector
+{
+public:
+
+    typedef T ElementType;
+    static const unsigned int SIZE = N;
+
+    // All elements zero
+    PackedVector();
+
+    // Pack the elements of a vector of the same size
+    template< typename U, bool t_bIsRow >
+    explicit PackedVector( const Vector< U, N, t_bIsRow >& ac_roVector );
+    template< typename U, bool t_bIsRow >
+    PackedVector& operator=( const Vector< U, N, t_bIsRow >& ac_roVector );
+
+    // Unpack into a vector of the same size
+    template< typename U, bool t_bIsRow >
+    void AssignTo( Vector< U, N, t_bIsRow >& a_roVector ) const;
+
+    // Unpacked element access.  Throws std::out_of_range for a bad index.
+    float operator[]( unsigned int a_uiIndex ) const;
+    PackedVector& Set( unsigned int a_uiIndex, float a_fValue );
+
+    // Raw elements
+    T* Data() { return m_atData; }
+    const T* Data() const { return m_atData; }
+
+    // Element-by-element comparison of the packed values
+    bool operator==( const PackedVector& ac_roVector ) const;
+    bool operator!=( const PackedVector& ac_roVector ) const;
+
+private:
+
+    T m_atData[ N ];
+
+};
+
+// Common vertex attribute types
+typedef PackedVector< Half, 2 > Half2;
+typedef PackedVector< Half, 3 > Half3;
+typedef PackedVector< Half, 4 > Half4;
+typedef PackedVector< uint16_t, 2 > NormalizedUShort2;
+typedef PackedVector< uint16_t, 4 > NormalizedUShort4;
+typedef PackedVector< int16_t, 2 > NormalizedShort2;
+typedef PackedVector< int16_t, 4 > NormalizedShort4;
+typedef PackedVector< uint8_t, 4 > NormalizedUByte4;
+
+// Pack and unpack whole arrays of elements, exactly as PackedElement does
+// one at a time.  Output must not overlap input.
+IMEXPORT void Pack( const float* ac_pfIn, Half* a_poOut,
+                    unsigned int a_uiCount );
+IMEXPORT void Pack( const double* ac_pdIn, Half* a_poOut,
+                    unsigned int a_uiCount );
+IMEXPORT void Pack( const float* ac_pfIn, uint8_t* a_pucOut,
+                    unsigned int a_uiCount );
+IMEXPORT void Pack( const double* ac_pdIn, uint8_t* a_pucOut,
+                    unsigned int a_uiCount );
+IMEXPORT void Pack( const float* ac_pfIn, uint16_t* a_pusOut,
+                    unsigned int a_uiCount );
+IMEXPORT void Pack( const double* ac_pdIn, uint16_t* a_pusOut,
+                    unsigned int a_uiCount );
+IMEXPORT void Pack( const float* ac_pfIn, int16_t* a_psOut,
+                    unsigned int a_uiCount );
+IMEXPORT void Pack( const double* ac_pdIn, int16_t* a_psOut,
+                    unsigned int a_uiCount );
+IMEXPORT void Unpack( const Half* ac_poIn, float* a_pfOut,
+                      unsigned int a_uiCount );
+IMEXPORT void Unpack( const Half* ac_poIn, double* a_pdOut,
+                      unsigned int a_uiCount );
+IMEXPORT void Unpack( const uint8_t* ac_pucIn, float* a_pfOut,
+                      unsigned int a_uiCount );
+IMEXPORT void Unpack( const uint8_t* ac_pucIn, double* a_pdOut,
+                      unsigned int a_uiCount );
+IMEXPORT void Unpack( const uint16_t* ac_pusIn, float* a_pfOut,
+                      unsigned int a_uiCount );
+IMEXPORT void Unpack( const uint16_t* ac_pusIn, double* a_pdOut,
+                      unsigned int a_uiCount );
+IMEXPORT void Unpack( const int16_t* ac_psIn, float* a_pfOut,
+                      unsigned int a_uiCount );
+IMEXPORT void Unpack( const int16_t* ac_psIn, double* a_pdOut,
+                      unsigned int a_uiCount );
+
+// Pack and unpack whole arrays of points and colors
+template< typename T >
+void Pack( const Plane::Point* ac_paoIn, PackedVector< T, 2 >* a_paoOut,
+           unsigned int a_uiCount );
+template< typename T >
+void Pack( const Space::Point* ac_paoIn, PackedVector< T, 3 >* a_paoOut,
+           unsigned int a_uiCount );
+template< typename T >
+void Pack( const Color::ColorVector* ac_paoIn, PackedVector< T, 4 >* a_paoOut,
+           unsigned int a_uiCount );
+template< typename T >
+void Unpack( const PackedVector< T, 2 >* ac_paoIn, Plane::Point* a_paoOut,
+             unsigned int a_uiCount );
+template< typename T >
+void Unpack( const PackedVector< T, 3 >* ac_paoIn, Space::Point* a_paoOut,
+             unsigned int a_uiCount );
+template< typename T >
+void Unpack( const PackedVector< T, 4 >* ac_paoIn,
+             Color::ColorVector* a_paoOut, unsigned int a_uiCount );
+
+}   // namespace Math
+
+// Packed types must be exactly as big as their elements to upload as-is
+static_assert( sizeof( Math::Half ) == 2, "Half must be 16 bits" );
+static_assert( sizeof( Math::Half4 ) == 4 * sizeof( Math::Half ),
+               "PackedVector must be a bare array of its elements" );
+static_assert( sizeof( Math::NormalizedUByte4 ) == 4,
+               "PackedVector must be a bare array of its elements" );
+
+// Always include template and inline function implementations with this header
+#include "../Implementations/VertexData_Templates.inl"
+#ifdef INLINE_IMPLEMENTATION
+#include "../Implementations/VertexData.inl"
+#endif
+
+#endif  // VERTEX_DATA__H
@@ -0,0 +1,641 @@
+/******************************************************************************
+ * File:               AffineTransform.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Inline function implementations for AffineTransform.h.
+ *                      Remember that this library uses row vectors, not column.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Inverse() returns zeroes if not invertable.
+ ******************************************************************************/
+
+#ifndef AFFINE_TRANSFORM__INL
+#define AFFINE_TRANSFORM__INL
+
+#include "../Declarations/AffineTransform.h"
+#include "../Declarations/ImExportMacro.h"
+
+namespace Plane
+{
+
+// Constructors
+INLINE AffineTransform::AffineTransform() : BaseType( 0.0, 1.0 ) {}
+INLINE AffineTransform::AffineTransform( const PointTransform& ac_roLinear,
+                                         const Point& ac_roTranslation )
+{
+    SetLinear( ac_roLinear );
+    SetTranslation( ac_roTranslation );
+}
+INLINE AffineTransform::AffineTransform( const double (&ac_raadData)[ 3 ][ 2 ] )
+    : BaseType( ac_raadData ) {}
+INLINE AffineTransform::AffineTransform( const Transform& ac_roTransform )
+{
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        m_aaData[i][0] = ac_roTransform[i][0];
+        m_aaData[i][1] = ac_roTransform[i][1];
+    }
+}
+
+// Equality and inequality checks
+INLINE bool AffineTransform::
+    operator==( const AffineTransform& ac_roTransform ) const
+{
+    return BaseType::operator==( ac_roTransform );
+}
+INLINE bool AffineTransform::
+    operator!=( const AffineTransform& ac_roTransform ) const
+{
+    return BaseType::operator!=( ac_roTransform );
+}
+
+// Get/set parts
+INLINE PointTransform AffineTransform::GetLinear() const
+{
+    double aadLinear[2][2] = { { m_aaData[0][0], m_aaData[0][1] },
+                               { m_aaData[1][0], m_aaData[1][1] } };
+    return PointTransform( aadLinear );
+}
+INLINE Point AffineTransform::GetTranslation() const
+{
+    return Point( m_aaData[2][0], m_aaData[2][1] );
+}
+INLINE AffineTransform& AffineTransform::
+    SetLinear( const PointTransform& ac_roLinear )
+{
+    m_aaData[0][0] = ac_roLinear[0][0];
+    m_aaData[0][1] = ac_roLinear[0][1];
+    m_aaData[1][0] = ac_roLinear[1][0];
+    m_aaData[1][1] = ac_roLinear[1][1];
+    return *this;
+}
+INLINE AffineTransform& AffineTransform::
+    SetTranslation( const Point& ac_roTranslation )
+{
+    m_aaData[2][0] = ac_roTranslation.x();
+    m_aaData[2][1] = ac_roTranslation.y();
+    return *this;
+}
+
+// Composition - the product of the linear parts, and this translation
+// transformed by the other transform
+INLINE AffineTransform AffineTransform::
+    operator*( const AffineTransform& ac_roTransform ) const
+{
+    const double (&raadR)[ 3 ][ 2 ] = ac_roTransform.m_aaData;
+    double aadResult[3][2];
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        aadResult[i][0] = m_aaData[i][0]*raadR[0][0] +
+                          m_aaData[i][1]*raadR[1][0];
+        aadResult[i][1] = m_aaData[i][0]*raadR[0][1] +
+                          m_aaData[i][1]*raadR[1][1];
+    }
+    aadResult[2][0] += raadR[2][0];
+    aadResult[2][1] += raadR[2][1];
+    return AffineTransform( aadResult );
+}
+INLINE AffineTransform& AffineTransform::
+    operator*=( const AffineTransform& ac_roTransform )
+{
+    return ( *this = *this * ac_roTransform );
+}
+INLINE Transform AffineTransform::
+    operator*( const Transform& ac_roTransform ) const
+{
+    double aadResult[3][3];
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        for( unsigned int j = 0; j < 3; ++j )
+        {
+            aadResult[i][j] = m_aaData[i][0]*ac_roTransform[0][j] +
+                              m_aaData[i][1]*ac_roTransform[1][j];
+        }
+    }
+    for( unsigned int j = 0; j < 3; ++j )
+    {
+        aadResult[2][j] += ac_roTransform[2][j];
+    }
+    return Transform( aadResult );
+}
+
+// Inversion - the inverse maps p to p*L^-1 - t*L^-1
+INLINE bool AffineTransform::Inverse( AffineTransform& a_roTransform ) const
+{
+    double aadLinear[2][2] = { { m_aaData[0][0], m_aaData[0][1] },
+                               { m_aaData[1][0], m_aaData[1][1] } };
+    double aadInverse[2][2];
+    if( !MatrixInverse< double, 2, 2 >::Invert( aadLinear, aadInverse ) )
+    {
+        return false;
+    }
+    // copy the translation first, in case the result is this transform
+    double adTranslation[2] = { m_aaData[2][0], m_aaData[2][1] };
+    double (&raadResult)[ 3 ][ 2 ] = a_roTransform.m_aaData;
+    for( unsigned int j = 0; j < 2; ++j )
+    {
+        raadResult[0][j] = aadInverse[0][j];
+        raadResult[1][j] = aadInverse[1][j];
+        raadResult[2][j] = -( adTranslation[0]*aadInverse[0][j] +
+                              adTranslation[1]*aadInverse[1][j] );
+    }
+    return true;
+}
+INLINE AffineTransform AffineTransform::Inverse() const
+{
+    // if not invertable, return zeroes, the same as Matrix::Inverse()
+    AffineTransform oInverse;
+    if( !Inverse( oInverse ) )
+    {
+        static_cast< BaseType& >( oInverse ) = BaseType::Zero();
+    }
+    return oInverse;
+}
+INLINE bool AffineTransform::Invert()
+{
+    return Inverse( *this );
+}
+INLINE AffineTransform AffineTransform::RigidInverse() const
+{
+    double aadResult[3][2];
+    for( unsigned int j = 0; j < 2; ++j )
+    {
+        aadResult[0][j] = m_aaData[j][0];
+        aadResult[1][j] = m_aaData[j][1];
+        aadResult[2][j] = -( m_aaData[2][0]*m_aaData[j][0] +
+                             m_aaData[2][1]*m_aaData[j][1] );
+    }
+    return AffineTransform( aadResult );
+}
+
+// Apply to points and directions
+INLINE Point AffineTransform::AppliedTo( const Point& ac_roPoint ) const
+{
+    Point oResult( ac_roPoint );
+    return ApplyTo( oResult );
+}
+INLINE Point& AffineTransform::ApplyTo( Point& a_roPoint ) const
+{
+    ApplyToDirection( a_roPoint );
+    a_roPoint.x() += m_aaData[2][0];
+    a_roPoint.y() += m_aaData[2][1];
+    return a_roPoint;
+}
+INLINE Point AffineTransform::
+    AppliedToDirection( const Point& ac_roDirection ) const
+{
+    Point oResult( ac_roDirection );
+    return ApplyToDirection( oResult );
+}
+INLINE Point& AffineTransform::ApplyToDirection( Point& a_roDirection ) const
+{
+    double dX = a_roDirection.x();
+    double dY = a_roDirection.y();
+    a_roDirection.x() = dX*m_aaData[0][0] + dY*m_aaData[1][0];
+    a_roDirection.y() = dX*m_aaData[0][1] + dY*m_aaData[1][1];
+    return a_roDirection;
+}
+
+// Turn into full homogeneous transform
+INLINE Transform AffineTransform::MakeTransform() const
+{
+    Transform oTransform;
+    MakeTransform( oTransform );
+    return oTransform;
+}
+INLINE void AffineTransform::MakeTransform( Transform& a_roTransform ) const
+{
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        a_roTransform[i][0] = m_aaData[i][0];
+        a_roTransform[i][1] = m_aaData[i][1];
+        a_roTransform[i][2] = ( 2 == i ? 1.0 : 0.0 );
+    }
+}
+
+// Transform that does nothing
+INLINE const AffineTransform& AffineTransform::Identity()
+{
+    static AffineTransform soIdentity;
+    return soIdentity;
+}
+
+// Scale
+INLINE AffineTransform AffineScaling( double a_dFactor,
+                                      const Point& ac_roOrigin )
+{
+    return AffineScaling( a_dFactor, a_dFactor, ac_roOrigin );
+}
+INLINE AffineTransform AffineScaling( double a_dX, double a_dY,
+                                      const Point& ac_roOrigin )
+{
+    // about a point, translation is origin - origin*L
+    double aadScale[3][2] = { { a_dX, 0.0 },
+                              { 0.0, a_dY },
+                              { ac_roOrigin.x() * ( 1.0 - a_dX ),
+                                ac_roOrigin.y() * ( 1.0 - a_dY ) } };
+    return AffineTransform( aadScale );
+}
+INLINE AffineTransform AffineScaling( const Point& ac_roFactor,
+                                      const Point& ac_roOrigin )
+{
+    return AffineScaling( ac_roFactor.x(), ac_roFactor.y(), ac_roOrigin );
+}
+
+// Translate
+INLINE AffineTransform AffineTranslation( double a_dX, double a_dY )
+{
+    double aadTranslate[3][2] = { { 1.0, 0.0 }, { 0.0, 1.0 }, { a_dX, a_dY } };
+    return AffineTransform( aadTranslate );
+}
+INLINE AffineTransform AffineTranslation( const Point& ac_roTranslation )
+{
+    return AffineTranslation( ac_roTranslation.x(), ac_roTranslation.y() );
+}
+
+// Rotate
+INLINE AffineTransform AffineRotation( double a_dRadians,
+                                       const Point& ac_roOrigin,
+                                       bool a_bClockwise )
+{
+    AffineTransform oRotate( PointRotation( a_dRadians, a_bClockwise ) );
+    if( ac_roOrigin != Point::Origin() )
+    {
+        oRotate.SetTranslation( ac_roOrigin -
+                                oRotate.AppliedToDirection( ac_roOrigin ) );
+    }
+    return oRotate;
+}
+INLINE AffineTransform AffineDegreeRotation( double a_dDegrees,
+                                             const Point& ac_roOrigin,
+                                             bool a_bClockwise )
+{
+    return AffineRotation( Radians( a_dDegrees ), ac_roOrigin, a_bClockwise );
+}
+
+}   // namespace Plane
+
+// Full transform followed by affine transform
+INLINE Transform2D operator*( const Transform2D& ac_roTransform,
+                              const Plane::AffineTransform& ac_roAffine )
+{
+    double aadResult[3][3];
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        for( unsigned int j = 0; j < 2; ++j )
+        {
+            aadResult[i][j] = ac_roTransform[i][0]*ac_roAffine[0][j] +
+                              ac_roTransform[i][1]*ac_roAffine[1][j] +
+                              ac_roTransform[i][2]*ac_roAffine[2][j];
+        }
+        aadResult[i][2] = ac_roTransform[i][2];
+    }
+    return Transform2D( aadResult );
+}
+
+namespace Space
+{
+
+// Constructors
+INLINE AffineTransform::AffineTransform() : BaseType( 0.0, 1.0 ) {}
+INLINE AffineTransform::AffineTransform( const PointTransform& ac_roLinear,
+                                         const Point& ac_roTranslation )
+{
+    SetLinear( ac_roLinear );
+    SetTranslation( ac_roTranslation );
+}
+INLINE AffineTransform::AffineTransform( const double (&ac_raadData)[ 4 ][ 3 ] )
+    : BaseType( ac_raadData ) {}
+INLINE AffineTransform::AffineTransform( const Transform& ac_roTransform )
+{
+    for( unsigned int i = 0; i < 4; ++i )
+    {
+        m_aaData[i][0] = ac_roTransform[i][0];
+        m_aaData[i][1] = ac_roTransform[i][1];
+        m_aaData[i][2] = ac_roTransform[i][2];
+    }
+}
+
+// Equality and inequality checks
+INLINE bool AffineTransform::
+    operator==( const AffineTransform& ac_roTransform ) const
+{
+    return BaseType::operator==( ac_roTransform );
+}
+INLINE bool AffineTransform::
+    operator!=( const AffineTransform& ac_roTransform ) const
+{
+    return BaseType::operator!=( ac_roTransform );
+}
+
+// Get/set parts
+INLINE PointTransform AffineTransform::GetLinear() const
+{
+    double aadLinear[3][3];
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        aadLinear[i][0] = m_aaData[i][0];
+        aadLinear[i][1] = m_aaData[i][1];
+        aadLinear[i][2] = m_aaData[i][2];
+    }
+    return PointTransform( aadLinear );
+}
+INLINE Point AffineTransform::GetTranslation() const
+{
+    return Point( m_aaData[3][0], m_aaData[3][1], m_aaData[3][2] );
+}
+INLINE AffineTransform& AffineTransform::
+    SetLinear( const PointTransform& ac_roLinear )
+{
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        m_aaData[i][0] = ac_roLinear[i][0];
+        m_aaData[i][1] = ac_roLinear[i][1];
+        m_aaData[i][2] = ac_roLinear[i][2];
+    }
+    return *this;
+}
+INLINE AffineTransform& AffineTransform::
+    SetTranslation( const Point& ac_roTranslation )
+{
+    m_aaData[3][0] = ac_roTranslation.x();
+    m_aaData[3][1] = ac_roTranslation.y();
+    m_aaData[3][2] = ac_roTranslation.z();
+    return *this;
+}
+
+// Composition - the product of the linear parts, and this translation
+// transformed by the other transform
+INLINE AffineTransform AffineTransform::
+    operator*( const AffineTransform& ac_roTransform ) const
+{
+    const double (&raadR)[ 4 ][ 3 ] = ac_roTransform.m_aaData;
+    double aadResult[4][3];
+    for( unsigned int i = 0; i < 4; ++i )
+    {
+        aadResult[i][0] = m_aaData[i][0]*raadR[0][0] +
+                          m_aaData[i][1]*raadR[1][0] +
+                          m_aaData[i][2]*raadR[2][0];
+        aadResult[i][1] = m_aaData[i][0]*raadR[0][1] +
+                          m_aaData[i][1]*raadR[1][1] +
+                          m_aaData[i][2]*raadR[2][1];
+        aadResult[i][2] = m_aaData[i][0]*raadR[0][2] +
+                          m_aaData[i][1]*raadR[1][2] +
+                          m_aaData[i][2]*raadR[2][2];
+    }
+    aadResult[3][0] += raadR[3][0];
+    aadResult[3][1] += raadR[3][1];
+    aadResult[3][2] += raadR[3][2];
+    return AffineTransform( aadResult );
+}
+INLINE AffineTransform& AffineTransform::
+    operator*=( const AffineTransform& ac_roTransform )
+{
+    return ( *this = *this * ac_roTransform );
+}
+INLINE Transform AffineTransform::
+    operator*( const Transform& ac_roTransform ) const
+{
+    double aadResult[4][4];
+    for( unsigned int i = 0; i < 4; ++i )
+    {
+        for( unsigned int j = 0; j < 4; ++j )
+        {
+            aadResult[i][j] = m_aaData[i][0]*ac_roTransform[0][j] +
+                              m_aaData[i][1]*ac_roTransform[1][j] +
+                              m_aaData[i][2]*ac_roTransform[2][j];
+        }
+    }
+    for( unsigned int j = 0; j < 4; ++j )
+    {
+        aadResult[3][j] += ac_roTransform[3][j];
+    }
+    return Transform( aadResult );
+}
+
+// Inversion - the inverse maps p to p*L^-1 - t*L^-1
+INLINE bool AffineTransform::Inverse( AffineTransform& a_roTransform ) const
+{
+    double aadLinear[3][3];
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        aadLinear[i][0] = m_aaData[i][0];
+        aadLinear[i][1] = m_aaData[i][1];
+        aadLinear[i][2] = m_aaData[i][2];
+    }
+    double aadInverse[3][3];
+    if( !MatrixInverse< double, 3, 3 >::Invert( aadLinear, aadInverse ) )
+    {
+        return false;
+    }
+    // copy the translation first, in case the result is this transform
+    double adTranslation[3] = { m_aaData[3][0], m_aaData[3][1],
+                                m_aaData[3][2] };
+    double (&raadResult)[ 4 ][ 3 ] = a_roTransform.m_aaData;
+    for( unsigned int j = 0; j < 3; ++j )
+    {
+        raadResult[0][j] = aadInverse[0][j];
+        raadResult[1][j] = aadInverse[1][j];
+        raadResult[2][j] = aadInverse[2][j];
+        raadResult[3][j] = -( adTranslation[0]*aadInverse[0][j] +
+                              adTranslation[1]*aadInverse[1][j] +
+                              adTranslation[2]*aadInverse[2][j] );
+    }
+    return true;
+}
+INLINE AffineTransform AffineTransform::Inverse() const
+{
+    // if not invertable, return zeroes, the same as Matrix::Inverse()
+    AffineTransform oInverse;
+    if( !Inverse( oInverse ) )
+    {
+        static_cast< BaseType& >( oInverse ) = BaseType::Zero();
+    }
+    return oInverse;
+}
+INLINE bool AffineTransform::Invert()
+{
+    return Inverse( *this );
+}
+INLINE AffineTransform AffineTransform::RigidInverse() const
+{
+    double aadResult[4][3];
+    for( unsigned int j = 0; j < 3; ++j )
+    {
+        aadResult[0][j] = m_aaData[j][0];
+        aadResult[1][j] = m_aaData[j][1];
+        aadResult[2][j] = m_aaData[j][2];
+        aadResult[3][j] = -( m_aaData[3][0]*m_aaData[j][0] +
+                             m_aaData[3][1]*m_aaData[j][1] +
+                             m_aaData[3][2]*m_aaData[j][2] );
+    }
+    return AffineTransform( aadResult );
+}
+
+// Apply to points and directions
+INLINE Point AffineTransform::AppliedTo( const Point& ac_roPoint ) const
+{
+    Point oResult( ac_roPoint );
+    return ApplyTo( oResult );
+}
+INLINE Point& AffineTransform::ApplyTo( Point& a_roPoint ) const
+{
+    ApplyToDirection( a_roPoint );
+    a_roPoint.x() += m_aaData[3][0];
+    a_roPoint.y() += m_aaData[3][1];
+    a_roPoint.z() += m_aaData[3][2];
+    return a_roPoint;
+}
+INLINE Point AffineTransform::
+    AppliedToDirection( const Point& ac_roDirection ) const
+{
+    Point oResult( ac_roDirection );
+    return ApplyToDirection( oResult );
+}
+INLINE Point& AffineTransform::ApplyToDirection( Point& a_roDirection ) const
+{
+    double dX = a_roDirection.x();
+    double dY = a_roDirection.y();
+    double dZ = a_roDirection.z();
+    a_roDirection.x() = dX*m_aaData[0][0] + dY*m_aaData[1][0] +
+                        dZ*m_aaData[2][0];
+    a_roDirection.y() = dX*m_aaData[0][1] + dY*m_aaData[1][1] +
+                        dZ*m_aaData[2][1];
+    a_roDirection.z() = dX*m_aaData[0][2] + dY*m_aaData[1][2] +
+                        dZ*m_aaData[2][2];
+    return a_roDirection;
+}
+
+// Turn into full homogeneous transform
+INLINE Transform AffineTransform::MakeTransform() const
+{
+    Transform oTransform;
+    MakeTransform( oTransform );
+    return oTransform;
+}
+INLINE void AffineTransform::MakeTransform( Transform& a_roTransform ) const
+{
+    for( unsigned int i = 0; i < 4; ++i )
+    {
+        a_roTransform[i][0] = m_aaData[i][0];
+        a_roTransform[i][1] = m_aaData[i][1];
+        a_roTransform[i][2] = m_aaData[i][2];
+        a_roTransform[i][3] = ( 3 == i ? 1.0 : 0.0 );
+    }
+}
+
+// Transform that does nothing
+INLINE const AffineTransform& AffineTransform::Identity()
+{
+    static AffineTransform soIdentity;
+    return soIdentity;
+}
+
+// Scale
+INLINE AffineTransform AffineScaling( double a_dFactor,
+                                      const Point& ac_roOrigin )
+{
+    return AffineScaling( a_dFactor, a_dFactor, a_dFactor, ac_roOrigin );
+}
+INLINE AffineTransform AffineScaling( double a_dX, double a_dY, double a_dZ,
+                                      const Point& ac_roOrigin )
+{
+    // about a point, translation is origin - origin*L
+    double aadScale[4][3] = { { a_dX, 0.0, 0.0 },
+                              { 0.0, a_dY, 0.0 },
+                              { 0.0, 0.0, a_dZ },
+                              { ac_roOrigin.x() * ( 1.0 - a_dX ),
+                                ac_roOrigin.y() * ( 1.0 - a_dY ),
+                                ac_roOrigin.z() * ( 1.0 - a_dZ ) } };
+    return AffineTransform( aadScale );
+}
+INLINE AffineTransform AffineScaling( const Point& ac_roFactor,
+                                      const Point& ac_roOrigin )
+{
+    return AffineScaling( ac_roFactor.x(), ac_roFactor.y(), ac_roFactor.z(),
+                          ac_roOrigin );
+}
+
+// Translate
+INLINE AffineTransform AffineTranslation( double a_dX, double a_dY,
+                                          double a_dZ )
+{
+    double aadTranslate[4][3] = { { 1.0, 0.0, 0.0 },
+                                  { 0.0, 1.0, 0.0 },
+                                  { 0.0, 0.0, 1.0 },
+                                  { a_dX, a_dY, a_dZ } };
+    return AffineTransform( aadTranslate );
+}
+INLINE AffineTransform AffineTranslation( const Point& ac_roTranslation )
+{
+    return AffineTranslation( ac_roTranslation.x(), ac_roTranslation.y(),
+                              ac_roTranslation.z() );
+}
+
+// Rotate
+INLINE AffineTransform AffineRotation( double a_dRadians,
+                                       const Point& ac_roAxis,
+                                       const Point& ac_roOrigin,
+                                       bool a_bClockwise )
+{
+    AffineTransform oRotate( PointRotation( a_dRadians, ac_roAxis,
+                                            a_bClockwise ) );
+    if( ac_roOrigin != Point::Origin() )
+    {
+        oRotate.SetTranslation( ac_roOrigin -
+                                oRotate.AppliedToDirection( ac_roOrigin ) );
+    }
+    return oRotate;
+}
+INLINE AffineTransform AffineRotation( double a_dYaw, double a_dPitch,
+                                       double a_dRoll,
+                                       const Point& ac_roOrigin,
+                                       bool a_bClockwise )
+{
+    AffineTransform oRotate( PointRotation( a_dYaw, a_dPitch, a_dRoll,
+                                            a_bClockwise ) );
+    if( ac_roOrigin != Point::Origin() )
+    {
+        oRotate.SetTranslation( ac_roOrigin -
+                                oRotate.AppliedToDirection( ac_roOrigin ) );
+    }
+    return oRotate;
+}
+INLINE AffineTransform AffineDegreeRotation( double a_dDegrees,
+                                             const Point& ac_roAxis,
+                                             const Point& ac_roOrigin,
+                                             bool a_bClockwise )
+{
+    return AffineRotation( Radians( a_dDegrees ), ac_roAxis, ac_roOrigin,
+                           a_bClockwise );
+}
+INLINE AffineTransform AffineDegreeRotation( double a_dYaw, double a_dPitch,
+                                             double a_dRoll,
+                                             const Point& ac_roOrigin,
+                                             bool a_bClockwise )
+{
+    return AffineRotation( Radians( a_dYaw ), Radians( a_dPitch ),
+                           Radians( a_dRoll ), ac_roOrigin, a_bClockwise );
+}
+
+}   // namespace Space
+
+// Full transform followed by affine transform
+INLINE Transform3D operator*( const Transform3D& ac_roTransform,
+                              const Space::AffineTransform& ac_roAffine )
+{
+    double aadResult[4][4];
+    for( unsigned int i = 0; i < 4; ++i )
+    {
+        for( unsigned int j = 0; j < 3; ++j )
+        {
+            aadResult[i][j] = ac_roTransform[i][0]*ac_roAffine[0][j] +
+                              ac_roTransform[i][1]*ac_roAffine[1][j] +
+                              ac_roTransform[i][2]*ac_roAffine[2][j] +
+                              ac_roTransform[i][3]*ac_roAffine[3][j];
+        }
+        aadResult[i][3] = ac_roTransform[i][3];
+    }
+    return Transform3D( aadResult );
+}
+
+#endif  // AFFINE_TRANSFORM__INL
@@ -0,0 +1,360 @@
+/******************************************************************************
+ * File:               Atom.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Inline function implementations for Atom and the pool
+ *                      of interned strings behind it.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef ATOM__INL
+#define ATOM__INL
+
+#include "../Declarations/Atom.h"
+#include "../Declarations/DynamicArray.h"
+#include "../Declarations/Singleton.h"
+#include <cstring>  // for memcpy
+#include <intrin.h> // for _InterlockedCompareExchange and _InterlockedExchange
+#include <stdexcept>
+#include <utility>  // for move
+#if defined _M_IX86 || defined _M_X64
+#include <emmintrin.h>  // for _mm_pause
+#endif
+
+#include "../Declarations/ImExportMacro.h"
+
+namespace Utility
+{
+
+// Process-wide pool of interned strings.  Adding and finding strings takes a
+// spin lock, since interning mostly happens while loading and hardly ever
+// contends.  Reading an interned string doesn't lock: entries are stored in
+// fixed-size chunks that never move, and the count is only updated after the
+// new entry is complete.
+class AtomPool : public Singleton< AtomPool >
+{
+    friend class Singleton< AtomPool >;
+
+public:
+
+    virtual ~AtomPool();
+
+    // ID for the given characters, adding them if they're new
+    unsigned int Intern( const DumbStringView& ac_roName );
+
+    // ID for the given characters, if they've been added
+    bool Find( const DumbStringView& ac_roName, unsigned int& a_ruiID );
+
+    // Interned strings
+    const char* CString( unsigned int a_uiID ) const
+    { return Get( a_uiID ).pcData; }
+    std::size_t Size( unsigned int a_uiID ) const
+    { return Get( a_uiID ).uiSize; }
+    unsigned int Count() const { return m_uiCount; }
+
+private:
+
+    AtomPool();
+
+    struct Entry
+    {
+        const char* pcData;
+        std::size_t uiSize;
+        std::size_t uiHash;
+    };
+
+    // Entries are stored in chunks of 1024, up to about four million
+    static const unsigned int CHUNK_BITS = 10;
+    static const unsigned int CHUNK_SIZE = 1 << CHUNK_BITS;
+    static const unsigned int MAX_CHUNKS = 4096;
+
+    // Characters are packed end to end in blocks of this size, except for
+    // long strings, which get blocks to themselves
+    static const std::size_t BLOCK_SIZE = 16384;
+
+    // Holds the spin lock for as long as it exists
+    class Lock
+    {
+    public:
+        Lock( volatile long& a_rlFlag );
+        ~Lock();
+    private:
+        Lock& operator=( const Lock& ac_roLock );
+        volatile long& m_rlFlag;
+    };
+
+    // Entry with the given ID - the ID must be less than the count
+    const Entry& Get( unsigned int a_uiID ) const
+    {
+        return m_apoChunks[ a_uiID >> CHUNK_BITS ]
+                          [ a_uiID & ( CHUNK_SIZE - 1 ) ];
+    }
+
+    // The rest must only be called while holding the lock
+
+    // Index slot holding the ID + 1 of the given characters, or the empty
+    // slot where they would go
+    unsigned int& Slot( const DumbStringView& ac_roName );
+
+    // Double the index size and put every entry back in
+    void GrowIndex();
+
+    // Add an entry and return its ID
+    unsigned int Add( const DumbStringView& ac_roName );
+
+    // Keep a null-terminated copy of the given characters
+    const char* Store( const char* ac_pcData, std::size_t a_uiSize );
+
+    Entry* m_apoChunks[ MAX_CHUNKS ];
+    volatile unsigned int m_uiCount;
+    DynamicArray< unsigned int > m_oIndex;  // open addressing, 0 when empty
+    DynamicArray< char* > m_oBlocks;
+    char* m_pcBlock;
+    std::size_t m_uiBlockRemaining;
+    volatile long m_lLock;
+
+};  // class AtomPool
+
+namespace
+{
+
+// Create the pool while the program starts up, since function-local statics
+// aren't created thread-safely
+const AtomPool& sc_roAtomPool = AtomPool::Instance();
+
+}   // namespace
+
+//
+// AtomPool
+//
+
+// Start with the empty string as ID 0
+INLINE AtomPool::AtomPool()
+    : m_uiCount( 0 ), m_oIndex( 1024, 0 ), m_pcBlock( nullptr ),
+      m_uiBlockRemaining( 0 ), m_lLock( 0 )
+{
+    for( unsigned int ui = 0; ui < MAX_CHUNKS; ++ui )
+    {
+        m_apoChunks[ ui ] = nullptr;
+    }
+    Add( DumbStringView() );
+}
+
+// Free all the chunks and blocks
+INLINE AtomPool::~AtomPool()
+{
+    for( unsigned int ui = 0; ui < MAX_CHUNKS; ++ui )
+    {
+        delete[] m_apoChunks[ ui ];
+        m_apoChunks[ ui ] = nullptr;
+    }
+    for( unsigned int ui = 0; ui < m_oBlocks.Size(); ++ui )
+    {
+        delete[] m_oBlocks.Unchecked( ui );
+    }
+    m_oBlocks.Clear();
+    m_uiCount = 0;
+}
+
+// ID for the given characters, adding them if they're new
+INLINE unsigned int AtomPool::Intern( const DumbStringView& ac_roName )
+{
+    if( ac_roName.IsEmpty() )
+    {
+        return 0;
+    }
+    ac_roName.Hash();   // calculate before taking the lock
+    Lock oLock( m_lLock );
+    if( 2 * ( m_uiCount + 1 ) > m_oIndex.Size() )
+    {
+        GrowIndex();
+    }
+    unsigned int& ruiSlot = Slot( ac_roName );
+    if( 0 == ruiSlot )
+    {
+        ruiSlot = Add( ac_roName ) + 1;
+    }
+    return ruiSlot - 1;
+}
+
+// ID for the given characters, if they've been added
+INLINE bool AtomPool::Find( const DumbStringView& ac_roName,
+                            unsigned int& a_ruiID )
+{
+    if( ac_roName.IsEmpty() )
+    {
+        a_ruiID = 0;
+        return true;
+    }
+    ac_roName.Hash();   // calculate before taking the lock
+    Lock oLock( m_lLock );
+    const unsigned int cuiSlot = Slot( ac_roName );
+    if( 0 == cuiSlot )
+    {
+        return false;
+    }
+    a_ruiID = cuiSlot - 1;
+    return true;
+}
+
+// Spin until no one else holds the lock
+INLINE AtomPool::Lock::Lock( volatile long& a_rlFlag ) : m_rlFlag( a_rlFlag )
+{
+    while( 0 != _InterlockedCompareExchange( &m_rlFlag, 1, 0 ) )
+    {
+#if defined _M_IX86 || defined _M_X64
+        _mm_pause();
+#endif
+    }
+}
+INLINE AtomPool::Lock::~Lock()
+{
+    _InterlockedExchange( &m_rlFlag, 0 );
+}
+
+// Index slot for the given characters, probing linearly from their hash
+INLINE unsigned int& AtomPool::Slot( const DumbStringView& ac_roName )
+{
+    const std::size_t cuiHash = ac_roName.Hash();
+    const unsigned int cuiMask = m_oIndex.Size() - 1;
+    for( unsigned int ui = (unsigned int)cuiHash & cuiMask; ;
+         ui = ( ui + 1 ) & cuiMask )
+    {
+        unsigned int& ruiSlot = m_oIndex.Unchecked( ui );
+        if( 0 == ruiSlot )
+        {
+            return ruiSlot;
+        }
+        const Entry& croEntry = Get( ruiSlot - 1 );
+        if( croEntry.uiHash == cuiHash &&
+            croEntry.uiSize == ac_roName.Size() &&
+            0 == std::memcmp( croEntry.pcData, ac_roName.Data(),
+                              croEntry.uiSize ) )
+        {
+            return ruiSlot;
+        }
+    }
+}
+
+// Double the index size and put every entry back in
+INLINE void AtomPool::GrowIndex()
+{
+    DynamicArray< unsigned int > oIndex( 2 * m_oIndex.Size(), 0 );
+    const unsigned int cuiMask = oIndex.Size() - 1;
+    for( unsigned int uiID = 1; uiID < m_uiCount; ++uiID )
+    {
+        unsigned int ui = (unsigned int)Get( uiID ).uiHash & cuiMask;
+        while( 0 != oIndex.Unchecked( ui ) )
+        {
+            ui = ( ui + 1 ) & cuiMask;
+        }
+        oIndex.Unchecked( ui ) = uiID + 1;
+    }
+    m_oIndex = std::move( oIndex );
+}
+
+// Add an entry and return its ID
+INLINE unsigned int AtomPool::Add( const DumbStringView& ac_roName )
+{
+    const unsigned int cuiID = m_uiCount;
+    const unsigned int cuiChunk = cuiID >> CHUNK_BITS;
+    if( cuiChunk >= MAX_CHUNKS )
+    {
+        throw std::length_error( "Too many interned strings" );
+    }
+    if( nullptr == m_apoChunks[ cuiChunk ] )
+    {
+        m_apoChunks[ cuiChunk ] = new Entry[ CHUNK_SIZE ];
+    }
+    Entry& roEntry = m_apoChunks[ cuiChunk ][ cuiID & ( CHUNK_SIZE - 1 ) ];
+    roEntry.pcData = Store( ac_roName.Data(), ac_roName.Size() );
+    roEntry.uiSize = ac_roName.Size();
+    roEntry.uiHash = ac_roName.Hash();
+    m_uiCount = cuiID + 1;  // only now can other threads read the entry
+    return cuiID;
+}
+
+// Keep a null-terminated copy of the given characters
+INLINE const char* AtomPool::Store( const char* ac_pcData,
+                                    std::size_t a_uiSize )
+{
+    char* pcData = nullptr;
+    if( a_uiSize + 1 > BLOCK_SIZE / 4 )
+    {
+        pcData = new char[ a_uiSize + 1 ];
+        m_oBlocks.PushBack( pcData );
+    }
+    else
+    {
+        if( a_uiSize + 1 > m_uiBlockRemaining )
+        {
+            m_pcBlock = new char[ BLOCK_SIZE ];
+            m_oBlocks.PushBack( m_pcBlock );
+            m_uiBlockRemaining = BLOCK_SIZE;
+        }
+        pcData = m_pcBlock;
+        m_pcBlock += a_uiSize + 1;
+        m_uiBlockRemaining -= a_uiSize + 1;
+    }
+    if( 0 < a_uiSize )
+    {
+        std::memcpy( pcData, ac_pcData, a_uiSize );
+    }
+    pcData[ a_uiSize ] = '\0';
+    return pcData;
+}
+
+//
+// Atom
+//
+
+// Intern the given characters
+INLINE Atom::Atom( const char* ac_pcName )
+    : m_uiID( AtomPool::Instance().Intern( DumbStringView( ac_pcName ) ) ) {}
+INLINE Atom::Atom( const DumbStringView& ac_roName )
+    : m_uiID( AtomPool::Instance().Intern( ac_roName ) ) {}
+
+// Interned properties
+INLINE const char* Atom::CString() const
+{
+    return AtomPool::Instance().CString( m_uiID );
+}
+INLINE std::size_t Atom::Size() const
+{
+    return AtomPool::Instance().Size( m_uiID );
+}
+
+// Look for already-interned characters without adding them
+INLINE bool Atom::Find( const DumbStringView& ac_roName, Atom& a_roAtom )
+{
+    unsigned int uiID = 0;
+    if( !AtomPool::Instance().Find( ac_roName, uiID ) )
+    {
+        return false;
+    }
+    a_roAtom.m_uiID = uiID;
+    return true;
+}
+
+// The atom with the given ID
+INLINE Atom Atom::FromID( unsigned int a_uiID )
+{
+    if( a_uiID >= AtomPool::Instance().Count() )
+    {
+        throw std::out_of_range( "No atom has the given ID" );
+    }
+    Atom oAtom;
+    oAtom.m_uiID = a_uiID;
+    return oAtom;
+}
+
+// Number of strings interned so far
+INLINE unsigned int Atom::Count()
+{
+    return AtomPool::Instance().Count();
+}
+
+}   // namespace Utility
+
+#endif  // ATOM__INL
@@ -0,0 +1,147 @@
+/******************************************************************************
+ * File:               AtomMap.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Function implementations for AtomMap.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef ATOM_MAP__INL
+#define ATOM_MAP__INL
+
+#include "../Declarations/AtomMap.h"
+#include <stdexcept>
+#include <utility>  // for move
+
+namespace Utility
+{
+
+// Look up values
+template< typename T >
+bool AtomMap< T >::Has( Atom a_oKey ) const
+{
+    return ( nullptr != Find( a_oKey ) );
+}
+template< typename T >
+T* AtomMap< T >::Find( Atom a_oKey )
+{
+    return const_cast< T* >(
+        static_cast< const AtomMap& >( *this ).Find( a_oKey ) );
+}
+template< typename T >
+const T* AtomMap< T >::Find( Atom a_oKey ) const
+{
+    const unsigned int cuiIndex = LowerBound( a_oKey );
+    if( cuiIndex < m_oKeys.Size() && m_oKeys.Unchecked( cuiIndex ) == a_oKey )
+    {
+        return &m_oValues.Unchecked( cuiIndex );
+    }
+    return nullptr;
+}
+template< typename T >
+T& AtomMap< T >::At( Atom a_oKey )
+{
+    T* ptValue = Find( a_oKey );
+    if( nullptr == ptValue )
+    {
+        throw std::out_of_range( "Key not in map" );
+    }
+    return *ptValue;
+}
+template< typename T >
+const T& AtomMap< T >::At( Atom a_oKey ) const
+{
+    const T* pctValue = Find( a_oKey );
+    if( nullptr == pctValue )
+    {
+        throw std::out_of_range( "Key not in map" );
+    }
+    return *pctValue;
+}
+
+// Value for the given key, adding a default value if the key is new
+template< typename T >
+T& AtomMap< T >::operator[]( Atom a_oKey )
+{
+    const unsigned int cuiIndex = LowerBound( a_oKey );
+    if( cuiIndex < m_oKeys.Size() && m_oKeys.Unchecked( cuiIndex ) == a_oKey )
+    {
+        return m_oValues.Unchecked( cuiIndex );
+    }
+
+    // Make room at the end, then shift later entries down to open a gap
+    m_oKeys.PushBack( a_oKey );
+    m_oValues.EmplaceBack();
+    for( unsigned int ui = m_oKeys.Size() - 1; ui > cuiIndex; --ui )
+    {
+        m_oKeys.Unchecked( ui ) = m_oKeys.Unchecked( ui - 1 );
+        m_oValues.Unchecked( ui ) = std::move( m_oValues.Unchecked( ui - 1 ) );
+    }
+    m_oKeys.Unchecked( cuiIndex ) = a_oKey;
+    m_oValues.Unchecked( cuiIndex ) = T();
+    return m_oValues.Unchecked( cuiIndex );
+}
+
+// Remove the given key
+template< typename T >
+bool AtomMap< T >::Remove( Atom a_oKey )
+{
+    const unsigned int cuiIndex = LowerBound( a_oKey );
+    if( cuiIndex >= m_oKeys.Size() || m_oKeys.Unchecked( cuiIndex ) != a_oKey )
+    {
+        return false;
+    }
+    for( unsigned int ui = cuiIndex + 1; ui < m_oKeys.Size(); ++ui )
+    {
+        m_oKeys.Unchecked( ui - 1 ) = m_oKeys.Unchecked( ui );
+        m_oValues.Unchecked( ui - 1 ) = std::move( m_oValues.Unchecked( ui ) );
+    }
+    m_oKeys.PopBack();
+    m_oValues.PopBack();
+    return true;
+}
+
+// Remove all keys, keeping the memory
+template< typename T >
+AtomMap< T >& AtomMap< T >::Clear()
+{
+    m_oKeys.Clear();
+    m_oValues.Clear();
+    return *this;
+}
+
+// Make room for at least the given number of keys
+template< typename T >
+AtomMap< T >& AtomMap< T >::Reserve( unsigned int a_uiCapacity )
+{
+    m_oKeys.Reserve( a_uiCapacity );
+    m_oValues.Reserve( a_uiCapacity );
+    return *this;
+}
+
+// Binary search over the sorted key IDs
+template< typename T >
+unsigned int AtomMap< T >::LowerBound( Atom a_oKey ) const
+{
+    const Atom* pcoKeys = m_oKeys.Data();
+    unsigned int uiLow = 0;
+    unsigned int uiHigh = m_oKeys.Size();
+    while( uiLow < uiHigh )
+    {
+        const unsigned int cuiMiddle = uiLow + ( uiHigh - uiLow ) / 2;
+        if( pcoKeys[ cuiMiddle ] < a_oKey )
+        {
+            uiLow = cuiMiddle + 1;
+        }
+        else
+        {
+            uiHigh = cuiMiddle;
+        }
+    }
+    return uiLow;
+}
+
+}   // namespace Utility
+
+#endif  // ATOM_MAP__INL
@@ -0,0 +1,994 @@
+/******************************************************************************
+ * File:               BatchTransform.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        SIMD kernels for transforming arrays of 3D points and
+ *                      quaternions.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added transform array functions.
+ ******************************************************************************/
+
+#ifndef BATCH_TRANSFORM__INL
+#define BATCH_TRANSFORM__INL
+
+#include "../Declarations/BatchTransform.h"
+#include "../Declarations/ImExportMacro.h"
+#include "../Declarations/MatrixProduct.h"
+#include "../Declarations/Quaternion.h"
+#include "../Declarations/SimdRegister.h"
+
+namespace Math
+{
+
+// Points are converted between interleaved and separate arrays this many at a
+// time, on the stack
+const unsigned int BATCH_BLOCK_SIZE = 256;
+
+// Batches at least twice this size are split across threads in pieces of this
+// size
+const unsigned int BATCH_THREAD_CHUNK = 16384;
+
+// The transform in the element type, with a flag for whether the results need
+// to be divided by the homogeneous coordinate
+template< typename T >
+struct BatchCoefficients
+{
+    T m_aaData[ 4 ][ 4 ];
+    bool m_bProject;
+};
+
+// Copy a point transform, or the rotation/scale part of one
+template< typename T >
+inline void BatchSetup( const Space::Transform& ac_roTransform,
+                        bool a_bTranslate, BatchCoefficients< T >& a_roResult )
+{
+    for( unsigned int i = 0; i < 4; ++i )
+    {
+        for( unsigned int j = 0; j < 4; ++j )
+        {
+            a_roResult.m_aaData[i][j] =
+                ( ( 3 == i || 3 == j ) && !a_bTranslate )
+                ? T( 3 == i && 3 == j ? 1 : 0 ) : T( ac_roTransform[i][j] );
+        }
+    }
+    a_roResult.m_bProject = ( a_bTranslate &&
+                              ( 0 != ac_roTransform[0][3] ||
+                                0 != ac_roTransform[1][3] ||
+                                0 != ac_roTransform[2][3] ||
+                                1 != ac_roTransform[3][3] ) );
+}
+template< typename T >
+inline void BatchSetup( const Space::Quaternion& ac_roRotation,
+                        BatchCoefficients< T >& a_roResult )
+{
+    Space::PointTransform oRotation;
+    ac_roRotation.MakePointTransform( oRotation );
+    for( unsigned int i = 0; i < 4; ++i )
+    {
+        for( unsigned int j = 0; j < 4; ++j )
+        {
+            a_roResult.m_aaData[i][j] =
+                ( 3 == i || 3 == j ) ? T( 3 == i && 3 == j ? 1 : 0 )
+                                     : T( oRotation[i][j] );
+        }
+    }
+    a_roResult.m_bProject = false;
+}
+
+// One point, with the same summation order as the SIMD kernels so that
+// results don't depend on where in the array a point falls
+template< typename T >
+inline void BatchScalar( const BatchCoefficients< T >& ac_roCoefficients,
+                         const T* ac_pInX, const T* ac_pInY, const T* ac_pInZ,
+                         T* a_pOutX, T* a_pOutY, T* a_pOutZ,
+                         unsigned int a_uiCount )
+{
+    const T (&m)[ 4 ][ 4 ] = ac_roCoefficients.m_aaData;
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        T x = ac_pInX[i], y = ac_pInY[i], z = ac_pInZ[i];
+        T tX = ( x*m[0][0] + y*m[1][0] ) + ( z*m[2][0] + m[3][0] );
+        T tY = ( x*m[0][1] + y*m[1][1] ) + ( z*m[2][1] + m[3][1] );
+        T tZ = ( x*m[0][2] + y*m[1][2] ) + ( z*m[2][2] + m[3][2] );
+        if( ac_roCoefficients.m_bProject )
+        {
+            T tW = ( x*m[0][3] + y*m[1][3] ) + ( z*m[2][3] + m[3][3] );
+            tX /= tW;
+            tY /= tW;
+            tZ /= tW;
+        }
+        a_pOutX[i] = tX;
+        a_pOutY[i] = tY;
+        a_pOutZ[i] = tZ;
+    }
+}
+
+// Transform as many points as fill whole registers and return how many that
+// was.  Every input register is loaded before any output is stored, so the
+// input and output arrays may be the same.
+template< typename R >
+inline unsigned int
+    BatchSimd( const BatchCoefficients< typename R::ElementType >&
+                   ac_roCoefficients,
+               const typename R::ElementType* ac_pInX,
+               const typename R::ElementType* ac_pInY,
+               const typename R::ElementType* ac_pInZ,
+               typename R::ElementType* a_pOutX,
+               typename R::ElementType* a_pOutY,
+               typename R::ElementType* a_pOutZ,
+               unsigned int a_uiCount )
+{
+    typedef typename R::Type Register;
+    const unsigned int cuiColumns = ( ac_roCoefficients.m_bProject ? 4 : 3 );
+    Register aaoMatrix[ 4 ][ 4 ];
+    for( unsigned int i = 0; i < 4; ++i )
+    {
+        for( unsigned int j = 0; j < cuiColumns; ++j )
+        {
+            aaoMatrix[i][j] = R::Set( ac_roCoefficients.m_aaData[i][j] );
+        }
+    }
+    unsigned int uiDone = 0;
+    for( ; uiDone + R::WIDTH <= a_uiCount; uiDone += R::WIDTH )
+    {
+        Register x = R::Load( ac_pInX + uiDone );
+        Register y = R::Load( ac_pInY + uiDone );
+        Register z = R::Load( ac_pInZ + uiDone );
+        Register aoResult[ 4 ];
+        for( unsigned int j = 0; j < cuiColumns; ++j )
+        {
+            aoResult[j] =
+                R::Add( R::Add( R::Multiply( x, aaoMatrix[0][j] ),
+                                R::Multiply( y, aaoMatrix[1][j] ) ),
+                        R::Add( R::Multiply( z, aaoMatrix[2][j] ),
+                                aaoMatrix[3][j] ) );
+        }
+        if( ac_roCoefficients.m_bProject )
+        {
+            for( unsigned int j = 0; j < 3; ++j )
+            {
+                aoResult[j] = R::Divide( aoResult[j], aoResult[3] );
+            }
+        }
+        R::Store( a_pOutX + uiDone, aoResult[0] );
+        R::Store( a_pOutY + uiDone, aoResult[1] );
+        R::Store( a_pOutZ + uiDone, aoResult[2] );
+    }
+    R::Finish();
+    return uiDone;
+}
+
+// Transform separate x, y, and z arrays on a single thread, using the widest
+// registers the processor supports and finishing any remainder one at a time
+inline void BatchSeparate( const BatchCoefficients< float >& ac_roCoefficients,
+                           const float* ac_pfInX, const float* ac_pfInY,
+                           const float* ac_pfInZ, float* a_pfOutX,
+                           float* a_pfOutY, float* a_pfOutZ,
+                           unsigned int a_uiCount )
+{
+    unsigned int uiDone = 0;
+    SimdLevel eLevel = DetectedSimdLevel();
+#ifdef SIMD_REGISTER_AVX
+    if( SIMD_AVX == eLevel )
+    {
+        uiDone = BatchSimd< AvxFloatRegister >( ac_roCoefficients, ac_pfInX,
+                                                ac_pfInY, ac_pfInZ, a_pfOutX,
+                                                a_pfOutY, a_pfOutZ, a_uiCount );
+    }
+#endif
+#ifdef SIMD_REGISTER_SSE2
+    if( SIMD_SSE2 <= eLevel )
+    {
+        uiDone += BatchSimd< SseFloatRegister >(
+            ac_roCoefficients, ac_pfInX + uiDone, ac_pfInY + uiDone,
+            ac_pfInZ + uiDone, a_pfOutX + uiDone, a_pfOutY + uiDone,
+            a_pfOutZ + uiDone, a_uiCount - uiDone );
+    }
+#endif
+    BatchScalar( ac_roCoefficients, ac_pfInX + uiDone, ac_pfInY + uiDone,
+                 ac_pfInZ + uiDone, a_pfOutX + uiDone, a_pfOutY + uiDone,
+                 a_pfOutZ + uiDone, a_uiCount - uiDone );
+}
+inline void BatchSeparate( const BatchCoefficients< double >& ac_roCoefficients,
+                           const double* ac_pdInX, const double* ac_pdInY,
+                           const double* ac_pdInZ, double* a_pdOutX,
+                           double* a_pdOutY, double* a_pdOutZ,
+                           unsigned int a_uiCount )
+{
+    unsigned int uiDone = 0;
+    SimdLevel eLevel = DetectedSimdLevel();
+#ifdef SIMD_REGISTER_AVX
+    if( SIMD_AVX == eLevel )
+    {
+        uiDone = BatchSimd< AvxDoubleRegister >( ac_roCoefficients, ac_pdInX,
+                                                 ac_pdInY, ac_pdInZ, a_pdOutX,
+                                                 a_pdOutY, a_pdOutZ,
+                                                 a_uiCount );
+    }
+#endif
+#ifdef SIMD_REGISTER_SSE2
+    if( SIMD_SSE2 <= eLevel )
+    {
+        uiDone += BatchSimd< SseDoubleRegister >(
+            ac_roCoefficients, ac_pdInX + uiDone, ac_pdInY + uiDone,
+            ac_pdInZ + uiDone, a_pdOutX + uiDone, a_pdOutY + uiDone,
+            a_pdOutZ + uiDone, a_uiCount - uiDone );
+    }
+#endif
+    BatchScalar( ac_roCoefficients, ac_pdInX + uiDone, ac_pdInY + uiDone,
+                 ac_pdInZ + uiDone, a_pdOutX + uiDone, a_pdOutY + uiDone,
+                 a_pdOutZ + uiDone, a_uiCount - uiDone );
+}
+
+// Transform interleaved x,y,z triples on a single thread by copying blocks of
+// them into separate arrays and back out again
+template< typename T >
+inline void BatchInterleaved( const BatchCoefficients< T >& ac_roCoefficients,
+                              const T* ac_pIn, T* a_pOut,
+                              unsigned int a_uiCount )
+{
+    T aX[ BATCH_BLOCK_SIZE ], aY[ BATCH_BLOCK_SIZE ], aZ[ BATCH_BLOCK_SIZE ];
+    for( unsigned int uiStart = 0; uiStart < a_uiCount;
+         uiStart += BATCH_BLOCK_SIZE )
+    {
+        unsigned int uiCount = a_uiCount - uiStart;
+        if( uiCount > BATCH_BLOCK_SIZE )
+        {
+            uiCount = BATCH_BLOCK_SIZE;
+        }
+        const T* cpIn = ac_pIn + 3*uiStart;
+        for( unsigned int i = 0; i < uiCount; ++i )
+        {
+            aX[i] = cpIn[ 3*i ];
+            aY[i] = cpIn[ 3*i + 1 ];
+            aZ[i] = cpIn[ 3*i + 2 ];
+        }
+        BatchSeparate( ac_roCoefficients, aX, aY, aZ, aX, aY, aZ, uiCount );
+        T* pOut = a_pOut + 3*uiStart;
+        for( unsigned int i = 0; i < uiCount; ++i )
+        {
+            pOut[ 3*i ] = aX[i];
+            pOut[ 3*i + 1 ] = aY[i];
+            pOut[ 3*i + 2 ] = aZ[i];
+        }
+    }
+}
+
+// Split large batches across threads.  Every piece writes only its own part of
+// the output, so no synchronization is needed.
+template< typename T >
+inline void BatchRun( const BatchCoefficients< T >& ac_roCoefficients,
+                      const T* ac_pIn, T* a_pOut, unsigned int a_uiCount )
+{
+#ifdef _OPENMP
+    if( a_uiCount >= 2 * BATCH_THREAD_CHUNK )
+    {
+        int iChunks = (int)( ( a_uiCount + BATCH_THREAD_CHUNK - 1 ) /
+                             BATCH_THREAD_CHUNK );
+#pragma omp parallel for
+        for( int i = 0; i < iChunks; ++i )
+        {
+            unsigned int uiStart = (unsigned int)i * BATCH_THREAD_CHUNK;
+            unsigned int uiCount = a_uiCount - uiStart;
+            BatchInterleaved( ac_roCoefficients, ac_pIn + 3*uiStart,
+                              a_pOut + 3*uiStart,
+                              uiCount < BATCH_THREAD_CHUNK
+                              ? uiCount : BATCH_THREAD_CHUNK );
+        }
+        return;
+    }
+#endif
+    BatchInterleaved( ac_roCoefficients, ac_pIn, a_pOut, a_uiCount );
+}
+template< typename T >
+inline void BatchRun( const BatchCoefficients< T >& ac_roCoefficients,
+                      const T* ac_pInX, const T* ac_pInY, const T* ac_pInZ,
+                      T* a_pOutX, T* a_pOutY, T* a_pOutZ,
+                      unsigned int a_uiCount )
+{
+#ifdef _OPENMP
+    if( a_uiCount >= 2 * BATCH_THREAD_CHUNK )
+    {
+        int iChunks = (int)( ( a_uiCount + BATCH_THREAD_CHUNK - 1 ) /
+                             BATCH_THREAD_CHUNK );
+#pragma omp parallel for
+        for( int i = 0; i < iChunks; ++i )
+        {
+            unsigned int uiStart = (unsigned int)i * BATCH_THREAD_CHUNK;
+            unsigned int uiCount = a_uiCount - uiStart;
+            BatchSeparate( ac_roCoefficients, ac_pInX + uiStart,
+                           ac_pInY + uiStart, ac_pInZ + uiStart,
+                           a_pOutX + uiStart, a_pOutY + uiStart,
+                           a_pOutZ + uiStart,
+                           uiCount < BATCH_THREAD_CHUNK
+                           ? uiCount : BATCH_THREAD_CHUNK );
+        }
+        return;
+    }
+#endif
+    BatchSeparate( ac_roCoefficients, ac_pInX, ac_pInY, ac_pInZ,
+                   a_pOutX, a_pOutY, a_pOutZ, a_uiCount );
+}
+
+// Quaternions are copied into separate w, x, y, and z arrays a block at a
+// time, like interleaved points.  Results are written back over the left-hand
+// arrays.
+struct BatchQuaternionBlock
+{
+    double m_aadLeft[ 4 ][ BATCH_BLOCK_SIZE ];
+    double m_aadRight[ 4 ][ BATCH_BLOCK_SIZE ];
+    double m_adProgress[ BATCH_BLOCK_SIZE ];
+};
+inline void BatchGather( const Space::Quaternion* ac_paoIn,
+                         unsigned int a_uiCount,
+                         double (&a_raadOut)[ 4 ][ BATCH_BLOCK_SIZE ] )
+{
+    // A quaternion is just its four elements
+    const double* cpIn = reinterpret_cast< const double* >( ac_paoIn );
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        for( unsigned int j = 0; j < 4; ++j )
+        {
+            a_raadOut[j][i] = cpIn[ 4*i + j ];
+        }
+    }
+}
+inline void BatchScatter( const double (&ac_raadIn)[ 4 ][ BATCH_BLOCK_SIZE ],
+                          unsigned int a_uiCount,
+                          Space::Quaternion* a_paoOut )
+{
+    double* pOut = reinterpret_cast< double* >( a_paoOut );
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        for( unsigned int j = 0; j < 4; ++j )
+        {
+            pOut[ 4*i + j ] = ac_raadIn[j][i];
+        }
+    }
+}
+
+// Divide each of four registers by their combined magnitude, the same way
+// Vector::Normalize does
+template< typename R >
+inline void BatchNormalize( typename R::Type (&a_raoQuaternion)[ 4 ] )
+{
+    typename R::Type oMagnitude =
+        R::Sqrt( R::Add( R::Add( R::Add(
+            R::Multiply( a_raoQuaternion[0], a_raoQuaternion[0] ),
+            R::Multiply( a_raoQuaternion[1], a_raoQuaternion[1] ) ),
+            R::Multiply( a_raoQuaternion[2], a_raoQuaternion[2] ) ),
+            R::Multiply( a_raoQuaternion[3], a_raoQuaternion[3] ) ) );
+    for( unsigned int j = 0; j < 4; ++j )
+    {
+        a_raoQuaternion[j] = R::Divide( a_raoQuaternion[j], oMagnitude );
+    }
+}
+
+// Each kernel processes as many quaternions as fill whole registers, starting
+// at the given index, and returns the index it stopped at
+struct BatchSlerpKernel
+{
+    // Same arithmetic as Quaternion::SlerpFast
+    template< typename R >
+    static unsigned int Run( BatchQuaternionBlock& a_roBlock,
+                             unsigned int a_uiStart, unsigned int a_uiCount )
+    {
+        typedef typename R::Type Register;
+        const Register oOne = R::Set( 1.0 );
+        Register aoU[ Space::SLERP_FAST_TERMS ];
+        Register aoV[ Space::SLERP_FAST_TERMS ];
+        for( unsigned int k = 0; k < Space::SLERP_FAST_TERMS; ++k )
+        {
+            aoU[k] = R::Set( Space::SLERP_FAST_U[k] );
+            aoV[k] = R::Set( Space::SLERP_FAST_V[k] );
+        }
+        unsigned int i = a_uiStart;
+        for( ; i + R::WIDTH <= a_uiCount; i += R::WIDTH )
+        {
+            Register aoFrom[4], aoTo[4];
+            for( unsigned int j = 0; j < 4; ++j )
+            {
+                aoFrom[j] = R::Load( a_roBlock.m_aadLeft[j] + i );
+                aoTo[j] = R::Load( a_roBlock.m_aadRight[j] + i );
+            }
+            Register oCos =
+                R::Add( R::Add( R::Add( R::Multiply( aoFrom[0], aoTo[0] ),
+                                        R::Multiply( aoFrom[1], aoTo[1] ) ),
+                                R::Multiply( aoFrom[2], aoTo[2] ) ),
+                        R::Multiply( aoFrom[3], aoTo[3] ) );
+            Register oCosMinusOne = R::Subtract( R::Abs( oCos ), oOne );
+            Register oTo = R::Load( a_roBlock.m_adProgress + i );
+            Register oFrom = R::Subtract( oOne, oTo );
+            Register oFromSquared = R::Multiply( oFrom, oFrom );
+            Register oToSquared = R::Multiply( oTo, oTo );
+            Register oFromFactor = oOne;
+            Register oToFactor = oOne;
+            for( int k = (int)Space::SLERP_FAST_TERMS - 1; k >= 0; --k )
+            {
+                oFromFactor = R::Add( oOne, R::Multiply( R::Multiply(
+                    R::Subtract( R::Multiply( aoU[k], oFromSquared ), aoV[k] ),
+                    oCosMinusOne ), oFromFactor ) );
+                oToFactor = R::Add( oOne, R::Multiply( R::Multiply(
+                    R::Subtract( R::Multiply( aoU[k], oToSquared ), aoV[k] ),
+                    oCosMinusOne ), oToFactor ) );
+            }
+            oFrom = R::Multiply( oFrom, oFromFactor );
+            oTo = R::FlipSign( R::Multiply( oTo, oToFactor ), oCos );
+            for( unsigned int j = 0; j < 4; ++j )
+            {
+                aoFrom[j] = R::Add( R::Multiply( oFrom, aoFrom[j] ),
+                                    R::Multiply( oTo, aoTo[j] ) );
+            }
+            BatchNormalize< R >( aoFrom );
+            for( unsigned int j = 0; j < 4; ++j )
+            {
+                R::Store( a_roBlock.m_aadLeft[j] + i, aoFrom[j] );
+            }
+        }
+        R::Finish();
+        return i;
+    }
+};
+struct BatchNormalizeKernel
+{
+    template< typename R >
+    static unsigned int Run( BatchQuaternionBlock& a_roBlock,
+                             unsigned int a_uiStart, unsigned int a_uiCount )
+    {
+        unsigned int i = a_uiStart;
+        for( ; i + R::WIDTH <= a_uiCount; i += R::WIDTH )
+        {
+            typename R::Type aoQuaternion[4];
+            for( unsigned int j = 0; j < 4; ++j )
+            {
+                aoQuaternion[j] = R::Load( a_roBlock.m_aadLeft[j] + i );
+            }
+            BatchNormalize< R >( aoQuaternion );
+            for( unsigned int j = 0; j < 4; ++j )
+            {
+                R::Store( a_roBlock.m_aadLeft[j] + i, aoQuaternion[j] );
+            }
+        }
+        R::Finish();
+        return i;
+    }
+};
+struct BatchMultiplyKernel
+{
+    // Same arithmetic as Quaternion::operator*=
+    template< typename R >
+    static unsigned int Run( BatchQuaternionBlock& a_roBlock,
+                             unsigned int a_uiStart, unsigned int a_uiCount )
+    {
+        typedef typename R::Type Register;
+        unsigned int i = a_uiStart;
+        for( ; i + R::WIDTH <= a_uiCount; i += R::WIDTH )
+        {
+            Register aoA[4], aoB[4], aoResult[4];
+            for( unsigned int j = 0; j < 4; ++j )
+            {
+                aoA[j] = R::Load( a_roBlock.m_aadLeft[j] + i );
+                aoB[j] = R::Load( a_roBlock.m_aadRight[j] + i );
+            }
+            // aaoProduct[j][k] = A[j] * B[k]
+            Register aaoProduct[4][4];
+            for( unsigned int j = 0; j < 4; ++j )
+            {
+                for( unsigned int k = 0; k < 4; ++k )
+                {
+                    aaoProduct[j][k] = R::Multiply( aoA[j], aoB[k] );
+                }
+            }
+            aoResult[0] = R::Subtract( R::Subtract( R::Subtract(
+                aaoProduct[0][0], aaoProduct[1][1] ), aaoProduct[2][2] ),
+                aaoProduct[3][3] );
+            aoResult[1] = R::Subtract( R::Add( R::Add(
+                aaoProduct[0][1], aaoProduct[1][0] ), aaoProduct[2][3] ),
+                aaoProduct[3][2] );
+            aoResult[2] = R::Add( R::Add( R::Subtract(
+                aaoProduct[0][2], aaoProduct[1][3] ), aaoProduct[2][0] ),
+                aaoProduct[3][1] );
+            aoResult[3] = R::Add( R::Subtract( R::Add(
+                aaoProduct[0][3], aaoProduct[1][2] ), aaoProduct[2][1] ),
+                aaoProduct[3][0] );
+            BatchNormalize< R >( aoResult );
+            for( unsigned int j = 0; j < 4; ++j )
+            {
+                R::Store( a_roBlock.m_aadLeft[j] + i, aoResult[j] );
+            }
+        }
+        R::Finish();
+        return i;
+    }
+};
+
+// Run a quaternion kernel over a block with the widest registers available
+template< typename K >
+inline void BatchQuaternions( BatchQuaternionBlock& a_roBlock,
+                              unsigned int a_uiCount )
+{
+    unsigned int uiDone = 0;
+    SimdLevel eLevel = DetectedSimdLevel();
+#ifdef SIMD_REGISTER_AVX
+    if( SIMD_AVX == eLevel )
+    {
+        uiDone = K::template Run< AvxDoubleRegister >( a_roBlock, uiDone,
+                                                       a_uiCount );
+    }
+#endif
+#ifdef SIMD_REGISTER_SSE2
+    if( SIMD_SSE2 <= eLevel )
+    {
+        uiDone = K::template Run< SseDoubleRegister >( a_roBlock, uiDone,
+                                                       a_uiCount );
+    }
+#endif
+    K::template Run< ScalarDoubleRegister >( a_roBlock, uiDone, a_uiCount );
+}
+
+// Slerp with either one progress value for every pair (stride 0) or one each
+inline void BatchSlerpMany( const Space::Quaternion* ac_paoFrom,
+                            const Space::Quaternion* ac_paoTo,
+                            const double* ac_pdProgress,
+                            unsigned int a_uiProgressStride,
+                            Space::Quaternion* a_paoOut,
+                            unsigned int a_uiCount )
+{
+    BatchQuaternionBlock oBlock;
+    for( unsigned int uiStart = 0; uiStart < a_uiCount;
+         uiStart += BATCH_BLOCK_SIZE )
+    {
+        unsigned int uiCount = a_uiCount - uiStart;
+        if( uiCount > BATCH_BLOCK_SIZE )
+        {
+            uiCount = BATCH_BLOCK_SIZE;
+        }
+        BatchGather( ac_paoFrom + uiStart, uiCount, oBlock.m_aadLeft );
+        BatchGather( ac_paoTo + uiStart, uiCount, oBlock.m_aadRight );
+        for( unsigned int i = 0; i < uiCount; ++i )
+        {
+            oBlock.m_adProgress[i] =
+                ac_pdProgress[ ( uiStart + i ) * a_uiProgressStride ];
+        }
+        BatchQuaternions< BatchSlerpKernel >( oBlock, uiCount );
+        BatchScatter( oBlock.m_aadLeft, uiCount, a_paoOut + uiStart );
+    }
+}
+
+// Transform products are split across threads in pieces of this many, if
+// there are at least twice this many
+const unsigned int BATCH_COMPOSE_CHUNK = 4096;
+
+// Multiply 4x4 arrays with the right-hand rows held in registers, each result
+// row being the left-hand elements of that row broadcast, multiplied by the
+// right-hand rows, and summed left to right - the same arithmetic as
+// SimdProduct and UnrolledProduct, so results match operator* exactly.
+// A stride of 0 reuses one array for every product.  Each product loads all
+// of its right-hand rows before storing anything and reads each left-hand row
+// before storing the same result row, so the output may be either input.
+//
+// Interleaving several matrices across the lanes of each register instead
+// (one register per element) was measured to be more than twice as slow,
+// since a 4x4 row already fills a register and the interleaving costs a
+// transpose on the way in and out.
+template< typename R >
+inline void BatchCompose( const typename R::ElementType* ac_pLeft,
+                          unsigned int a_uiLeftStride,
+                          const typename R::ElementType* ac_pRight,
+                          unsigned int a_uiRightStride,
+                          typename R::ElementType* a_pOut,
+                          unsigned int a_uiCount )
+{
+    typedef typename R::Type Register;
+    const unsigned int P = 4 / R::WIDTH;    // registers per row
+    for( unsigned int m = 0; m < a_uiCount; ++m )
+    {
+        const typename R::ElementType* pLeft = ac_pLeft + m * a_uiLeftStride;
+        const typename R::ElementType* pRight =
+            ac_pRight + m * a_uiRightStride;
+        typename R::ElementType* pOut = a_pOut + 16 * m;
+        Register aaoRight[ 4 ][ P ];
+        for( unsigned int k = 0; k < 4; ++k )
+        {
+            for( unsigned int p = 0; p < P; ++p )
+            {
+                aaoRight[k][p] = R::Load( pRight + 4*k + p * R::WIDTH );
+            }
+        }
+        for( unsigned int i = 0; i < 4; ++i )
+        {
+            Register aoFactor[4];
+            for( unsigned int k = 0; k < 4; ++k )
+            {
+                aoFactor[k] = R::Set( pLeft[ 4*i + k ] );
+            }
+            for( unsigned int p = 0; p < P; ++p )
+            {
+                Register oRow = R::Multiply( aoFactor[0], aaoRight[0][p] );
+                for( unsigned int k = 1; k < 4; ++k )
+                {
+                    oRow = R::Add( oRow, R::Multiply( aoFactor[k],
+                                                      aaoRight[k][p] ) );
+                }
+                R::Store( pOut + 4*i + p * R::WIDTH, oRow );
+            }
+        }
+    }
+    R::Finish();
+}
+
+// Multiply on a single thread with the widest registers that hold a row.
+// Float rows fill an SSE register, so there's nothing for AVX to add.
+inline void BatchComposeRun( const double* ac_pdLeft,
+                             unsigned int a_uiLeftStride,
+                             const double* ac_pdRight,
+                             unsigned int a_uiRightStride,
+                             double* a_pdOut, unsigned int a_uiCount )
+{
+    SimdLevel eLevel = DetectedSimdLevel();
+#ifdef SIMD_REGISTER_AVX
+    if( SIMD_AVX == eLevel )
+    {
+        BatchCompose< AvxDoubleRegister >( ac_pdLeft, a_uiLeftStride,
+                                           ac_pdRight, a_uiRightStride,
+                                           a_pdOut, a_uiCount );
+        return;
+    }
+#endif
+#ifdef SIMD_REGISTER_SSE2
+    if( SIMD_SSE2 <= eLevel )
+    {
+        BatchCompose< SseDoubleRegister >( ac_pdLeft, a_uiLeftStride,
+                                           ac_pdRight, a_uiRightStride,
+                                           a_pdOut, a_uiCount );
+        return;
+    }
+#endif
+    BatchCompose< ScalarDoubleRegister >( ac_pdLeft, a_uiLeftStride,
+                                          ac_pdRight, a_uiRightStride,
+                                          a_pdOut, a_uiCount );
+}
+inline void BatchComposeRun( const float* ac_pfLeft,
+                             unsigned int a_uiLeftStride,
+                             const float* ac_pfRight,
+                             unsigned int a_uiRightStride,
+                             float* a_pfOut, unsigned int a_uiCount )
+{
+#ifdef SIMD_REGISTER_SSE2
+    if( SIMD_SSE2 <= DetectedSimdLevel() )
+    {
+        BatchCompose< SseFloatRegister >( ac_pfLeft, a_uiLeftStride,
+                                          ac_pfRight, a_uiRightStride,
+                                          a_pfOut, a_uiCount );
+        return;
+    }
+#endif
+    BatchCompose< ScalarRegister< float > >( ac_pfLeft, a_uiLeftStride,
+                                             ac_pfRight, a_uiRightStride,
+                                             a_pfOut, a_uiCount );
+}
+
+// Split large batches across threads.  Every piece writes only its own part of
+// the output, and reads only its own part of any input it could overlap.
+template< typename T >
+inline void BatchComposeMany( const Matrix< T, 4, 4 >* ac_paoLeft,
+                              unsigned int a_uiLeftStride,
+                              const Matrix< T, 4, 4 >* ac_paoRight,
+                              unsigned int a_uiRightStride,
+                              Matrix< T, 4, 4 >* a_paoOut,
+                              unsigned int a_uiCount )
+{
+    // A transform is just its sixteen elements
+    const T* cpLeft = reinterpret_cast< const T* >( ac_paoLeft );
+    const T* cpRight = reinterpret_cast< const T* >( ac_paoRight );
+    T* pOut = reinterpret_cast< T* >( a_paoOut );
+#ifdef _OPENMP
+    if( a_uiCount >= 2 * BATCH_COMPOSE_CHUNK )
+    {
+        int iChunks = (int)( ( a_uiCount + BATCH_COMPOSE_CHUNK - 1 ) /
+                             BATCH_COMPOSE_CHUNK );
+#pragma omp parallel for
+        for( int i = 0; i < iChunks; ++i )
+        {
+            unsigned int uiStart = (unsigned int)i * BATCH_COMPOSE_CHUNK;
+            unsigned int uiCount = a_uiCount - uiStart;
+            BatchComposeRun( cpLeft + uiStart * a_uiLeftStride,
+                             a_uiLeftStride,
+                             cpRight + uiStart * a_uiRightStride,
+                             a_uiRightStride, pOut + 16 * uiStart,
+                             uiCount < BATCH_COMPOSE_CHUNK
+                             ? uiCount : BATCH_COMPOSE_CHUNK );
+        }
+        return;
+    }
+#endif
+    BatchComposeRun( cpLeft, a_uiLeftStride, cpRight, a_uiRightStride, pOut,
+                     a_uiCount );
+}
+
+}   // namespace Math
+
+namespace Space
+{
+
+// Transform points
+INLINE void TransformPoints( const Transform& ac_roTransform,
+                             const Point* ac_paoIn, Point* a_paoOut,
+                             unsigned int a_uiCount )
+{
+    // Points are laid out exactly like their element arrays
+    TransformPoints( ac_roTransform,
+                     reinterpret_cast< const double* >( ac_paoIn ),
+                     reinterpret_cast< double* >( a_paoOut ), a_uiCount );
+}
+INLINE void TransformPoints( const Transform& ac_roTransform,
+                             const double* ac_pdIn, double* a_pdOut,
+                             unsigned int a_uiCount )
+{
+    Math::BatchCoefficients< double > oCoefficients;
+    Math::BatchSetup( ac_roTransform, true, oCoefficients );
+    Math::BatchRun( oCoefficients, ac_pdIn, a_pdOut, a_uiCount );
+}
+INLINE void TransformPoints( const Transform& ac_roTransform,
+                             const float* ac_pfIn, float* a_pfOut,
+                             unsigned int a_uiCount )
+{
+    Math::BatchCoefficients< float > oCoefficients;
+    Math::BatchSetup( ac_roTransform, true, oCoefficients );
+    Math::BatchRun( oCoefficients, ac_pfIn, a_pfOut, a_uiCount );
+}
+INLINE void TransformPoints( const Transform& ac_roTransform,
+                             const double* ac_pdInX, const double* ac_pdInY,
+                             const double* ac_pdInZ, double* a_pdOutX,
+                             double* a_pdOutY, double* a_pdOutZ,
+                             unsigned int a_uiCount )
+{
+    Math::BatchCoefficients< double > oCoefficients;
+    Math::BatchSetup( ac_roTransform, true, oCoefficients );
+    Math::BatchRun( oCoefficients, ac_pdInX, ac_pdInY, ac_pdInZ,
+                    a_pdOutX, a_pdOutY, a_pdOutZ, a_uiCount );
+}
+INLINE void TransformPoints( const Transform& ac_roTransform,
+                             const float* ac_pfInX, const float* ac_pfInY,
+                             const float* ac_pfInZ, float* a_pfOutX,
+                             float* a_pfOutY, float* a_pfOutZ,
+                             unsigned int a_uiCount )
+{
+    Math::BatchCoefficients< float > oCoefficients;
+    Math::BatchSetup( ac_roTransform, true, oCoefficients );
+    Math::BatchRun( oCoefficients, ac_pfInX, ac_pfInY, ac_pfInZ,
+                    a_pfOutX, a_pfOutY, a_pfOutZ, a_uiCount );
+}
+
+// Transform directions
+INLINE void TransformDirections( const Transform& ac_roTransform,
+                                 const Point* ac_paoIn, Point* a_paoOut,
+                                 unsigned int a_uiCount )
+{
+    TransformDirections( ac_roTransform,
+                         reinterpret_cast< const double* >( ac_paoIn ),
+                         reinterpret_cast< double* >( a_paoOut ), a_uiCount );
+}
+INLINE void TransformDirections( const Transform& ac_roTransform,
+                                 const double* ac_pdIn, double* a_pdOut,
+                                 unsigned int a_uiCount )
+{
+    Math::BatchCoefficients< double > oCoefficients;
+    Math::BatchSetup( ac_roTransform, false, oCoefficients );
+    Math::BatchRun( oCoefficients, ac_pdIn, a_pdOut, a_uiCount );
+}
+INLINE void TransformDirections( const Transform& ac_roTransform,
+                                 const float* ac_pfIn, float* a_pfOut,
+                                 unsigned int a_uiCount )
+{
+    Math::BatchCoefficients< float > oCoefficients;
+    Math::BatchSetup( ac_roTransform, false, oCoefficients );
+    Math::BatchRun( oCoefficients, ac_pfIn, a_pfOut, a_uiCount );
+}
+INLINE void TransformDirections( const Transform& ac_roTransform,
+                                 const double* ac_pdInX,
+                                 const double* ac_pdInY,
+                                 const double* ac_pdInZ, double* a_pdOutX,
+                                 double* a_pdOutY, double* a_pdOutZ,
+                                 unsigned int a_uiCount )
+{
+    Math::BatchCoefficients< double > oCoefficients;
+    Math::BatchSetup( ac_roTransform, false, oCoefficients );
+    Math::BatchRun( oCoefficients, ac_pdInX, ac_pdInY, ac_pdInZ,
+                    a_pdOutX, a_pdOutY, a_pdOutZ, a_uiCount );
+}
+INLINE void TransformDirections( const Transform& ac_roTransform,
+                                 const float* ac_pfInX,
+                                 const float* ac_pfInY,
+                                 const float* ac_pfInZ, float* a_pfOutX,
+                                 float* a_pfOutY, float* a_pfOutZ,
+                                 unsigned int a_uiCount )
+{
+    Math::BatchCoefficients< float > oCoefficients;
+    Math::BatchSetup( ac_roTransform, false, oCoefficients );
+    Math::BatchRun( oCoefficients, ac_pfInX, ac_pfInY, ac_pfInZ,
+                    a_pfOutX, a_pfOutY, a_pfOutZ, a_uiCount );
+}
+
+// Rotate points
+INLINE void RotatePoints( const Quaternion& ac_roRotation,
+                          const Point* ac_paoIn, Point* a_paoOut,
+                          unsigned int a_uiCount )
+{
+    RotatePoints( ac_roRotation,
+                  reinterpret_cast< const double* >( ac_paoIn ),
+                  reinterpret_cast< double* >( a_paoOut ), a_uiCount );
+}
+INLINE void RotatePoints( const Quaternion& ac_roRotation,
+                          const double* ac_pdIn, double* a_pdOut,
+                          unsigned int a_uiCount )
+{
+    Math::BatchCoefficients< double > oCoefficients;
+    Math::BatchSetup( ac_roRotation, oCoefficients );
+    Math::BatchRun( oCoefficients, ac_pdIn, a_pdOut, a_uiCount );
+}
+INLINE void RotatePoints( const Quaternion& ac_roRotation,
+                          const float* ac_pfIn, float* a_pfOut,
+                          unsigned int a_uiCount )
+{
+    Math::BatchCoefficients< float > oCoefficients;
+    Math::BatchSetup( ac_roRotation, oCoefficients );
+    Math::BatchRun( oCoefficients, ac_pfIn, a_pfOut, a_uiCount );
+}
+INLINE void RotatePoints( const Quaternion& ac_roRotation,
+                          const double* ac_pdInX, const double* ac_pdInY,
+                          const double* ac_pdInZ, double* a_pdOutX,
+                          double* a_pdOutY, double* a_pdOutZ,
+                          unsigned int a_uiCount )
+{
+    Math::BatchCoefficients< double > oCoefficients;
+    Math::BatchSetup( ac_roRotation, oCoefficients );
+    Math::BatchRun( oCoefficients, ac_pdInX, ac_pdInY, ac_pdInZ,
+                    a_pdOutX, a_pdOutY, a_pdOutZ, a_uiCount );
+}
+INLINE void RotatePoints( const Quaternion& ac_roRotation,
+                          const float* ac_pfInX, const float* ac_pfInY,
+                          const float* ac_pfInZ, float* a_pfOutX,
+                          float* a_pfOutY, float* a_pfOutZ,
+                          unsigned int a_uiCount )
+{
+    Math::BatchCoefficients< float > oCoefficients;
+    Math::BatchSetup( ac_roRotation, oCoefficients );
+    Math::BatchRun( oCoefficients, ac_pfInX, ac_pfInY, ac_pfInZ,
+                    a_pfOutX, a_pfOutY, a_pfOutZ, a_uiCount );
+}
+
+// Interpolate, normalize, or multiply arrays of quaternions
+INLINE void SlerpMany( const Quaternion* ac_paoFrom,
+                       const Quaternion* ac_paoTo, double a_dProgress,
+                       Quaternion* a_paoOut, unsigned int a_uiCount )
+{
+    Math::BatchSlerpMany( ac_paoFrom, ac_paoTo, &a_dProgress, 0,
+                          a_paoOut, a_uiCount );
+}
+INLINE void SlerpMany( const Quaternion* ac_paoFrom,
+                       const Quaternion* ac_paoTo,
+                       const double* ac_pdProgress,
+                       Quaternion* a_paoOut, unsigned int a_uiCount )
+{
+    Math::BatchSlerpMany( ac_paoFrom, ac_paoTo, ac_pdProgress, 1,
+                          a_paoOut, a_uiCount );
+}
+INLINE void NormalizeMany( Quaternion* a_paoQuaternions,
+                           unsigned int a_uiCount )
+{
+    Math::BatchQuaternionBlock oBlock;
+    for( unsigned int uiStart = 0; uiStart < a_uiCount;
+         uiStart += Math::BATCH_BLOCK_SIZE )
+    {
+        unsigned int uiCount = a_uiCount - uiStart;
+        if( uiCount > Math::BATCH_BLOCK_SIZE )
+        {
+            uiCount = Math::BATCH_BLOCK_SIZE;
+        }
+        Math::BatchGather( a_paoQuaternions + uiStart, uiCount,
+                           oBlock.m_aadLeft );
+        Math::BatchQuaternions< Math::BatchNormalizeKernel >( oBlock,
+                                                              uiCount );
+        Math::BatchScatter( oBlock.m_aadLeft, uiCount,
+                            a_paoQuaternions + uiStart );
+    }
+}
+INLINE void MultiplyMany( const Quaternion* ac_paoLeft,
+                          const Quaternion* ac_paoRight,
+                          Quaternion* a_paoOut, unsigned int a_uiCount )
+{
+    Math::BatchQuaternionBlock oBlock;
+    for( unsigned int uiStart = 0; uiStart < a_uiCount;
+         uiStart += Math::BATCH_BLOCK_SIZE )
+    {
+        unsigned int uiCount = a_uiCount - uiStart;
+        if( uiCount > Math::BATCH_BLOCK_SIZE )
+        {
+            uiCount = Math::BATCH_BLOCK_SIZE;
+        }
+        Math::BatchGather( ac_paoLeft + uiStart, uiCount, oBlock.m_aadLeft );
+        Math::BatchGather( ac_paoRight + uiStart, uiCount,
+                           oBlock.m_aadRight );
+        Math::BatchQuaternions< Math::BatchMultiplyKernel >( oBlock,
+                                                             uiCount );
+        Math::BatchScatter( oBlock.m_aadLeft, uiCount, a_paoOut + uiStart );
+    }
+}
+
+// Multiply arrays of transforms
+INLINE void MultiplyMany( const Transform* ac_paoLeft,
+                          const Transform* ac_paoRight,
+                          Transform* a_paoOut, unsigned int a_uiCount )
+{
+    Math::BatchComposeMany( ac_paoLeft, 16, ac_paoRight, 16, a_paoOut,
+                            a_uiCount );
+}
+INLINE void MultiplyMany( const Transform* ac_paoLeft,
+                          const Transform& ac_roRight,
+                          Transform* a_paoOut, unsigned int a_uiCount )
+{
+    // Copy the shared transform in case it's one of the outputs
+    Transform oRight( ac_roRight );
+    Math::BatchComposeMany( ac_paoLeft, 16, &oRight, 0, a_paoOut,
+                            a_uiCount );
+}
+INLINE void MultiplyMany( const Transform& ac_roLeft,
+                          const Transform* ac_paoRight,
+                          Transform* a_paoOut, unsigned int a_uiCount )
+{
+    Transform oLeft( ac_roLeft );
+    Math::BatchComposeMany( &oLeft, 0, ac_paoRight, 16, a_paoOut,
+                            a_uiCount );
+}
+INLINE void MultiplyMany( const FloatTransform* ac_paoLeft,
+                          const FloatTransform* ac_paoRight,
+                          FloatTransform* a_paoOut, unsigned int a_uiCount )
+{
+    Math::BatchComposeMany( ac_paoLeft, 16, ac_paoRight, 16, a_paoOut,
+                            a_uiCount );
+}
+INLINE void MultiplyMany( const FloatTransform* ac_paoLeft,
+                          const FloatTransform& ac_roRight,
+                          FloatTransform* a_paoOut, unsigned int a_uiCount )
+{
+    FloatTransform oRight( ac_roRight );
+    Math::BatchComposeMany( ac_paoLeft, 16, &oRight, 0, a_paoOut,
+                            a_uiCount );
+}
+INLINE void MultiplyMany( const FloatTransform& ac_roLeft,
+                          const FloatTransform* ac_paoRight,
+                          FloatTransform* a_paoOut, unsigned int a_uiCount )
+{
+    FloatTransform oLeft( ac_roLeft );
+    Math::BatchComposeMany( &oLeft, 0, ac_paoRight, 16, a_paoOut,
+                            a_uiCount );
+}
+
+// Compose a hierarchy.  Each node depends on its parent, so this runs on one
+// thread, but it still skips the per-product overhead of operator*.
+INLINE void ComposeHierarchy( const Transform* ac_paoLocal,
+                              const unsigned int* ac_puiParent,
+                              Transform* a_paoWorld,
+                              unsigned int a_uiCount )
+{
+    const double* cpLocal = reinterpret_cast< const double* >( ac_paoLocal );
+    double* pWorld = reinterpret_cast< double* >( a_paoWorld );
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        if( ac_puiParent[i] >= i )
+        {
+            a_paoWorld[i] = ac_paoLocal[i];
+        }
+        else
+        {
+            Math::BatchComposeRun( cpLocal + 16*i, 0,
+                                   pWorld + 16 * ac_puiParent[i], 0,
+                                   pWorld + 16*i, 1 );
+        }
+    }
+}
+
+}   // namespace Space
+
+#endif  // BATCH_TRANSFORM__INL
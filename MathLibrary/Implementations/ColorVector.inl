@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       December 16, 2013
  * Description:        Inline function implementations for ColorVector class.
- * Last Modified:      February 27, 2014
- * Last Modification:  Adding functions.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added batch color conversion and blending.
  ******************************************************************************/
 
 #ifndef COLOR_VECTOR__INL
@@ -15,52 +15,23 @@
 #include "../Declarations/Functions.h"
 #include "../Declarations/ImExportMacro.h"
 
-// separate file for template functions to keep filesize down
+// separate files for template functions and batch functions to keep filesize
+// down
 #include "ColorVector_Templates.inl"
+#include "ColorVector_Batch.inl"
 
 namespace Color
 {
 
-// Destructor does nothing
-INLINE ColorVector::~ColorVector() {}
-
 // Constructors that forward to base class constructors
 INLINE ColorVector::ColorVector()
-    : BaseType( 1.0f ),
-      r( m_aaData[0][0] ),
-      g( m_aaData[0][1] ),
-      b( m_aaData[0][2] ),
-      a( m_aaData[0][3] ) {}
-INLINE ColorVector::ColorVector( const ColorVector& ac_roVector )
-    : BaseType( ac_roVector ),
-      r( m_aaData[0][0] ),
-      g( m_aaData[0][1] ),
-      b( m_aaData[0][2] ),
-      a( m_aaData[0][3] ) {}
+    : BaseType( 1.0f ) {}
 INLINE ColorVector::ColorVector( const RootType& ac_roMatrix )
-    : BaseType( ac_roMatrix ),
-      r( m_aaData[0][0] ),
-      g( m_aaData[0][1] ),
-      b( m_aaData[0][2] ),
-      a( m_aaData[0][3] ) {}
-INLINE ColorVector::ColorVector( ColorVector&& a_rroVector )
-    : BaseType( std::forward< ColorVector >( a_rroVector ) ),
-      r( m_aaData[0][0] ),
-      g( m_aaData[0][1] ),
-      b( m_aaData[0][2] ),
-      a( m_aaData[0][3] ) {}
+    : BaseType( ac_roMatrix ) {}
 INLINE ColorVector::ColorVector( float a_fFill )
-    : BaseType( a_fFill ),
-      r( m_aaData[0][0] ),
-      g( m_aaData[0][1] ),
-      b( m_aaData[0][2] ),
-      a( m_aaData[0][3] ) {}
+    : BaseType( a_fFill ) {}
 INLINE ColorVector::ColorVector( const float (&ac_rafData)[ 4 ] )
-    : BaseType( ac_rafData ),
-      r( m_aaData[0][0] ),
-      g( m_aaData[0][1] ),
-      b( m_aaData[0][2] ),
-      a( m_aaData[0][3] ) {}
+    : BaseType( ac_rafData ) {}
 
 // Assignment operators that pass to base class
 INLINE ColorVector& ColorVector::operator=( float a_fFill )
@@ -79,55 +50,39 @@ INLINE ColorVector::ColorVector( Channel a_ucRed,
                                  Channel a_ucGreen,
                                  Channel a_ucBlue,
                                  Channel a_ucAlpha )
-    : BaseType(),
-      r( m_aaData[0][0] ),
-      g( m_aaData[0][1] ),
-      b( m_aaData[0][2] ),
-      a( m_aaData[0][3] )
+    : BaseType()
 {
-    r = (float)a_ucRed / 0xFF;
-    g = (float)a_ucGreen / 0xFF;
-    b = (float)a_ucBlue / 0xFF;
-    a = (float)a_ucAlpha / 0xFF;
+    r() = (float)a_ucRed / 0xFF;
+    g() = (float)a_ucGreen / 0xFF;
+    b() = (float)a_ucBlue / 0xFF;
+    a() = (float)a_ucAlpha / 0xFF;
 }
 INLINE ColorVector::ColorVector( float a_fRed,
                                  float a_fGreen,
                                  float a_fBlue,
                                  float a_fAlpha )
-    : BaseType(),
-      r( m_aaData[0][0] ),
-      g( m_aaData[0][1] ),
-      b( m_aaData[0][2] ),
-      a( m_aaData[0][3] )
+    : BaseType()
 {
-    r = a_fRed;
-    g = a_fGreen;
-    b = a_fBlue;
-    a = a_fAlpha;
+    r() = a_fRed;
+    g() = a_fGreen;
+    b() = a_fBlue;
+    a() = a_fAlpha;
 }
 INLINE ColorVector::ColorVector( FourChannelInt a_uiHex )
-    : BaseType(),
-      r( m_aaData[0][0] ),
-      g( m_aaData[0][1] ),
-      b( m_aaData[0][2] ),
-      a( m_aaData[0][3] )
+    : BaseType()
 {
-    r = (float)( Hex(a_uiHex).r ) / 0xFF;
-    g = (float)( Hex(a_uiHex).g ) / 0xFF;
-    b = (float)( Hex(a_uiHex).b ) / 0xFF;
-    a = (float)( Hex(a_uiHex).a ) / 0xFF;
+    r() = (float)( Hex(a_uiHex).r ) / 0xFF;
+    g() = (float)( Hex(a_uiHex).g ) / 0xFF;
+    b() = (float)( Hex(a_uiHex).b ) / 0xFF;
+    a() = (float)( Hex(a_uiHex).a ) / 0xFF;
 }
 INLINE ColorVector::ColorVector( const Hex& ac_rHex )
-    : BaseType(),
-      r( m_aaData[0][0] ),
-      g( m_aaData[0][1] ),
-      b( m_aaData[0][2] ),
-      a( m_aaData[0][3] )
+    : BaseType()
 {
-    r = (float)( ac_rHex.r ) / 0xFF;
-    g = (float)( ac_rHex.g ) / 0xFF;
-    b = (float)( ac_rHex.b ) / 0xFF;
-    a = (float)( ac_rHex.a ) / 0xFF;
+    r() = (float)( ac_rHex.r ) / 0xFF;
+    g() = (float)( ac_rHex.g ) / 0xFF;
+    b() = (float)( ac_rHex.b ) / 0xFF;
+    a() = (float)( ac_rHex.a ) / 0xFF;
 }
 
 // Assign from or convert to color Hex value
@@ -137,15 +92,15 @@ INLINE ColorVector& ColorVector::operator=( FourChannelInt a_uiHex )
 }
 INLINE ColorVector& ColorVector::operator=( const Hex& ac_rHex )
 {
-    r = (float)( ac_rHex.r ) / 0xFF;
-    g = (float)( ac_rHex.g ) / 0xFF;
-    b = (float)( ac_rHex.b ) / 0xFF;
-    a = (float)( ac_rHex.a ) / 0xFF;
+    r() = (float)( ac_rHex.r ) / 0xFF;
+    g() = (float)( ac_rHex.g ) / 0xFF;
+    b() = (float)( ac_rHex.b ) / 0xFF;
+    a() = (float)( ac_rHex.a ) / 0xFF;
     return *this;
 }
 INLINE ColorVector::operator Hex() const
 {
-    return Hex( r, g, b, a );
+    return Hex( r(), g(), b(), a() );
 }
 
 // Bitwise operators
@@ -226,48 +181,40 @@ INLINE ColorVector& ColorVector::operator>>=( unsigned char a_ucBits )
 // Return rgb values as 8-bit channel values
 INLINE Channel ColorVector::AlphaChannel() const
 {
-    return 0.0f > a ? 0x00
-        : 1.0f < a ? 0xFF
-        : (Channel)Math::Round( a * 0xFF );
+    return ChannelFromFloat( a() );
 }
 INLINE Channel ColorVector::RedChannel() const
 {
-    return 0.0f > r ? 0x00
-        : 1.0f < r ? 0xFF
-        : (Channel)Math::Round( r * 0xFF );
+    return ChannelFromFloat( r() );
 }
 INLINE Channel ColorVector::GreenChannel() const
 {
-    return 0.0f > g ? 0x00
-        : 1.0f < g ? 0xFF
-        : (Channel)Math::Round( g * 0xFF );
+    return ChannelFromFloat( g() );
 }
 INLINE Channel ColorVector::BlueChannel() const
 {
-    return 0.0f > b ? 0x00
-        : 1.0f < b ? 0xFF
-        : (Channel)Math::Round( b * 0xFF );
+    return ChannelFromFloat( b() );
 }
 
 // Set individual rgba values using 8-bit channel values
 INLINE ColorVector& ColorVector::AlphaChannel( Channel a_ucAlpha )
 {
-    a = (float)a_ucAlpha / 255.0f;
+    a() = (float)a_ucAlpha / 255.0f;
     return *this;
 }
 INLINE ColorVector& ColorVector::RedChannel( Channel a_ucRed )
 {
-    r = (float)a_ucRed / 255.0f;
+    r() = (float)a_ucRed / 255.0f;
     return *this;
 }
 INLINE ColorVector& ColorVector::GreenChannel( Channel a_ucGreen )
 {
-    g = (float)a_ucGreen / 255.0f;
+    g() = (float)a_ucGreen / 255.0f;
     return *this;
 }
 INLINE ColorVector& ColorVector::BlueChannel( Channel a_ucBlue )
 {
-    b = (float)a_ucBlue / 255.0f;
+    b() = (float)a_ucBlue / 255.0f;
     return *this;
 }
 
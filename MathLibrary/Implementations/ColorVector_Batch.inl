@@ -0,0 +1,593 @@
+/******************************************************************************
+ * File:               ColorVector_Batch.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Implementations for functions that convert and blend
+ *                      whole arrays of colors.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  sRGB tables are built at startup.
+ ******************************************************************************/
+
+#ifndef COLOR_VECTOR__BATCH__INL
+#define COLOR_VECTOR__BATCH__INL
+
+#include "../Declarations/ColorVector.h"
+#include "../Declarations/ImExportMacro.h"
+#include "../Declarations/MatrixProduct.h"
+#include "../Declarations/SimdRegister.h"
+#include <cmath>    // for pow
+
+namespace Color
+{
+
+// Operations on whole colors held in the float registers from SimdRegister.h,
+// one color per SSE register or two per AVX register
+template< typename R >
+struct ColorLanes;
+
+#ifdef SIMD_REGISTER_SSE2
+
+template<>
+struct ColorLanes< Math::SseFloatRegister >
+{
+    static const unsigned int COLORS = 1;
+
+    // The given color in every group of four lanes
+    static __m128 Repeat( const ColorVector& ac_roColor )
+    { return _mm_loadu_ps( ac_roColor.Data() ); }
+
+    // Each color's alpha in all four of its lanes
+    static __m128 Alpha( const __m128& ac_roColors )
+    { return _mm_shuffle_ps( ac_roColors, ac_roColors, 0xFF ); }
+
+    // Each color's alpha in its red, green, and blue lanes and one in its
+    // alpha lane
+    static __m128 AlphaFactor( const __m128& ac_roColors )
+    {
+        const __m128 coAlphaLane =
+            _mm_castsi128_ps( _mm_set_epi32( -1, 0, 0, 0 ) );
+        return _mm_or_ps( _mm_andnot_ps( coAlphaLane, Alpha( ac_roColors ) ),
+                          _mm_and_ps( coAlphaLane, _mm_set1_ps( 1.0f ) ) );
+    }
+};
+
+// Divide unsigned 16-bit lanes holding products of two channels by 255,
+// rounding to nearest.  Exact for every value up to 255 * 255.
+inline __m128i DivideBy255( const __m128i& ac_roValues )
+{
+    __m128i oRounded = _mm_add_epi16( ac_roValues, _mm_set1_epi16( 128 ) );
+    return _mm_srli_epi16(
+        _mm_add_epi16( oRounded, _mm_srli_epi16( oRounded, 8 ) ), 8 );
+}
+
+#endif  // SIMD_REGISTER_SSE2
+
+#ifdef SIMD_REGISTER_AVX
+
+template<>
+struct ColorLanes< Math::AvxFloatRegister >
+{
+    static const unsigned int COLORS = 2;
+    static __m256 Repeat( const ColorVector& ac_roColor )
+    {
+        return _mm256_broadcast_ps(
+            reinterpret_cast< const __m128* >( ac_roColor.Data() ) );
+    }
+    static __m256 Alpha( const __m256& ac_roColors )
+    { return _mm256_permute_ps( ac_roColors, 0xFF ); }
+    static __m256 AlphaFactor( const __m256& ac_roColors )
+    { return _mm256_blend_ps( Alpha( ac_roColors ), _mm256_set1_ps( 1.0f ),
+                              0x88 ); }
+};
+
+#endif  // SIMD_REGISTER_AVX
+
+// Scalar version of DivideBy255
+inline Channel DivideBy255( unsigned int a_uiValue )
+{
+    unsigned int uiRounded = a_uiValue + 128;
+    return (Channel)( ( uiRounded + ( uiRounded >> 8 ) ) >> 8 );
+}
+
+// Run a kernel on the floating-point colors it was given, with the widest
+// registers available, and finish whatever is left one color at a time.  Each
+// kernel has a Run< R >( start, end ) template and a RunScalar( start, end )
+// function that do the same arithmetic.
+template< typename K >
+inline void RunColorKernel( const K& ac_roKernel, unsigned int a_uiCount )
+{
+    unsigned int uiDone = 0;
+    Math::SimdLevel eLevel = Math::DetectedSimdLevel();
+#ifdef SIMD_REGISTER_AVX
+    if( Math::SIMD_AVX == eLevel )
+    {
+        uiDone = a_uiCount - a_uiCount % 2;
+        ac_roKernel.template Run< Math::AvxFloatRegister >( 0, uiDone );
+        Math::AvxFloatRegister::Finish();
+    }
+    else
+#endif
+#ifdef SIMD_REGISTER_SSE2
+    if( Math::SIMD_SSE2 <= eLevel )
+    {
+        uiDone = a_uiCount;
+        ac_roKernel.template Run< Math::SseFloatRegister >( 0, uiDone );
+    }
+#endif
+    ac_roKernel.RunScalar( uiDone, a_uiCount );
+}
+
+// Kernels for RunColorKernel
+struct PremultiplyKernel
+{
+    const float* cpIn;
+    float* pOut;
+    template< typename R >
+    void Run( unsigned int a_uiStart, unsigned int a_uiEnd ) const
+    {
+        typedef ColorLanes< R > Lanes;
+        for( unsigned int i = a_uiStart; i < a_uiEnd; i += Lanes::COLORS )
+        {
+            typename R::Type oColors = R::Load( cpIn + 4*i );
+            R::Store( pOut + 4*i,
+                      R::Multiply( oColors, Lanes::AlphaFactor( oColors ) ) );
+        }
+    }
+    void RunScalar( unsigned int a_uiStart, unsigned int a_uiEnd ) const
+    {
+        for( unsigned int i = a_uiStart; i < a_uiEnd; ++i )
+        {
+            float fAlpha = cpIn[ 4*i + 3 ];
+            pOut[ 4*i ] = cpIn[ 4*i ] * fAlpha;
+            pOut[ 4*i + 1 ] = cpIn[ 4*i + 1 ] * fAlpha;
+            pOut[ 4*i + 2 ] = cpIn[ 4*i + 2 ] * fAlpha;
+            pOut[ 4*i + 3 ] = fAlpha;
+        }
+    }
+};
+struct TintKernel
+{
+    const float* cpIn;
+    const ColorVector* cpoTint;
+    float* pOut;
+    template< typename R >
+    void Run( unsigned int a_uiStart, unsigned int a_uiEnd ) const
+    {
+        typedef ColorLanes< R > Lanes;
+        const typename R::Type coTint = Lanes::Repeat( *cpoTint );
+        for( unsigned int i = a_uiStart; i < a_uiEnd; i += Lanes::COLORS )
+        {
+            R::Store( pOut + 4*i,
+                      R::Multiply( R::Load( cpIn + 4*i ), coTint ) );
+        }
+    }
+    void RunScalar( unsigned int a_uiStart, unsigned int a_uiEnd ) const
+    {
+        const float* cpTint = cpoTint->Data();
+        for( unsigned int i = a_uiStart; i < a_uiEnd; ++i )
+        {
+            for( unsigned int j = 0; j < 4; ++j )
+            {
+                pOut[ 4*i + j ] = cpIn[ 4*i + j ] * cpTint[j];
+            }
+        }
+    }
+};
+struct LerpKernel
+{
+    const float* cpFrom;
+    const float* cpTo;
+    float fWeight;
+    float* pOut;
+    template< typename R >
+    void Run( unsigned int a_uiStart, unsigned int a_uiEnd ) const
+    {
+        typedef ColorLanes< R > Lanes;
+        const typename R::Type coWeight = R::Set( fWeight );
+        for( unsigned int i = a_uiStart; i < a_uiEnd; i += Lanes::COLORS )
+        {
+            typename R::Type oFrom = R::Load( cpFrom + 4*i );
+            typename R::Type oDifference =
+                R::Subtract( R::Load( cpTo + 4*i ), oFrom );
+            R::Store( pOut + 4*i,
+                      R::Add( oFrom, R::Multiply( oDifference, coWeight ) ) );
+        }
+    }
+    void RunScalar( unsigned int a_uiStart, unsigned int a_uiEnd ) const
+    {
+        for( unsigned int i = 4 * a_uiStart; i < 4 * a_uiEnd; ++i )
+        {
+            pOut[i] = cpFrom[i] + ( cpTo[i] - cpFrom[i] ) * fWeight;
+        }
+    }
+};
+struct BlendOverKernel
+{
+    const float* cpSource;
+    const float* cpDestination;
+    float* pOut;
+    template< typename R >
+    void Run( unsigned int a_uiStart, unsigned int a_uiEnd ) const
+    {
+        typedef ColorLanes< R > Lanes;
+        const typename R::Type coOne = R::Set( 1.0f );
+        for( unsigned int i = a_uiStart; i < a_uiEnd; i += Lanes::COLORS )
+        {
+            typename R::Type oSource = R::Load( cpSource + 4*i );
+            typename R::Type oRemaining =
+                R::Subtract( coOne, Lanes::Alpha( oSource ) );
+            R::Store( pOut + 4*i,
+                      R::Add( oSource,
+                              R::Multiply( R::Load( cpDestination + 4*i ),
+                                           oRemaining ) ) );
+        }
+    }
+    void RunScalar( unsigned int a_uiStart, unsigned int a_uiEnd ) const
+    {
+        for( unsigned int i = a_uiStart; i < a_uiEnd; ++i )
+        {
+            float fRemaining = 1.0f - cpSource[ 4*i + 3 ];
+            for( unsigned int j = 4*i; j < 4*i + 4; ++j )
+            {
+                pOut[j] = cpSource[j] + cpDestination[j] * fRemaining;
+            }
+        }
+    }
+};
+
+// Lookup tables for sRGB encoding and decoding
+struct SrgbTables
+{
+    // Linear value of each sRGB value
+    float afDecode[ 256 ];
+
+    // Smallest linear value that encodes to each sRGB value, halfway between
+    // it and the one below.  The last entry is past the end of the range.
+    float afThreshold[ 257 ];
+
+    // sRGB value at the start of each 1/4096th of the linear range.  Encoded
+    // values change at most once per step, even near zero where the curve is
+    // steepest, so one comparison with the next threshold finishes the job.
+    Channel aucEncode[ 4096 ];
+
+    SrgbTables()
+    {
+        for( unsigned int i = 0; i < 256; ++i )
+        {
+            afDecode[i] = (float)Decode( i / 255.0 );
+            afThreshold[i] = (float)Decode( ( i - 0.5 ) / 255.0 );
+        }
+        afThreshold[0] = 0.0f;
+        afThreshold[256] = 2.0f;
+        unsigned int uiValue = 0;
+        for( unsigned int i = 0; i < 4096; ++i )
+        {
+            while( (float)( i / 4096.0 ) >= afThreshold[ uiValue + 1 ] )
+            {
+                ++uiValue;
+            }
+            aucEncode[i] = (Channel)uiValue;
+        }
+    }
+
+    // Encode one channel
+    Channel Encode( float a_fValue ) const
+    {
+        if( !( a_fValue > 0.0f ) )  // also catches NaN
+        {
+            return 0x00;
+        }
+        if( a_fValue >= 1.0f )
+        {
+            return 0xFF;
+        }
+        Channel ucValue = aucEncode[ (unsigned int)( a_fValue * 4096 ) ];
+        return ( a_fValue >= afThreshold[ ucValue + 1 ] ? ucValue + 1
+                                                        : ucValue );
+    }
+
+    // The sRGB transfer function, from sRGB to linear
+    static double Decode( double a_dValue )
+    {
+        return ( a_dValue <= 0.04045
+                 ? a_dValue / 12.92
+                 : std::pow( ( a_dValue + 0.055 ) / 1.055, 2.4 ) );
+    }
+
+    // Tables are built while the program starts up, by sc_roSrgbTables below
+    static const SrgbTables& Get()
+    {
+        static const SrgbTables sc_oTables;
+        return sc_oTables;
+    }
+};
+
+namespace
+{
+
+// Visual Studio 2010 doesn't guard function-local statics, so two threads
+// converting colors at once could both start building the tables.  Building
+// them while the library loads, before any threads start, avoids that.
+const SrgbTables& sc_roSrgbTables = SrgbTables::Get();
+
+}   // namespace
+
+// Convert to and from hex values.  On processors with SSE2, which are all
+// little-endian, a hex value is blue, green, red, and alpha bytes in that
+// order.  These stay with SSE2 even when AVX is available, since AVX has no
+// 256-bit integer instructions to pack or unpack with.
+INLINE void ToHex( const ColorVector* ac_paoColors, Hex* a_paoHex,
+                   unsigned int a_uiCount )
+{
+    unsigned int uiDone = 0;
+#ifdef SIMD_REGISTER_SSE2
+    if( Math::SIMD_SSE2 <= Math::DetectedSimdLevel() )
+    {
+        // Scale, clamp, truncate, and then round up anything more than half
+        // way to the next integer, the way ChannelFromFloat does
+        const __m128 coScale = _mm_set1_ps( 255.0f );
+        const __m128 coZero = _mm_setzero_ps();
+        const __m128 coHalf = _mm_set1_ps( 0.5f );
+        uiDone = a_uiCount - a_uiCount % 4;
+        for( unsigned int i = 0; i < uiDone; i += 4 )
+        {
+            __m128i aoChannels[4];
+            for( unsigned int j = 0; j < 4; ++j )
+            {
+                __m128 oScaled = _mm_min_ps(
+                    _mm_max_ps( _mm_mul_ps( _mm_loadu_ps(
+                                    ac_paoColors[ i + j ].Data() ), coScale ),
+                                coZero ), coScale );
+                __m128i oWhole = _mm_cvttps_epi32( oScaled );
+                __m128 oFraction =
+                    _mm_sub_ps( oScaled, _mm_cvtepi32_ps( oWhole ) );
+                oWhole = _mm_sub_epi32( oWhole, _mm_castps_si128(
+                    _mm_cmpgt_ps( oFraction, coHalf ) ) );
+                aoChannels[j] = _mm_shuffle_epi32( oWhole,
+                                                   _MM_SHUFFLE( 3, 0, 1, 2 ) );
+            }
+            _mm_storeu_si128( reinterpret_cast< __m128i* >( a_paoHex + i ),
+                              _mm_packus_epi16(
+                                  _mm_packs_epi32( aoChannels[0],
+                                                   aoChannels[1] ),
+                                  _mm_packs_epi32( aoChannels[2],
+                                                   aoChannels[3] ) ) );
+        }
+    }
+#endif
+    for( unsigned int i = uiDone; i < a_uiCount; ++i )
+    {
+        a_paoHex[i] = (Hex)ac_paoColors[i];
+    }
+}
+INLINE void ToColors( const Hex* ac_paoHex, ColorVector* a_paoColors,
+                      unsigned int a_uiCount )
+{
+    unsigned int uiDone = 0;
+#ifdef SIMD_REGISTER_SSE2
+    if( Math::SIMD_SSE2 <= Math::DetectedSimdLevel() )
+    {
+        // Divide instead of multiplying by 1/255, to match the constructor
+        const __m128 coScale = _mm_set1_ps( 255.0f );
+        const __m128i coZero = _mm_setzero_si128();
+        uiDone = a_uiCount - a_uiCount % 4;
+        for( unsigned int i = 0; i < uiDone; i += 4 )
+        {
+            __m128i oBytes = _mm_loadu_si128(
+                reinterpret_cast< const __m128i* >( ac_paoHex + i ) );
+            __m128i aoPairs[2] = { _mm_unpacklo_epi8( oBytes, coZero ),
+                                   _mm_unpackhi_epi8( oBytes, coZero ) };
+            for( unsigned int j = 0; j < 4; ++j )
+            {
+                __m128i oChannels = ( 0 == j % 2
+                    ? _mm_unpacklo_epi16( aoPairs[ j / 2 ], coZero )
+                    : _mm_unpackhi_epi16( aoPairs[ j / 2 ], coZero ) );
+                oChannels = _mm_shuffle_epi32( oChannels,
+                                               _MM_SHUFFLE( 3, 0, 1, 2 ) );
+                _mm_storeu_ps( a_paoColors[ i + j ].Data(),
+                               _mm_div_ps( _mm_cvtepi32_ps( oChannels ),
+                                           coScale ) );
+            }
+        }
+    }
+#endif
+    for( unsigned int i = uiDone; i < a_uiCount; ++i )
+    {
+        a_paoColors[i] = ac_paoHex[i];
+    }
+}
+
+// Multiply red, green, and blue by alpha
+INLINE void Premultiply( const ColorVector* ac_paoColors,
+                         ColorVector* a_paoResult, unsigned int a_uiCount )
+{
+    PremultiplyKernel oKernel = { ac_paoColors->Data(),
+                                  a_paoResult->Data() };
+    RunColorKernel( oKernel, a_uiCount );
+}
+INLINE void Premultiply( const Hex* ac_paoHex, Hex* a_paoResult,
+                         unsigned int a_uiCount )
+{
+    unsigned int uiDone = 0;
+#ifdef SIMD_REGISTER_SSE2
+    if( Math::SIMD_SSE2 <= Math::DetectedSimdLevel() )
+    {
+        // Two colors per register, with 16 bits per channel.  Alpha is
+        // multiplied by 255, which dividing by 255 undoes exactly.
+        const __m128i coZero = _mm_setzero_si128();
+        const __m128i coAlphaLanes =
+            _mm_set_epi16( -1, 0, 0, 0, -1, 0, 0, 0 );
+        const __m128i coFull = _mm_set1_epi16( 0xFF );
+        uiDone = a_uiCount - a_uiCount % 4;
+        for( unsigned int i = 0; i < uiDone; i += 4 )
+        {
+            __m128i oBytes = _mm_loadu_si128(
+                reinterpret_cast< const __m128i* >( ac_paoHex + i ) );
+            __m128i aoPairs[2] = { _mm_unpacklo_epi8( oBytes, coZero ),
+                                   _mm_unpackhi_epi8( oBytes, coZero ) };
+            for( unsigned int j = 0; j < 2; ++j )
+            {
+                __m128i oAlpha = _mm_shufflehi_epi16(
+                    _mm_shufflelo_epi16( aoPairs[j], 0xFF ), 0xFF );
+                oAlpha = _mm_or_si128( _mm_andnot_si128( coAlphaLanes, oAlpha ),
+                                       _mm_and_si128( coAlphaLanes, coFull ) );
+                aoPairs[j] =
+                    DivideBy255( _mm_mullo_epi16( aoPairs[j], oAlpha ) );
+            }
+            _mm_storeu_si128( reinterpret_cast< __m128i* >( a_paoResult + i ),
+                              _mm_packus_epi16( aoPairs[0], aoPairs[1] ) );
+        }
+    }
+#endif
+    for( unsigned int i = uiDone; i < a_uiCount; ++i )
+    {
+        Hex oHex = ac_paoHex[i];
+        oHex.r = DivideBy255( oHex.r * oHex.a );
+        oHex.g = DivideBy255( oHex.g * oHex.a );
+        oHex.b = DivideBy255( oHex.b * oHex.a );
+        a_paoResult[i] = oHex;
+    }
+}
+
+// Multiply by a tint
+INLINE void Tint( const ColorVector* ac_paoColors,
+                  const ColorVector& ac_roTint,
+                  ColorVector* a_paoResult, unsigned int a_uiCount )
+{
+    ColorVector oTint( ac_roTint );     // in case it's in the output
+    TintKernel oKernel = { ac_paoColors->Data(), &oTint,
+                           a_paoResult->Data() };
+    RunColorKernel( oKernel, a_uiCount );
+}
+INLINE void Tint( const Hex* ac_paoHex, const Hex& ac_rTint,
+                  Hex* a_paoResult, unsigned int a_uiCount )
+{
+    Hex oTint( ac_rTint.i );
+    unsigned int uiDone = 0;
+#ifdef SIMD_REGISTER_SSE2
+    if( Math::SIMD_SSE2 <= Math::DetectedSimdLevel() )
+    {
+        const __m128i coZero = _mm_setzero_si128();
+        const __m128i coTint = _mm_unpacklo_epi8(
+            _mm_set1_epi32( (int)oTint.i ), coZero );
+        uiDone = a_uiCount - a_uiCount % 4;
+        for( unsigned int i = 0; i < uiDone; i += 4 )
+        {
+            __m128i oBytes = _mm_loadu_si128(
+                reinterpret_cast< const __m128i* >( ac_paoHex + i ) );
+            __m128i oLow = DivideBy255( _mm_mullo_epi16(
+                _mm_unpacklo_epi8( oBytes, coZero ), coTint ) );
+            __m128i oHigh = DivideBy255( _mm_mullo_epi16(
+                _mm_unpackhi_epi8( oBytes, coZero ), coTint ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i* >( a_paoResult + i ),
+                              _mm_packus_epi16( oLow, oHigh ) );
+        }
+    }
+#endif
+    for( unsigned int i = uiDone; i < a_uiCount; ++i )
+    {
+        Hex oHex = ac_paoHex[i];
+        for( unsigned int j = 0; j < 4; ++j )
+        {
+            oHex.c[j] = DivideBy255( oHex.c[j] * oTint.c[j] );
+        }
+        a_paoResult[i] = oHex;
+    }
+}
+
+// Linear interpolation
+INLINE void Lerp( const ColorVector* ac_paoFrom,
+                  const ColorVector* ac_paoTo, float a_fWeight,
+                  ColorVector* a_paoResult, unsigned int a_uiCount )
+{
+    LerpKernel oKernel = { ac_paoFrom->Data(), ac_paoTo->Data(), a_fWeight,
+                           a_paoResult->Data() };
+    RunColorKernel( oKernel, a_uiCount );
+}
+INLINE void Lerp( const Hex* ac_paoFrom, const Hex* ac_paoTo,
+                  Channel a_ucWeight, Hex* a_paoResult,
+                  unsigned int a_uiCount )
+{
+    unsigned int uiDone = 0;
+#ifdef SIMD_REGISTER_SSE2
+    if( Math::SIMD_SSE2 <= Math::DetectedSimdLevel() )
+    {
+        // Both products fit in 16 bits, and so does their sum
+        const __m128i coZero = _mm_setzero_si128();
+        const __m128i coTo = _mm_set1_epi16( a_ucWeight );
+        const __m128i coFrom = _mm_set1_epi16( 0xFF - a_ucWeight );
+        uiDone = a_uiCount - a_uiCount % 4;
+        for( unsigned int i = 0; i < uiDone; i += 4 )
+        {
+            __m128i oFrom = _mm_loadu_si128(
+                reinterpret_cast< const __m128i* >( ac_paoFrom + i ) );
+            __m128i oTo = _mm_loadu_si128(
+                reinterpret_cast< const __m128i* >( ac_paoTo + i ) );
+            __m128i oLow = DivideBy255( _mm_add_epi16(
+                _mm_mullo_epi16( _mm_unpacklo_epi8( oFrom, coZero ), coFrom ),
+                _mm_mullo_epi16( _mm_unpacklo_epi8( oTo, coZero ), coTo ) ) );
+            __m128i oHigh = DivideBy255( _mm_add_epi16(
+                _mm_mullo_epi16( _mm_unpackhi_epi8( oFrom, coZero ), coFrom ),
+                _mm_mullo_epi16( _mm_unpackhi_epi8( oTo, coZero ), coTo ) ) );
+            _mm_storeu_si128( reinterpret_cast< __m128i* >( a_paoResult + i ),
+                              _mm_packus_epi16( oLow, oHigh ) );
+        }
+    }
+#endif
+    for( unsigned int i = uiDone; i < a_uiCount; ++i )
+    {
+        Hex oFrom = ac_paoFrom[i];
+        Hex oTo = ac_paoTo[i];
+        for( unsigned int j = 0; j < 4; ++j )
+        {
+            oFrom.c[j] = DivideBy255( oFrom.c[j] * ( 0xFF - a_ucWeight ) +
+                                      oTo.c[j] * a_ucWeight );
+        }
+        a_paoResult[i] = oFrom;
+    }
+}
+
+// Draw premultiplied colors over others
+INLINE void BlendOver( const ColorVector* ac_paoSource,
+                       const ColorVector* ac_paoDestination,
+                       ColorVector* a_paoResult, unsigned int a_uiCount )
+{
+    BlendOverKernel oKernel = { ac_paoSource->Data(),
+                                ac_paoDestination->Data(),
+                                a_paoResult->Data() };
+    RunColorKernel( oKernel, a_uiCount );
+}
+
+// Convert between sRGB and linear colors.  Table lookups can't be vectorized
+// without AVX2 gathers, but they're still far cheaper than pow.
+INLINE void SrgbToLinear( const Hex* ac_paoHex, ColorVector* a_paoColors,
+                          unsigned int a_uiCount )
+{
+    const SrgbTables& croTables = SrgbTables::Get();
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        Hex oHex = ac_paoHex[i];
+        ColorVector& roColor = a_paoColors[i];
+        roColor.r() = croTables.afDecode[ oHex.r ];
+        roColor.g() = croTables.afDecode[ oHex.g ];
+        roColor.b() = croTables.afDecode[ oHex.b ];
+        roColor.a() = (float)oHex.a / 0xFF;
+    }
+}
+INLINE void LinearToSrgb( const ColorVector* ac_paoColors, Hex* a_paoHex,
+                          unsigned int a_uiCount )
+{
+    const SrgbTables& croTables = SrgbTables::Get();
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        const ColorVector& croColor = ac_paoColors[i];
+        a_paoHex[i] = Hex( croTables.Encode( croColor.r() ),
+                           croTables.Encode( croColor.g() ),
+                           croTables.Encode( croColor.b() ),
+                           ChannelFromFloat( croColor.a() ) );
+    }
+}
+
+}   // namespace Color
+
+#endif  // COLOR_VECTOR__BATCH__INL
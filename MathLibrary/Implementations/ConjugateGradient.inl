@@ -0,0 +1,263 @@
+/******************************************************************************
+ * File:               ConjugateGradient.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Template implementations for the conjugate-gradient
+ *                      solver.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  OpenMP pragmas only compile with OpenMP on.
+ ******************************************************************************/
+
+#ifndef CONJUGATE_GRADIENT__INL
+#define CONJUGATE_GRADIENT__INL
+
+#include "../Declarations/ConjugateGradient.h"
+#include <cmath>    // for sqrt
+#include <stdexcept>
+
+namespace Math
+{
+
+// Vector kernels for the iteration, each fused so that it makes one pass over
+// its vectors.  Every element is independent, so large vectors split across
+// threads, with the dot products combined by OpenMP reductions.
+template< typename T >
+struct ConjugateGradientKernels
+{
+    // Return a . b
+    static T Dot( const T* ac_pA, const T* ac_pB, unsigned int a_uiSize )
+    {
+        const int iSize = (int)a_uiSize;
+        T tSum = 0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction( +: tSum ) \
+                         if( a_uiSize >= SPARSE_THREAD_WORK )
+#endif
+        for( int i = 0; i < iSize; ++i )
+        {
+            tSum += ac_pA[i] * ac_pB[i];
+        }
+        return tSum;
+    }
+
+    // r = b - r, returning |r|^2
+    static T Residual( const T* ac_pRight, T* a_pResidual,
+                       unsigned int a_uiSize )
+    {
+        const int iSize = (int)a_uiSize;
+        T tSum = 0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction( +: tSum ) \
+                         if( a_uiSize >= SPARSE_THREAD_WORK )
+#endif
+        for( int i = 0; i < iSize; ++i )
+        {
+            a_pResidual[i] = ac_pRight[i] - a_pResidual[i];
+            tSum += a_pResidual[i] * a_pResidual[i];
+        }
+        return tSum;
+    }
+
+    // x += alpha * p and r -= alpha * q, returning |r|^2
+    static T Step( T a_tAlpha, const T* ac_pDirection, const T* ac_pProduct,
+                   T* a_pResult, T* a_pResidual, unsigned int a_uiSize )
+    {
+        const int iSize = (int)a_uiSize;
+        T tSum = 0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction( +: tSum ) \
+                         if( a_uiSize >= SPARSE_THREAD_WORK )
+#endif
+        for( int i = 0; i < iSize; ++i )
+        {
+            a_pResult[i] += a_tAlpha * ac_pDirection[i];
+            a_pResidual[i] -= a_tAlpha * ac_pProduct[i];
+            tSum += a_pResidual[i] * a_pResidual[i];
+        }
+        return tSum;
+    }
+
+    // z = r / diagonal, returning r . z
+    static T Precondition( const T* ac_pInverseDiagonal, const T* ac_pResidual,
+                           T* a_pPreconditioned, unsigned int a_uiSize )
+    {
+        const int iSize = (int)a_uiSize;
+        T tSum = 0;
+#ifdef _OPENMP
+#pragma omp parallel for reduction( +: tSum ) \
+                         if( a_uiSize >= SPARSE_THREAD_WORK )
+#endif
+        for( int i = 0; i < iSize; ++i )
+        {
+            a_pPreconditioned[i] = ac_pInverseDiagonal[i] * ac_pResidual[i];
+            tSum += ac_pResidual[i] * a_pPreconditioned[i];
+        }
+        return tSum;
+    }
+
+    // p = z + beta * p
+    static void Direction( const T* ac_pPreconditioned, T a_tBeta,
+                           T* a_pDirection, unsigned int a_uiSize )
+    {
+        const int iSize = (int)a_uiSize;
+#ifdef _OPENMP
+#pragma omp parallel for if( a_uiSize >= SPARSE_THREAD_WORK )
+#endif
+        for( int i = 0; i < iSize; ++i )
+        {
+            a_pDirection[i] = ac_pPreconditioned[i] + a_tBeta * a_pDirection[i];
+        }
+    }
+};
+
+template< typename T >
+inline ConjugateGradient< T >::
+    ConjugateGradient( unsigned int a_uiMaxIterations, T a_tTolerance,
+                       Preconditioner a_ePreconditioner )
+    : m_uiMaxIterations( a_uiMaxIterations ), m_tTolerance( a_tTolerance ),
+      m_ePreconditioner( a_ePreconditioner ), m_uiIterations( 0 ),
+      m_tResidual( 0 ) {}
+
+// Settings
+template< typename T >
+inline ConjugateGradient< T >& ConjugateGradient< T >::
+    SetMaxIterations( unsigned int a_uiMaxIterations )
+{
+    m_uiMaxIterations = a_uiMaxIterations;
+    return *this;
+}
+template< typename T >
+inline ConjugateGradient< T >& ConjugateGradient< T >::
+    SetTolerance( T a_tTolerance )
+{
+    m_tTolerance = a_tTolerance;
+    return *this;
+}
+template< typename T >
+inline ConjugateGradient< T >& ConjugateGradient< T >::
+    SetPreconditioner( Preconditioner a_ePreconditioner )
+{
+    m_ePreconditioner = a_ePreconditioner;
+    return *this;
+}
+
+// Solve A*x = b.  Without a preconditioner, z is just r, so r . z is the
+// squared residual that Step already computed.
+template< typename T >
+bool ConjugateGradient< T >::Solve( const SparseMatrix< T >& ac_roMatrix,
+                                    const DenseVector< T >& ac_roRight,
+                                    DenseVector< T >& a_roResult )
+{
+    typedef ConjugateGradientKernels< T > Kernels;
+    const unsigned int N = ac_roMatrix.Rows();
+    if( !ac_roMatrix.IsSquare() || ac_roRight.Size() != N )
+    {
+        throw std::invalid_argument(
+            "Cannot solve a system with mismatched dimensions" );
+    }
+    if( a_roResult.Size() != N )
+    {
+        a_roResult.SetSize( N );
+    }
+    m_uiIterations = 0;
+    m_tResidual = 0;
+
+    const T tRightSquared = Kernels::Dot( ac_roRight.Data(),
+                                          ac_roRight.Data(), N );
+    if( 0 == tRightSquared )
+    {
+        a_roResult.Fill( 0 );
+        return true;
+    }
+    const T tLimit = m_tTolerance * m_tTolerance * tRightSquared;
+
+    // Inverse of the diagonal, or nothing for no preconditioning
+    DenseVector< T > oInverseDiagonal;
+    if( PRECONDITIONER_JACOBI == m_ePreconditioner )
+    {
+        oInverseDiagonal = ac_roMatrix.Diagonal();
+        for( unsigned int i = 0; i < N; ++i )
+        {
+            T& rValue = oInverseDiagonal.Data()[i];
+            if( !( rValue > 0 ) )
+            {
+                // Not positive definite.  Zero is the only result that makes
+                // sense without iterating, and |b - A*0| / |b| is 1.
+                a_roResult.Fill( 0 );
+                m_tResidual = 1;
+                return false;
+            }
+            rValue = 1 / rValue;
+        }
+    }
+    const bool cbPrecondition = ( 0 < oInverseDiagonal.Size() );
+
+    // r = b - A*x
+    DenseVector< T > oResidual( N );
+    ac_roMatrix.Multiply( a_roResult.Data(), oResidual.Data() );
+    T tResidualSquared = Kernels::Residual( ac_roRight.Data(),
+                                            oResidual.Data(), N );
+
+    // p = z
+    DenseVector< T > oPreconditioned;
+    T tRZ = tResidualSquared;
+    if( cbPrecondition )
+    {
+        oPreconditioned.SetSize( N );
+        tRZ = Kernels::Precondition( oInverseDiagonal.Data(),
+                                     oResidual.Data(),
+                                     oPreconditioned.Data(), N );
+    }
+    DenseVector< T > oDirection( cbPrecondition ? oPreconditioned
+                                                 : oResidual );
+    DenseVector< T > oProduct( N );
+
+    while( tResidualSquared > tLimit && m_uiIterations < m_uiMaxIterations )
+    {
+        // Step as far along p as minimizes the error in the A-norm
+        ac_roMatrix.Multiply( oDirection.Data(), oProduct.Data() );
+        T tCurvature = Kernels::Dot( oDirection.Data(), oProduct.Data(), N );
+        if( !( tCurvature > 0 ) )
+        {
+            break;  // not positive definite
+        }
+        T tAlpha = tRZ / tCurvature;
+        tResidualSquared = Kernels::Step( tAlpha, oDirection.Data(),
+                                          oProduct.Data(), a_roResult.Data(),
+                                          oResidual.Data(), N );
+        ++m_uiIterations;
+
+        // Next direction is conjugate to all of the previous ones
+        T tNextRZ = tResidualSquared;
+        if( cbPrecondition )
+        {
+            tNextRZ = Kernels::Precondition( oInverseDiagonal.Data(),
+                                             oResidual.Data(),
+                                             oPreconditioned.Data(), N );
+        }
+        Kernels::Direction( cbPrecondition ? oPreconditioned.Data()
+                                           : oResidual.Data(),
+                            tNextRZ / tRZ, oDirection.Data(), N );
+        tRZ = tNextRZ;
+    }
+
+    m_tResidual = std::sqrt( tResidualSquared / tRightSquared );
+    return ( tResidualSquared <= tLimit );
+}
+template< typename T >
+template< unsigned int N, bool t_bIsRow >
+inline bool ConjugateGradient< T >::
+    Solve( const SparseMatrix< T >& ac_roMatrix,
+           const Vector< T, N, t_bIsRow >& ac_roRight,
+           Vector< T, N, t_bIsRow >& a_roResult )
+{
+    DenseVector< T > oResult( a_roResult );
+    bool bConverged = Solve( ac_roMatrix, DenseVector< T >( ac_roRight ),
+                             oResult );
+    oResult.AssignTo( a_roResult );
+    return bConverged;
+}
+
+}   // namespace Math
+
+#endif  // CONJUGATE_GRADIENT__INL
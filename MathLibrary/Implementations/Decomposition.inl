@@ -0,0 +1,638 @@
+/******************************************************************************
+ * File:               Decomposition.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Template implementations for matrix decompositions.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Rank test allows for rounding error.
+ ******************************************************************************/
+
+#ifndef DECOMPOSITION__INL
+#define DECOMPOSITION__INL
+
+#include "../Declarations/Decomposition.h"
+#include "../Declarations/Functions.h"
+#include <cmath>        // for abs and sqrt
+#include <limits>       // for numeric_limits
+#include <type_traits>  // for is_integral
+#include <utility>      // for swap
+
+namespace Math
+{
+
+//
+// LU
+//
+
+// Factor the given matrix
+template< typename T, unsigned int N >
+inline LU< T, N >::LU( const T (&ac_raaMatrix)[ N ][ N ] )
+{
+    Factor( &ac_raaMatrix[0][0] );
+}
+template< typename T, unsigned int N >
+inline LU< T, N >::LU( const Matrix< T, N, N >& ac_roMatrix )
+{
+    Factor( ac_roMatrix.Data() );
+}
+
+// Swap the row with the largest value in each column up to the diagonal to
+// keep the multipliers small, then eliminate the column below the diagonal
+template< typename T, unsigned int N >
+template< typename U >
+void LU< T, N >::Factor( const U* ac_pMatrix )
+{
+    for( unsigned int i = 0; i < N; ++i )
+    {
+        for( unsigned int j = 0; j < N; ++j )
+        {
+            m_aaLU[i][j] = (InverseT)ac_pMatrix[ i*N + j ];
+        }
+        m_auiPivot[i] = i;
+    }
+    m_tSign = 1;
+    m_bInvertable = true;
+    for( unsigned int k = 0; k < N; ++k )
+    {
+        unsigned int uiPivot = k;
+        for( unsigned int i = k + 1; i < N; ++i )
+        {
+            if( std::abs( m_aaLU[i][k] ) > std::abs( m_aaLU[uiPivot][k] ) )
+            {
+                uiPivot = i;
+            }
+        }
+        if( 0 == m_aaLU[uiPivot][k] )
+        {
+            m_bInvertable = false;
+            return;
+        }
+        if( uiPivot != k )
+        {
+            for( unsigned int j = 0; j < N; ++j )
+            {
+                std::swap( m_aaLU[k][j], m_aaLU[uiPivot][j] );
+            }
+            std::swap( m_auiPivot[k], m_auiPivot[uiPivot] );
+            m_tSign = -m_tSign;
+        }
+        for( unsigned int i = k + 1; i < N; ++i )
+        {
+            m_aaLU[i][k] /= m_aaLU[k][k];
+            for( unsigned int j = k + 1; j < N; ++j )
+            {
+                m_aaLU[i][j] -= m_aaLU[i][k] * m_aaLU[k][j];
+            }
+        }
+    }
+}
+
+// Determinant of the original matrix, or 0 if it was singular
+template< typename T, unsigned int N >
+inline T LU< T, N >::Determinant() const
+{
+    if( !m_bInvertable )
+    {
+        return 0;
+    }
+    InverseT tDeterminant = m_tSign;
+    for( unsigned int i = 0; i < N; ++i )
+    {
+        tDeterminant *= m_aaLU[i][i];
+    }
+
+    // The determinant of an integer matrix is an integer, so don't let
+    // rounding error truncate it to the wrong one.
+    return (T)( std::is_integral< T >::value ? Round( tDeterminant )
+                                              : tDeterminant );
+}
+
+// Solve L*U*X = P*B, a whole row of X at a time
+template< typename T, unsigned int N >
+void LU< T, N >::Solve( const InverseT* ac_pRight, InverseT* a_pResult,
+                        unsigned int a_uiColumns ) const
+{
+    const unsigned int P = a_uiColumns;
+    for( unsigned int i = 0; i < N; ++i )
+    {
+        InverseT* pRow = a_pResult + i*P;
+        const InverseT* pRight = ac_pRight + m_auiPivot[i] * P;
+        for( unsigned int j = 0; j < P; ++j )
+        {
+            pRow[j] = pRight[j];
+        }
+        for( unsigned int k = 0; k < i; ++k )
+        {
+            const InverseT* pSolved = a_pResult + k*P;
+            for( unsigned int j = 0; j < P; ++j )
+            {
+                pRow[j] -= m_aaLU[i][k] * pSolved[j];
+            }
+        }
+    }
+    for( unsigned int i = N; i-- > 0; )
+    {
+        InverseT* pRow = a_pResult + i*P;
+        for( unsigned int k = i + 1; k < N; ++k )
+        {
+            const InverseT* pSolved = a_pResult + k*P;
+            for( unsigned int j = 0; j < P; ++j )
+            {
+                pRow[j] -= m_aaLU[i][k] * pSolved[j];
+            }
+        }
+        for( unsigned int j = 0; j < P; ++j )
+        {
+            pRow[j] /= m_aaLU[i][i];
+        }
+    }
+}
+
+// Solve A*X = B for X
+template< typename T, unsigned int N >
+template< typename U, unsigned int P >
+inline bool LU< T, N >::Solve( const Matrix< U, N, P >& ac_roRight,
+                               Matrix< InverseT, N, P >& a_roResult ) const
+{
+    if( !m_bInvertable )
+    {
+        return false;
+    }
+    Matrix< InverseT, N, P > oRight( ac_roRight );
+    Solve( oRight.Data(), a_roResult.Data(), P );
+    return true;
+}
+
+// Solve X*A = B for X.  With A = P^T*L*U, each row x of X satisfies
+// x*P^T*L*U = b, so solve y*U = b forward, then z*L = y backward, and then
+// unscramble x = z*P.
+template< typename T, unsigned int N >
+template< typename U, unsigned int P >
+inline bool LU< T, N >::Divide( const Matrix< U, P, N >& ac_roLeft,
+                                Matrix< InverseT, P, N >& a_roResult ) const
+{
+    if( !m_bInvertable )
+    {
+        return false;
+    }
+    Matrix< InverseT, P, N > oLeft( ac_roLeft );
+    for( unsigned int r = 0; r < P; ++r )
+    {
+        InverseT* pRow = oLeft.Data() + r*N;
+        for( unsigned int j = 0; j < N; ++j )
+        {
+            for( unsigned int k = 0; k < j; ++k )
+            {
+                pRow[j] -= pRow[k] * m_aaLU[k][j];
+            }
+            pRow[j] /= m_aaLU[j][j];
+        }
+        for( unsigned int j = N; j-- > 0; )
+        {
+            for( unsigned int k = j + 1; k < N; ++k )
+            {
+                pRow[j] -= pRow[k] * m_aaLU[k][j];
+            }
+        }
+        InverseT* pResult = a_roResult.Data() + r*N;
+        for( unsigned int i = 0; i < N; ++i )
+        {
+            pResult[ m_auiPivot[i] ] = pRow[i];
+        }
+    }
+    return true;
+}
+
+// A^-1, by solving A*X = I
+template< typename T, unsigned int N >
+inline bool LU< T, N >::Inverse( Matrix< InverseT, N, N >& a_roInverse ) const
+{
+    return Inverse( *reinterpret_cast< InverseT (*)[ N ][ N ] >(
+                        a_roInverse.Data() ) );
+}
+template< typename T, unsigned int N >
+inline bool LU< T, N >::Inverse( InverseT (&a_raaInverse)[ N ][ N ] ) const
+{
+    if( !m_bInvertable )
+    {
+        return false;
+    }
+    InverseT aaIdentity[ N ][ N ];
+    for( unsigned int i = 0; i < N; ++i )
+    {
+        for( unsigned int j = 0; j < N; ++j )
+        {
+            aaIdentity[i][j] = ( i == j ? 1 : 0 );
+        }
+    }
+    Solve( &aaIdentity[0][0], &a_raaInverse[0][0], N );
+    return true;
+}
+
+//
+// QR
+//
+
+// Factor the given matrix.  Each reflection zeroes one column of A below the
+// diagonal and is stored as the vector it reflects across, scaled so that its
+// first element is 1 + |column| / |column|, which saves storing its length.
+template< typename T, unsigned int M, unsigned int N >
+QR< T, M, N >::QR( const Matrix< T, M, N >& ac_roMatrix )
+{
+    const T* pMatrix = ac_roMatrix.Data();
+    for( unsigned int i = 0; i < M*N; ++i )
+    {
+        m_aaQR[i/N][i%N] = (InverseT)pMatrix[i];
+    }
+    for( unsigned int j = 0; j < N; ++j )
+    {
+        m_aRDiagonal[j] = 0;
+    }
+    for( unsigned int k = 0; k < K; ++k )
+    {
+        // Length of this column on and below the diagonal, with the sign of
+        // the diagonal element so that adding doesn't cancel
+        InverseT tNorm = 0;
+        for( unsigned int i = k; i < M; ++i )
+        {
+            tNorm += m_aaQR[i][k] * m_aaQR[i][k];
+        }
+        tNorm = std::sqrt( tNorm );
+        if( 0 == tNorm )
+        {
+            continue;
+        }
+        if( m_aaQR[k][k] < 0 )
+        {
+            tNorm = -tNorm;
+        }
+        for( unsigned int i = k; i < M; ++i )
+        {
+            m_aaQR[i][k] /= tNorm;
+        }
+        m_aaQR[k][k] += 1;
+
+        // Reflect the remaining columns, a row at a time
+        InverseT aDot[ N ];
+        for( unsigned int j = k + 1; j < N; ++j )
+        {
+            aDot[j] = 0;
+        }
+        for( unsigned int i = k; i < M; ++i )
+        {
+            for( unsigned int j = k + 1; j < N; ++j )
+            {
+                aDot[j] += m_aaQR[i][k] * m_aaQR[i][j];
+            }
+        }
+        for( unsigned int j = k + 1; j < N; ++j )
+        {
+            aDot[j] = -aDot[j] / m_aaQR[k][k];
+        }
+        for( unsigned int i = k; i < M; ++i )
+        {
+            for( unsigned int j = k + 1; j < N; ++j )
+            {
+                m_aaQR[i][j] += aDot[j] * m_aaQR[i][k];
+            }
+        }
+        m_aRDiagonal[k] = -tNorm;
+    }
+}
+
+// True if the columns of A are linearly independent.  Rounding error means
+// the diagonal of R is rarely exactly zero even when they aren't, so anything
+// too small to matter next to the largest diagonal element counts as zero.
+template< typename T, unsigned int M, unsigned int N >
+inline bool QR< T, M, N >::IsFullRank() const
+{
+    if( M < N )
+    {
+        return false;
+    }
+    InverseT tLargest = 0;
+    for( unsigned int j = 0; j < N; ++j )
+    {
+        if( std::abs( m_aRDiagonal[j] ) > tLargest )
+        {
+            tLargest = std::abs( m_aRDiagonal[j] );
+        }
+    }
+    const InverseT ctTolerance =
+        tLargest * M * std::numeric_limits< InverseT >::epsilon();
+    for( unsigned int j = 0; j < N; ++j )
+    {
+        if( !( std::abs( m_aRDiagonal[j] ) > ctTolerance ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Least-squares solution of A*X = B: apply Q^T to B, then solve R*X = Q^T*B
+// by back substitution.  Rows of Q^T*B past N are the residual and ignored.
+template< typename T, unsigned int M, unsigned int N >
+template< typename U, unsigned int P >
+inline bool QR< T, M, N >::Solve( const Matrix< U, M, P >& ac_roRight,
+                                  Matrix< InverseT, N, P >& a_roResult ) const
+{
+    if( !IsFullRank() )
+    {
+        return false;
+    }
+    Matrix< InverseT, M, P > oRight( ac_roRight );
+    InverseT* pRight = oRight.Data();
+    for( unsigned int k = 0; k < K; ++k )
+    {
+        InverseT aDot[ P ];
+        for( unsigned int j = 0; j < P; ++j )
+        {
+            aDot[j] = 0;
+        }
+        for( unsigned int i = k; i < M; ++i )
+        {
+            for( unsigned int j = 0; j < P; ++j )
+            {
+                aDot[j] += m_aaQR[i][k] * pRight[ i*P + j ];
+            }
+        }
+        for( unsigned int j = 0; j < P; ++j )
+        {
+            aDot[j] = -aDot[j] / m_aaQR[k][k];
+        }
+        for( unsigned int i = k; i < M; ++i )
+        {
+            for( unsigned int j = 0; j < P; ++j )
+            {
+                pRight[ i*P + j ] += aDot[j] * m_aaQR[i][k];
+            }
+        }
+    }
+    for( unsigned int k = N; k-- > 0; )
+    {
+        for( unsigned int j = 0; j < P; ++j )
+        {
+            pRight[ k*P + j ] /= m_aRDiagonal[k];
+        }
+        for( unsigned int i = 0; i < k; ++i )
+        {
+            for( unsigned int j = 0; j < P; ++j )
+            {
+                pRight[ i*P + j ] -= pRight[ k*P + j ] * m_aaQR[i][k];
+            }
+        }
+    }
+    InverseT* pResult = a_roResult.Data();
+    for( unsigned int i = 0; i < N*P; ++i )
+    {
+        pResult[i] = pRight[i];
+    }
+    return true;
+}
+
+// X = B * R^-1 * Q1^T, where Q1 is the first N columns of Q.  For each row b,
+// solve y*R = b forward, then reflect ( y, 0 ) back through Q in reverse
+// order.
+template< typename T, unsigned int M, unsigned int N >
+template< typename U, unsigned int P >
+inline bool QR< T, M, N >::Divide( const Matrix< U, P, N >& ac_roLeft,
+                                   Matrix< InverseT, P, M >& a_roResult ) const
+{
+    if( !IsFullRank() )
+    {
+        return false;
+    }
+    Matrix< InverseT, P, N > oLeft( ac_roLeft );
+    Matrix< InverseT, P, M > oResult;
+    for( unsigned int r = 0; r < P; ++r )
+    {
+        const InverseT* pLeft = oLeft.Data() + r*N;
+        InverseT* pRow = oResult.Data() + r*M;
+        for( unsigned int j = 0; j < N; ++j )
+        {
+            pRow[j] = pLeft[j];
+            for( unsigned int k = 0; k < j; ++k )
+            {
+                pRow[j] -= pRow[k] * m_aaQR[k][j];
+            }
+            pRow[j] /= m_aRDiagonal[j];
+        }
+        for( unsigned int i = N; i < M; ++i )
+        {
+            pRow[i] = 0;
+        }
+        for( unsigned int k = K; k-- > 0; )
+        {
+            InverseT tDot = 0;
+            for( unsigned int i = k; i < M; ++i )
+            {
+                tDot += m_aaQR[i][k] * pRow[i];
+            }
+            tDot = -tDot / m_aaQR[k][k];
+            for( unsigned int i = k; i < M; ++i )
+            {
+                pRow[i] += tDot * m_aaQR[i][k];
+            }
+        }
+    }
+    a_roResult = oResult;
+    return true;
+}
+
+// A^+ = R^-1 * Q1^T, the least-squares solution of A*X = I
+template< typename T, unsigned int M, unsigned int N >
+inline bool QR< T, M, N >::
+    LeftInverse( Matrix< InverseT, N, M >& a_roInverse ) const
+{
+    return Solve( Matrix< InverseT, M, M >::Identity(), a_roInverse );
+}
+
+//
+// Cholesky
+//
+
+// Factor the given matrix one column at a time.  The matrix is positive
+// definite exactly when every diagonal element comes out positive.
+template< typename T, unsigned int N >
+Cholesky< T, N >::Cholesky( const Matrix< T, N, N >& ac_roMatrix )
+    : m_bPositiveDefinite( true )
+{
+    const T* pMatrix = ac_roMatrix.Data();
+    for( unsigned int i = 0; i < N; ++i )
+    {
+        for( unsigned int j = 0; j < N; ++j )
+        {
+            m_aaL[i][j] = ( j <= i ? (InverseT)pMatrix[ i*N + j ] : 0 );
+        }
+    }
+    for( unsigned int j = 0; j < N; ++j )
+    {
+        for( unsigned int k = 0; k < j; ++k )
+        {
+            m_aaL[j][j] -= m_aaL[j][k] * m_aaL[j][k];
+        }
+        if( !( m_aaL[j][j] > 0 ) )
+        {
+            m_bPositiveDefinite = false;
+            return;
+        }
+        m_aaL[j][j] = std::sqrt( m_aaL[j][j] );
+        for( unsigned int i = j + 1; i < N; ++i )
+        {
+            for( unsigned int k = 0; k < j; ++k )
+            {
+                m_aaL[i][j] -= m_aaL[i][k] * m_aaL[j][k];
+            }
+            m_aaL[i][j] /= m_aaL[j][j];
+        }
+    }
+}
+
+// Determinant of the original matrix, or 0 if it wasn't positive definite
+template< typename T, unsigned int N >
+inline typename Cholesky< T, N >::InverseT Cholesky< T, N >::Determinant() const
+{
+    if( !m_bPositiveDefinite )
+    {
+        return 0;
+    }
+    InverseT tDeterminant = 1;
+    for( unsigned int i = 0; i < N; ++i )
+    {
+        tDeterminant *= m_aaL[i][i] * m_aaL[i][i];
+    }
+    return tDeterminant;
+}
+
+// Solve L*y = b forward, then L^T*x = y backward
+template< typename T, unsigned int N >
+void Cholesky< T, N >::Solve( InverseT* a_pVector,
+                              unsigned int a_uiStride ) const
+{
+    for( unsigned int i = 0; i < N; ++i )
+    {
+        InverseT& rValue = a_pVector[ i * a_uiStride ];
+        for( unsigned int k = 0; k < i; ++k )
+        {
+            rValue -= m_aaL[i][k] * a_pVector[ k * a_uiStride ];
+        }
+        rValue /= m_aaL[i][i];
+    }
+    for( unsigned int i = N; i-- > 0; )
+    {
+        InverseT& rValue = a_pVector[ i * a_uiStride ];
+        for( unsigned int k = i + 1; k < N; ++k )
+        {
+            rValue -= m_aaL[k][i] * a_pVector[ k * a_uiStride ];
+        }
+        rValue /= m_aaL[i][i];
+    }
+}
+
+// Solve A*X = B for X, one column at a time
+template< typename T, unsigned int N >
+template< typename U, unsigned int P >
+inline bool Cholesky< T, N >::
+    Solve( const Matrix< U, N, P >& ac_roRight,
+           Matrix< InverseT, N, P >& a_roResult ) const
+{
+    if( !m_bPositiveDefinite )
+    {
+        return false;
+    }
+    a_roResult = ac_roRight;
+    for( unsigned int j = 0; j < P; ++j )
+    {
+        Solve( a_roResult.Data() + j, P );
+    }
+    return true;
+}
+
+// Solve X*A = B for X, one row at a time
+template< typename T, unsigned int N >
+template< typename U, unsigned int P >
+inline bool Cholesky< T, N >::
+    Divide( const Matrix< U, P, N >& ac_roLeft,
+            Matrix< InverseT, P, N >& a_roResult ) const
+{
+    if( !m_bPositiveDefinite )
+    {
+        return false;
+    }
+    a_roResult = ac_roLeft;
+    for( unsigned int i = 0; i < P; ++i )
+    {
+        Solve( a_roResult.Data() + i*N, 1 );
+    }
+    return true;
+}
+
+// A^-1, by solving A*X = I
+template< typename T, unsigned int N >
+inline bool Cholesky< T, N >::
+    Inverse( Matrix< InverseT, N, N >& a_roInverse ) const
+{
+    return Solve( Matrix< InverseT, N, N >::Identity(), a_roInverse );
+}
+
+//
+// MatrixDivision
+//
+
+// Non-square divisors multiply by the pseudo-inverse.  Small ones compute it
+// from the normal equations, like Matrix::Inverse does, so results stay the
+// same as multiplying by the inverse.  For larger ones, a tall divisor B is
+// factored directly, and for a wide one, A * B^+ = ( ( B^T )^+ * A^T )^T,
+// which is a least-squares solve against B^T.
+template< typename T, unsigned int M, unsigned int N, unsigned int P >
+inline bool MatrixDivision< T, M, N, P >::
+    Divide( const Matrix< T, M, N >& ac_roLeft,
+            const Matrix< T, P, N >& ac_roRight,
+            Matrix< InverseT, M, P >& a_roResult )
+{
+    if( ( P > N ? N : P ) <= 4 )
+    {
+        Matrix< InverseT, N, P > oInverse;
+        if( !ac_roRight.Inverse( oInverse ) )
+        {
+            return false;
+        }
+        a_roResult = Matrix< InverseT, M, N >( ac_roLeft ) * oInverse;
+        return true;
+    }
+    if( P > N )
+    {
+        return QR< T, P, N >( ac_roRight ).Divide( ac_roLeft, a_roResult );
+    }
+    Matrix< InverseT, P, M > oTranspose;
+    if( !QR< T, N, P >( ac_roRight.Transpose() ).Solve( ac_roLeft.Transpose(),
+                                                        oTranspose ) )
+    {
+        return false;
+    }
+    a_roResult = oTranspose.Transpose();
+    return true;
+}
+template< typename T, unsigned int M, unsigned int N >
+inline bool MatrixDivision< T, M, N, N >::
+    Divide( const Matrix< T, M, N >& ac_roLeft,
+            const Matrix< T, N, N >& ac_roRight,
+            Matrix< InverseT, M, N >& a_roResult )
+{
+    if( N > 4 )
+    {
+        return LU< T, N >( ac_roRight ).Divide( ac_roLeft, a_roResult );
+    }
+    Matrix< InverseT, N, N > oInverse;
+    if( !ac_roRight.Inverse( oInverse ) )
+    {
+        return false;
+    }
+    a_roResult = Matrix< InverseT, M, N >( ac_roLeft ) * oInverse;
+    return true;
+}
+
+}   // namespace Math
+
+#endif  // DECOMPOSITION__INL
@@ -0,0 +1,612 @@
+/******************************************************************************
+ * File:               DenseMatrix.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Function implementations for DenseMatrix.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Scalar division checks for zero.
+ ******************************************************************************/
+
+#ifndef DENSE_MATRIX__INL
+#define DENSE_MATRIX__INL
+
+#include "../Declarations/DenseMatrix.h"
+#include "../Declarations/ElementKernels.h"
+#include <climits>  // for UINT_MAX
+#include <cmath>    // for abs
+#include <malloc.h> // for _aligned_malloc and _aligned_free
+#include <new>      // for bad_alloc
+#include <stdexcept>
+#include <utility>  // for swap
+
+namespace Math
+{
+
+// Edge length of the square blocks Transpose copies at a time
+const unsigned int DENSE_TRANSPOSE_BLOCK = 32;
+
+// Columns of the inverse solved for together by each thread
+const unsigned int DENSE_INVERSE_BLOCK = 64;
+
+//
+// DenseBuffer
+//
+
+template< typename T >
+inline DenseBuffer< T >::DenseBuffer( unsigned int a_uiSize )
+    : m_pData( Allocate( a_uiSize ) ) {}
+template< typename T >
+inline DenseBuffer< T >::~DenseBuffer()
+{
+    Free( m_pData );
+}
+template< typename T >
+inline T* DenseBuffer< T >::Release()
+{
+    T* pData = m_pData;
+    m_pData = nullptr;
+    return pData;
+}
+template< typename T >
+inline T* DenseBuffer< T >::Allocate( unsigned int a_uiSize )
+{
+    if( 0 == a_uiSize )
+    {
+        return nullptr;
+    }
+    if( a_uiSize > (size_t)-1 / sizeof( T ) )
+    {
+        throw std::bad_alloc();
+    }
+    void* pData = _aligned_malloc( a_uiSize * sizeof( T ), DENSE_ALIGNMENT );
+    if( nullptr == pData )
+    {
+        throw std::bad_alloc();
+    }
+    return (T*)pData;
+}
+template< typename T >
+inline void DenseBuffer< T >::Free( T* a_pData )
+{
+    if( nullptr != a_pData )
+    {
+        _aligned_free( a_pData );
+    }
+}
+
+//
+// DenseMatrix
+//
+
+// Throw instead of wrapping around when the element count won't fit
+inline unsigned int DenseSize( unsigned int a_uiRows,
+                               unsigned int a_uiColumns )
+{
+    if( 0 != a_uiRows && a_uiColumns > UINT_MAX / a_uiRows )
+    {
+        throw std::length_error( "Matrix dimensions are too large" );
+    }
+    return a_uiRows * a_uiColumns;
+}
+
+// Construct with all elements set to the given value
+template< typename T >
+inline DenseMatrix< T >::DenseMatrix()
+    : m_uiRows( 0 ), m_uiColumns( 0 ), m_pData( nullptr ) {}
+template< typename T >
+inline DenseMatrix< T >::DenseMatrix( unsigned int a_uiRows,
+                                      unsigned int a_uiColumns,
+                                      const T& ac_rFill )
+    : m_uiRows( a_uiRows ), m_uiColumns( a_uiColumns ),
+      m_pData( DenseBuffer< T >::Allocate( DenseSize( a_uiRows,
+                                                      a_uiColumns ) ) )
+{
+    Fill( ac_rFill );
+}
+
+// Construct with row-major data
+template< typename T >
+inline DenseMatrix< T >::DenseMatrix( const T* ac_pData,
+                                      unsigned int a_uiRows,
+                                      unsigned int a_uiColumns )
+    : m_uiRows( a_uiRows ), m_uiColumns( a_uiColumns ),
+      m_pData( DenseBuffer< T >::Allocate( DenseSize( a_uiRows,
+                                                      a_uiColumns ) ) )
+{
+    ElementKernels< T >::Copy( ac_pData, m_pData, Size() );
+}
+
+// Construct from a fixed-size matrix
+template< typename T >
+template< unsigned int M, unsigned int N >
+inline DenseMatrix< T >::DenseMatrix( const Matrix< T, M, N >& ac_roMatrix )
+    : m_uiRows( M ), m_uiColumns( N ),
+      m_pData( DenseBuffer< T >::Allocate( M*N ) )
+{
+    ElementKernels< T >::Copy( ac_roMatrix.Data(), m_pData, M*N );
+}
+
+// Copy and destroy
+template< typename T >
+inline DenseMatrix< T >::DenseMatrix( const DenseMatrix& ac_roMatrix )
+    : m_uiRows( ac_roMatrix.m_uiRows ), m_uiColumns( ac_roMatrix.m_uiColumns ),
+      m_pData( DenseBuffer< T >::Allocate( ac_roMatrix.Size() ) )
+{
+    ElementKernels< T >::Copy( ac_roMatrix.m_pData, m_pData, Size() );
+}
+template< typename T >
+inline DenseMatrix< T >&
+    DenseMatrix< T >::operator=( const DenseMatrix& ac_roMatrix )
+{
+    if( &ac_roMatrix != this )
+    {
+        // Only reallocate if the element count changes
+        if( Size() != ac_roMatrix.Size() )
+        {
+            T* pData = DenseBuffer< T >::Allocate( ac_roMatrix.Size() );
+            DenseBuffer< T >::Free( m_pData );
+            m_pData = pData;
+        }
+        m_uiRows = ac_roMatrix.m_uiRows;
+        m_uiColumns = ac_roMatrix.m_uiColumns;
+        ElementKernels< T >::Copy( ac_roMatrix.m_pData, m_pData, Size() );
+    }
+    return *this;
+}
+template< typename T >
+inline DenseMatrix< T >::~DenseMatrix()
+{
+    DenseBuffer< T >::Free( m_pData );
+}
+
+// Change dimensions, discarding the old elements
+template< typename T >
+inline DenseMatrix< T >& DenseMatrix< T >::SetSize( unsigned int a_uiRows,
+                                                    unsigned int a_uiColumns,
+                                                    const T& ac_rFill )
+{
+    unsigned int uiSize = DenseSize( a_uiRows, a_uiColumns );
+    if( Size() != uiSize )
+    {
+        T* pData = DenseBuffer< T >::Allocate( uiSize );
+        DenseBuffer< T >::Free( m_pData );
+        m_pData = pData;
+    }
+    m_uiRows = a_uiRows;
+    m_uiColumns = a_uiColumns;
+    return Fill( ac_rFill );
+}
+
+// Set all elements to the given value
+template< typename T >
+inline DenseMatrix< T >& DenseMatrix< T >::Fill( const T& ac_rFill )
+{
+    ElementKernels< T >::Fill( m_pData, ac_rFill, Size() );
+    return *this;
+}
+
+// Equality and inequality checks - matrices of different dimensions are
+// never equal
+template< typename T >
+inline bool DenseMatrix< T >::operator==( const DenseMatrix& ac_roMatrix ) const
+{
+    return m_uiRows == ac_roMatrix.m_uiRows &&
+           m_uiColumns == ac_roMatrix.m_uiColumns &&
+           ElementKernels< T >::Equal( m_pData, ac_roMatrix.m_pData, Size() );
+}
+template< typename T >
+inline bool DenseMatrix< T >::operator!=( const DenseMatrix& ac_roMatrix ) const
+{
+    return !operator==( ac_roMatrix );
+}
+
+// Array access
+template< typename T >
+inline T* DenseMatrix< T >::operator[]( unsigned int a_uiRow )
+{
+    if( a_uiRow >= m_uiRows )
+    {
+        throw std::out_of_range( "Cannot access non-existent matrix row" );
+    }
+    return m_pData + a_uiRow * m_uiColumns;
+}
+template< typename T >
+inline const T* DenseMatrix< T >::operator[]( unsigned int a_uiRow ) const
+{
+    if( a_uiRow >= m_uiRows )
+    {
+        throw std::out_of_range( "Cannot access non-existent matrix row" );
+    }
+    return m_pData + a_uiRow * m_uiColumns;
+}
+template< typename T >
+inline T& DenseMatrix< T >::At( unsigned int a_uiRow, unsigned int a_uiColumn )
+{
+    if( a_uiColumn >= m_uiColumns )
+    {
+        throw std::out_of_range( "Cannot access non-existent matrix column" );
+    }
+    return operator[]( a_uiRow )[ a_uiColumn ];
+}
+template< typename T >
+inline const T& DenseMatrix< T >::At( unsigned int a_uiRow,
+                                      unsigned int a_uiColumn ) const
+{
+    if( a_uiColumn >= m_uiColumns )
+    {
+        throw std::out_of_range( "Cannot access non-existent matrix column" );
+    }
+    return operator[]( a_uiRow )[ a_uiColumn ];
+}
+
+// Transpose a square block at a time, so that both the rows being read and
+// the rows being written stay in cache
+template< typename T >
+inline DenseMatrix< T > DenseMatrix< T >::Transpose() const
+{
+    DenseMatrix oResult( m_uiColumns, m_uiRows );
+    for( unsigned int ii = 0; ii < m_uiRows; ii += DENSE_TRANSPOSE_BLOCK )
+    {
+        unsigned int uiRowEnd = ( m_uiRows - ii < DENSE_TRANSPOSE_BLOCK
+                                  ? m_uiRows : ii + DENSE_TRANSPOSE_BLOCK );
+        for( unsigned int jj = 0; jj < m_uiColumns;
+             jj += DENSE_TRANSPOSE_BLOCK )
+        {
+            unsigned int uiColumnEnd =
+                ( m_uiColumns - jj < DENSE_TRANSPOSE_BLOCK
+                  ? m_uiColumns : jj + DENSE_TRANSPOSE_BLOCK );
+            for( unsigned int i = ii; i < uiRowEnd; ++i )
+            {
+                for( unsigned int j = jj; j < uiColumnEnd; ++j )
+                {
+                    oResult.m_pData[ j * m_uiRows + i ] =
+                        m_pData[ i * m_uiColumns + j ];
+                }
+            }
+        }
+    }
+    return oResult;
+}
+
+// LU decomposition with partial pivoting, the same as LU< T, N > uses for
+// fixed-size matrices.  Rows below the pivot are independent of each other,
+// so large eliminations are split across threads.
+template< typename T >
+bool DenseMatrix< T >::Decompose( InverseType& a_roLU,
+                                  unsigned int* a_puiPivot,
+                                  InverseT& a_rSign ) const
+{
+    if( !IsSquare() )
+    {
+        return false;
+    }
+    const unsigned int N = m_uiRows;
+    a_roLU.SetSize( N, N );
+    InverseT* pLU = a_roLU.Data();
+    for( unsigned int i = 0; i < N*N; ++i )
+    {
+        pLU[i] = (InverseT)m_pData[i];
+    }
+    for( unsigned int i = 0; i < N; ++i )
+    {
+        a_puiPivot[i] = i;
+    }
+    a_rSign = 1;
+    for( unsigned int k = 0; k < N; ++k )
+    {
+        // Swap the row with the largest value in this column up to the
+        // diagonal to keep the multipliers small
+        unsigned int uiPivot = k;
+        for( unsigned int i = k + 1; i < N; ++i )
+        {
+            if( std::abs( pLU[ i*N + k ] ) > std::abs( pLU[ uiPivot*N + k ] ) )
+            {
+                uiPivot = i;
+            }
+        }
+        if( 0 == pLU[ uiPivot*N + k ] )
+        {
+            return false;
+        }
+        if( uiPivot != k )
+        {
+            for( unsigned int j = 0; j < N; ++j )
+            {
+                std::swap( pLU[ k*N + j ], pLU[ uiPivot*N + j ] );
+            }
+            std::swap( a_puiPivot[k], a_puiPivot[uiPivot] );
+            a_rSign = -a_rSign;
+        }
+
+        // Eliminate this column below the diagonal
+        const InverseT* pPivotRow = pLU + k*N;
+        int iEnd = (int)N;
+        double dWork = (double)( N - k ) * (double)( N - k );
+#ifdef _OPENMP
+#pragma omp parallel for if( dWork >= DENSE_THREAD_WORK )
+#endif
+        for( int i = (int)k + 1; i < iEnd; ++i )
+        {
+            InverseT* pRow = pLU + (unsigned int)i * N;
+            pRow[k] /= pPivotRow[k];
+            for( unsigned int j = k + 1; j < N; ++j )
+            {
+                pRow[j] -= pRow[k] * pPivotRow[j];
+            }
+        }
+        (void)dWork;
+    }
+    return true;
+}
+
+// Determinant - return 0 if non-square matrix
+template< typename T >
+inline T DenseMatrix< T >::Determinant() const
+{
+    InverseType oLU;
+    DenseBuffer< unsigned int > oPivot( m_uiRows );
+    InverseT tDeterminant;
+    if( !Decompose( oLU, oPivot.Data(), tDeterminant ) )
+    {
+        return 0;
+    }
+    for( unsigned int i = 0; i < m_uiRows; ++i )
+    {
+        tDeterminant *= oLU.Data()[ i * m_uiRows + i ];
+    }
+
+    // The determinant of an integer matrix is an integer, so don't let
+    // rounding error truncate it to the wrong one.
+    return (T)( std::is_integral< T >::value ? Round( tDeterminant )
+                                              : tDeterminant );
+}
+
+// Inverse - solve L*U*X = P for the inverse X, a block of columns at a time.
+// Each block is independent of the others, so they're split across threads.
+// If !invertable, don't change the given matrix.
+template< typename T >
+bool DenseMatrix< T >::Inverse( InverseType& a_roMatrix ) const
+{
+    InverseType oLU;
+    DenseBuffer< unsigned int > oPivot( m_uiRows );
+    InverseT tSign;
+    if( !Decompose( oLU, oPivot.Data(), tSign ) )
+    {
+        return false;
+    }
+    const unsigned int N = m_uiRows;
+    const InverseT* pLU = oLU.Data();
+    const unsigned int* pPivot = oPivot.Data();
+    InverseType oInverse( N, N );
+    InverseT* pInverse = oInverse.Data();
+    int iBlocks = (int)( ( N + DENSE_INVERSE_BLOCK - 1 ) /
+                         DENSE_INVERSE_BLOCK );
+    double dWork = (double)N * (double)N * (double)N;
+#ifdef _OPENMP
+#pragma omp parallel for if( dWork >= DENSE_THREAD_WORK )
+#endif
+    for( int iBlock = 0; iBlock < iBlocks; ++iBlock )
+    {
+        unsigned int uiStart = (unsigned int)iBlock * DENSE_INVERSE_BLOCK;
+        unsigned int uiEnd = ( N - uiStart < DENSE_INVERSE_BLOCK
+                               ? N : uiStart + DENSE_INVERSE_BLOCK );
+
+        // Forward substitution through the unit lower triangle
+        for( unsigned int i = 0; i < N; ++i )
+        {
+            InverseT* pRow = pInverse + i*N;
+            for( unsigned int j = uiStart; j < uiEnd; ++j )
+            {
+                pRow[j] = ( pPivot[i] == j ? 1 : 0 );
+            }
+            for( unsigned int k = 0; k < i; ++k )
+            {
+                const InverseT tFactor = pLU[ i*N + k ];
+                const InverseT* pSolved = pInverse + k*N;
+                for( unsigned int j = uiStart; j < uiEnd; ++j )
+                {
+                    pRow[j] -= tFactor * pSolved[j];
+                }
+            }
+        }
+
+        // Back substitution through the upper triangle
+        for( unsigned int i = N; i-- > 0; )
+        {
+            InverseT* pRow = pInverse + i*N;
+            for( unsigned int k = i + 1; k < N; ++k )
+            {
+                const InverseT tFactor = pLU[ i*N + k ];
+                const InverseT* pSolved = pInverse + k*N;
+                for( unsigned int j = uiStart; j < uiEnd; ++j )
+                {
+                    pRow[j] -= tFactor * pSolved[j];
+                }
+            }
+            for( unsigned int j = uiStart; j < uiEnd; ++j )
+            {
+                pRow[j] /= pLU[ i*N + i ];
+            }
+        }
+    }
+    (void)dWork;
+    a_roMatrix = oInverse;
+    return true;
+}
+template< typename T >
+inline typename DenseMatrix< T >::InverseType DenseMatrix< T >::Inverse() const
+{
+    bool bDummy;
+    return Inverse( bDummy );
+}
+template< typename T >
+inline typename DenseMatrix< T >::InverseType
+    DenseMatrix< T >::Inverse( bool& a_rbInvertable ) const
+{
+    InverseType oInverse( m_uiColumns, m_uiRows );
+    a_rbInvertable = Inverse( oInverse );
+    return oInverse;
+}
+
+// Matrix multiplication
+template< typename T >
+inline DenseMatrix< T >
+    DenseMatrix< T >::operator*( const DenseMatrix& ac_roMatrix ) const
+{
+    if( m_uiColumns != ac_roMatrix.m_uiRows )
+    {
+        throw std::invalid_argument(
+            "Cannot multiply matrices with mismatched dimensions" );
+    }
+    DenseMatrix oResult( m_uiRows, ac_roMatrix.m_uiColumns );
+    DenseProduct< T >::Multiply( m_pData, ac_roMatrix.m_pData, oResult.m_pData,
+                                 m_uiRows, m_uiColumns,
+                                 ac_roMatrix.m_uiColumns );
+    return oResult;
+}
+template< typename T >
+inline DenseMatrix< T >&
+    DenseMatrix< T >::operator*=( const DenseMatrix& ac_roMatrix )
+{
+    return operator=( operator*( ac_roMatrix ) );
+}
+
+// Matrix addition and subtraction
+template< typename T >
+inline DenseMatrix< T > DenseMatrix< T >::operator-() const
+{
+    DenseMatrix oResult( m_uiRows, m_uiColumns );
+    ElementKernels< T >::Negate( m_pData, oResult.m_pData, Size() );
+    return oResult;
+}
+template< typename T >
+inline DenseMatrix< T >&
+    DenseMatrix< T >::operator+=( const DenseMatrix& ac_roMatrix )
+{
+    CheckSameSize( ac_roMatrix );
+    ElementKernels< T >::Add( m_pData, ac_roMatrix.m_pData, m_pData, Size() );
+    return *this;
+}
+template< typename T >
+inline DenseMatrix< T >
+    DenseMatrix< T >::operator+( const DenseMatrix& ac_roMatrix ) const
+{
+    CheckSameSize( ac_roMatrix );
+    DenseMatrix oResult( m_uiRows, m_uiColumns );
+    ElementKernels< T >::Add( m_pData, ac_roMatrix.m_pData, oResult.m_pData,
+                              Size() );
+    return oResult;
+}
+template< typename T >
+inline DenseMatrix< T >&
+    DenseMatrix< T >::operator-=( const DenseMatrix& ac_roMatrix )
+{
+    CheckSameSize( ac_roMatrix );
+    ElementKernels< T >::Subtract( m_pData, ac_roMatrix.m_pData, m_pData,
+                                   Size() );
+    return *this;
+}
+template< typename T >
+inline DenseMatrix< T >
+    DenseMatrix< T >::operator-( const DenseMatrix& ac_roMatrix ) const
+{
+    CheckSameSize( ac_roMatrix );
+    DenseMatrix oResult( m_uiRows, m_uiColumns );
+    ElementKernels< T >::Subtract( m_pData, ac_roMatrix.m_pData,
+                                   oResult.m_pData, Size() );
+    return oResult;
+}
+
+// Scalar multiplication and division
+template< typename T >
+template< typename U >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                DenseMatrix< T >& >::type
+    DenseMatrix< T >::operator*=( const U& ac_rScalar )
+{
+    ElementKernels< T >::Multiply( m_pData, ac_rScalar, m_pData, Size() );
+    return *this;
+}
+template< typename T >
+template< typename U >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                DenseMatrix< T > >::type
+    DenseMatrix< T >::operator*( const U& ac_rScalar ) const
+{
+    DenseMatrix oResult( m_uiRows, m_uiColumns );
+    ElementKernels< T >::Multiply( m_pData, ac_rScalar, oResult.m_pData,
+                                   Size() );
+    return oResult;
+}
+template< typename T >
+template< typename U >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                DenseMatrix< T >& >::type
+    DenseMatrix< T >::operator/=( const U& ac_rScalar )
+{
+    if( ac_rScalar == 0 )
+    {
+        throw std::invalid_argument( "Cannot divide by zero" );
+    }
+    ElementKernels< T >::Divide( m_pData, ac_rScalar, m_pData, Size() );
+    return *this;
+}
+template< typename T >
+template< typename U >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                DenseMatrix< T > >::type
+    DenseMatrix< T >::operator/( const U& ac_rScalar ) const
+{
+    if( ac_rScalar == 0 )
+    {
+        throw std::invalid_argument( "Cannot divide by zero" );
+    }
+    DenseMatrix oResult( m_uiRows, m_uiColumns );
+    ElementKernels< T >::Divide( m_pData, ac_rScalar, oResult.m_pData,
+                                 Size() );
+    return oResult;
+}
+
+// Zero and identity matrices of the given sizes
+template< typename T >
+inline DenseMatrix< T > DenseMatrix< T >::Zero( unsigned int a_uiRows,
+                                                unsigned int a_uiColumns )
+{
+    return DenseMatrix( a_uiRows, a_uiColumns );
+}
+template< typename T >
+inline DenseMatrix< T > DenseMatrix< T >::Identity( unsigned int a_uiSize )
+{
+    DenseMatrix oIdentity( a_uiSize, a_uiSize );
+    for( unsigned int i = 0; i < a_uiSize; ++i )
+    {
+        oIdentity.m_pData[ i * a_uiSize + i ] = 1;
+    }
+    return oIdentity;
+}
+
+// Throw if the given matrix doesn't have the same dimensions as this one
+template< typename T >
+inline void DenseMatrix< T >::CheckSameSize(
+    const DenseMatrix& ac_roMatrix ) const
+{
+    if( m_uiRows != ac_roMatrix.m_uiRows ||
+        m_uiColumns != ac_roMatrix.m_uiColumns )
+    {
+        throw std::invalid_argument(
+            "Cannot combine matrices with mismatched dimensions" );
+    }
+}
+
+}   // namespace Math
+
+// Scalar multiplication in the other direction
+template< typename U, typename T >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                Math::DenseMatrix< T > >::type
+    operator*( const U& ac_rScalar, const Math::DenseMatrix< T >& ac_roMatrix )
+{
+    return ac_roMatrix.operator*( ac_rScalar );
+}
+
+#endif  // DENSE_MATRIX__INL
@@ -0,0 +1,318 @@
+/******************************************************************************
+ * File:               DenseMatrix_Product.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Cache-blocked product kernel for DenseMatrix.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef DENSE_MATRIX__PRODUCT__INL
+#define DENSE_MATRIX__PRODUCT__INL
+
+#include "../Declarations/DenseMatrix.h"
+#include "../Declarations/MatrixProduct.h"
+#include "../Declarations/SimdRegister.h"
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace Math
+{
+
+// Copy a block of the left-hand matrix into strips of DENSE_TILE_ROWS rows,
+// each stored one column at a time, so the tile kernel reads it in order.
+// Rows past the end of the block are padded with zeroes.
+template< typename T >
+inline void DensePackLeft( const T* ac_pLeft, unsigned int a_uiStride,
+                           unsigned int a_uiRows, unsigned int a_uiDepth,
+                           T* a_pPacked )
+{
+    for( unsigned int i = 0; i < a_uiRows; i += DENSE_TILE_ROWS )
+    {
+        for( unsigned int k = 0; k < a_uiDepth; ++k )
+        {
+            for( unsigned int ii = 0; ii < DENSE_TILE_ROWS; ++ii )
+            {
+                *( a_pPacked++ ) =
+                    ( i + ii < a_uiRows
+                      ? ac_pLeft[ ( i + ii ) * a_uiStride + k ] : T( 0 ) );
+            }
+        }
+    }
+}
+
+// Copy a panel of the right-hand matrix into strips of the given width, each
+// stored one row at a time.  Columns past the end of the panel are padded
+// with zeroes.
+template< typename T >
+inline void DensePackRight( const T* ac_pRight, unsigned int a_uiStride,
+                            unsigned int a_uiDepth, unsigned int a_uiColumns,
+                            unsigned int a_uiWidth, T* a_pPacked )
+{
+    for( unsigned int j = 0; j < a_uiColumns; j += a_uiWidth )
+    {
+        for( unsigned int k = 0; k < a_uiDepth; ++k )
+        {
+            const T* pRow = ac_pRight + k * a_uiStride;
+            for( unsigned int jj = 0; jj < a_uiWidth; ++jj )
+            {
+                *( a_pPacked++ ) = ( j + jj < a_uiColumns ? pRow[ j + jj ]
+                                                          : T( 0 ) );
+            }
+        }
+    }
+}
+
+// Compute one DENSE_TILE_ROWS x ( 2 * R::WIDTH ) tile of the result from
+// packed strips, keeping the whole tile in registers.  If a_bAccumulate is
+// set, the products are added to what's already in the result, which
+// continues each sum from the previous block of terms.
+template< typename R >
+inline void DenseTile( const typename R::ElementType* ac_pLeft,
+                       const typename R::ElementType* ac_pRight,
+                       unsigned int a_uiDepth,
+                       typename R::ElementType* a_pResult,
+                       unsigned int a_uiStride, bool a_bAccumulate )
+{
+    typedef typename R::Type Type;
+    Type aaoSum[ DENSE_TILE_ROWS ][ 2 ];
+    for( unsigned int i = 0; i < DENSE_TILE_ROWS; ++i )
+    {
+        for( unsigned int j = 0; j < 2; ++j )
+        {
+            aaoSum[i][j] =
+                ( a_bAccumulate
+                  ? R::Load( a_pResult + i * a_uiStride + j * R::WIDTH )
+                  : R::Set( 0 ) );
+        }
+    }
+    for( unsigned int k = 0; k < a_uiDepth; ++k )
+    {
+        const Type oRight0 = R::Load( ac_pRight );
+        const Type oRight1 = R::Load( ac_pRight + R::WIDTH );
+        for( unsigned int i = 0; i < DENSE_TILE_ROWS; ++i )
+        {
+            const Type oLeft = R::Set( ac_pLeft[i] );
+            aaoSum[i][0] = R::Add( aaoSum[i][0],
+                                   R::Multiply( oLeft, oRight0 ) );
+            aaoSum[i][1] = R::Add( aaoSum[i][1],
+                                   R::Multiply( oLeft, oRight1 ) );
+        }
+        ac_pLeft += DENSE_TILE_ROWS;
+        ac_pRight += 2 * R::WIDTH;
+    }
+    for( unsigned int i = 0; i < DENSE_TILE_ROWS; ++i )
+    {
+        for( unsigned int j = 0; j < 2; ++j )
+        {
+            R::Store( a_pResult + i * a_uiStride + j * R::WIDTH,
+                      aaoSum[i][j] );
+        }
+    }
+}
+
+// Multiply a packed block by a packed panel, one tile at a time.  Tiles that
+// hang off the edge of the result go through a scratch tile, so the kernel
+// never reads or writes past the end of a row.
+template< typename R >
+inline void DenseBlock( const typename R::ElementType* ac_pLeft,
+                        const typename R::ElementType* ac_pRight,
+                        unsigned int a_uiRows, unsigned int a_uiDepth,
+                        unsigned int a_uiColumns,
+                        typename R::ElementType* a_pResult,
+                        unsigned int a_uiStride, bool a_bAccumulate )
+{
+    typedef typename R::ElementType ElementType;
+    const unsigned int uiWidth = 2 * R::WIDTH;
+    ElementType aTile[ DENSE_TILE_ROWS * 2 * R::WIDTH ];
+    for( unsigned int j = 0; j < a_uiColumns; j += uiWidth )
+    {
+        const ElementType* pRight = ac_pRight + j * a_uiDepth;
+        unsigned int uiColumns = ( a_uiColumns - j < uiWidth
+                                   ? a_uiColumns - j : uiWidth );
+        for( unsigned int i = 0; i < a_uiRows; i += DENSE_TILE_ROWS )
+        {
+            const ElementType* pLeft = ac_pLeft + i * a_uiDepth;
+            ElementType* pResult = a_pResult + i * a_uiStride + j;
+            unsigned int uiRows = ( a_uiRows - i < DENSE_TILE_ROWS
+                                    ? a_uiRows - i : DENSE_TILE_ROWS );
+            if( DENSE_TILE_ROWS == uiRows && uiWidth == uiColumns )
+            {
+                DenseTile< R >( pLeft, pRight, a_uiDepth, pResult,
+                                a_uiStride, a_bAccumulate );
+                continue;
+            }
+            for( unsigned int ii = 0; ii < DENSE_TILE_ROWS; ++ii )
+            {
+                for( unsigned int jj = 0; jj < uiWidth; ++jj )
+                {
+                    aTile[ ii * uiWidth + jj ] =
+                        ( a_bAccumulate && ii < uiRows && jj < uiColumns
+                          ? pResult[ ii * a_uiStride + jj ] : 0 );
+                }
+            }
+            DenseTile< R >( pLeft, pRight, a_uiDepth, aTile, uiWidth,
+                            a_bAccumulate );
+            for( unsigned int ii = 0; ii < uiRows; ++ii )
+            {
+                for( unsigned int jj = 0; jj < uiColumns; ++jj )
+                {
+                    pResult[ ii * a_uiStride + jj ] =
+                        aTile[ ii * uiWidth + jj ];
+                }
+            }
+        }
+    }
+}
+
+// Multiply an M x K array by a K x N one with the given register type.
+// The right-hand matrix is packed a DENSE_BLOCK_DEPTH x DENSE_BLOCK_COLUMNS
+// panel at a time, and each thread packs and multiplies its own
+// DENSE_BLOCK_ROWS-row blocks of the left-hand matrix against it.  Panels are
+// visited in order of depth, so every result element still sums its terms
+// from first to last.
+template< typename R >
+void DenseMultiply( const typename R::ElementType* ac_pLeft,
+                    const typename R::ElementType* ac_pRight,
+                    typename R::ElementType* a_pResult,
+                    unsigned int a_uiRows, unsigned int a_uiDepth,
+                    unsigned int a_uiColumns )
+{
+    typedef typename R::ElementType ElementType;
+    if( 0 == a_uiDepth )
+    {
+        ElementKernels< ElementType >::Fill( a_pResult, ElementType( 0 ),
+                                             a_uiRows * a_uiColumns );
+        return;
+    }
+    if( 0 == a_uiRows || 0 == a_uiColumns )
+    {
+        return;
+    }
+    const unsigned int uiWidth = 2 * R::WIDTH;
+    const unsigned int uiLeftSize = DENSE_BLOCK_ROWS * DENSE_BLOCK_DEPTH;
+    int iThreads = 1;
+#ifdef _OPENMP
+    iThreads = omp_get_max_threads();
+#endif
+    DenseBuffer< ElementType > oRight( DENSE_BLOCK_DEPTH *
+                                       DENSE_BLOCK_COLUMNS );
+    DenseBuffer< ElementType > oLeft( (unsigned int)iThreads * uiLeftSize );
+    int iBlocks = (int)( ( a_uiRows + DENSE_BLOCK_ROWS - 1 ) /
+                         DENSE_BLOCK_ROWS );
+    for( unsigned int jj = 0; jj < a_uiColumns; jj += DENSE_BLOCK_COLUMNS )
+    {
+        unsigned int uiColumns = ( a_uiColumns - jj < DENSE_BLOCK_COLUMNS
+                                   ? a_uiColumns - jj : DENSE_BLOCK_COLUMNS );
+        for( unsigned int kk = 0; kk < a_uiDepth; kk += DENSE_BLOCK_DEPTH )
+        {
+            unsigned int uiDepth = ( a_uiDepth - kk < DENSE_BLOCK_DEPTH
+                                     ? a_uiDepth - kk : DENSE_BLOCK_DEPTH );
+            DensePackRight( ac_pRight + kk * a_uiColumns + jj, a_uiColumns,
+                            uiDepth, uiColumns, uiWidth, oRight.Data() );
+            const ElementType* pRight = oRight.Data();
+            ElementType* pLeftBuffers = oLeft.Data();
+            bool bAccumulate = ( 0 != kk );
+            double dWork = (double)a_uiRows * uiDepth * uiColumns;
+#ifdef _OPENMP
+#pragma omp parallel for if( 1 < iBlocks && dWork >= DENSE_THREAD_WORK )
+#endif
+            for( int iBlock = 0; iBlock < iBlocks; ++iBlock )
+            {
+                int iThread = 0;
+#ifdef _OPENMP
+                iThread = omp_get_thread_num();
+#endif
+                ElementType* pLeft = pLeftBuffers + iThread * uiLeftSize;
+                unsigned int ii = (unsigned int)iBlock * DENSE_BLOCK_ROWS;
+                unsigned int uiRows = ( a_uiRows - ii < DENSE_BLOCK_ROWS
+                                        ? a_uiRows - ii : DENSE_BLOCK_ROWS );
+                DensePackLeft( ac_pLeft + ii * a_uiDepth + kk, a_uiDepth,
+                               uiRows, uiDepth, pLeft );
+                DenseBlock< R >( pLeft, pRight, uiRows, uiDepth, uiColumns,
+                                 a_pResult + ii * a_uiColumns + jj,
+                                 a_uiColumns, bAccumulate );
+                R::Finish();
+            }
+            (void)dWork;
+        }
+    }
+}
+
+// Any other type one element at a time
+template< typename T >
+inline void DenseProduct< T >::Multiply( const T* ac_pLeft,
+                                         const T* ac_pRight, T* a_pResult,
+                                         unsigned int a_uiRows,
+                                         unsigned int a_uiDepth,
+                                         unsigned int a_uiColumns )
+{
+    DenseMultiply< ScalarRegister< T > >( ac_pLeft, ac_pRight, a_pResult,
+                                          a_uiRows, a_uiDepth, a_uiColumns );
+}
+
+// Float and double with the widest registers the processor supports.  Only
+// the tile width changes between instruction sets, so results don't.
+inline void DenseProduct< double >::Multiply( const double* ac_pdLeft,
+                                              const double* ac_pdRight,
+                                              double* a_pdResult,
+                                              unsigned int a_uiRows,
+                                              unsigned int a_uiDepth,
+                                              unsigned int a_uiColumns )
+{
+    SimdLevel eLevel = DetectedSimdLevel();
+#ifdef SIMD_REGISTER_AVX
+    if( SIMD_AVX == eLevel )
+    {
+        DenseMultiply< AvxDoubleRegister >( ac_pdLeft, ac_pdRight, a_pdResult,
+                                            a_uiRows, a_uiDepth, a_uiColumns );
+        return;
+    }
+#endif
+#ifdef SIMD_REGISTER_SSE2
+    if( SIMD_SSE2 <= eLevel )
+    {
+        DenseMultiply< SseDoubleRegister >( ac_pdLeft, ac_pdRight, a_pdResult,
+                                            a_uiRows, a_uiDepth, a_uiColumns );
+        return;
+    }
+#endif
+    (void)eLevel;
+    DenseMultiply< ScalarRegister< double > >( ac_pdLeft, ac_pdRight,
+                                               a_pdResult, a_uiRows,
+                                               a_uiDepth, a_uiColumns );
+}
+inline void DenseProduct< float >::Multiply( const float* ac_pfLeft,
+                                             const float* ac_pfRight,
+                                             float* a_pfResult,
+                                             unsigned int a_uiRows,
+                                             unsigned int a_uiDepth,
+                                             unsigned int a_uiColumns )
+{
+    SimdLevel eLevel = DetectedSimdLevel();
+#ifdef SIMD_REGISTER_AVX
+    if( SIMD_AVX == eLevel )
+    {
+        DenseMultiply< AvxFloatRegister >( ac_pfLeft, ac_pfRight, a_pfResult,
+                                           a_uiRows, a_uiDepth, a_uiColumns );
+        return;
+    }
+#endif
+#ifdef SIMD_REGISTER_SSE2
+    if( SIMD_SSE2 <= eLevel )
+    {
+        DenseMultiply< SseFloatRegister >( ac_pfLeft, ac_pfRight, a_pfResult,
+                                           a_uiRows, a_uiDepth, a_uiColumns );
+        return;
+    }
+#endif
+    (void)eLevel;
+    DenseMultiply< ScalarRegister< float > >( ac_pfLeft, ac_pfRight,
+                                              a_pfResult, a_uiRows,
+                                              a_uiDepth, a_uiColumns );
+}
+
+}   // namespace Math
+
+#endif  // DENSE_MATRIX__PRODUCT__INL
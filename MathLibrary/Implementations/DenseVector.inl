@@ -0,0 +1,306 @@
+/******************************************************************************
+ * File:               DenseVector.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Function implementations for DenseVector.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Scalar division checks for zero.
+ ******************************************************************************/
+
+#ifndef DENSE_VECTOR__INL
+#define DENSE_VECTOR__INL
+
+#include "../Declarations/DenseVector.h"
+#include "../Declarations/ElementKernels.h"
+#include <cmath>    // for sqrt
+#include <stdexcept>
+
+namespace Math
+{
+
+// Construct with all elements set to the given value
+template< typename T >
+inline DenseVector< T >::DenseVector() : m_uiSize( 0 ), m_pData( nullptr ) {}
+template< typename T >
+inline DenseVector< T >::DenseVector( unsigned int a_uiSize,
+                                      const T& ac_rFill )
+    : m_uiSize( a_uiSize ), m_pData( DenseBuffer< T >::Allocate( a_uiSize ) )
+{
+    Fill( ac_rFill );
+}
+
+// Construct with data
+template< typename T >
+inline DenseVector< T >::DenseVector( const T* ac_pData,
+                                      unsigned int a_uiSize )
+    : m_uiSize( a_uiSize ), m_pData( DenseBuffer< T >::Allocate( a_uiSize ) )
+{
+    ElementKernels< T >::Copy( ac_pData, m_pData, m_uiSize );
+}
+
+// Construct from a fixed-size vector
+template< typename T >
+template< unsigned int N, bool t_bIsRow >
+inline DenseVector< T >::
+    DenseVector( const Vector< T, N, t_bIsRow >& ac_roVector )
+    : m_uiSize( N ), m_pData( DenseBuffer< T >::Allocate( N ) )
+{
+    ElementKernels< T >::Copy( ac_roVector.Data(), m_pData, N );
+}
+
+// Copy and destroy
+template< typename T >
+inline DenseVector< T >::DenseVector( const DenseVector& ac_roVector )
+    : m_uiSize( ac_roVector.m_uiSize ),
+      m_pData( DenseBuffer< T >::Allocate( ac_roVector.m_uiSize ) )
+{
+    ElementKernels< T >::Copy( ac_roVector.m_pData, m_pData, m_uiSize );
+}
+template< typename T >
+inline DenseVector< T >&
+    DenseVector< T >::operator=( const DenseVector& ac_roVector )
+{
+    if( &ac_roVector != this )
+    {
+        // Only reallocate if the size changes
+        if( m_uiSize != ac_roVector.m_uiSize )
+        {
+            T* pData = DenseBuffer< T >::Allocate( ac_roVector.m_uiSize );
+            DenseBuffer< T >::Free( m_pData );
+            m_pData = pData;
+            m_uiSize = ac_roVector.m_uiSize;
+        }
+        ElementKernels< T >::Copy( ac_roVector.m_pData, m_pData, m_uiSize );
+    }
+    return *this;
+}
+template< typename T >
+inline DenseVector< T >::~DenseVector()
+{
+    DenseBuffer< T >::Free( m_pData );
+}
+
+// Copy into a fixed-size vector, which must have the same size
+template< typename T >
+template< unsigned int N, bool t_bIsRow >
+inline void DenseVector< T >::
+    AssignTo( Vector< T, N, t_bIsRow >& a_roVector ) const
+{
+    if( N != m_uiSize )
+    {
+        throw std::invalid_argument(
+            "Cannot assign to a vector of a different size" );
+    }
+    ElementKernels< T >::Copy( m_pData, a_roVector.Data(), N );
+}
+
+// Change size, discarding the old elements
+template< typename T >
+inline DenseVector< T >& DenseVector< T >::SetSize( unsigned int a_uiSize,
+                                                    const T& ac_rFill )
+{
+    if( m_uiSize != a_uiSize )
+    {
+        T* pData = DenseBuffer< T >::Allocate( a_uiSize );
+        DenseBuffer< T >::Free( m_pData );
+        m_pData = pData;
+        m_uiSize = a_uiSize;
+    }
+    return Fill( ac_rFill );
+}
+
+// Set all elements to the given value
+template< typename T >
+inline DenseVector< T >& DenseVector< T >::Fill( const T& ac_rFill )
+{
+    ElementKernels< T >::Fill( m_pData, ac_rFill, m_uiSize );
+    return *this;
+}
+
+// Equality and inequality checks - vectors of different sizes are never equal
+template< typename T >
+inline bool DenseVector< T >::operator==( const DenseVector& ac_roVector ) const
+{
+    return m_uiSize == ac_roVector.m_uiSize &&
+           ElementKernels< T >::Equal( m_pData, ac_roVector.m_pData,
+                                       m_uiSize );
+}
+template< typename T >
+inline bool DenseVector< T >::operator!=( const DenseVector& ac_roVector ) const
+{
+    return !operator==( ac_roVector );
+}
+
+// Element access
+template< typename T >
+inline T& DenseVector< T >::operator[]( unsigned int a_uiIndex )
+{
+    if( a_uiIndex >= m_uiSize )
+    {
+        throw std::out_of_range( "Cannot access non-existent vector element" );
+    }
+    return m_pData[ a_uiIndex ];
+}
+template< typename T >
+inline const T& DenseVector< T >::operator[]( unsigned int a_uiIndex ) const
+{
+    if( a_uiIndex >= m_uiSize )
+    {
+        throw std::out_of_range( "Cannot access non-existent vector element" );
+    }
+    return m_pData[ a_uiIndex ];
+}
+
+// Dot product
+template< typename T >
+inline T DenseVector< T >::Dot( const DenseVector& ac_roVector ) const
+{
+    CheckSameSize( ac_roVector );
+    T tResult = 0;
+    for( unsigned int i = 0; i < m_uiSize; ++i )
+    {
+        tResult += m_pData[i] * ac_roVector.m_pData[i];
+    }
+    return tResult;
+}
+
+// Length
+template< typename T >
+inline typename DenseVector< T >::InverseT DenseVector< T >::Magnitude() const
+{
+    return std::sqrt( (InverseT)MagnitudeSquared() );
+}
+template< typename T >
+inline T DenseVector< T >::MagnitudeSquared() const
+{
+    return Dot( *this );
+}
+
+// Vector addition and subtraction
+template< typename T >
+inline DenseVector< T > DenseVector< T >::operator-() const
+{
+    DenseVector oResult( m_uiSize );
+    ElementKernels< T >::Negate( m_pData, oResult.m_pData, m_uiSize );
+    return oResult;
+}
+template< typename T >
+inline DenseVector< T >&
+    DenseVector< T >::operator+=( const DenseVector& ac_roVector )
+{
+    CheckSameSize( ac_roVector );
+    ElementKernels< T >::Add( m_pData, ac_roVector.m_pData, m_pData,
+                              m_uiSize );
+    return *this;
+}
+template< typename T >
+inline DenseVector< T >
+    DenseVector< T >::operator+( const DenseVector& ac_roVector ) const
+{
+    CheckSameSize( ac_roVector );
+    DenseVector oResult( m_uiSize );
+    ElementKernels< T >::Add( m_pData, ac_roVector.m_pData, oResult.m_pData,
+                              m_uiSize );
+    return oResult;
+}
+template< typename T >
+inline DenseVector< T >&
+    DenseVector< T >::operator-=( const DenseVector& ac_roVector )
+{
+    CheckSameSize( ac_roVector );
+    ElementKernels< T >::Subtract( m_pData, ac_roVector.m_pData, m_pData,
+                                   m_uiSize );
+    return *this;
+}
+template< typename T >
+inline DenseVector< T >
+    DenseVector< T >::operator-( const DenseVector& ac_roVector ) const
+{
+    CheckSameSize( ac_roVector );
+    DenseVector oResult( m_uiSize );
+    ElementKernels< T >::Subtract( m_pData, ac_roVector.m_pData,
+                                   oResult.m_pData, m_uiSize );
+    return oResult;
+}
+
+// Scalar multiplication and division
+template< typename T >
+template< typename U >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                DenseVector< T >& >::type
+    DenseVector< T >::operator*=( const U& ac_rScalar )
+{
+    ElementKernels< T >::Multiply( m_pData, ac_rScalar, m_pData, m_uiSize );
+    return *this;
+}
+template< typename T >
+template< typename U >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                DenseVector< T > >::type
+    DenseVector< T >::operator*( const U& ac_rScalar ) const
+{
+    DenseVector oResult( m_uiSize );
+    ElementKernels< T >::Multiply( m_pData, ac_rScalar, oResult.m_pData,
+                                   m_uiSize );
+    return oResult;
+}
+template< typename T >
+template< typename U >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                DenseVector< T >& >::type
+    DenseVector< T >::operator/=( const U& ac_rScalar )
+{
+    if( ac_rScalar == 0 )
+    {
+        throw std::invalid_argument( "Cannot divide by zero" );
+    }
+    ElementKernels< T >::Divide( m_pData, ac_rScalar, m_pData, m_uiSize );
+    return *this;
+}
+template< typename T >
+template< typename U >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                DenseVector< T > >::type
+    DenseVector< T >::operator/( const U& ac_rScalar ) const
+{
+    if( ac_rScalar == 0 )
+    {
+        throw std::invalid_argument( "Cannot divide by zero" );
+    }
+    DenseVector oResult( m_uiSize );
+    ElementKernels< T >::Divide( m_pData, ac_rScalar, oResult.m_pData,
+                                 m_uiSize );
+    return oResult;
+}
+
+// Zero vector of the given size
+template< typename T >
+inline DenseVector< T > DenseVector< T >::Zero( unsigned int a_uiSize )
+{
+    return DenseVector( a_uiSize );
+}
+
+// Throw if the given vector doesn't have the same size as this one
+template< typename T >
+inline void DenseVector< T >::CheckSameSize(
+    const DenseVector& ac_roVector ) const
+{
+    if( m_uiSize != ac_roVector.m_uiSize )
+    {
+        throw std::invalid_argument(
+            "Cannot combine vectors of different sizes" );
+    }
+}
+
+}   // namespace Math
+
+// Scalar multiplication in the other direction
+template< typename U, typename T >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                Math::DenseVector< T > >::type
+    operator*( const U& ac_rScalar, const Math::DenseVector< T >& ac_roVector )
+{
+    return ac_roVector.operator*( ac_rScalar );
+}
+
+#endif  // DENSE_VECTOR__INL
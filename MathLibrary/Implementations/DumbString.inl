@@ -3,107 +3,127 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 10, 2014
  * Description:        Inline function implementations for the DumbString class.
- * Last Modified:      February 25, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added short string buffer, cached hash, moves, and
+ *                      string views.
  ******************************************************************************/
 
 #ifndef DUMB_STRING__INL
 #define DUMB_STRING__INL
 
 #include "..\Declarations\DumbString.h"
+#include <cstring>  // for memcpy, memcmp, memmove, and strlen
 #include <functional>
 #include <fstream>
 #include <iostream>
-#include <string>
-#include <utility>  // for swap
 
 #include "..\Declarations\ImExportMacro.h"
 
 namespace Utility
 {
 
+//
+// DumbString
+//
+
 // Constructors
 INLINE DumbString::DumbString()
-    : m_uiSize( 0 ), m_uiCapacity( sizeof( int ) ), m_pcData( nullptr )
+    : m_pcData( m_acLocal ), m_uiSize( 0 ), m_uiCapacity( LOCAL_CAPACITY ),
+      m_uiHash( 0 )
 {
-    m_pcData = new char[ m_uiCapacity ];
-    m_pcData[0] = '\0';
+    m_acLocal[0] = '\0';
 }
 INLINE DumbString::DumbString( std::size_t a_uiSize )
-    : m_uiSize( 0 ), m_uiCapacity( RequiredCapacity( a_uiSize ) ),
-      m_pcData( nullptr )
+    : m_pcData( m_acLocal ), m_uiSize( 0 ), m_uiCapacity( LOCAL_CAPACITY ),
+      m_uiHash( 0 )
 {
-    m_pcData = new char[ m_uiCapacity ];
-    m_pcData[0] = '\0';
+    m_acLocal[0] = '\0';
+    GrowTo( a_uiSize, false );
 }
 INLINE DumbString::DumbString( const DumbString& ac_roString )
-    : m_uiSize( ac_roString.m_uiSize ),
-        m_uiCapacity( ac_roString.m_uiCapacity ),
-        m_pcData( nullptr )
+    : m_pcData( m_acLocal ), m_uiSize( 0 ), m_uiCapacity( LOCAL_CAPACITY ),
+      m_uiHash( 0 )
 {
-    m_pcData = new char[ m_uiCapacity ];
-    strcpy_s( m_pcData, m_uiCapacity, ac_roString.m_pcData );
+    Assign( ac_roString.m_pcData, ac_roString.m_uiSize );
+    m_uiHash = ac_roString.m_uiHash;
+}
+INLINE DumbString::DumbString( DumbString&& a_rroString )
+    : m_pcData( m_acLocal ), m_uiSize( 0 ), m_uiCapacity( LOCAL_CAPACITY ),
+      m_uiHash( 0 )
+{
+    Steal( a_rroString );
 }
 INLINE DumbString::DumbString( const char* ac_pcData )
-    : m_uiSize( strlen( ac_pcData ) ),
-        m_uiCapacity( RequiredCapacity( m_uiSize ) ),
-        m_pcData( nullptr )
+    : m_pcData( m_acLocal ), m_uiSize( 0 ), m_uiCapacity( LOCAL_CAPACITY ),
+      m_uiHash( 0 )
 {
-    m_pcData = new char[ m_uiCapacity ];
-    if( nullptr == ac_pcData )
-    {
-        m_pcData[0] = '\0';
-    }
-    else
+    m_acLocal[0] = '\0';
+    if( nullptr != ac_pcData )
     {
-        strcpy_s( m_pcData, m_uiCapacity, ac_pcData );
+        Assign( ac_pcData, std::strlen( ac_pcData ) );
     }
 }
 INLINE DumbString::DumbString( char a_cCharacter )
-    : m_uiSize( '\0' == a_cCharacter ? 0 : 1 ),
-      m_uiCapacity( RequiredCapacity( 1 ) ),
-      m_pcData( nullptr )
+    : m_pcData( m_acLocal ), m_uiSize( '\0' == a_cCharacter ? 0 : 1 ),
+      m_uiCapacity( LOCAL_CAPACITY ), m_uiHash( 0 )
 {
-    m_pcData = new char[ m_uiCapacity ];
-    m_pcData[0] = a_cCharacter;
-    m_pcData[1] = '\0';
+    m_acLocal[0] = a_cCharacter;
+    m_acLocal[1] = '\0';
 }
 INLINE DumbString::DumbString( std::istream& a_roInput )
-    : m_uiSize( 0 ), m_uiCapacity( sizeof( int ) ), m_pcData( nullptr )
+    : m_pcData( m_acLocal ), m_uiSize( 0 ), m_uiCapacity( LOCAL_CAPACITY ),
+      m_uiHash( 0 )
 {
-    m_pcData = new char[ m_uiCapacity ];
-    m_pcData[0] = '\0';
+    m_acLocal[0] = '\0';
     ReadFrom( a_roInput );
 }
+INLINE DumbString::DumbString( const DumbStringView& ac_roView )
+    : m_pcData( m_acLocal ), m_uiSize( 0 ), m_uiCapacity( LOCAL_CAPACITY ),
+      m_uiHash( 0 )
+{
+    Assign( ac_roView.Data(), ac_roView.Size() );
+}
+INLINE DumbString::DumbString( const DumbStringView& ac_roView, bool )
+    : m_pcData( const_cast< char* >( ac_roView.Data() ) ),
+      m_uiSize( ac_roView.Size() ), m_uiCapacity( 0 ), m_uiHash( 0 )
+{
+    m_acLocal[0] = '\0';
+}
 
 // Destructor actually does something
 INLINE DumbString::~DumbString()
 {
-    if( nullptr != m_pcData )
-    {
-        delete[] m_pcData;
-    }
+    Release();
 }
 
 // Assign operators
 INLINE DumbString& DumbString::operator=( const DumbString& ac_roString )
 {
-    GrowTo( ac_roString.m_uiSize );
-    strcpy_s( m_pcData, m_uiCapacity, ac_roString.m_pcData );
-    m_uiSize = ac_roString.m_uiSize;
+    if( this != &ac_roString )
+    {
+        Assign( ac_roString.m_pcData, ac_roString.m_uiSize );
+        m_uiHash = ac_roString.m_uiHash;
+    }
+    return *this;
+}
+INLINE DumbString& DumbString::operator=( DumbString&& a_rroString )
+{
+    if( this != &a_rroString )
+    {
+        Release();
+        Steal( a_rroString );
+    }
     return *this;
 }
 INLINE DumbString& DumbString::operator=( const char* ac_pcData )
 {
     if( nullptr == ac_pcData )
     {
-        m_pcData[0] = '\0';
+        Assign( "", 0 );
     }
     else
     {
-        GrowTo( strlen( ac_pcData ) );
-        strcpy_s( m_pcData, m_uiCapacity, ac_pcData );
-        m_uiSize = strlen( ac_pcData );
+        Assign( ac_pcData, std::strlen( ac_pcData ) );
     }
     return *this;
 }
@@ -116,18 +136,14 @@ INLINE DumbString& DumbString::operator=( char a_cCharacter )
 // Concatenation-assign operators
 INLINE DumbString& DumbString::operator+=( const DumbString& ac_roString )
 {
-    GrowTo( m_uiSize + ac_roString.m_uiSize );
-    strcpy_s( m_pcData + m_uiSize, m_uiCapacity - m_uiSize, ac_roString.m_pcData );
-    m_uiSize += ac_roString.m_uiSize;
+    Append( ac_roString.m_pcData, ac_roString.m_uiSize );
     return *this;
 }
 INLINE DumbString& DumbString::operator+=( const char* ac_pcData )
 {
     if( nullptr != ac_pcData )
     {
-        GrowTo( m_uiSize + strlen( ac_pcData ) );
-        strcpy_s( m_pcData + m_uiSize, m_uiCapacity - m_uiSize, ac_pcData );
-        m_uiSize += strlen( ac_pcData );
+        Append( ac_pcData, std::strlen( ac_pcData ) );
     }
     return *this;
 }
@@ -141,11 +157,8 @@ INLINE DumbString& DumbString::operator+=( char a_cCharacter )
 INLINE DumbString DumbString::operator+( const DumbString& ac_roString ) const
 {
     DumbString oResult( m_uiSize + ac_roString.m_uiSize );
-    strcpy_s( oResult.m_pcData, oResult.m_uiCapacity, m_pcData );
-    strcpy_s( oResult.m_pcData + m_uiSize,
-              oResult.m_uiCapacity - m_uiSize,
-              ac_roString.m_pcData );
-    oResult.m_uiSize = m_uiSize + ac_roString.m_uiSize;
+    oResult.Append( m_pcData, m_uiSize );
+    oResult.Append( ac_roString.m_pcData, ac_roString.m_uiSize );
     return oResult;
 }
 INLINE DumbString DumbString::operator+( const char* ac_pcData ) const
@@ -154,12 +167,10 @@ INLINE DumbString DumbString::operator+( const char* ac_pcData ) const
     {
         return *this ;
     }
-    DumbString oResult( m_uiSize + strlen( ac_pcData ) );
-    strcpy_s( oResult.m_pcData, oResult.m_uiCapacity, m_pcData );
-    strcpy_s( oResult.m_pcData + m_uiSize,
-              oResult.m_uiCapacity - m_uiSize,
-              ac_pcData );
-    oResult.m_uiSize = m_uiSize + strlen( ac_pcData );
+    std::size_t uiSize = std::strlen( ac_pcData );
+    DumbString oResult( m_uiSize + uiSize );
+    oResult.Append( m_pcData, m_uiSize );
+    oResult.Append( ac_pcData, uiSize );
     return oResult;
 }
 INLINE DumbString DumbString::operator+( char a_cCharacter ) const
@@ -177,36 +188,128 @@ INLINE DumbString operator+( char a_cCharacter, const DumbString& ac_roString )
     return DumbString( a_cCharacter ).operator+( ac_roString );
 }
 
-// Expand capacity to fit a string of the given size
-INLINE void DumbString::GrowTo( std::size_t a_uiSize )
+// Expand capacity to fit a string of the given size, at least doubling it so
+// that appending one character at a time doesn't reallocate every time
+INLINE void DumbString::GrowTo( std::size_t a_uiSize, bool a_bKeepData )
 {
     if( a_uiSize >= m_uiCapacity )
     {
-        unsigned int uiCapacity = RequiredCapacity( a_uiSize );
+        std::size_t uiCapacity = RequiredCapacity( a_uiSize );
+        if( uiCapacity < 2 * m_uiCapacity )
+        {
+            uiCapacity = 2 * m_uiCapacity;
+        }
         char* pcNewData = new char[ uiCapacity ];
-        std::swap( m_pcData, pcNewData );
+        if( a_bKeepData )
+        {
+            std::memcpy( pcNewData, m_pcData, m_uiSize );
+        }
+        else
+        {
+            m_uiSize = 0;
+        }
+        pcNewData[ m_uiSize ] = '\0';
+        if( m_pcData != m_acLocal && 0 != m_uiCapacity )
+        {
+            delete[] m_pcData;
+        }
+        m_pcData = pcNewData;
         m_uiCapacity = uiCapacity;
-        delete[] pcNewData;
     }
 }
 
+// Replace the characters.  The new ones may be part of this string already.
+INLINE void DumbString::Assign( const char* ac_pcData, std::size_t a_uiSize )
+{
+    GrowTo( a_uiSize, false );
+    std::memmove( m_pcData, ac_pcData, a_uiSize );
+    m_pcData[ a_uiSize ] = '\0';
+    m_uiSize = a_uiSize;
+    m_uiHash = 0;
+}
+
+// Add to the characters.  The new ones may be part of this string already.
+INLINE void DumbString::Append( const char* ac_pcData, std::size_t a_uiSize )
+{
+    const char* pcData = ac_pcData;
+    if( ac_pcData >= m_pcData && ac_pcData <= m_pcData + m_uiSize )
+    {
+        const std::size_t cuiOffset = ac_pcData - m_pcData;
+        GrowTo( m_uiSize + a_uiSize );
+        pcData = m_pcData + cuiOffset;
+    }
+    else
+    {
+        GrowTo( m_uiSize + a_uiSize );
+    }
+    std::memmove( m_pcData + m_uiSize, pcData, a_uiSize );
+    m_uiSize += a_uiSize;
+    m_pcData[ m_uiSize ] = '\0';
+    m_uiHash = 0;
+}
+
+// Take another string's characters, leaving it empty.  Heap memory and
+// borrowed characters change hands without copying.
+INLINE void DumbString::Steal( DumbString& a_roString )
+{
+    if( a_roString.m_pcData == a_roString.m_acLocal )
+    {
+        std::memcpy( m_acLocal, a_roString.m_acLocal, a_roString.m_uiSize + 1 );
+        m_pcData = m_acLocal;
+    }
+    else
+    {
+        m_pcData = a_roString.m_pcData;
+    }
+    m_uiSize = a_roString.m_uiSize;
+    m_uiCapacity = a_roString.m_uiCapacity;
+    m_uiHash = a_roString.m_uiHash;
+    a_roString.m_pcData = a_roString.m_acLocal;
+    a_roString.m_acLocal[0] = '\0';
+    a_roString.m_uiSize = 0;
+    a_roString.m_uiCapacity = LOCAL_CAPACITY;
+    a_roString.m_uiHash = 0;
+}
+
+// Free heap memory, if any, and go back to being empty
+INLINE void DumbString::Release()
+{
+    if( m_pcData != m_acLocal && 0 != m_uiCapacity )
+    {
+        delete[] m_pcData;
+    }
+    m_pcData = m_acLocal;
+    m_acLocal[0] = '\0';
+    m_uiSize = 0;
+    m_uiCapacity = LOCAL_CAPACITY;
+    m_uiHash = 0;
+}
+
 // Implement abstract functions from parent classes
 INLINE std::size_t DumbString::Hash() const
 {
-    return std::hash< std::string >()( std::string( m_pcData ) );
+    if( 0 == m_uiHash )
+    {
+        m_uiHash = HashCharacters( m_pcData, m_uiSize );
+    }
+    return m_uiHash;
 }
 INLINE int DumbString::Compare( const DumbString& ac_roString ) const
 {
-    return strcmp( m_pcData, ac_roString.m_pcData );
+    return CompareCharacters( m_pcData, m_uiSize,
+                              ac_roString.m_pcData, ac_roString.m_uiSize );
 }
 INLINE int DumbString::Compare( const char* ac_pcData ) const
 {
-    return strcmp( m_pcData, ac_pcData );
+    return ( nullptr == ac_pcData
+             ? ( 0 == m_uiSize ? 0 : 1 )
+             : CompareCharacters( m_pcData, m_uiSize,
+                                  ac_pcData, std::strlen( ac_pcData ) ) );
 }
 INLINE int DumbString::Compare( char a_cCharacter ) const
 {
-    char acData[] = { a_cCharacter, '\0' };
-    return strcmp( m_pcData, acData );
+    return CompareCharacters( m_pcData, m_uiSize,
+                              &a_cCharacter, '\0' == a_cCharacter ? 0 : 1 );
 }
 
 // Calculate the int-aligned capacity needed for a string of the given size
@@ -216,6 +319,48 @@ INLINE std::size_t DumbString::RequiredCapacity( std::size_t a_uiSize )
                 / sizeof( int ) ) * sizeof( int );
 }
 
+// Borrow the viewed characters instead of copying them
+INLINE const DumbString DumbString::Borrow( const DumbStringView& ac_roView )
+{
+    return DumbString( ac_roView, true );
+}
+
+// FNV-1a hash of the given characters, never zero so that zero can mean "not
+// calculated yet"
+INLINE std::size_t DumbString::HashCharacters( const char* ac_pcData,
+                                               std::size_t a_uiSize )
+{
+    const bool cbIs64Bit = ( sizeof( std::size_t ) > 4 );
+    const std::size_t cuiPrime =
+        (std::size_t)( cbIs64Bit ? 1099511628211ULL : 16777619ULL );
+    std::size_t uiHash =
+        (std::size_t)( cbIs64Bit ? 14695981039346656037ULL : 2166136261ULL );
+    for( std::size_t ui = 0; ui < a_uiSize; ++ui )
+    {
+        uiHash ^= (unsigned char)ac_pcData[ ui ];
+        uiHash *= cuiPrime;
+    }
+    return ( 0 == uiHash ? 1 : uiHash );
+}
+
+// Compare like strcmp, but by size instead of null termination
+INLINE int DumbString::CompareCharacters( const char* ac_pcFirst,
+                                          std::size_t a_uiFirstSize,
+                                          const char* ac_pcSecond,
+                                          std::size_t a_uiSecondSize )
+{
+    std::size_t uiSize = ( a_uiFirstSize < a_uiSecondSize
+                           ? a_uiFirstSize : a_uiSecondSize );
+    int iResult =
+        ( 0 == uiSize ? 0 : std::memcmp( ac_pcFirst, ac_pcSecond, uiSize ) );
+    if( 0 != iResult )
+    {
+        return ( iResult < 0 ? -1 : 1 );
+    }
+    return ( a_uiFirstSize < a_uiSecondSize ? -1
+             : a_uiFirstSize > a_uiSecondSize ? 1 : 0 );
+}
+
 // read from or write to stream
 INLINE void DumbString::ReadFrom( std::istream& a_roInput )
 {
@@ -236,10 +381,11 @@ INLINE void DumbString::ReadFrom( std::istream& a_roInput,
 {
     if( a_roInput )
     {
-        GrowTo( a_uiSize );
+        GrowTo( a_uiSize, false );
         a_roInput.read( m_pcData, a_uiSize );
         m_uiSize = (unsigned int)( a_roInput.gcount() );
         m_pcData[ m_uiSize ] = '\0';
+        m_uiHash = 0;
     }
 }
 INLINE void DumbString::WriteTo( std::ostream& a_roOutput ) const
@@ -275,6 +421,41 @@ INLINE DumbString DumbString::LoadFrom( const char* ac_pcFileName,
     return oString;
 }
 
+//
+// DumbStringView
+//
+
+// Constructors
+INLINE DumbStringView::DumbStringView()
+    : m_pcData( "" ), m_uiSize( 0 ), m_uiHash( 0 ) {}
+INLINE DumbStringView::DumbStringView( const char* ac_pcData )
+    : m_pcData( nullptr == ac_pcData ? "" : ac_pcData ),
+      m_uiSize( nullptr == ac_pcData ? 0 : std::strlen( ac_pcData ) ),
+      m_uiHash( 0 ) {}
+INLINE DumbStringView::DumbStringView( const char* ac_pcData,
+                                       std::size_t a_uiSize )
+    : m_pcData( nullptr == ac_pcData ? "" : ac_pcData ),
+      m_uiSize( nullptr == ac_pcData ? 0 : a_uiSize ), m_uiHash( 0 ) {}
+INLINE DumbStringView::DumbStringView( const DumbString& ac_roString )
+    : m_pcData( ac_roString.CString() ), m_uiSize( ac_roString.Size() ),
+      m_uiHash( 0 ) {}
+
+// Implement abstract functions from parent classes
+INLINE int DumbStringView::Compare( const DumbStringView& ac_roView ) const
+{
+    return DumbString::CompareCharacters( m_pcData, m_uiSize,
+                                          ac_roView.m_pcData,
+                                          ac_roView.m_uiSize );
+}
+INLINE std::size_t DumbStringView::Hash() const
+{
+    if( 0 == m_uiHash )
+    {
+        m_uiHash = DumbString::HashCharacters( m_pcData, m_uiSize );
+    }
+    return m_uiHash;
+}
+
 }   // namespace Utility
 
 #endif  // DUMB_STRING__INL
\ No newline at end of file
@@ -3,14 +3,17 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 20, 2014
  * Description:        Function implementations for DynamicArray.
- * Last Modified:      March 20, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added capacity, appending, moves, and bulk copies.
  ******************************************************************************/
 
 #ifndef DYNAMIC_ARRAY__INL
 #define DYNAMIC_ARRAY__INL
 
 #include "../Declarations/DynamicArray.h"
+#include <cstring>  // for memcpy and memmove
+#include <new>      // for placement new
+#include <utility>  // for forward and move
 
 namespace Utility
 {
@@ -22,46 +25,59 @@ const DynamicArray< T > DynamicArray< T >::EMPTY = DynamicArray< T >( 0 );
 // default constructor
 template< typename T >
 DynamicArray< T >::DynamicArray( unsigned int a_uiSize )
-    : m_uiSize( a_uiSize ),
-      m_paData( 0 == a_uiSize ? nullptr : new T[ a_uiSize ] ) {}
+    : m_paData( Allocate( a_uiSize ) ), m_uiSize( 0 ),
+      m_uiCapacity( a_uiSize )
+{
+    SetSize( a_uiSize );
+}
 template< typename T >
 DynamicArray< T >::DynamicArray( unsigned int a_uiSize, const T& ac_rFill )
-    : m_uiSize( a_uiSize ),
-      m_paData( 0 == a_uiSize ? nullptr : new T[ a_uiSize ] )
+    : m_paData( Allocate( a_uiSize ) ), m_uiSize( 0 ),
+      m_uiCapacity( a_uiSize )
 {
-    Fill( ac_rFill );
+    SetSize( a_uiSize, ac_rFill );
 }
 
 // construct from data
 template< typename T >
 DynamicArray< T >::DynamicArray( const T& ac_rData )
-    : m_uiSize( 1 ), m_paData( new T[1] )
+    : m_paData( Allocate( 1 ) ), m_uiSize( 0 ), m_uiCapacity( 1 )
 {
-    CopyData( &ac_rData, 1 );
+    CopyConstruct( m_paData, &ac_rData, 1 );
+    m_uiSize = 1;
 }
 template< typename T >
 DynamicArray< T >::DynamicArray( const T* a_pacData, unsigned int a_uiSize )
-    : m_uiSize( nullptr == a_pacData ? 0 : a_uiSize ),
-      m_paData( 0 == a_uiSize || nullptr == a_pacData ? nullptr
-                                                      : new T[ a_uiSize ] )
+    : m_paData( nullptr ), m_uiSize( 0 ), m_uiCapacity( 0 )
 {
-    if( 0 < m_uiSize )
+    if( nullptr != a_pacData && 0 < a_uiSize )
     {
-        CopyData( a_pacData, a_uiSize );
+        m_paData = Allocate( a_uiSize );
+        m_uiCapacity = a_uiSize;
+        CopyConstruct( m_paData, a_pacData, a_uiSize );
+        m_uiSize = a_uiSize;
     }
 }
 
 // copy construct
 template< typename T >
 DynamicArray< T >::DynamicArray( const DynamicArray& ac_roArray )
-    : m_uiSize( nullptr == ac_roArray.m_paData ? 0 : ac_roArray.m_uiSize ),
-      m_paData( 0 == ac_roArray.m_uiSize || nullptr == ac_roArray.m_paData
-                ? nullptr : new T[ ac_roArray.m_uiSize ] )
+    : m_paData( Allocate( ac_roArray.m_uiSize ) ), m_uiSize( 0 ),
+      m_uiCapacity( ac_roArray.m_uiSize )
 {
-    if( 0 < m_uiSize )
-    {
-        CopyData( ac_roArray.m_paData, ac_roArray.m_uiSize );
-    }
+    CopyConstruct( m_paData, ac_roArray.m_paData, ac_roArray.m_uiSize );
+    m_uiSize = ac_roArray.m_uiSize;
+}
+
+// move construct
+template< typename T >
+DynamicArray< T >::DynamicArray( DynamicArray&& a_rroArray )
+    : m_paData( a_rroArray.m_paData ), m_uiSize( a_rroArray.m_uiSize ),
+      m_uiCapacity( a_rroArray.m_uiCapacity )
+{
+    a_rroArray.m_paData = nullptr;
+    a_rroArray.m_uiSize = 0;
+    a_rroArray.m_uiCapacity = 0;
 }
 
 // destroy
@@ -70,10 +86,12 @@ DynamicArray< T >::~DynamicArray()
 {
     if( nullptr != m_paData )
     {
+        Destroy( m_paData, m_uiSize );
         m_uiSize = 0;
+        m_uiCapacity = 0;
         T* paData = m_paData;
         m_paData = nullptr;
-        delete[] paData;
+        Free( paData );
     }
 }
 
@@ -82,13 +100,75 @@ template< typename T >
 DynamicArray< T >&
     DynamicArray< T >::operator=( const DynamicArray& ac_roArray )
 {
-    if( &ac_roArray.m_uiSize != &m_uiSize )
+    if( &ac_roArray != this )
     {
-        SetSize( nullptr == ac_roArray.m_paData ? 0 : ac_roArray.m_uiSize );
-        if( 0 < m_uiSize )
+        const unsigned int cuiSize = ac_roArray.m_uiSize;
+        if( cuiSize > m_uiCapacity )
+        {
+            // Copy into new memory before letting go of the old
+            T* paData = Allocate( cuiSize );
+            try
+            {
+                CopyConstruct( paData, ac_roArray.m_paData, cuiSize );
+            }
+            catch( ... )
+            {
+                Free( paData );
+                throw;
+            }
+            Destroy( m_paData, m_uiSize );
+            Free( m_paData );
+            m_paData = paData;
+            m_uiCapacity = cuiSize;
+        }
+        else if( IS_TRIVIAL )
         {
-            CopyData( ac_roArray.m_paData, ac_roArray.m_uiSize );
+            if( 0 < cuiSize )
+            {
+                std::memcpy( m_paData, ac_roArray.m_paData,
+                             cuiSize * sizeof( T ) );
+            }
         }
+        else
+        {
+            // Assign over existing elements, then construct or destroy the
+            // difference
+            const unsigned int cuiCommon =
+                ( m_uiSize < cuiSize ? m_uiSize : cuiSize );
+            for( unsigned int ui = 0; ui < cuiCommon; ++ui )
+            {
+                m_paData[ ui ] = ac_roArray.m_paData[ ui ];
+            }
+            if( cuiSize > m_uiSize )
+            {
+                CopyConstruct( m_paData + m_uiSize,
+                               ac_roArray.m_paData + m_uiSize,
+                               cuiSize - m_uiSize );
+            }
+            else
+            {
+                Destroy( m_paData + cuiSize, m_uiSize - cuiSize );
+            }
+        }
+        m_uiSize = cuiSize;
+    }
+    return *this;
+}
+
+// move assign
+template< typename T >
+DynamicArray< T >& DynamicArray< T >::operator=( DynamicArray&& a_rroArray )
+{
+    if( &a_rroArray != this )
+    {
+        Destroy( m_paData, m_uiSize );
+        Free( m_paData );
+        m_paData = a_rroArray.m_paData;
+        m_uiSize = a_rroArray.m_uiSize;
+        m_uiCapacity = a_rroArray.m_uiCapacity;
+        a_rroArray.m_paData = nullptr;
+        a_rroArray.m_uiSize = 0;
+        a_rroArray.m_uiCapacity = 0;
     }
     return *this;
 }
@@ -97,9 +177,19 @@ DynamicArray< T >&
 template< typename T >
 DynamicArray< T >& DynamicArray< T >::operator=( const T& ac_rData )
 {
-    SetSize( 1 );
-    CopyData( &ac_rData, 1 );
-    return *this;
+    if( 0 < m_uiSize && &ac_rData == m_paData )
+    {
+        return SetSize( 1 );
+    }
+    if( 0 == m_uiCapacity || &ac_rData < m_paData ||
+        &ac_rData >= m_paData + m_uiSize )
+    {
+        Clear();
+        return PushBack( ac_rData );
+    }
+    T oData( ac_rData );    // the element is about to be destroyed
+    Clear();
+    return PushBack( std::move( oData ) );
 }
 
 // access array elements
@@ -122,20 +212,22 @@ const T& DynamicArray< T >::operator[]( unsigned int a_uiIndex ) const
     return m_paData[ a_uiIndex ];
 }
 
-// manage array size
+// manage array size - new elements are default-constructed
 template< typename T >
 DynamicArray< T >& DynamicArray< T >::SetSize( unsigned int a_uiSize )
 {
-    if( a_uiSize != m_uiSize )
+    if( a_uiSize > m_uiCapacity )
     {
-        T* paData = m_paData;
-        m_paData = ( 0 == a_uiSize ? nullptr : new T[ a_uiSize ] );
-        CopyData( paData, a_uiSize );
+        Reallocate( GrownCapacity( a_uiSize ) );
+    }
+    for( ; m_uiSize < a_uiSize; ++m_uiSize )
+    {
+        new( m_paData + m_uiSize ) T;
+    }
+    if( a_uiSize < m_uiSize )
+    {
+        Destroy( m_paData + a_uiSize, m_uiSize - a_uiSize );
         m_uiSize = a_uiSize;
-        if( nullptr != paData )
-        {
-            delete[] paData;
-        }
     }
     return *this;
 }
@@ -143,15 +235,180 @@ template< typename T >
 DynamicArray< T >& DynamicArray< T >::SetSize( unsigned int a_uiSize,
                                                const T& ac_rFill )
 {
-    unsigned int uiSize = m_uiSize;
-    SetSize( a_uiSize );
-    for( unsigned int ui = uiSize; ui < m_uiSize; ++ui )
+    if( a_uiSize > m_uiCapacity )
     {
-        m_paData[ ui ] = ac_rFill;
+        if( 0 < m_uiSize && &ac_rFill >= m_paData &&
+            &ac_rFill < m_paData + m_uiSize )
+        {
+            T oFill( ac_rFill );    // the element is about to move
+            return SetSize( a_uiSize, oFill );
+        }
+        Reallocate( GrownCapacity( a_uiSize ) );
+    }
+    for( ; m_uiSize < a_uiSize; ++m_uiSize )
+    {
+        new( m_paData + m_uiSize ) T( ac_rFill );
+    }
+    if( a_uiSize < m_uiSize )
+    {
+        Destroy( m_paData + a_uiSize, m_uiSize - a_uiSize );
+        m_uiSize = a_uiSize;
     }
     return *this;
 }
 
+// manage memory
+template< typename T >
+DynamicArray< T >& DynamicArray< T >::Reserve( unsigned int a_uiCapacity )
+{
+    if( a_uiCapacity > m_uiCapacity )
+    {
+        Reallocate( a_uiCapacity );
+    }
+    return *this;
+}
+template< typename T >
+DynamicArray< T >& DynamicArray< T >::ShrinkToFit()
+{
+    if( m_uiCapacity > m_uiSize )
+    {
+        Reallocate( m_uiSize );
+    }
+    return *this;
+}
+
+// remove all elements, keeping the memory
+template< typename T >
+DynamicArray< T >& DynamicArray< T >::Clear()
+{
+    Destroy( m_paData, m_uiSize );
+    m_uiSize = 0;
+    return *this;
+}
+
+// add an element to the end
+template< typename T >
+DynamicArray< T >& DynamicArray< T >::PushBack( const T& ac_rData )
+{
+    EmplaceBack( ac_rData );
+    return *this;
+}
+template< typename T >
+DynamicArray< T >& DynamicArray< T >::PushBack( T&& a_rrData )
+{
+    EmplaceBack( std::move( a_rrData ) );
+    return *this;
+}
+
+// construct an element at the end
+template< typename T >
+T& DynamicArray< T >::EmplaceBack()
+{
+    if( m_uiSize < m_uiCapacity )
+    {
+        new( m_paData + m_uiSize ) T();
+        return m_paData[ m_uiSize++ ];
+    }
+    T* paNewData = nullptr;
+    T* pSlot = AppendSlot( paNewData );
+    try
+    {
+        new( pSlot ) T();
+    }
+    catch( ... )
+    {
+        Free( paNewData );
+        throw;
+    }
+    return FinishAppend( paNewData );
+}
+template< typename T >
+template< typename A1 >
+T& DynamicArray< T >::EmplaceBack( A1&& a_rrArgument1 )
+{
+    if( m_uiSize < m_uiCapacity )
+    {
+        new( m_paData + m_uiSize ) T( std::forward< A1 >( a_rrArgument1 ) );
+        return m_paData[ m_uiSize++ ];
+    }
+    T* paNewData = nullptr;
+    T* pSlot = AppendSlot( paNewData );
+    try
+    {
+        new( pSlot ) T( std::forward< A1 >( a_rrArgument1 ) );
+    }
+    catch( ... )
+    {
+        Free( paNewData );
+        throw;
+    }
+    return FinishAppend( paNewData );
+}
+template< typename T >
+template< typename A1, typename A2 >
+T& DynamicArray< T >::EmplaceBack( A1&& a_rrArgument1, A2&& a_rrArgument2 )
+{
+    if( m_uiSize < m_uiCapacity )
+    {
+        new( m_paData + m_uiSize ) T( std::forward< A1 >( a_rrArgument1 ),
+                                      std::forward< A2 >( a_rrArgument2 ) );
+        return m_paData[ m_uiSize++ ];
+    }
+    T* paNewData = nullptr;
+    T* pSlot = AppendSlot( paNewData );
+    try
+    {
+        new( pSlot ) T( std::forward< A1 >( a_rrArgument1 ),
+                        std::forward< A2 >( a_rrArgument2 ) );
+    }
+    catch( ... )
+    {
+        Free( paNewData );
+        throw;
+    }
+    return FinishAppend( paNewData );
+}
+template< typename T >
+template< typename A1, typename A2, typename A3 >
+T& DynamicArray< T >::EmplaceBack( A1&& a_rrArgument1, A2&& a_rrArgument2,
+                                   A3&& a_rrArgument3 )
+{
+    if( m_uiSize < m_uiCapacity )
+    {
+        new( m_paData + m_uiSize ) T( std::forward< A1 >( a_rrArgument1 ),
+                                      std::forward< A2 >( a_rrArgument2 ),
+                                      std::forward< A3 >( a_rrArgument3 ) );
+        return m_paData[ m_uiSize++ ];
+    }
+    T* paNewData = nullptr;
+    T* pSlot = AppendSlot( paNewData );
+    try
+    {
+        new( pSlot ) T( std::forward< A1 >( a_rrArgument1 ),
+                        std::forward< A2 >( a_rrArgument2 ),
+                        std::forward< A3 >( a_rrArgument3 ) );
+    }
+    catch( ... )
+    {
+        Free( paNewData );
+        throw;
+    }
+    return FinishAppend( paNewData );
+}
+
+// remove the last element
+template< typename T >
+DynamicArray< T >& DynamicArray< T >::PopBack()
+{
+    if( 0 == m_uiSize )
+    {
+        throw std::out_of_range( "Cannot remove from an empty array" );
+    }
+    --m_uiSize;
+    Destroy( m_paData + m_uiSize, 1 );
+    return *this;
+}
+
 // set all elements to the given value
 template< typename T >
 DynamicArray< T >& DynamicArray< T >::Fill( const T& ac_rFill )
@@ -163,7 +420,8 @@ DynamicArray< T >& DynamicArray< T >::Fill( const T& ac_rFill )
     return *this;
 }
 
-// copy data
+// copy data into existing elements, starting at the given index and stopping
+// at the end of the array
 template< typename T >
 DynamicArray< T >& DynamicArray< T >::CopyData( const T* a_pacData,
                                                 unsigned int a_uiSize,
@@ -175,14 +433,150 @@ DynamicArray< T >& DynamicArray< T >::CopyData( const T* a_pacData,
         unsigned int uiSize = ( m_uiSize - a_uiStart < a_uiSize
                                 ? m_uiSize - a_uiStart : a_uiSize );
         T* paData = m_paData + a_uiStart;
-        for( unsigned int ui = 0; ui < uiSize; ++ui )
+        if( IS_TRIVIAL )
+        {
+            std::memmove( paData, a_pacData, uiSize * sizeof( T ) );
+        }
+        else
         {
-            paData[ ui ] = a_pacData[ ui ];
+            for( unsigned int ui = 0; ui < uiSize; ++ui )
+            {
+                paData[ ui ] = a_pacData[ ui ];
+            }
         }
     }
     return *this;
 }
 
+// raw memory
+template< typename T >
+T* DynamicArray< T >::Allocate( unsigned int a_uiCapacity )
+{
+    if( 0 == a_uiCapacity )
+    {
+        return nullptr;
+    }
+    if( a_uiCapacity > (size_t)-1 / sizeof( T ) )
+    {
+        throw std::length_error( "Array too large to allocate" );
+    }
+    return static_cast< T* >( ::operator new( a_uiCapacity * sizeof( T ) ) );
+}
+template< typename T >
+void DynamicArray< T >::Free( T* a_paData )
+{
+    ::operator delete( a_paData );
+}
+
+// copy elements into raw memory
+template< typename T >
+void DynamicArray< T >::CopyConstruct( T* a_paTarget, const T* ac_paSource,
+                                       unsigned int a_uiCount )
+{
+    if( IS_TRIVIAL )
+    {
+        if( 0 < a_uiCount )
+        {
+            std::memcpy( a_paTarget, ac_paSource, a_uiCount * sizeof( T ) );
+        }
+        return;
+    }
+    unsigned int ui = 0;
+    try
+    {
+        for( ; ui < a_uiCount; ++ui )
+        {
+            new( a_paTarget + ui ) T( ac_paSource[ ui ] );
+        }
+    }
+    catch( ... )
+    {
+        Destroy( a_paTarget, ui );
+        throw;
+    }
+}
+
+// move elements into raw memory, leaving raw memory behind.  Element move
+// constructors are assumed not to throw.
+template< typename T >
+void DynamicArray< T >::Relocate( T* a_paTarget, T* a_paSource,
+                                  unsigned int a_uiCount )
+{
+    if( IS_TRIVIAL )
+    {
+        if( 0 < a_uiCount )
+        {
+            std::memcpy( a_paTarget, a_paSource, a_uiCount * sizeof( T ) );
+        }
+        return;
+    }
+    for( unsigned int ui = 0; ui < a_uiCount; ++ui )
+    {
+        new( a_paTarget + ui ) T( std::move( a_paSource[ ui ] ) );
+        a_paSource[ ui ].~T();
+    }
+}
+
+// destroy elements, leaving raw memory
+template< typename T >
+void DynamicArray< T >::Destroy( T* a_paData, unsigned int a_uiCount )
+{
+    if( !IS_TRIVIAL )
+    {
+        for( unsigned int ui = 0; ui < a_uiCount; ++ui )
+        {
+            a_paData[ ui ].~T();
+        }
+    }
+}
+
+// grow by half again, but at least to the given capacity
+template< typename T >
+unsigned int DynamicArray< T >::GrownCapacity( unsigned int a_uiMinimum ) const
+{
+    unsigned int uiCapacity = m_uiCapacity + m_uiCapacity / 2;
+    if( uiCapacity < m_uiCapacity )
+    {
+        uiCapacity = (unsigned int)-1;  // overflow
+    }
+    if( uiCapacity < 4 )
+    {
+        uiCapacity = 4;
+    }
+    return ( uiCapacity < a_uiMinimum ? a_uiMinimum : uiCapacity );
+}
+
+// move the elements to new memory
+template< typename T >
+void DynamicArray< T >::Reallocate( unsigned int a_uiCapacity )
+{
+    T* paData = Allocate( a_uiCapacity );
+    Relocate( paData, m_paData, m_uiSize );
+    Free( m_paData );
+    m_paData = paData;
+    m_uiCapacity = a_uiCapacity;
+}
+
+// where the next element goes in new memory, once the array is full
+template< typename T >
+T* DynamicArray< T >::AppendSlot( T*& a_rpaNewData )
+{
+    a_rpaNewData = Allocate( GrownCapacity( m_uiSize + 1 ) );
+    return a_rpaNewData + m_uiSize;
+}
+
+// move the other elements over to the new memory and count the new one
+template< typename T >
+T& DynamicArray< T >::FinishAppend( T* a_paNewData )
+{
+    const unsigned int cuiCapacity = GrownCapacity( m_uiSize + 1 );
+    Relocate( a_paNewData, m_paData, m_uiSize );
+    Free( m_paData );
+    m_paData = a_paNewData;
+    m_uiCapacity = cuiCapacity;
+    return m_paData[ m_uiSize++ ];
+}
+
 }   // namespace Utility
 
 #endif  // DYNAMIC_ARRAY__INL
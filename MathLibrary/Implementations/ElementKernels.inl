@@ -0,0 +1,251 @@
+/******************************************************************************
+ * File:               ElementKernels.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Template implementations for element-wise kernels.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef ELEMENT_KERNELS__INL
+#define ELEMENT_KERNELS__INL
+
+#include "../Declarations/ElementKernels.h"
+#include "../Declarations/SimdRegister.h"
+
+namespace Math
+{
+
+//
+// One element at a time
+//
+
+template< typename T >
+inline void ScalarElementKernels< T >::Add( const T* ac_pLeft,
+                                            const T* ac_pRight,
+                                            T* a_pResult,
+                                            unsigned int a_uiCount )
+{
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        a_pResult[i] = T( ac_pLeft[i] + ac_pRight[i] );
+    }
+}
+template< typename T >
+inline void ScalarElementKernels< T >::Subtract( const T* ac_pLeft,
+                                                 const T* ac_pRight,
+                                                 T* a_pResult,
+                                                 unsigned int a_uiCount )
+{
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        a_pResult[i] = T( ac_pLeft[i] - ac_pRight[i] );
+    }
+}
+template< typename T >
+template< typename U >
+inline void ScalarElementKernels< T >::Multiply( const T* ac_pElements,
+                                                 const U& ac_rScalar,
+                                                 T* a_pResult,
+                                                 unsigned int a_uiCount )
+{
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        a_pResult[i] = T( ac_pElements[i] * ac_rScalar );
+    }
+}
+template< typename T >
+template< typename U >
+inline void ScalarElementKernels< T >::Divide( const T* ac_pElements,
+                                               const U& ac_rScalar,
+                                               T* a_pResult,
+                                               unsigned int a_uiCount )
+{
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        a_pResult[i] = T( ac_pElements[i] / ac_rScalar );
+    }
+}
+template< typename T >
+inline void ScalarElementKernels< T >::Negate( const T* ac_pElements,
+                                               T* a_pResult,
+                                               unsigned int a_uiCount )
+{
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        a_pResult[i] = T( ac_pElements[i] * -1 );
+    }
+}
+template< typename T >
+inline bool ScalarElementKernels< T >::Equal( const T* ac_pLeft,
+                                              const T* ac_pRight,
+                                              unsigned int a_uiCount )
+{
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        if( !( ac_pLeft[i] == ac_pRight[i] ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+template< typename T >
+inline bool ScalarElementKernels< T >::NotEqual( const T* ac_pLeft,
+                                                 const T* ac_pRight,
+                                                 unsigned int a_uiCount )
+{
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        if( ac_pLeft[i] != ac_pRight[i] )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+template< typename T >
+inline void ScalarElementKernels< T >::Fill( T* a_pResult, const T& ac_rValue,
+                                             unsigned int a_uiCount )
+{
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        a_pResult[i] = ac_rValue;
+    }
+}
+template< typename T >
+inline void ScalarElementKernels< T >::Copy( const T* ac_pElements,
+                                             T* a_pResult,
+                                             unsigned int a_uiCount )
+{
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        a_pResult[i] = ac_pElements[i];
+    }
+}
+template< typename T >
+inline void ScalarElementKernels< T >::Transpose( const T* ac_pElements,
+                                                  unsigned int a_uiRows,
+                                                  unsigned int a_uiColumns,
+                                                  T* a_pResult )
+{
+    for( unsigned int i = 0; i < a_uiRows; ++i )
+    {
+        for( unsigned int j = 0; j < a_uiColumns; ++j )
+        {
+            a_pResult[ j * a_uiRows + i ] = ac_pElements[ i * a_uiColumns + j ];
+        }
+    }
+}
+
+//
+// Whole registers at a time
+//
+
+template< typename R >
+inline void SimdElementKernels< R >::Add( const ElementType* ac_pLeft,
+                                          const ElementType* ac_pRight,
+                                          ElementType* a_pResult,
+                                          unsigned int a_uiCount )
+{
+    unsigned int i = 0;
+    for( ; i + R::WIDTH <= a_uiCount; i += R::WIDTH )
+    {
+        R::Store( a_pResult + i, R::Add( R::Load( ac_pLeft + i ),
+                                         R::Load( ac_pRight + i ) ) );
+    }
+    ScalarType::Add( ac_pLeft + i, ac_pRight + i, a_pResult + i,
+                     a_uiCount - i );
+}
+template< typename R >
+inline void SimdElementKernels< R >::Subtract( const ElementType* ac_pLeft,
+                                               const ElementType* ac_pRight,
+                                               ElementType* a_pResult,
+                                               unsigned int a_uiCount )
+{
+    unsigned int i = 0;
+    for( ; i + R::WIDTH <= a_uiCount; i += R::WIDTH )
+    {
+        R::Store( a_pResult + i, R::Subtract( R::Load( ac_pLeft + i ),
+                                              R::Load( ac_pRight + i ) ) );
+    }
+    ScalarType::Subtract( ac_pLeft + i, ac_pRight + i, a_pResult + i,
+                          a_uiCount - i );
+}
+template< typename R >
+template< typename U >
+inline void SimdElementKernels< R >::Multiply( const ElementType* ac_pElements,
+                                               const U& ac_rScalar,
+                                               ElementType* a_pResult,
+                                               unsigned int a_uiCount )
+{
+    unsigned int i = 0;
+    ElementType tScalar = (ElementType)ac_rScalar;
+    if( (U)tScalar == ac_rScalar )
+    {
+        const typename R::Type oScalar = R::Set( tScalar );
+        for( ; i + R::WIDTH <= a_uiCount; i += R::WIDTH )
+        {
+            R::Store( a_pResult + i,
+                      R::Multiply( R::Load( ac_pElements + i ), oScalar ) );
+        }
+    }
+    ScalarType::Multiply( ac_pElements + i, ac_rScalar, a_pResult + i,
+                          a_uiCount - i );
+}
+template< typename R >
+template< typename U >
+inline void SimdElementKernels< R >::Divide( const ElementType* ac_pElements,
+                                             const U& ac_rScalar,
+                                             ElementType* a_pResult,
+                                             unsigned int a_uiCount )
+{
+    unsigned int i = 0;
+    ElementType tScalar = (ElementType)ac_rScalar;
+    if( (U)tScalar == ac_rScalar )
+    {
+        const typename R::Type oScalar = R::Set( tScalar );
+        for( ; i + R::WIDTH <= a_uiCount; i += R::WIDTH )
+        {
+            R::Store( a_pResult + i,
+                      R::Divide( R::Load( ac_pElements + i ), oScalar ) );
+        }
+    }
+    ScalarType::Divide( ac_pElements + i, ac_rScalar, a_pResult + i,
+                        a_uiCount - i );
+}
+template< typename R >
+inline void SimdElementKernels< R >::Negate( const ElementType* ac_pElements,
+                                             ElementType* a_pResult,
+                                             unsigned int a_uiCount )
+{
+    // multiply instead of flipping sign bits, so NaNs come out the same way
+    Multiply( ac_pElements, -1, a_pResult, a_uiCount );
+}
+template< typename R >
+inline bool SimdElementKernels< R >::Equal( const ElementType* ac_pLeft,
+                                            const ElementType* ac_pRight,
+                                            unsigned int a_uiCount )
+{
+    unsigned int i = 0;
+    for( ; i + R::WIDTH <= a_uiCount; i += R::WIDTH )
+    {
+        if( !R::AllEqual( R::Load( ac_pLeft + i ), R::Load( ac_pRight + i ) ) )
+        {
+            return false;
+        }
+    }
+    return ScalarType::Equal( ac_pLeft + i, ac_pRight + i, a_uiCount - i );
+}
+template< typename R >
+inline bool SimdElementKernels< R >::NotEqual( const ElementType* ac_pLeft,
+                                               const ElementType* ac_pRight,
+                                               unsigned int a_uiCount )
+{
+    // for floating point, a != b is exactly !( a == b ), even for NaNs
+    return !Equal( ac_pLeft, ac_pRight, a_uiCount );
+}
+
+}   // namespace Math
+
+#endif  // ELEMENT_KERNELS__INL
@@ -0,0 +1,208 @@
+/******************************************************************************
+ * File:               FastFunctions.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Array versions of the fast math functions.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef FAST_FUNCTIONS__INL
+#define FAST_FUNCTIONS__INL
+
+#include "../Declarations/FastFunctions.h"
+#include "../Declarations/ImExportMacro.h"
+#include "../Declarations/MatrixProduct.h"
+#include "../Declarations/SimdRegister.h"
+
+namespace Math
+{
+
+namespace Fast
+{
+
+// The arrays one call works on - up to two inputs and two outputs
+struct FastArrays
+{
+    const double* m_apdIn[ 2 ];
+    double* m_apdOut[ 2 ];
+};
+
+// Each kernel handles the R::WIDTH elements starting at the given index
+struct FastSinKernel
+{
+    template< typename R >
+    static void Apply( const FastArrays& ac_roArrays, unsigned int a_uiIndex )
+    {
+        typename R::Type oSin, oCos;
+        SinCosKernel< R >( R::Load( ac_roArrays.m_apdIn[0] + a_uiIndex ),
+                           oSin, oCos );
+        R::Store( ac_roArrays.m_apdOut[0] + a_uiIndex, oSin );
+    }
+};
+struct FastCosKernel
+{
+    template< typename R >
+    static void Apply( const FastArrays& ac_roArrays, unsigned int a_uiIndex )
+    {
+        typename R::Type oSin, oCos;
+        SinCosKernel< R >( R::Load( ac_roArrays.m_apdIn[0] + a_uiIndex ),
+                           oSin, oCos );
+        R::Store( ac_roArrays.m_apdOut[0] + a_uiIndex, oCos );
+    }
+};
+struct FastSinCosKernel
+{
+    template< typename R >
+    static void Apply( const FastArrays& ac_roArrays, unsigned int a_uiIndex )
+    {
+        typename R::Type oSin, oCos;
+        SinCosKernel< R >( R::Load( ac_roArrays.m_apdIn[0] + a_uiIndex ),
+                           oSin, oCos );
+        R::Store( ac_roArrays.m_apdOut[0] + a_uiIndex, oSin );
+        R::Store( ac_roArrays.m_apdOut[1] + a_uiIndex, oCos );
+    }
+};
+struct FastAtan2Kernel
+{
+    template< typename R >
+    static void Apply( const FastArrays& ac_roArrays, unsigned int a_uiIndex )
+    {
+        R::Store( ac_roArrays.m_apdOut[0] + a_uiIndex,
+                  Atan2Kernel< R >(
+                      R::Load( ac_roArrays.m_apdIn[0] + a_uiIndex ),
+                      R::Load( ac_roArrays.m_apdIn[1] + a_uiIndex ) ) );
+    }
+};
+struct FastAcosKernel
+{
+    template< typename R >
+    static void Apply( const FastArrays& ac_roArrays, unsigned int a_uiIndex )
+    {
+        R::Store( ac_roArrays.m_apdOut[0] + a_uiIndex,
+                  AcosKernel< R >(
+                      R::Load( ac_roArrays.m_apdIn[0] + a_uiIndex ) ) );
+    }
+};
+struct FastRsqrtKernel
+{
+    template< typename R >
+    static void Apply( const FastArrays& ac_roArrays, unsigned int a_uiIndex )
+    {
+        R::Store( ac_roArrays.m_apdOut[0] + a_uiIndex,
+                  RsqrtKernel< R >(
+                      R::Load( ac_roArrays.m_apdIn[0] + a_uiIndex ) ) );
+    }
+};
+struct FastExpKernel
+{
+    template< typename R >
+    static void Apply( const FastArrays& ac_roArrays, unsigned int a_uiIndex )
+    {
+        R::Store( ac_roArrays.m_apdOut[0] + a_uiIndex,
+                  ExpKernel< R >(
+                      R::Load( ac_roArrays.m_apdIn[0] + a_uiIndex ) ) );
+    }
+};
+
+// Apply a kernel to as many whole registers as fit, starting from the given
+// index, and return the index of the first element left over
+template< typename K, typename R >
+inline unsigned int FastRun( const FastArrays& ac_roArrays,
+                             unsigned int a_uiStart, unsigned int a_uiCount )
+{
+    unsigned int i = a_uiStart;
+    for( ; i + R::WIDTH <= a_uiCount; i += R::WIDTH )
+    {
+        K::template Apply< R >( ac_roArrays, i );
+    }
+    R::Finish();
+    return i;
+}
+
+// Apply a kernel to whole arrays with the widest registers available
+template< typename K >
+inline void FastDispatch( const FastArrays& ac_roArrays,
+                          unsigned int a_uiCount )
+{
+    unsigned int uiDone = 0;
+    SimdLevel eLevel = DetectedSimdLevel();
+#ifdef SIMD_REGISTER_AVX
+    if( SIMD_AVX == eLevel )
+    {
+        uiDone = FastRun< K, AvxDoubleRegister >( ac_roArrays, uiDone,
+                                                  a_uiCount );
+    }
+#endif
+#ifdef SIMD_REGISTER_SSE2
+    if( SIMD_SSE2 <= eLevel )
+    {
+        uiDone = FastRun< K, SseDoubleRegister >( ac_roArrays, uiDone,
+                                                  a_uiCount );
+    }
+#endif
+    FastRun< K, ScalarDoubleRegister >( ac_roArrays, uiDone, a_uiCount );
+}
+
+// Fill in the arrays and dispatch
+template< typename K >
+inline void FastDispatch( const double* ac_pdIn0, const double* ac_pdIn1,
+                          double* a_pdOut0, double* a_pdOut1,
+                          unsigned int a_uiCount )
+{
+    FastArrays oArrays;
+    oArrays.m_apdIn[0] = ac_pdIn0;
+    oArrays.m_apdIn[1] = ac_pdIn1;
+    oArrays.m_apdOut[0] = a_pdOut0;
+    oArrays.m_apdOut[1] = a_pdOut1;
+    FastDispatch< K >( oArrays, a_uiCount );
+}
+
+INLINE void Sin( const double* ac_pdRadians, double* a_pdOut,
+                 unsigned int a_uiCount )
+{
+    FastDispatch< FastSinKernel >( ac_pdRadians, nullptr, a_pdOut, nullptr,
+                                   a_uiCount );
+}
+INLINE void Cos( const double* ac_pdRadians, double* a_pdOut,
+                 unsigned int a_uiCount )
+{
+    FastDispatch< FastCosKernel >( ac_pdRadians, nullptr, a_pdOut, nullptr,
+                                   a_uiCount );
+}
+INLINE void SinCos( const double* ac_pdRadians, double* a_pdSin,
+                    double* a_pdCos, unsigned int a_uiCount )
+{
+    FastDispatch< FastSinCosKernel >( ac_pdRadians, nullptr, a_pdSin,
+                                      a_pdCos, a_uiCount );
+}
+INLINE void Atan2( const double* ac_pdY, const double* ac_pdX,
+                   double* a_pdOut, unsigned int a_uiCount )
+{
+    FastDispatch< FastAtan2Kernel >( ac_pdY, ac_pdX, a_pdOut, nullptr,
+                                     a_uiCount );
+}
+INLINE void Acos( const double* ac_pdX, double* a_pdOut,
+                  unsigned int a_uiCount )
+{
+    FastDispatch< FastAcosKernel >( ac_pdX, nullptr, a_pdOut, nullptr,
+                                    a_uiCount );
+}
+INLINE void Rsqrt( const double* ac_pdX, double* a_pdOut,
+                   unsigned int a_uiCount )
+{
+    FastDispatch< FastRsqrtKernel >( ac_pdX, nullptr, a_pdOut, nullptr,
+                                     a_uiCount );
+}
+INLINE void Exp( const double* ac_pdX, double* a_pdOut,
+                 unsigned int a_uiCount )
+{
+    FastDispatch< FastExpKernel >( ac_pdX, nullptr, a_pdOut, nullptr,
+                                   a_uiCount );
+}
+
+}   // namespace Fast
+
+}   // namespace Math
+
+#endif  // FAST_FUNCTIONS__INL
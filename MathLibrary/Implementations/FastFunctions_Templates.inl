@@ -0,0 +1,271 @@
+/******************************************************************************
+ * File:               FastFunctions_Templates.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Kernels for the fast math functions, templated on the
+ *                      register type, and the one-value versions built on
+ *                      them.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef FAST_FUNCTIONS__TEMPLATES__INL
+#define FAST_FUNCTIONS__TEMPLATES__INL
+
+#include "../Declarations/FastFunctions.h"
+#include "../Declarations/Functions.h"
+#include "../Declarations/SimdRegister.h"
+
+namespace Math
+{
+
+namespace Fast
+{
+
+// PI/2 split in two so that N*PIO2_HIGH is exact for |N| < 2^20 (fdlibm)
+const double PIO2_HIGH = 1.57079632673412561417e+00;
+const double PIO2_LOW = 6.07710050650619224932e-11;
+const double TWO_OVER_PI = 0.636619772367581343076;
+
+// Minimax polynomials for sine and cosine on [-PI/4,PI/4] (fdlibm)
+const unsigned int SIN_TERMS = 6;
+const double SIN_COEFFICIENTS[ SIN_TERMS ] =
+    { -1.66666666666666324348e-01, 8.33333333332248946124e-03,
+      -1.98412698298579493134e-04, 2.75573137070700676789e-06,
+      -2.50507602534068634195e-08, 1.58969099521155010221e-10 };
+const double COS_COEFFICIENTS[ SIN_TERMS ] =
+    { 4.16666666666666019037e-02, -1.38888888888741095749e-03,
+      2.48015872894767294178e-05, -2.75573143513906633035e-07,
+      2.08757232129817482790e-09, -1.13596475577881948265e-11 };
+
+// Rational approximation of arctangent on [-0.42,0.66] (Cephes) - the
+// denominator's leading coefficient is 1
+const unsigned int ATAN_TERMS = 5;
+const double ATAN_REDUCTION_THRESHOLD = 0.66;
+const double ATAN_NUMERATOR[ ATAN_TERMS ] =
+    { -8.750608600031904122785e-01, -1.615753718733365076637e+01,
+      -7.500855792314704667340e+01, -1.228866684490136173410e+02,
+      -6.485021904942025371773e+01 };
+const double ATAN_DENOMINATOR[ ATAN_TERMS ] =
+    { 2.485846490142306297962e+01, 1.650270098316988542046e+02,
+      4.328810604912902668951e+02, 4.853903996359136964868e+02,
+      1.945506571482613964425e+02 };
+
+// ln(2) split in two so that N*LN2_HIGH is exact (fdlibm), and the Taylor
+// series for e^x, which converges to double precision by the 12th power on
+// [-ln(2)/2,ln(2)/2]
+const double LOG2_E = 1.44269504088896338700e+00;
+const double LN2_HIGH = 6.93147180369123816490e-01;
+const double LN2_LOW = 1.90821492927058770002e-10;
+const double EXP_MINIMUM = -708.0;
+const double EXP_MAXIMUM = 709.0;
+const unsigned int EXP_TERMS = 13;
+const double EXP_COEFFICIENTS[ EXP_TERMS ] =
+    { 1.0, 1.0, 1.0 / 2, 1.0 / 6, 1.0 / 24, 1.0 / 120, 1.0 / 720,
+      1.0 / 5040, 1.0 / 40320, 1.0 / 362880, 1.0 / 3628800,
+      1.0 / 39916800, 1.0 / 479001600 };
+
+// Newton's method steps for 1/sqrt(x) - each roughly squares the error
+const unsigned int RSQRT_STEPS = 3;
+
+// Round to the nearest integer, for values less than 2^51 in magnitude
+template< typename R >
+inline typename R::Type Round( const typename R::Type& ac_roValue )
+{
+    const typename R::Type oConstant = R::Set( ROUNDING_CONSTANT );
+    return R::Subtract( R::Add( ac_roValue, oConstant ), oConstant );
+}
+
+// Reduce to r = x - N*PI/2 and evaluate both polynomials, then choose and
+// negate according to the quadrant, N mod 4.  The quadrant arithmetic only
+// ever multiplies by 0, 1, or -1, so it's exact.
+template< typename R >
+inline void SinCosKernel( const typename R::Type& ac_roRadians,
+                          typename R::Type& a_roSin,
+                          typename R::Type& a_roCos )
+{
+    typedef typename R::Type Register;
+    const Register oOne = R::Set( 1.0 );
+    const Register oTwo = R::Set( 2.0 );
+    const Register oHalf = R::Set( 0.5 );
+    Register oN = Round< R >( R::Multiply( ac_roRadians,
+                                           R::Set( TWO_OVER_PI ) ) );
+    Register oR = R::Subtract(
+        R::Subtract( ac_roRadians, R::Multiply( oN, R::Set( PIO2_HIGH ) ) ),
+        R::Multiply( oN, R::Set( PIO2_LOW ) ) );
+    Register oZ = R::Multiply( oR, oR );
+    Register oSinSum = R::Set( SIN_COEFFICIENTS[ SIN_TERMS - 1 ] );
+    Register oCosSum = R::Set( COS_COEFFICIENTS[ SIN_TERMS - 1 ] );
+    for( int i = (int)SIN_TERMS - 2; i >= 0; --i )
+    {
+        oSinSum = R::Add( R::Set( SIN_COEFFICIENTS[i] ),
+                          R::Multiply( oZ, oSinSum ) );
+        oCosSum = R::Add( R::Set( COS_COEFFICIENTS[i] ),
+                          R::Multiply( oZ, oCosSum ) );
+    }
+    Register oSin = R::Add( oR, R::Multiply( R::Multiply( oR, oZ ),
+                                             oSinSum ) );
+    Register oCos = R::Add( R::Subtract( oOne, R::Multiply( oHalf, oZ ) ),
+                            R::Multiply( R::Multiply( oZ, oZ ), oCosSum ) );
+
+    // Quadrant - odd quadrants swap sine and cosine, and each function is
+    // negated in two of the four
+    Register oQuadrant = R::Subtract(
+        oN, R::Multiply( R::Set( 4.0 ),
+                         Round< R >( R::Subtract( R::Multiply( oN,
+                                                               R::Set( 0.25 ) ),
+                                                  R::Set( 0.375 ) ) ) ) );
+    Register oOdd = R::Subtract(
+        oQuadrant, R::Multiply( oTwo, Round< R >( R::Subtract(
+            R::Multiply( oQuadrant, oHalf ), R::Set( 0.25 ) ) ) ) );
+    Register oSinNegative = R::Multiply( R::Subtract( oQuadrant, oOdd ),
+                                         oHalf );
+    Register oCosNegative = R::Subtract(
+        R::Add( oOdd, oSinNegative ),
+        R::Multiply( oTwo, R::Multiply( oOdd, oSinNegative ) ) );
+    a_roSin = R::Multiply(
+        R::Subtract( oOne, R::Multiply( oTwo, oSinNegative ) ),
+        R::Add( oSin, R::Multiply( oOdd, R::Subtract( oCos, oSin ) ) ) );
+    a_roCos = R::Multiply(
+        R::Subtract( oOne, R::Multiply( oTwo, oCosNegative ) ),
+        R::Add( oCos, R::Multiply( oOdd, R::Subtract( oSin, oCos ) ) ) );
+}
+
+// Reduce to the arctangent of min(|x|,|y|)/max(|x|,|y|) in [0,1], shift ratios
+// above 0.66 down by PI/4, then reflect back into the right octant.  The sign
+// bit of x decides the left half, so -0 behaves as it does for std::atan2.
+template< typename R >
+inline typename R::Type Atan2Kernel( const typename R::Type& ac_roY,
+                                     const typename R::Type& ac_roX )
+{
+    typedef typename R::Type Register;
+    const Register oOne = R::Set( 1.0 );
+    const Register oZero = R::Set( 0.0 );
+    Register oAbsY = R::Abs( ac_roY );
+    Register oAbsX = R::Abs( ac_roX );
+    Register oMax = R::Max( oAbsY, oAbsX );
+    Register oRatio =
+        R::Divide( R::Min( oAbsY, oAbsX ),
+                   R::Select( R::Greater( oMax, oZero ), oMax, oOne ) );
+    typename R::Mask oReduce =
+        R::Greater( oRatio, R::Set( ATAN_REDUCTION_THRESHOLD ) );
+    Register oT = R::Select( oReduce,
+                             R::Divide( R::Subtract( oRatio, oOne ),
+                                        R::Add( oRatio, oOne ) ),
+                             oRatio );
+    Register oZ = R::Multiply( oT, oT );
+    Register oNumerator = R::Set( ATAN_NUMERATOR[0] );
+    Register oDenominator = R::Add( oZ, R::Set( ATAN_DENOMINATOR[0] ) );
+    for( unsigned int i = 1; i < ATAN_TERMS; ++i )
+    {
+        oNumerator = R::Add( R::Multiply( oNumerator, oZ ),
+                             R::Set( ATAN_NUMERATOR[i] ) );
+        oDenominator = R::Add( R::Multiply( oDenominator, oZ ),
+                               R::Set( ATAN_DENOMINATOR[i] ) );
+    }
+    Register oAngle =
+        R::Add( oT, R::Divide( R::Multiply( R::Multiply( oT, oZ ),
+                                            oNumerator ),
+                               oDenominator ) );
+    oAngle = R::Add( oAngle, R::Select( oReduce, R::Set( (double)PI / 4 ),
+                                        oZero ) );
+    oAngle = R::Select( R::Greater( oAbsY, oAbsX ),
+                        R::Subtract( R::Set( (double)HALF_PI ), oAngle ),
+                        oAngle );
+    oAngle = R::Select( R::Greater( oZero, R::FlipSign( oOne, ac_roX ) ),
+                        R::Subtract( R::Set( (double)PI ), oAngle ),
+                        oAngle );
+    return R::FlipSign( oAngle, ac_roY );
+}
+
+// acos(x) = atan2( sqrt(1 - x^2), x ), with 1 - x^2 factored to keep precision
+// near +/-1
+template< typename R >
+inline typename R::Type AcosKernel( const typename R::Type& ac_roX )
+{
+    const typename R::Type oOne = R::Set( 1.0 );
+    return Atan2Kernel< R >( R::Sqrt( R::Multiply( R::Subtract( oOne, ac_roX ),
+                                                   R::Add( oOne, ac_roX ) ) ),
+                             ac_roX );
+}
+
+// Refine the bit-pattern estimate with y = y * ( 1.5 - x/2 * y * y )
+template< typename R >
+inline typename R::Type RsqrtKernel( const typename R::Type& ac_roX )
+{
+    typedef typename R::Type Register;
+    const Register oThreeHalves = R::Set( 1.5 );
+    Register oHalfX = R::Multiply( R::Set( 0.5 ), ac_roX );
+    Register oY = R::RsqrtEstimate( ac_roX );
+    for( unsigned int i = 0; i < RSQRT_STEPS; ++i )
+    {
+        oY = R::Multiply( oY, R::Subtract( oThreeHalves, R::Multiply(
+                                  R::Multiply( oHalfX, oY ), oY ) ) );
+    }
+    return oY;
+}
+
+// e^x = 2^N * e^r, where N = round(x/ln(2)) and r = x - N*ln(2)
+template< typename R >
+inline typename R::Type ExpKernel( const typename R::Type& ac_roX )
+{
+    typedef typename R::Type Register;
+    Register oX = R::Min( R::Max( ac_roX, R::Set( EXP_MINIMUM ) ),
+                          R::Set( EXP_MAXIMUM ) );
+    Register oRounded = R::Add( R::Multiply( oX, R::Set( LOG2_E ) ),
+                                R::Set( ROUNDING_CONSTANT ) );
+    Register oN = R::Subtract( oRounded, R::Set( ROUNDING_CONSTANT ) );
+    Register oR = R::Subtract(
+        R::Subtract( oX, R::Multiply( oN, R::Set( LN2_HIGH ) ) ),
+        R::Multiply( oN, R::Set( LN2_LOW ) ) );
+    Register oSum = R::Set( EXP_COEFFICIENTS[ EXP_TERMS - 1 ] );
+    for( int i = (int)EXP_TERMS - 2; i >= 0; --i )
+    {
+        oSum = R::Add( R::Multiply( oSum, oR ),
+                       R::Set( EXP_COEFFICIENTS[i] ) );
+    }
+    return R::Multiply( oSum, R::PowerOfTwo( oRounded ) );
+}
+
+//
+// One value at a time
+//
+
+inline double Sin( double a_dRadians )
+{
+    double dSin, dCos;
+    SinCosKernel< ScalarDoubleRegister >( a_dRadians, dSin, dCos );
+    return dSin;
+}
+inline double Cos( double a_dRadians )
+{
+    double dSin, dCos;
+    SinCosKernel< ScalarDoubleRegister >( a_dRadians, dSin, dCos );
+    return dCos;
+}
+inline void SinCos( double a_dRadians, double& a_rdSin, double& a_rdCos )
+{
+    SinCosKernel< ScalarDoubleRegister >( a_dRadians, a_rdSin, a_rdCos );
+}
+inline double Atan2( double a_dY, double a_dX )
+{
+    return Atan2Kernel< ScalarDoubleRegister >( a_dY, a_dX );
+}
+inline double Acos( double a_dX )
+{
+    return AcosKernel< ScalarDoubleRegister >( a_dX );
+}
+inline double Rsqrt( double a_dX )
+{
+    return RsqrtKernel< ScalarDoubleRegister >( a_dX );
+}
+inline double Exp( double a_dX )
+{
+    return ExpKernel< ScalarDoubleRegister >( a_dX );
+}
+
+}   // namespace Fast
+
+}   // namespace Math
+
+#endif  // FAST_FUNCTIONS__TEMPLATES__INL
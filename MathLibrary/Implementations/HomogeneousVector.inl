@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       January 5, 2014
  * Description:        Inline function implementations for HomogeneousVector.
- * Last Modified:      February 10, 2014
- * Last Modification:  Templatizing PointVector.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Removed coordinate reference members.
  ******************************************************************************/
 
 #ifndef HOMOGENEOUS_VECTOR__INL
@@ -17,33 +17,19 @@
 namespace Plane
 {
 
-// destructor
-INLINE HomogeneousVector::~HomogeneousVector() {}
-
 // Constructors that forward to base class constructors
 INLINE HomogeneousVector::HomogeneousVector()
-    : BaseType(),
-      x( m_aaData[0][0] ), y( m_aaData[0][1] ), h( m_aaData[0][2] )
+    : BaseType()
 {
-    h = 1.0;
+    h() = 1.0;
 }
-INLINE HomogeneousVector::
-    HomogeneousVector( const HomogeneousVector& ac_roVector )
-    : BaseType( ac_roVector ),
-      x( m_aaData[0][0] ), y( m_aaData[0][1] ), h( m_aaData[0][2] ) {}
-INLINE HomogeneousVector::HomogeneousVector( HomogeneousVector&& a_rroVector )
-    : BaseType( std::forward< HomogeneousVector >( a_rroVector ) ),
-      x( m_aaData[0][0] ), y( m_aaData[0][1] ), h( m_aaData[0][2] ) {}
 INLINE HomogeneousVector::
     HomogeneousVector( const RootType& ac_roMatrix )
-    : BaseType( ac_roMatrix ),
-      x( m_aaData[0][0] ), y( m_aaData[0][1] ), h( m_aaData[0][2] ) {}
+    : BaseType( ac_roMatrix ) {}
 INLINE HomogeneousVector::HomogeneousVector( double a_dFill )
-    : BaseType( a_dFill ),
-      x( m_aaData[0][0] ), y( m_aaData[0][1] ), h( m_aaData[0][2] ) {}
+    : BaseType( a_dFill ) {}
 INLINE HomogeneousVector::HomogeneousVector( const double (&ac_radData)[ 3 ] )
-    : BaseType( ac_radData ),
-      x( m_aaData[0][0] ), y( m_aaData[0][1] ), h( m_aaData[0][2] ) {}
+    : BaseType( ac_radData ) {}
 
 // Assignment operators that pass to base class
 INLINE HomogeneousVector& HomogeneousVector::operator=( const double& ac_rFill )
@@ -60,35 +46,32 @@ INLINE HomogeneousVector& HomogeneousVector::operator=( const double (&ac_raData
 // Construct from the given coordinates
 INLINE HomogeneousVector::
     HomogeneousVector( double a_dX, double a_dY, double a_dH )
-    : BaseType(),
-      x( m_aaData[0][0] ), y( m_aaData[0][1] ), h( m_aaData[0][2] )
+    : BaseType()
 {
-    x = a_dX;
-    y = a_dY;
-    h = a_dH;
+    x() = a_dX;
+    y() = a_dY;
+    h() = a_dH;
 }
 
 // Construct from a 2D point
 INLINE HomogeneousVector::
     HomogeneousVector( const PointType& ac_roPoint, double a_dH )
-    : BaseType( ac_roPoint ),
-      x( m_aaData[0][0] ), y( m_aaData[0][1] ), h( m_aaData[0][2] )
+    : BaseType( ac_roPoint )
 {
-    h = a_dH;
+    h() = a_dH;
 }
 INLINE HomogeneousVector&
     HomogeneousVector::operator=( const PointType& ac_roPoint )
 {
-    x = ac_roPoint.x * h;
-    y = ac_roPoint.y * h;
+    x() = ac_roPoint.x() * h();
+    y() = ac_roPoint.y() * h();
     return *this;
 }
 
 // Construct from a 3D homogeneous vector
 INLINE HomogeneousVector::
     HomogeneousVector( const Space::HomogeneousVector& ac_roVector )
-    : BaseType( Space::Point( ac_roVector ) ),
-      x( m_aaData[0][0] ), y( m_aaData[0][1] ), h( m_aaData[0][2] ) {}
+    : BaseType( Space::Point( ac_roVector ) ) {}
 INLINE HomogeneousVector&
     HomogeneousVector::operator=( const Space::HomogeneousVector& ac_roVector )
 {
@@ -128,9 +111,9 @@ INLINE HomogeneousVector HomogeneousVector::Normal() const
 // Adjust values so that h = 1 or 0
 INLINE HomogeneousVector& HomogeneousVector::Homogenize()
 {
-    if( h != 0.0 )
+    if( h() != 0.0 )
     {
-        operator/=( h );
+        operator/=( h() );
     }
     return *this;
 }
@@ -163,51 +146,19 @@ INLINE const HomogeneousVector& HomogeneousVector::Origin()
 namespace Space
 {
 
-// destructor
-INLINE HomogeneousVector::~HomogeneousVector() {}
-
 // Constructors that forward to base class constructors
 INLINE HomogeneousVector::HomogeneousVector()
-    : BaseType(),
-      x( m_aaData[0][0] ),
-      y( m_aaData[0][1] ),
-      z( m_aaData[0][2] ),
-      h( m_aaData[0][3] )
+    : BaseType()
 {
-    h = 1.0;
+    h() = 1.0;
 }
-INLINE HomogeneousVector::
-    HomogeneousVector( const HomogeneousVector& ac_roVector )
-    : BaseType( ac_roVector ),
-      x( m_aaData[0][0] ),
-      y( m_aaData[0][1] ),
-      z( m_aaData[0][2] ),
-      h( m_aaData[0][3] ) {}
-INLINE HomogeneousVector::HomogeneousVector( HomogeneousVector&& a_rroVector )
-    : BaseType( std::forward< HomogeneousVector >( a_rroVector ) ),
-      x( m_aaData[0][0] ),
-      y( m_aaData[0][1] ),
-      z( m_aaData[0][2] ),
-      h( m_aaData[0][3] ) {}
 INLINE HomogeneousVector::
     HomogeneousVector( const RootType& ac_roMatrix )
-    : BaseType( ac_roMatrix ),
-      x( m_aaData[0][0] ),
-      y( m_aaData[0][1] ),
-      z( m_aaData[0][2] ),
-      h( m_aaData[0][3] ) {}
+    : BaseType( ac_roMatrix ) {}
 INLINE HomogeneousVector::HomogeneousVector( double a_dFill )
-    : BaseType( a_dFill ),
-      x( m_aaData[0][0] ),
-      y( m_aaData[0][1] ),
-      z( m_aaData[0][2] ),
-      h( m_aaData[0][3] ) {}
+    : BaseType( a_dFill ) {}
 INLINE HomogeneousVector::HomogeneousVector( const double (&ac_radData)[ 4 ] )
-    : BaseType( ac_radData ),
-      x( m_aaData[0][0] ),
-      y( m_aaData[0][1] ),
-      z( m_aaData[0][2] ),
-      h( m_aaData[0][3] ) {}
+    : BaseType( ac_radData ) {}
 
 // Assignment operators that pass to base class
 INLINE HomogeneousVector& HomogeneousVector::operator=( const double& ac_rFill )
@@ -224,35 +175,27 @@ INLINE HomogeneousVector& HomogeneousVector::operator=( const double (&ac_raData
 // Construct from the given coordinates
 INLINE HomogeneousVector::
     HomogeneousVector( double a_dX, double a_dY, double a_dZ, double a_dH )
-    : BaseType(),
-      x( m_aaData[0][0] ),
-      y( m_aaData[0][1] ),
-      z( m_aaData[0][2] ),
-      h( m_aaData[0][3] )
+    : BaseType()
 {
-    x = a_dX;
-    y = a_dY;
-    z = a_dZ;
-    h = a_dH;
+    x() = a_dX;
+    y() = a_dY;
+    z() = a_dZ;
+    h() = a_dH;
 }
 
 // Construct from a 3D point
 INLINE HomogeneousVector::
     HomogeneousVector( const PointType& ac_roPoint, double a_dH )
-    : BaseType( ac_roPoint ),
-      x( m_aaData[0][0] ),
-      y( m_aaData[0][1] ),
-      z( m_aaData[0][2] ),
-      h( m_aaData[0][3] )
+    : BaseType( ac_roPoint )
 {
-    h = a_dH;
+    h() = a_dH;
     operator=( ac_roPoint );
 }
 INLINE HomogeneousVector& HomogeneousVector::operator=( const PointType& ac_roPoint )
 {
-    x = ac_roPoint.x * h;
-    y = ac_roPoint.y * h;
-    z = ac_roPoint.z * h;
+    x() = ac_roPoint.x() * h();
+    y() = ac_roPoint.y() * h();
+    z() = ac_roPoint.z() * h();
     return *this;
 }
 
@@ -290,9 +233,9 @@ INLINE HomogeneousVector HomogeneousVector::Normal() const
 // Adjust values so that h = 1 or 0
 INLINE HomogeneousVector& HomogeneousVector::Homogenize()
 {
-    if( h != 0.0 )
+    if( h() != 0.0 )
     {
-        operator/=( h );
+        operator/=( h() );
     }
     return *this;
 }
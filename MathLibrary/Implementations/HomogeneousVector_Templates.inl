@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       January 5, 2014
  * Description:        Template function implementations for HomogeneousVector.
- * Last Modified:      February 10, 2014
- * Last Modification:  Templatizing PointVector.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Removed coordinate reference members.
  ******************************************************************************/
 
 #ifndef HOMOGENEOUS_VECTOR__TEMPLATES__INL
@@ -20,24 +20,22 @@ template< typename U, unsigned int Q, bool t_bOtherIsRow >
 inline HomogeneousVector::
     HomogeneousVector( const Vector< U, Q, t_bOtherIsRow >& ac_roVector,
                        double a_dFill )
-    : BaseType( ac_roVector, a_dFill ),
-      x( m_aaData[0][0] ), y( m_aaData[0][1] ), h( m_aaData[0][2] )
+    : BaseType( ac_roVector, a_dFill )
 {
     if( Q < 3 )
     {
-        h = 1.0;
+        h() = 1.0;
     }
 }
 template< typename U, unsigned int P, unsigned int Q >
 inline HomogeneousVector::
     HomogeneousVector( const Matrix< U, P, Q >& ac_roMatrix,
                        double a_dFill )
-    : BaseType( ac_roMatrix, a_dFill ),
-      x( m_aaData[0][0] ), y( m_aaData[0][1] ), h( m_aaData[0][2] )
+    : BaseType( ac_roMatrix, a_dFill )
 {
     if( Q < 3 )
     {
-        h = 1.0;
+        h() = 1.0;
     }
 }
 
@@ -101,30 +99,22 @@ template< typename U, unsigned int Q, bool t_bOtherIsRow >
 inline HomogeneousVector::
     HomogeneousVector( const Vector< U, Q, t_bOtherIsRow >& ac_roVector,
                        double a_dFill )
-    : BaseType( ac_roVector, a_dFill ),
-      x( m_aaData[0][0] ),
-      y( m_aaData[0][1] ),
-      z( m_aaData[0][2] ),
-      h( m_aaData[0][3] )
+    : BaseType( ac_roVector, a_dFill )
 {
     if( Q < 4 )
     {
-        h = 1.0;
+        h() = 1.0;
     }
 }
 template< typename U, unsigned int P, unsigned int Q >
 inline HomogeneousVector::
     HomogeneousVector( const Matrix< U, P, Q >& ac_roMatrix,
                        double a_dFill )
-    : BaseType( ac_roMatrix, a_dFill ),
-      x( m_aaData[0][0] ),
-      y( m_aaData[0][1] ),
-      z( m_aaData[0][2] ),
-      h( m_aaData[0][3] )
+    : BaseType( ac_roMatrix, a_dFill )
 {
     if( Q < 4 )
     {
-        h = 1.0;
+        h() = 1.0;
     }
 }
 
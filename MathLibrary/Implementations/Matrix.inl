@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       November 18, 2013
  * Description:        Function implementations for Matrix template class.
- * Last Modified:      February 12, 2014
- * Last Modification:  Refactoring.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Fixed pointer-array AssignTo.
  ******************************************************************************/
 
 #ifndef MATRIX__INL
@@ -55,10 +55,7 @@ inline typename ArrayReference< U, P >::type
     {
         throw exception("Non-convertable input type");
     }  /**/
-    for( unsigned int i = 0; i < M*N && i < P; ++i )
-    {
-        a_raData[i] = a_bTranspose ? m_aaData[i%N][i/N] : m_aaData[i/N][i%N];
-    }
+    AssignTo( &( a_raData[0] ), P, a_bTranspose );
     return a_raData;
 }
 template< typename T, unsigned int M, unsigned int N >
@@ -98,9 +95,22 @@ U* Matrix< T, M, N >::AssignTo( U* const a_cpData,
     {
         throw exception("Non-convertable input type");
     }  /**/
-    for( unsigned int i = 0; i < M*N && i < a_uiSize; ++i )
+    const T* cpData = Data();
+    if( !a_bTranspose )
     {
-        a_raData[i] = a_bTranspose ? m_aaData[i%N][i/N] : m_aaData[i/N][i%N];
+        for( unsigned int i = 0; i < M*N && i < a_uiSize; ++i )
+        {
+            a_cpData[i] = cpData[i];
+        }
+        return a_cpData;
+    }
+    unsigned int uiIndex = 0;
+    for( unsigned int j = 0; j < N; ++j )
+    {
+        for( unsigned int i = 0; i < M && uiIndex < a_uiSize; ++i, ++uiIndex )
+        {
+            a_cpData[ uiIndex ] = m_aaData[i][j];
+        }
     }
     return a_cpData;
 }
@@ -125,10 +135,10 @@ U** Matrix< T, M, N >::AssignTo( U* const* const a_cpcpData,
              j < ( a_bTranspose ? M : N ) && j < a_uiColumns;
              ++j )
         {
-            a_raaData[i][j] = a_bTranspose ? m_aaData[j][i] : m_aaData[i][j];
+            a_cpcpData[i][j] = a_bTranspose ? m_aaData[j][i] : m_aaData[i][j];
         }
     }
-    return a_cpcpData;
+    return const_cast< U** >( a_cpcpData );
 }
 
 // Element access
@@ -153,6 +163,18 @@ inline const T& Matrix< T, M, N >::
     return m_aaData[a_uiRow][a_uiColumn];
 }
 
+// Flat element access
+template< typename T, unsigned int M, unsigned int N >
+inline T* Matrix< T, M, N >::Data()
+{
+    return &( m_aaData[0][0] );
+}
+template< typename T, unsigned int M, unsigned int N >
+inline const T* Matrix< T, M, N >::Data() const
+{
+    return &( m_aaData[0][0] );
+}
+
 // Get row/column vectors
 template< typename T, unsigned int M, unsigned int N >
 inline typename Matrix< T, M, N >::ColumnVectorType
@@ -261,9 +283,10 @@ inline Matrix< T, M, N >& Matrix< T, M, N >::Shift( int a_iRight, int a_iDown )
 template< typename T, unsigned int M, unsigned int N >
 inline Matrix< T, M, N >& Matrix< T, M, N >::Round()
 {
+    T* pData = Data();
     for( unsigned int i = 0; i < M*N; ++i )
     {
-        m_aaData[i/N][i%N] = Math::Round( m_aaData[i/N][i%N] );
+        pData[i] = Math::Round( pData[i] );
     }
     return *this;
 }
@@ -274,10 +297,7 @@ inline typename Matrix< T, M, N >::TransposeType
     Matrix< T, M, N >::Transpose() const
 {
     TransposeType oTranspose;
-    for(unsigned int i = 0; i < M*N; ++i )
-    {
-        oTranspose[i%N][i/N] = m_aaData[i/N][i%N];
-    }
+    ElementKernels< T >::Transpose( Data(), M, N, oTranspose.Data() );
     return oTranspose;
 }
 template< typename T, unsigned int M, unsigned int N >
@@ -285,9 +305,12 @@ inline typename Matrix< T, M, N >::TransposeType
     Matrix< T, M, N >::ConjugateTranspose() const
 {
     TransposeType oTranspose;
-    for(unsigned int i = 0; i < M*N; ++i )
+    for( unsigned int i = 0; i < M; ++i )
     {
-        oTranspose[i%N][i/N] = ComplexConjugate( m_aaData[i/N][i%N] );
+        for( unsigned int j = 0; j < N; ++j )
+        {
+            oTranspose.m_aaData[j][i] = ComplexConjugate( m_aaData[i][j] );
+        }
     }
     return oTranspose;
 }
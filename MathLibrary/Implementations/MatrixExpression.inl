@@ -0,0 +1,294 @@
+/******************************************************************************
+ * File:               MatrixExpression.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Template implementations for element-wise expressions.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef MATRIX_EXPRESSION__INL
+#define MATRIX_EXPRESSION__INL
+
+#include "../Declarations/MatrixExpression.h"
+#include <stdexcept>    // for invalid_argument
+
+namespace Math
+{
+
+//
+// Element nodes
+//
+
+template< typename T >
+inline ElementArray< T >::ElementArray( const T* ac_cpData )
+    : m_cpData( ac_cpData ) {}
+template< typename T >
+inline T ElementArray< T >::operator[]( unsigned int a_uiIndex ) const
+{
+    return m_cpData[ a_uiIndex ];
+}
+
+template< typename T, typename L, typename R >
+inline ElementSum< T, L, R >::ElementSum( const L& ac_roLeft,
+                                          const R& ac_roRight )
+    : m_oLeft( ac_roLeft ), m_oRight( ac_roRight ) {}
+template< typename T, typename L, typename R >
+inline T ElementSum< T, L, R >::operator[]( unsigned int a_uiIndex ) const
+{
+    return T( m_oLeft[ a_uiIndex ] + m_oRight[ a_uiIndex ] );
+}
+
+template< typename T, typename L, typename R >
+inline ElementDifference< T, L, R >::ElementDifference( const L& ac_roLeft,
+                                                        const R& ac_roRight )
+    : m_oLeft( ac_roLeft ), m_oRight( ac_roRight ) {}
+template< typename T, typename L, typename R >
+inline T ElementDifference< T, L, R >::
+    operator[]( unsigned int a_uiIndex ) const
+{
+    return T( m_oLeft[ a_uiIndex ] - m_oRight[ a_uiIndex ] );
+}
+
+template< typename T, typename E, typename U >
+inline ElementProduct< T, E, U >::ElementProduct( const E& ac_roElements,
+                                                  const U& ac_rScalar )
+    : m_oElements( ac_roElements ), m_uScalar( ac_rScalar ) {}
+template< typename T, typename E, typename U >
+inline T ElementProduct< T, E, U >::operator[]( unsigned int a_uiIndex ) const
+{
+    return T( m_oElements[ a_uiIndex ] * m_uScalar );
+}
+
+template< typename T, typename E, typename U >
+inline ElementQuotient< T, E, U >::ElementQuotient( const E& ac_roElements,
+                                                    const U& ac_rScalar )
+    : m_oElements( ac_roElements ), m_uScalar( ac_rScalar ) {}
+template< typename T, typename E, typename U >
+inline T ElementQuotient< T, E, U >::operator[]( unsigned int a_uiIndex ) const
+{
+    return T( m_oElements[ a_uiIndex ] / m_uScalar );
+}
+
+template< typename T, typename E, typename U >
+inline ElementModulo< T, E, U >::ElementModulo( const E& ac_roElements,
+                                                const U& ac_rScalar )
+    : m_oElements( ac_roElements ), m_uScalar( ac_rScalar ) {}
+template< typename T, typename E, typename U >
+inline T ElementModulo< T, E, U >::operator[]( unsigned int a_uiIndex ) const
+{
+    T tElement = m_oElements[ a_uiIndex ];
+    ModuloAssign( tElement, m_uScalar );
+    return tElement;
+}
+
+template< typename T, typename E >
+inline ElementNegation< T, E >::ElementNegation( const E& ac_roElements )
+    : m_oElements( ac_roElements ) {}
+template< typename T, typename E >
+inline T ElementNegation< T, E >::operator[]( unsigned int a_uiIndex ) const
+{
+    return T( m_oElements[ a_uiIndex ] * -1 );
+}
+
+template< typename T, typename L, typename R >
+inline ElementInterpolation< T, L, R >::
+    ElementInterpolation( const L& ac_roPointA, const R& ac_roPointB,
+                          float a_fProgress )
+    : m_oPointA( ac_roPointA ), m_oPointB( ac_roPointB ),
+      m_fProgress( a_fProgress ) {}
+template< typename T, typename L, typename R >
+inline T ElementInterpolation< T, L, R >::
+    operator[]( unsigned int a_uiIndex ) const
+{
+    // same conversions as evaluating A + progress * ( B - A ) one matrix
+    // operation at a time
+    T tA = m_oPointA[ a_uiIndex ];
+    T tDifference = T( m_oPointB[ a_uiIndex ] - tA );
+    return T( tA + T( tDifference * m_fProgress ) );
+}
+
+//
+// Matrix expression
+//
+
+template< typename E, typename T, unsigned int M, unsigned int N >
+inline MatrixExpression< E, T, M, N >::
+    MatrixExpression( const E& ac_roElements )
+    : m_oElements( ac_roElements ) {}
+
+// Compute a single element
+template< typename E, typename T, unsigned int M, unsigned int N >
+inline T MatrixExpression< E, T, M, N >::
+    operator[]( unsigned int a_uiIndex ) const
+{
+    return m_oElements[ a_uiIndex ];
+}
+
+// Evaluate
+template< typename E, typename T, unsigned int M, unsigned int N >
+inline MatrixExpression< E, T, M, N >::operator Matrix< T, M, N >() const
+{
+    return Evaluate();
+}
+template< typename E, typename T, unsigned int M, unsigned int N >
+inline Matrix< T, M, N > MatrixExpression< E, T, M, N >::Evaluate() const
+{
+    MatrixType oResult;
+    AssignTo( oResult );
+    return oResult;
+}
+template< typename E, typename T, unsigned int M, unsigned int N >
+inline Matrix< T, M, N >& MatrixExpression< E, T, M, N >::
+    AssignTo( MatrixType& a_roMatrix ) const
+{
+    T* pData = &( a_roMatrix[0][0] );
+    for( unsigned int i = 0; i < M*N; ++i )
+    {
+        pData[i] = m_oElements[i];
+    }
+    return a_roMatrix;
+}
+
+// Reinterpret dimensions
+template< typename E, typename T, unsigned int M, unsigned int N >
+template< unsigned int P, unsigned int Q >
+inline MatrixExpression< E, T, P, Q >
+    MatrixExpression< E, T, M, N >::Reshaped() const
+{
+    static_assert( P*Q == M*N, "Reshaped expression must have the same number "
+                               "of elements" );
+    return MatrixExpression< E, T, P, Q >( m_oElements );
+}
+
+// Addition and subtraction
+template< typename E, typename T, unsigned int M, unsigned int N >
+template< typename F >
+inline MatrixExpression< ElementSum< T, E, F >, T, M, N >
+    MatrixExpression< E, T, M, N >::
+    operator+( const MatrixExpression< F, T, M, N >& ac_roOther ) const
+{
+    return MatrixExpression< ElementSum< T, E, F >, T, M, N >(
+        ElementSum< T, E, F >( m_oElements, ac_roOther.m_oElements ) );
+}
+template< typename E, typename T, unsigned int M, unsigned int N >
+inline MatrixExpression< ElementSum< T, E, ElementArray< T > >, T, M, N >
+    MatrixExpression< E, T, M, N >::
+    operator+( const MatrixType& ac_roMatrix ) const
+{
+    return operator+( Lazy( ac_roMatrix ) );
+}
+template< typename E, typename T, unsigned int M, unsigned int N >
+template< typename F >
+inline MatrixExpression< ElementDifference< T, E, F >, T, M, N >
+    MatrixExpression< E, T, M, N >::
+    operator-( const MatrixExpression< F, T, M, N >& ac_roOther ) const
+{
+    return MatrixExpression< ElementDifference< T, E, F >, T, M, N >(
+        ElementDifference< T, E, F >( m_oElements, ac_roOther.m_oElements ) );
+}
+template< typename E, typename T, unsigned int M, unsigned int N >
+inline MatrixExpression< ElementDifference< T, E, ElementArray< T > >, T, M, N >
+    MatrixExpression< E, T, M, N >::
+    operator-( const MatrixType& ac_roMatrix ) const
+{
+    return operator-( Lazy( ac_roMatrix ) );
+}
+
+// Scalar math
+template< typename E, typename T, unsigned int M, unsigned int N >
+inline MatrixExpression< ElementNegation< T, E >, T, M, N >
+    MatrixExpression< E, T, M, N >::operator-() const
+{
+    return MatrixExpression< ElementNegation< T, E >, T, M, N >(
+        ElementNegation< T, E >( m_oElements ) );
+}
+template< typename E, typename T, unsigned int M, unsigned int N >
+template< typename U >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                MatrixExpression< ElementProduct< T, E, U >,
+                                                  T, M, N > >::type
+    MatrixExpression< E, T, M, N >::operator*( const U& ac_rScalar ) const
+{
+    return MatrixExpression< ElementProduct< T, E, U >, T, M, N >(
+        ElementProduct< T, E, U >( m_oElements, ac_rScalar ) );
+}
+template< typename E, typename T, unsigned int M, unsigned int N >
+template< typename U >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                MatrixExpression< ElementQuotient< T, E, U >,
+                                                  T, M, N > >::type
+    MatrixExpression< E, T, M, N >::operator/( const U& ac_rScalar ) const
+{
+    if( ac_rScalar == 0 )
+    {
+        throw std::invalid_argument( "Cannot divide by zero" );
+    }
+    return MatrixExpression< ElementQuotient< T, E, U >, T, M, N >(
+        ElementQuotient< T, E, U >( m_oElements, ac_rScalar ) );
+}
+template< typename E, typename T, unsigned int M, unsigned int N >
+template< typename U >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                MatrixExpression< ElementModulo< T, E, U >,
+                                                  T, M, N > >::type
+    MatrixExpression< E, T, M, N >::operator%( const U& ac_rScalar ) const
+{
+    if( ac_rScalar == 0 )
+    {
+        throw std::invalid_argument( "Cannot modulo by zero" );
+    }
+    return MatrixExpression< ElementModulo< T, E, U >, T, M, N >(
+        ElementModulo< T, E, U >( m_oElements, ac_rScalar ) );
+}
+
+//
+// Free functions
+//
+
+// Start an expression from an existing matrix
+template< typename T, unsigned int M, unsigned int N >
+inline MatrixExpression< ElementArray< T >, T, M, N >
+    Lazy( const Matrix< T, M, N >& ac_roMatrix )
+{
+    return MatrixExpression< ElementArray< T >, T, M, N >(
+        ElementArray< T >( &( ac_roMatrix[0][0] ) ) );
+}
+
+// Linear interpolation
+template< typename T, unsigned int M, unsigned int N >
+inline MatrixExpression< ElementInterpolation< T, ElementArray< T >,
+                                               ElementArray< T > >, T, M, N >
+    Interpolation( const Matrix< T, M, N >& ac_roPointA,
+                   const Matrix< T, M, N >& ac_roPointB,
+                   float a_fProgress )
+{
+    typedef ElementInterpolation< T, ElementArray< T >, ElementArray< T > >
+        NodeType;
+    return MatrixExpression< NodeType, T, M, N >(
+        NodeType( ElementArray< T >( &( ac_roPointA[0][0] ) ),
+                  ElementArray< T >( &( ac_roPointB[0][0] ) ),
+                  a_fProgress ) );
+}
+template< typename T, unsigned int M, unsigned int N >
+inline Matrix< T, M, N > Interpolate( const Matrix< T, M, N >& ac_roPointA,
+                                      const Matrix< T, M, N >& ac_roPointB,
+                                      float a_fProgress )
+{
+    return Interpolation( ac_roPointA, ac_roPointB, a_fProgress ).Evaluate();
+}
+
+}   // namespace Math
+
+// Expression scalar multiplication in the other direction
+template< typename U, typename E, typename T, unsigned int M, unsigned int N >
+inline typename std::enable_if<
+    std::is_scalar< U >::value,
+    Math::MatrixExpression< Math::ElementProduct< T, E, U >, T, M, N > >::type
+    operator*( const U& ac_rScalar,
+               const Math::MatrixExpression< E, T, M, N >& ac_roExpression )
+{
+    return ac_roExpression.operator*( ac_rScalar );
+}
+
+#endif  // MATRIX_EXPRESSION__INL
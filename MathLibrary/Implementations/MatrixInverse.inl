@@ -0,0 +1,268 @@
+/******************************************************************************
+ * File:               MatrixInverse.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Template implementations for determinant and inverse
+ *                      kernels.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Renamed locals.
+ ******************************************************************************/
+
+#ifndef MATRIX_INVERSE__INL
+#define MATRIX_INVERSE__INL
+
+#include "../Declarations/MatrixInverse.h"
+#include "../Declarations/Decomposition.h"
+#include "../Declarations/Functions.h"
+
+namespace Math
+{
+
+// Non-square matrices
+template< typename T, unsigned int M, unsigned int N >
+inline T MatrixInverse< T, M, N >::
+    Determinant( const T (&ac_raaMatrix)[ M ][ N ] )
+{
+    return 0;
+}
+template< typename T, unsigned int M, unsigned int N >
+inline bool MatrixInverse< T, M, N >::
+    Invert( const T (&ac_raaMatrix)[ M ][ N ],
+            InverseT (&a_raaInverse)[ N ][ M ] )
+{
+    return false;
+}
+
+// LU decomposition with partial pivoting
+template< typename T, unsigned int N >
+inline T MatrixInverse< T, N, N >::
+    Determinant( const T (&ac_raaMatrix)[ N ][ N ] )
+{
+    return LU< T, N >( ac_raaMatrix ).Determinant();
+}
+template< typename T, unsigned int N >
+inline bool MatrixInverse< T, N, N >::
+    Invert( const T (&ac_raaMatrix)[ N ][ N ],
+            InverseT (&a_raaInverse)[ N ][ N ] )
+{
+    return LU< T, N >( ac_raaMatrix ).Inverse( a_raaInverse );
+}
+
+// 1x1
+template< typename T >
+inline T MatrixInverse< T, 1, 1 >::
+    Determinant( const T (&ac_raaMatrix)[ 1 ][ 1 ] )
+{
+    return ac_raaMatrix[0][0];
+}
+template< typename T >
+inline bool MatrixInverse< T, 1, 1 >::
+    Invert( const T (&ac_raaMatrix)[ 1 ][ 1 ],
+            InverseT (&a_raaInverse)[ 1 ][ 1 ] )
+{
+    if( 0 == ac_raaMatrix[0][0] )
+    {
+        return false;
+    }
+    a_raaInverse[0][0] = 1 / (InverseT)ac_raaMatrix[0][0];
+    return true;
+}
+
+// 2x2
+template< typename T >
+inline T MatrixInverse< T, 2, 2 >::
+    Determinant( const T (&ac_raaMatrix)[ 2 ][ 2 ] )
+{
+    return ( ac_raaMatrix[0][0] * ac_raaMatrix[1][1] )
+            - ( ac_raaMatrix[0][1] * ac_raaMatrix[1][0] );
+}
+template< typename T >
+inline bool MatrixInverse< T, 2, 2 >::
+    Invert( const T (&ac_raaMatrix)[ 2 ][ 2 ],
+            InverseT (&a_raaInverse)[ 2 ][ 2 ] )
+{
+    const T tDeterminant = Determinant( ac_raaMatrix );
+    if( 0 == tDeterminant )
+    {
+        return false;
+    }
+    const T (&raaM)[ 2 ][ 2 ] = ac_raaMatrix;
+    a_raaInverse[0][0] = (InverseT)raaM[1][1] / tDeterminant;
+    a_raaInverse[0][1] = -(InverseT)raaM[0][1] / tDeterminant;
+    a_raaInverse[1][0] = -(InverseT)raaM[1][0] / tDeterminant;
+    a_raaInverse[1][1] = (InverseT)raaM[0][0] / tDeterminant;
+    return true;
+}
+
+// 3x3 - adjugate (transposed cofactors) divided by the determinant
+template< typename T >
+inline T MatrixInverse< T, 3, 3 >::
+    Determinant( const T (&ac_raaMatrix)[ 3 ][ 3 ] )
+{
+    const T (&raaM)[ 3 ][ 3 ] = ac_raaMatrix;
+    return raaM[0][0] * ( raaM[1][1] * raaM[2][2] - raaM[1][2] * raaM[2][1] )
+         - raaM[0][1] * ( raaM[1][0] * raaM[2][2] - raaM[1][2] * raaM[2][0] )
+         + raaM[0][2] * ( raaM[1][0] * raaM[2][1] - raaM[1][1] * raaM[2][0] );
+}
+template< typename T >
+inline bool MatrixInverse< T, 3, 3 >::
+    Invert( const T (&ac_raaMatrix)[ 3 ][ 3 ],
+            InverseT (&a_raaInverse)[ 3 ][ 3 ] )
+{
+    const T (&raaM)[ 3 ][ 3 ] = ac_raaMatrix;
+    const T aaCofactor[ 3 ][ 3 ] =
+        { {   raaM[1][1] * raaM[2][2] - raaM[1][2] * raaM[2][1],
+            -( raaM[1][0] * raaM[2][2] - raaM[1][2] * raaM[2][0] ),
+              raaM[1][0] * raaM[2][1] - raaM[1][1] * raaM[2][0] },
+          { -( raaM[0][1] * raaM[2][2] - raaM[0][2] * raaM[2][1] ),
+              raaM[0][0] * raaM[2][2] - raaM[0][2] * raaM[2][0],
+            -( raaM[0][0] * raaM[2][1] - raaM[0][1] * raaM[2][0] ) },
+          {   raaM[0][1] * raaM[1][2] - raaM[0][2] * raaM[1][1],
+            -( raaM[0][0] * raaM[1][2] - raaM[0][2] * raaM[1][0] ),
+              raaM[0][0] * raaM[1][1] - raaM[0][1] * raaM[1][0] } };
+    const T tDeterminant = raaM[0][0] * aaCofactor[0][0] +
+                          raaM[0][1] * aaCofactor[0][1] +
+                          raaM[0][2] * aaCofactor[0][2];
+    if( 0 == tDeterminant )
+    {
+        return false;
+    }
+    for( unsigned int i = 0; i < 9; ++i )
+    {
+        a_raaInverse[i%3][i/3] = (InverseT)aaCofactor[i/3][i%3] / tDeterminant;
+    }
+    return true;
+}
+
+// 4x4 - Laplace expansion along the top two rows, so each 2x2 determinant
+// from the top and bottom halves is only computed once
+template< typename T >
+inline T MatrixInverse< T, 4, 4 >::
+    Determinant( const T (&ac_raaMatrix)[ 4 ][ 4 ] )
+{
+    const T (&raaM)[ 4 ][ 4 ] = ac_raaMatrix;
+    return ( raaM[0][0] * raaM[1][1] - raaM[1][0] * raaM[0][1] ) *
+           ( raaM[2][2] * raaM[3][3] - raaM[3][2] * raaM[2][3] )
+         - ( raaM[0][0] * raaM[1][2] - raaM[1][0] * raaM[0][2] ) *
+           ( raaM[2][1] * raaM[3][3] - raaM[3][1] * raaM[2][3] )
+         + ( raaM[0][0] * raaM[1][3] - raaM[1][0] * raaM[0][3] ) *
+           ( raaM[2][1] * raaM[3][2] - raaM[3][1] * raaM[2][2] )
+         + ( raaM[0][1] * raaM[1][2] - raaM[1][1] * raaM[0][2] ) *
+           ( raaM[2][0] * raaM[3][3] - raaM[3][0] * raaM[2][3] )
+         - ( raaM[0][1] * raaM[1][3] - raaM[1][1] * raaM[0][3] ) *
+           ( raaM[2][0] * raaM[3][2] - raaM[3][0] * raaM[2][2] )
+         + ( raaM[0][2] * raaM[1][3] - raaM[1][2] * raaM[0][3] ) *
+           ( raaM[2][0] * raaM[3][1] - raaM[3][0] * raaM[2][1] );
+}
+template< typename T >
+inline bool MatrixInverse< T, 4, 4 >::
+    Invert( const T (&ac_raaMatrix)[ 4 ][ 4 ],
+            InverseT (&a_raaInverse)[ 4 ][ 4 ] )
+{
+    const T (&raaM)[ 4 ][ 4 ] = ac_raaMatrix;
+
+    // 2x2 determinants from the top two rows...
+    const T tS0 = raaM[0][0] * raaM[1][1] - raaM[1][0] * raaM[0][1];
+    const T tS1 = raaM[0][0] * raaM[1][2] - raaM[1][0] * raaM[0][2];
+    const T tS2 = raaM[0][0] * raaM[1][3] - raaM[1][0] * raaM[0][3];
+    const T tS3 = raaM[0][1] * raaM[1][2] - raaM[1][1] * raaM[0][2];
+    const T tS4 = raaM[0][1] * raaM[1][3] - raaM[1][1] * raaM[0][3];
+    const T tS5 = raaM[0][2] * raaM[1][3] - raaM[1][2] * raaM[0][3];
+
+    // ...and the bottom two
+    const T tC5 = raaM[2][2] * raaM[3][3] - raaM[3][2] * raaM[2][3];
+    const T tC4 = raaM[2][1] * raaM[3][3] - raaM[3][1] * raaM[2][3];
+    const T tC3 = raaM[2][1] * raaM[3][2] - raaM[3][1] * raaM[2][2];
+    const T tC2 = raaM[2][0] * raaM[3][3] - raaM[3][0] * raaM[2][3];
+    const T tC1 = raaM[2][0] * raaM[3][2] - raaM[3][0] * raaM[2][2];
+    const T tC0 = raaM[2][0] * raaM[3][1] - raaM[3][0] * raaM[2][1];
+
+    const T tDeterminant =
+        tS0 * tC5 - tS1 * tC4 + tS2 * tC3 + tS3 * tC2 - tS4 * tC1 + tS5 * tC0;
+    if( 0 == tDeterminant )
+    {
+        return false;
+    }
+
+    const T aaAdjugate[ 4 ][ 4 ] =
+        { {  raaM[1][1] * tC5 - raaM[1][2] * tC4 + raaM[1][3] * tC3,
+            -raaM[0][1] * tC5 + raaM[0][2] * tC4 - raaM[0][3] * tC3,
+             raaM[3][1] * tS5 - raaM[3][2] * tS4 + raaM[3][3] * tS3,
+            -raaM[2][1] * tS5 + raaM[2][2] * tS4 - raaM[2][3] * tS3 },
+          { -raaM[1][0] * tC5 + raaM[1][2] * tC2 - raaM[1][3] * tC1,
+             raaM[0][0] * tC5 - raaM[0][2] * tC2 + raaM[0][3] * tC1,
+            -raaM[3][0] * tS5 + raaM[3][2] * tS2 - raaM[3][3] * tS1,
+             raaM[2][0] * tS5 - raaM[2][2] * tS2 + raaM[2][3] * tS1 },
+          {  raaM[1][0] * tC4 - raaM[1][1] * tC2 + raaM[1][3] * tC0,
+            -raaM[0][0] * tC4 + raaM[0][1] * tC2 - raaM[0][3] * tC0,
+             raaM[3][0] * tS4 - raaM[3][1] * tS2 + raaM[3][3] * tS0,
+            -raaM[2][0] * tS4 + raaM[2][1] * tS2 - raaM[2][3] * tS0 },
+          { -raaM[1][0] * tC3 + raaM[1][1] * tC1 - raaM[1][2] * tC0,
+             raaM[0][0] * tC3 - raaM[0][1] * tC1 + raaM[0][2] * tC0,
+            -raaM[3][0] * tS3 + raaM[3][1] * tS1 - raaM[3][2] * tS0,
+             raaM[2][0] * tS3 - raaM[2][1] * tS1 + raaM[2][2] * tS0 } };
+    for( unsigned int i = 0; i < 16; ++i )
+    {
+        a_raaInverse[i/4][i%4] = (InverseT)aaAdjugate[i/4][i%4] / tDeterminant;
+    }
+    return true;
+}
+
+// Affine transform - invert the linear part and run the negated translation
+// through it
+template< typename T, unsigned int N >
+inline bool TransformInverse< T, N >::
+    Affine( const T (&ac_raaTransform)[ N ][ N ],
+            InverseT (&a_raaInverse)[ N ][ N ] )
+{
+    T aaLinear[ N - 1 ][ N - 1 ];
+    for( unsigned int i = 0; i < N - 1; ++i )
+    {
+        for( unsigned int j = 0; j < N - 1; ++j )
+        {
+            aaLinear[i][j] = ac_raaTransform[i][j];
+        }
+    }
+    InverseT aaLinearInverse[ N - 1 ][ N - 1 ];
+    if( !MatrixInverse< T, N - 1, N - 1 >::Invert( aaLinear, aaLinearInverse ) )
+    {
+        return false;
+    }
+    for( unsigned int j = 0; j < N - 1; ++j )
+    {
+        InverseT tTranslation = 0;
+        for( unsigned int i = 0; i < N - 1; ++i )
+        {
+            a_raaInverse[i][j] = aaLinearInverse[i][j];
+            tTranslation -= ac_raaTransform[N - 1][i] * aaLinearInverse[i][j];
+        }
+        a_raaInverse[N - 1][j] = tTranslation;
+        a_raaInverse[j][N - 1] = 0;
+    }
+    a_raaInverse[N - 1][N - 1] = 1;
+    return true;
+}
+
+// Rigid transform - same as above, but the linear part is its own transpose
+template< typename T, unsigned int N >
+inline void TransformInverse< T, N >::
+    Rigid( const T (&ac_raaTransform)[ N ][ N ],
+           InverseT (&a_raaInverse)[ N ][ N ] )
+{
+    for( unsigned int j = 0; j < N - 1; ++j )
+    {
+        InverseT tTranslation = 0;
+        for( unsigned int i = 0; i < N - 1; ++i )
+        {
+            a_raaInverse[i][j] = ac_raaTransform[j][i];
+            tTranslation -= ac_raaTransform[N - 1][i] * ac_raaTransform[j][i];
+        }
+        a_raaInverse[N - 1][j] = tTranslation;
+        a_raaInverse[j][N - 1] = 0;
+    }
+    a_raaInverse[N - 1][N - 1] = 1;
+}
+
+}   // namespace Math
+
+#endif  // MATRIX_INVERSE__INL
@@ -0,0 +1,220 @@
+/******************************************************************************
+ * File:               MatrixProduct.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Processor detection and SIMD kernels for 4x4 products.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef MATRIX_PRODUCT__INL
+#define MATRIX_PRODUCT__INL
+
+#include "../Declarations/MatrixProduct.h"
+#include "../Declarations/ImExportMacro.h"
+
+// SSE2 and CPUID are available on every x86 compiler we target, AVX intrinsics
+// only from Visual Studio 2010 SP1 on.  Intrinsics don't need /arch:AVX - the
+// AVX kernels are only ever called after checking the processor supports them.
+#if defined _M_IX86 || defined _M_X64
+#define MATRIX_PRODUCT_SSE2
+#include <emmintrin.h>
+#include <intrin.h>
+#if defined _MSC_FULL_VER && _MSC_FULL_VER >= 160040219
+#define MATRIX_PRODUCT_AVX
+#include <immintrin.h>
+#endif
+#endif
+
+namespace Math
+{
+
+// Best instruction set supported by both the processor and the operating
+// system.  Detected once and cached.
+INLINE SimdLevel DetectedSimdLevel()
+{
+    static bool sbDetected = false;
+    static SimdLevel seLevel = SIMD_NONE;
+    if( !sbDetected )
+    {
+#ifdef MATRIX_PRODUCT_SSE2
+        int aiInfo[4];
+        __cpuid( aiInfo, 0 );
+        if( aiInfo[0] >= 1 )
+        {
+            __cpuid( aiInfo, 1 );
+            if( 0 != ( aiInfo[3] & ( 1 << 26 ) ) )
+            {
+                seLevel = SIMD_SSE2;
+            }
+#ifdef MATRIX_PRODUCT_AVX
+            // The processor has to support AVX and the OS has to save the YMM
+            // registers on a context switch (OSXSAVE set, XCR0 bits 1 and 2).
+            if( SIMD_SSE2 == seLevel &&
+                0 != ( aiInfo[2] & ( 1 << 27 ) ) &&
+                0 != ( aiInfo[2] & ( 1 << 28 ) ) &&
+                6 == ( _xgetbv( 0 ) & 6 ) )
+            {
+                seLevel = SIMD_AVX;
+            }
+#endif
+        }
+#endif
+        sbDetected = true;
+    }
+    return seLevel;
+}
+
+// 4x4 double product
+INLINE void SimdProduct( const double (&ac_raadLeft)[ 4 ][ 4 ],
+                         const double (&ac_raadRight)[ 4 ][ 4 ],
+                         double (&a_raadResult)[ 4 ][ 4 ],
+                         SimdLevel a_eMaxLevel )
+{
+    SimdLevel eLevel = DetectedSimdLevel();
+    if( a_eMaxLevel < eLevel )
+    {
+        eLevel = a_eMaxLevel;
+    }
+
+#ifdef MATRIX_PRODUCT_AVX
+    // Each right-hand row fits in one register, so each result row is four
+    // broadcast-multiply-adds.
+    if( SIMD_AVX == eLevel )
+    {
+        const __m256d aoRight[4] = { _mm256_loadu_pd( ac_raadRight[0] ),
+                                     _mm256_loadu_pd( ac_raadRight[1] ),
+                                     _mm256_loadu_pd( ac_raadRight[2] ),
+                                     _mm256_loadu_pd( ac_raadRight[3] ) };
+        for( unsigned int i = 0; i < 4; ++i )
+        {
+            __m256d oRow =
+                _mm256_mul_pd( _mm256_broadcast_sd( &ac_raadLeft[i][0] ),
+                               aoRight[0] );
+            for( unsigned int k = 1; k < 4; ++k )
+            {
+                oRow = _mm256_add_pd(
+                    oRow, _mm256_mul_pd( _mm256_broadcast_sd(
+                                             &ac_raadLeft[i][k] ),
+                                         aoRight[k] ) );
+            }
+            _mm256_storeu_pd( a_raadResult[i], oRow );
+        }
+        _mm256_zeroupper();
+        return;
+    }
+#endif
+
+#ifdef MATRIX_PRODUCT_SSE2
+    // Same as above, but each row takes two registers.
+    if( SIMD_SSE2 <= eLevel )
+    {
+        for( unsigned int i = 0; i < 4; ++i )
+        {
+            __m128d oFactor = _mm_set1_pd( ac_raadLeft[i][0] );
+            __m128d oLow = _mm_mul_pd( oFactor,
+                                       _mm_loadu_pd( &ac_raadRight[0][0] ) );
+            __m128d oHigh = _mm_mul_pd( oFactor,
+                                        _mm_loadu_pd( &ac_raadRight[0][2] ) );
+            for( unsigned int k = 1; k < 4; ++k )
+            {
+                oFactor = _mm_set1_pd( ac_raadLeft[i][k] );
+                oLow = _mm_add_pd(
+                    oLow, _mm_mul_pd( oFactor,
+                                      _mm_loadu_pd( &ac_raadRight[k][0] ) ) );
+                oHigh = _mm_add_pd(
+                    oHigh, _mm_mul_pd( oFactor,
+                                       _mm_loadu_pd( &ac_raadRight[k][2] ) ) );
+            }
+            _mm_storeu_pd( &a_raadResult[i][0], oLow );
+            _mm_storeu_pd( &a_raadResult[i][2], oHigh );
+        }
+        return;
+    }
+#endif
+
+    UnrolledProduct( ac_raadLeft, ac_raadRight, a_raadResult );
+}
+
+#ifdef MATRIX_PRODUCT_AVX
+// Element [a_uiRow][a_uiColumn] in the low half of a register and element
+// [a_uiRow + 1][a_uiColumn] in the high half
+inline __m256 PairFactors( const float (&ac_raafMatrix)[ 4 ][ 4 ],
+                           unsigned int a_uiRow, unsigned int a_uiColumn )
+{
+    return _mm256_insertf128_ps(
+        _mm256_castps128_ps256(
+            _mm_set1_ps( ac_raafMatrix[a_uiRow][a_uiColumn] ) ),
+        _mm_set1_ps( ac_raafMatrix[a_uiRow + 1][a_uiColumn] ), 1 );
+}
+#endif
+
+// 4x4 float product
+INLINE void SimdProduct( const float (&ac_raafLeft)[ 4 ][ 4 ],
+                         const float (&ac_raafRight)[ 4 ][ 4 ],
+                         float (&a_raafResult)[ 4 ][ 4 ],
+                         SimdLevel a_eMaxLevel )
+{
+    SimdLevel eLevel = DetectedSimdLevel();
+    if( a_eMaxLevel < eLevel )
+    {
+        eLevel = a_eMaxLevel;
+    }
+
+#ifdef MATRIX_PRODUCT_AVX
+    // Each right-hand row is copied into both halves of a register, so two
+    // result rows are computed at once.
+    if( SIMD_AVX == eLevel )
+    {
+        __m256 aoRight[4];
+        for( unsigned int k = 0; k < 4; ++k )
+        {
+            aoRight[k] = _mm256_broadcast_ps(
+                reinterpret_cast< const __m128* >( ac_raafRight[k] ) );
+        }
+        for( unsigned int i = 0; i < 4; i += 2 )
+        {
+            __m256 oRows = _mm256_mul_ps( PairFactors( ac_raafLeft, i, 0 ),
+                                          aoRight[0] );
+            for( unsigned int k = 1; k < 4; ++k )
+            {
+                oRows = _mm256_add_ps(
+                    oRows, _mm256_mul_ps( PairFactors( ac_raafLeft, i, k ),
+                                          aoRight[k] ) );
+            }
+            _mm256_storeu_ps( a_raafResult[i], oRows );
+        }
+        _mm256_zeroupper();
+        return;
+    }
+#endif
+
+#ifdef MATRIX_PRODUCT_SSE2
+    if( SIMD_SSE2 <= eLevel )
+    {
+        const __m128 aoRight[4] = { _mm_loadu_ps( ac_raafRight[0] ),
+                                    _mm_loadu_ps( ac_raafRight[1] ),
+                                    _mm_loadu_ps( ac_raafRight[2] ),
+                                    _mm_loadu_ps( ac_raafRight[3] ) };
+        for( unsigned int i = 0; i < 4; ++i )
+        {
+            __m128 oRow = _mm_mul_ps( _mm_set1_ps( ac_raafLeft[i][0] ),
+                                      aoRight[0] );
+            for( unsigned int k = 1; k < 4; ++k )
+            {
+                oRow = _mm_add_ps( oRow,
+                                   _mm_mul_ps( _mm_set1_ps( ac_raafLeft[i][k] ),
+                                               aoRight[k] ) );
+            }
+            _mm_storeu_ps( a_raafResult[i], oRow );
+        }
+        return;
+    }
+#endif
+
+    UnrolledProduct( ac_raafLeft, ac_raafRight, a_raafResult );
+}
+
+}   // namespace Math
+
+#endif  // MATRIX_PRODUCT__INL
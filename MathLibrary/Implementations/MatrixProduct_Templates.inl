@@ -0,0 +1,133 @@
+/******************************************************************************
+ * File:               MatrixProduct_Templates.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Template implementations for matrix product kernels.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef MATRIX_PRODUCT__TEMPLATES__INL
+#define MATRIX_PRODUCT__TEMPLATES__INL
+
+#include "../Declarations/MatrixProduct.h"
+
+namespace Math
+{
+
+// Unrolled square products
+template< typename T >
+inline void UnrolledProduct( const T (&ac_raaLeft)[ 2 ][ 2 ],
+                             const T (&ac_raaRight)[ 2 ][ 2 ],
+                             T (&a_raaResult)[ 2 ][ 2 ] )
+{
+    const T (&raaL)[ 2 ][ 2 ] = ac_raaLeft;
+    const T (&raaR)[ 2 ][ 2 ] = ac_raaRight;
+    a_raaResult[0][0] = raaL[0][0]*raaR[0][0] + raaL[0][1]*raaR[1][0];
+    a_raaResult[0][1] = raaL[0][0]*raaR[0][1] + raaL[0][1]*raaR[1][1];
+    a_raaResult[1][0] = raaL[1][0]*raaR[0][0] + raaL[1][1]*raaR[1][0];
+    a_raaResult[1][1] = raaL[1][0]*raaR[0][1] + raaL[1][1]*raaR[1][1];
+}
+template< typename T >
+inline void UnrolledProduct( const T (&ac_raaLeft)[ 3 ][ 3 ],
+                             const T (&ac_raaRight)[ 3 ][ 3 ],
+                             T (&a_raaResult)[ 3 ][ 3 ] )
+{
+    const T (&raaL)[ 3 ][ 3 ] = ac_raaLeft;
+    const T (&raaR)[ 3 ][ 3 ] = ac_raaRight;
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        a_raaResult[i][0] = raaL[i][0]*raaR[0][0] + raaL[i][1]*raaR[1][0] +
+                            raaL[i][2]*raaR[2][0];
+        a_raaResult[i][1] = raaL[i][0]*raaR[0][1] + raaL[i][1]*raaR[1][1] +
+                            raaL[i][2]*raaR[2][1];
+        a_raaResult[i][2] = raaL[i][0]*raaR[0][2] + raaL[i][1]*raaR[1][2] +
+                            raaL[i][2]*raaR[2][2];
+    }
+}
+template< typename T >
+inline void UnrolledProduct( const T (&ac_raaLeft)[ 4 ][ 4 ],
+                             const T (&ac_raaRight)[ 4 ][ 4 ],
+                             T (&a_raaResult)[ 4 ][ 4 ] )
+{
+    const T (&raaL)[ 4 ][ 4 ] = ac_raaLeft;
+    const T (&raaR)[ 4 ][ 4 ] = ac_raaRight;
+    for( unsigned int i = 0; i < 4; ++i )
+    {
+        a_raaResult[i][0] = raaL[i][0]*raaR[0][0] + raaL[i][1]*raaR[1][0] +
+                            raaL[i][2]*raaR[2][0] + raaL[i][3]*raaR[3][0];
+        a_raaResult[i][1] = raaL[i][0]*raaR[0][1] + raaL[i][1]*raaR[1][1] +
+                            raaL[i][2]*raaR[2][1] + raaL[i][3]*raaR[3][1];
+        a_raaResult[i][2] = raaL[i][0]*raaR[0][2] + raaL[i][1]*raaR[1][2] +
+                            raaL[i][2]*raaR[2][2] + raaL[i][3]*raaR[3][2];
+        a_raaResult[i][3] = raaL[i][0]*raaR[0][3] + raaL[i][1]*raaR[1][3] +
+                            raaL[i][2]*raaR[2][3] + raaL[i][3]*raaR[3][3];
+    }
+}
+
+// General case
+template< typename T, unsigned int M, unsigned int N, unsigned int P >
+inline void MatrixProduct< T, M, N, P >::
+    Multiply( const T (&ac_raaLeft)[ M ][ N ],
+              const T (&ac_raaRight)[ N ][ P ],
+              T (&a_raaResult)[ M ][ P ] )
+{
+    for( unsigned int i = 0; i < M; ++i )
+    {
+        for( unsigned int j = 0; j < P; ++j )
+        {
+            T tSum = ac_raaLeft[i][0] * ac_raaRight[0][j];
+            for( unsigned int k = 1; k < N; ++k )
+            {
+                tSum += ac_raaLeft[i][k] * ac_raaRight[k][j];
+            }
+            a_raaResult[i][j] = tSum;
+        }
+    }
+}
+
+// Square cases
+template< typename T >
+inline void MatrixProduct< T, 2, 2, 2 >::
+    Multiply( const T (&ac_raaLeft)[ 2 ][ 2 ],
+              const T (&ac_raaRight)[ 2 ][ 2 ],
+              T (&a_raaResult)[ 2 ][ 2 ] )
+{
+    UnrolledProduct( ac_raaLeft, ac_raaRight, a_raaResult );
+}
+template< typename T >
+inline void MatrixProduct< T, 3, 3, 3 >::
+    Multiply( const T (&ac_raaLeft)[ 3 ][ 3 ],
+              const T (&ac_raaRight)[ 3 ][ 3 ],
+              T (&a_raaResult)[ 3 ][ 3 ] )
+{
+    UnrolledProduct( ac_raaLeft, ac_raaRight, a_raaResult );
+}
+template< typename T >
+inline void MatrixProduct< T, 4, 4, 4 >::
+    Multiply( const T (&ac_raaLeft)[ 4 ][ 4 ],
+              const T (&ac_raaRight)[ 4 ][ 4 ],
+              T (&a_raaResult)[ 4 ][ 4 ] )
+{
+    UnrolledProduct( ac_raaLeft, ac_raaRight, a_raaResult );
+}
+
+// 4x4 floating-point cases go to the SIMD kernels
+inline void MatrixProduct< double, 4, 4, 4 >::
+    Multiply( const double (&ac_raadLeft)[ 4 ][ 4 ],
+              const double (&ac_raadRight)[ 4 ][ 4 ],
+              double (&a_raadResult)[ 4 ][ 4 ] )
+{
+    SimdProduct( ac_raadLeft, ac_raadRight, a_raadResult );
+}
+inline void MatrixProduct< float, 4, 4, 4 >::
+    Multiply( const float (&ac_raafLeft)[ 4 ][ 4 ],
+              const float (&ac_raafRight)[ 4 ][ 4 ],
+              float (&a_raafResult)[ 4 ][ 4 ] )
+{
+    SimdProduct( ac_raafLeft, ac_raafRight, a_raafResult );
+}
+
+}   // namespace Math
+
+#endif  // MATRIX_PRODUCT__TEMPLATES__INL
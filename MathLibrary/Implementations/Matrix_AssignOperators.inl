@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       January 5, 2014
  * Description:        Operator implementations for Matrix template class.
- * Last Modified:      February 4, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Element loops run over the flat element array.
  ******************************************************************************/
 
 #ifndef MATRIX__ASSIGN_OPERATORS__INL
@@ -33,13 +33,14 @@ inline Matrix< T, M, N >& Matrix< T, M, N >::
     {
         throw exception("Non-convertable input type");
     }  /**/
-    if( ThisIsNot( ac_roMatrix ) )
+    // no virtual base, so the matrix data starts at the object's address
+    if( (const void*)this != (const void*)&ac_roMatrix )
     {
         for( unsigned int i = 0; i < M && i < P; ++i )
         {
             for( unsigned int j = 0; j < N && j < Q; ++j )
             {
-                m_aaData[i][j] =  (T)(ac_roMatrix[i][j]);
+                m_aaData[i][j] =  (T)(ac_roMatrix.m_aaData[i][j]);
             }
         }
     }
@@ -54,10 +55,7 @@ inline Matrix< T, M, N >& Matrix< T, M, N >::operator=( const T& ac_rFill )
     {
         throw exception("Non-copy-assignable type");
     } /**/
-    for( unsigned int i = 0; i < M*N; ++i )
-    {
-        m_aaData[i/N][i%N] = ac_rFill;
-    }
+    ElementKernels< T >::Fill( Data(), ac_rFill, M*N );
     return *this;
 }
 
@@ -70,10 +68,7 @@ inline Matrix< T, M, N >& Matrix< T, M, N >::
     {
         throw exception("Non-copy-assignable type");
     } /**/
-    for( unsigned int i = 0; i < M*N; ++i )
-    {
-        m_aaData[i/N][i%N] = ac_raData[i];
-    }
+    ElementKernels< T >::Copy( ac_raData, Data(), M*N );
     return *this;
 }
 
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       December 3, 2013
  * Description:        Constructor implementations for Matrix template class.
- * Last Modified:      February 12, 2014
- * Last Modification:  Refactoring.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Element loops run over the flat element array.
  ******************************************************************************/
 
 #ifndef MATRIX__CONSTRUCTORS__INL
@@ -17,10 +17,6 @@
 namespace Math
 {
 
-// destructor doesn't need to do anything
-template< typename T, unsigned int M, unsigned int N >
-inline Matrix< T, M, N >::~Matrix() {}
-    
 // Copy constructor
 template< typename T, unsigned int M, unsigned int N >
 template< typename U, unsigned int P, unsigned int Q >
@@ -40,7 +36,8 @@ inline Matrix< T, M, N >::
         for( unsigned int j = 0; j < N; ++j )
         {
              m_aaData[i][j] =
-                 ( ( i < P && j < Q ) ? (T)(ac_roMatrix[i][j]) : ac_rFill );
+                 ( ( i < P && j < Q ) ? (T)(ac_roMatrix.m_aaData[i][j])
+                                      : ac_rFill );
         }
     }
 }
@@ -53,10 +50,7 @@ inline Matrix< T, M, N >::Matrix( const T& ac_rFill )
     {
         throw exception("Non-copy-assignable type");
     } /**/
-    for( unsigned int i = 0; i < M*N; ++i )
-    {
-        m_aaData[i/N][i%N] = ac_rFill;
-    }
+    ElementKernels< T >::Fill( Data(), ac_rFill, M*N );
 }
 
 // Construct with diagonal elements set to the second given value and all others
@@ -85,10 +79,7 @@ inline Matrix< T, M, N >::Matrix( const T (&ac_raData)[ M*N ] )
     {
         throw exception("Non-copy-assignable type");
     } /**/
-    for( unsigned int i = 0; i < M*N; ++i )
-    {
-        m_aaData[i/N][i%N] = ac_raData[i];
-    }
+    ElementKernels< T >::Copy( ac_raData, Data(), M*N );
 }
 template< typename T, unsigned int M, unsigned int N >
 inline Matrix< T, M, N >::Matrix( const T (&ac_raaData)[ M ][ N ] )
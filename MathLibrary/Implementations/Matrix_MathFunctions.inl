@@ -3,47 +3,27 @@
  * Author:             Elizabeth Lowry
  * Date Created:       January 5, 2014
  * Description:        Function implementations for Matrix template class.
- * Last Modified:      February 12, 2014
- * Last Modification:  Refactoring.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Large pseudo-inverses use QR decomposition.
  ******************************************************************************/
 
 #ifndef MATRIX__MATH_FUNCTIONS__INL
 #define MATRIX__MATH_FUNCTIONS__INL
 
 #include "../Declarations/Matrix.h"
+#include "../Declarations/Decomposition.h"
+#include "../Declarations/MatrixInverse.h"
 
 namespace Math
 {
 
 // Determinant - return 0 if non-square matrix
+// Small matrices use closed-form cofactor expansions and larger ones use LU
+// decomposition, so this is O(N^3) at worst instead of O(N!).
 template< typename T, unsigned int M, unsigned int N >
-T Matrix< T, M, N >::Determinant() const
+inline T Matrix< T, M, N >::Determinant() const
 {
-    // Trivial cases
-    if( N != M || N == 0 )
-    {
-        return 0;
-    }
-    if( N == 1 )
-    {
-        return m_aaData[0][0];
-    }
-    if( N == 2 )
-    {
-        return ( m_aaData[0][0] * m_aaData[1][1] )
-                - ( m_aaData[0][1] * m_aaData[1][0] );
-    }
-
-    // Recursive case - this gets really inefficient for larger matrices
-    // (complexity is O(!N)) and should be replaced with a more efficient
-    // algorithm if this library is ever used for matrices with larger
-    // dimensions.
-    T determinant = 0;
-    for( unsigned int i = 0; i < N; i++ )
-    {
-        determinant += m_aaData[0][i] * Minor( 0, i ) * ( (i%2) == 0 ? 1 : -1 );
-    }
-    return determinant;
+    return MatrixInverse< T, M, N >::Determinant( m_aaData );
 }
 template< typename T, unsigned int M, unsigned int N >
 inline T Matrix< T, M, N >::Minor( unsigned int a_uiRow,
@@ -58,11 +38,13 @@ inline bool Matrix< T, M, N >::IsInvertable() const
 {
     if( M > N ) // is the matrix left-invertable?
     {
-        return ( Transpose() * (*this) ).IsInvertable();
+        return ( N > 4 ? QR< T, M, N >( *this ).IsFullRank()
+                       : ( Transpose() * (*this) ).IsInvertable() );
     }
     if( M < N ) // is the matrix right-invertable?
     {
-        return ( (*this) * Transpose() ).IsInvertable();
+        return ( M > 4 ? QR< T, N, M >( Transpose() ).IsFullRank()
+                       : ( (*this) * Transpose() ).IsInvertable() );
     }
     return ( 0 != Determinant() );  // is the matrix truely invertable?
 }
@@ -108,11 +90,17 @@ inline typename Matrix< T, M, N >::InverseType Matrix< T, M, N >::
 }
 
 // For MxN matrix A where M > N, ( A^T * A )^(-1) * A^T * A
-// So we have a left inverse ( A^T * A )^(-1) * A^T
+// So we have a left inverse ( A^T * A )^(-1) * A^T.  Forming A^T * A squares
+// the condition number, so once it's too big for the closed-form inverse, the
+// left inverse is computed from the QR decomposition of A instead.
 template< typename T, unsigned int M, unsigned int N >
 inline bool Matrix< T, M, N >::
     LeftInverse( InverseType& a_roMatrix ) const    // !invertable = !change
 {
+    if( N > 4 )
+    {
+        return QR< T, M, N >( *this ).LeftInverse( a_roMatrix );
+    }
     InverseType oTranspose = Transpose();
     Matrix< InverseT, M, N > oCopy( *this );
     typename Matrix< T, N >::InverseType oSquare( oTranspose * oCopy );
@@ -125,11 +113,23 @@ inline bool Matrix< T, M, N >::
 }
 
 // For MxN matrix A where M < N, A * A^T * ( A * A^T )^(-1)
-// So we have a right inverse A^T * ( A * A^T )^(-1)
+// So we have a right inverse A^T * ( A * A^T )^(-1).  As above, larger
+// matrices use QR - the right inverse is the transpose of the left inverse of
+// A^T.
 template< typename T, unsigned int M, unsigned int N >
 inline bool Matrix< T, M, N >::
     RightInverse( InverseType& a_roMatrix ) const   // !invertable = !change
 {
+    if( M > 4 )
+    {
+        Matrix< InverseT, M, N > oTransposeInverse;
+        if( !QR< T, N, M >( Transpose() ).LeftInverse( oTransposeInverse ) )
+        {
+            return false;
+        }
+        a_roMatrix = oTransposeInverse.Transpose();
+        return true;
+    }
     InverseType oTranspose = Transpose();
     Matrix< InverseT, M, N > oCopy( *this );
     typename Matrix< T, M >::InverseType oSquare( oCopy * oTranspose );
@@ -141,30 +141,13 @@ inline bool Matrix< T, M, N >::
     return true;
 }
 
-// True inverse = transpose of cofactor matrix divided by determinant
-// cofactor_i,j = minor_i,j * (-1)^(i+j)
-// minor_i,j = determinant of submatrix created by removing row i and column j
+// True inverse - adjugate divided by determinant for matrices up to 4x4,
+// solved from the LU decomposition for anything larger
 template< typename T, unsigned int M, unsigned int N >
-bool Matrix< T, M, N >::
+inline bool Matrix< T, M, N >::
     TrueInverse( InverseType& a_roMatrix ) const    // !invertable = !change
 {
-    T determinant = Determinant();
-    if( 0 == determinant )
-    {
-        return false;
-    }
-    if( 1 == N )
-    {
-        a_roMatrix[0][0] = 1 / determinant;
-        return true;
-    }
-    for( unsigned int i = 0; i < M*N; ++i )
-    {
-        a_roMatrix[i%N][i/N] = Minor( i/N, i%N );
-        a_roMatrix[i%N][i/N] *= ( ( ( (i/N) + (i%N) ) % 2 ) == 0 ) ? 1 : -1;
-    }
-    a_roMatrix /= determinant;
-    return true;
+    return MatrixInverse< T, M, N >::Invert( m_aaData, a_roMatrix.m_aaData );
 }
 
 // Return true if this matrix is an orthogonal matrix
@@ -3,15 +3,19 @@
  * Author:             Elizabeth Lowry
  * Date Created:       December 3, 2013
  * Description:        Operator implementations for Matrix template class.
- * Last Modified:      February 12, 2014
- * Last Modification:  Refactoring.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Scalar division checks for zero before dividing.
  ******************************************************************************/
 
 #ifndef MATRIX__OPERATORS__INL
 #define MATRIX__OPERATORS__INL
 
 #include "../Declarations/Matrix.h"
+#include "../Declarations/Decomposition.h"
+#include "../Declarations/ElementKernels.h"
 #include "../Declarations/Functions.h"
+#include "../Declarations/MatrixExpression.h"
+#include "../Declarations/MatrixProduct.h"
 #include <iostream>     // for ostream
 #include <stdexcept>    // for invalid_argument and out_of_range
 #include <type_traits>  // for enable_if and is_scalar
@@ -23,22 +27,12 @@ namespace Math
 template< typename T, unsigned int M, unsigned int N >
 inline bool Matrix< T, M, N >::operator==( const Matrix& ac_roMatrix ) const
 {
-    bool bResult = true;
-    for( unsigned int i = 0; bResult && i < M*N; ++i )
-    {
-        bResult = ( m_aaData[i/N][i%N] == ac_roMatrix[i/N][i%N] );
-    }
-    return bResult;
+    return ElementKernels< T >::Equal( Data(), ac_roMatrix.Data(), M*N );
 }
 template< typename T, unsigned int M, unsigned int N >
 inline bool Matrix< T, M, N >::operator!=( const Matrix& ac_roMatrix ) const
 {
-    bool bResult = false;
-    for( unsigned int i = 0; !bResult && i < M*N; ++i )
-    {
-        bResult = ( m_aaData[i/N][i%N] != ac_roMatrix[i/N][i%N] );
-    }
-    return bResult;
+    return ElementKernels< T >::NotEqual( Data(), ac_roMatrix.Data(), M*N );
 }
 
 // Row access
@@ -69,10 +63,8 @@ inline Matrix< T, M, P > Matrix< T, M, N >::
     operator*( const Matrix< T, N, P >& ac_roMatrix ) const
 {
     Matrix< T, M, P > oResult;
-    for( unsigned int i = 0; i < M*P; i++ )
-    {
-        oResult[i/P][i%P] = Row( i/P ).Dot( ac_roMatrix.Column( i%P ) );
-    }
+    MatrixProduct< T, M, N, P >::Multiply( m_aaData, ac_roMatrix.m_aaData,
+                                           oResult.m_aaData );
     return oResult;
 }
 
@@ -87,12 +79,12 @@ template< unsigned int P >
 inline Matrix< typename InverseOf< T >::Type, M, P >
     Matrix< T, M, N >::operator/( const Matrix< T, P, N >& ac_roMatrix ) const
 {
-    if( !ac_roMatrix.IsInvertable() )
+    Matrix< InverseT, M, P > oResult;
+    if( !MatrixDivision< T, M, N, P >::Divide( *this, ac_roMatrix, oResult ) )
     {
         throw std::invalid_argument( "Cannot divide by a non-invertable matrix" );
     }
-    Matrix< InverseT, M, N > oCopy( *this );
-    return oCopy * ac_roMatrix.Inverse() ;
+    return oResult;
 }
 
 // Transform assign
@@ -111,49 +103,48 @@ Matrix< T, M, N >& Matrix< T, M, N >::
     return *this;
 }
 
-// Matrix addition and subtraction
+// Matrix addition and subtraction - single operations run as flat kernels,
+// while longer chains can still be fused through Lazy()
 template< typename T, unsigned int M, unsigned int N >
 inline Matrix< T, M, N >& Matrix< T, M, N >::
     operator+=( const Matrix& ac_roMatrix )
 {
-    for( unsigned int i = 0; i < M*N; ++i )
-    {
-        m_aaData[i/N][i%N] += ac_roMatrix[i/N][i%N];
-    }
+    ElementKernels< T >::Add( Data(), ac_roMatrix.Data(), Data(), M*N );
     return *this;
 }
 template< typename T, unsigned int M, unsigned int N >
 inline Matrix< T, M, N > Matrix< T, M, N >::
     operator+( const Matrix& ac_roMatrix ) const
 {
-    Matrix oCopy(*this);
-    oCopy += ac_roMatrix;
-    return oCopy;
+    Matrix oResult;
+    ElementKernels< T >::Add( Data(), ac_roMatrix.Data(), oResult.Data(),
+                              M*N );
+    return oResult;
 }
 template< typename T, unsigned int M, unsigned int N >
 inline Matrix< T, M, N >& Matrix< T, M, N >::
     operator-=( const Matrix& ac_roMatrix )
 {
-    for( unsigned int i = 0; i < M*N; ++i )
-    {
-        m_aaData[i/N][i%N] -= ac_roMatrix[i/N][i%N];
-    }
+    ElementKernels< T >::Subtract( Data(), ac_roMatrix.Data(), Data(), M*N );
     return *this;
 }
 template< typename T, unsigned int M, unsigned int N >
 inline Matrix< T, M, N > Matrix< T, M, N >::
     operator-( const Matrix& ac_roMatrix ) const
 {
-    Matrix oCopy(*this);
-    oCopy -= ac_roMatrix;
-    return oCopy;
+    Matrix oResult;
+    ElementKernels< T >::Subtract( Data(), ac_roMatrix.Data(), oResult.Data(),
+                                   M*N );
+    return oResult;
 }
 
 // Scalar math - multiplication, division, and modulo
 template< typename T, unsigned int M, unsigned int N >
 inline Matrix< T, M, N > Matrix< T, M, N >::operator-() const
 {
-    return operator*( -1 );
+    Matrix oResult;
+    ElementKernels< T >::Negate( Data(), oResult.Data(), M*N );
+    return oResult;
 }
 template< typename T, unsigned int M, unsigned int N >
 template< typename U >
@@ -161,10 +152,7 @@ inline typename std::enable_if< std::is_scalar< U >::value,
                                 Matrix< T, M, N >& >::type
     Matrix< T, M, N >::operator*=( const U& ac_rScalar )
 {
-    for( unsigned int i = 0; i < M*N; ++i )
-    {
-        m_aaData[i/N][i%N] *= ac_rScalar;
-    }
+    ElementKernels< T >::Multiply( Data(), ac_rScalar, Data(), M*N );
     return *this;
 }
 template< typename T, unsigned int M, unsigned int N >
@@ -173,9 +161,9 @@ inline typename std::enable_if< std::is_scalar< U >::value,
                                 Matrix< T, M, N > >::type
     Matrix< T, M, N >::operator*( const U& ac_rScalar ) const
 {
-    Matrix oCopy(*this);
-    oCopy *= ac_rScalar;
-    return oCopy;
+    Matrix oResult;
+    ElementKernels< T >::Multiply( Data(), ac_rScalar, oResult.Data(), M*N );
+    return oResult;
 }
 template< typename T, unsigned int M, unsigned int N >
 template< typename U >
@@ -187,10 +175,7 @@ inline typename std::enable_if< std::is_scalar< U >::value,
     {
         throw std::invalid_argument( "Cannot divide by zero" );
     }
-    for( unsigned int i = 0; i < M*N; ++i )
-    {
-        m_aaData[i/N][i%N] /= ac_rScalar;
-    }
+    ElementKernels< T >::Divide( Data(), ac_rScalar, Data(), M*N );
     return *this;
 }
 template< typename T, unsigned int M, unsigned int N >
@@ -199,9 +184,13 @@ inline typename std::enable_if< std::is_scalar< U >::value,
                                 Matrix< T, M, N > >::type
     Matrix< T, M, N >::operator/( const U& ac_rScalar ) const
 {
-    Matrix oCopy(*this);
-    oCopy /= ac_rScalar;
-    return oCopy;
+    if( ac_rScalar == 0 )
+    {
+        throw std::invalid_argument( "Cannot divide by zero" );
+    }
+    Matrix oResult;
+    ElementKernels< T >::Divide( Data(), ac_rScalar, oResult.Data(), M*N );
+    return oResult;
 }
 template< typename T, unsigned int M, unsigned int N >
 template< typename U >
@@ -209,14 +198,7 @@ inline typename std::enable_if< std::is_scalar< U >::value,
                                 Matrix< T, M, N >& >::type
     Matrix< T, M, N >::operator%=( const U& ac_rScalar )
 {
-    if( ac_rScalar == 0 )
-    {
-        throw std::invalid_argument( "Cannot modulo by zero" );
-    }
-    for( unsigned int i = 0; i < M*N; ++i )
-    {
-        ModuloAssign( m_aaData[i/N][i%N], ac_rScalar );
-    }
+    ( Lazy( *this ) % ac_rScalar ).AssignTo( *this );
     return *this;
 }
 template< typename T, unsigned int M, unsigned int N >
@@ -225,9 +207,7 @@ inline typename std::enable_if< std::is_scalar< U >::value,
                                 Matrix< T, M, N > >::type
     Matrix< T, M, N >::operator%( const U& ac_rScalar ) const
 {
-    Matrix oCopy(*this);
-    oCopy %= ac_rScalar;
-    return oCopy;
+    return ( Lazy( *this ) % ac_rScalar ).Evaluate();
 }
 
 }   // namespace Math
@@ -247,11 +227,12 @@ inline typename std::enable_if< std::is_scalar< U >::value,
     operator/( const U& ac_rScalar,
                const Math::Matrix< T, M, N >& ac_roMatrix )
 {
-    if( !ac_roMatrix.IsInvertable() )
+    typename Math::Matrix< T, M, N >::InverseType oInverse;
+    if( !ac_roMatrix.Inverse( oInverse ) )
     {
         throw std::invalid_argument( "Cannot divide by a non-invertable matrix" );
     }
-    return ac_roMatrix.Inverse().operator*( ac_rScalar );
+    return oInverse.operator*( ac_rScalar );
 }
 
 // stream operator
@@ -3,10 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       December 17, 2013
  * Description:        Inline function implementations for PointVector.
- * Last Modified:      February 11, 2014
- * Last Modification:  Redistributing functions from this file and
- *                      PointVector_Templates.inl into this file and
- *                      PointVector_Constructors.inl.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Zero, unit, and origin points are returned by value.
  ******************************************************************************/
 
 #ifndef POINT_VECTOR__INL
@@ -20,10 +18,6 @@
 namespace Plane
 {
 
-// destructor
-template< typename T >
-INLINE PointVector< T >::~PointVector() {}
-
 // Assignment operators that pass to base class
 template< typename T >
 INLINE PointVector< T >& PointVector< T >::operator=( const T& ac_rFill )
@@ -56,12 +50,30 @@ INLINE PointVector< T >& PointVector< T >::
     return *this;
 }
 
+// Zero point
+template< typename T >
+INLINE PointVector< T > PointVector< T >::Zero()
+{
+    return PointVector(0);
+}
+
+// Unit points
+template< typename T >
+INLINE PointVector< T > PointVector< T >::Unit( unsigned int a_uiAxis )
+{
+    PointVector oUnit(0);
+    if( a_uiAxis < 2 )
+    {
+        oUnit[ a_uiAxis ] = (T)1;
+    }
+    return oUnit;
+}
+
 // Origin of the coordinate system
 template< typename T >
-INLINE const PointVector< T >& PointVector< T >::Origin()
+INLINE PointVector< T > PointVector< T >::Origin()
 {
-    static PointVector oOrigin = Zero();
-    return oOrigin;
+    return Zero();
 }
 
 }   // namespace Plane
@@ -69,10 +81,6 @@ INLINE const PointVector< T >& PointVector< T >::Origin()
 namespace Space
 {
 
-// destructor
-template< typename T >
-INLINE PointVector< T >::~PointVector() {}
-
 // Assignment operators that pass to base class
 template< typename T >
 INLINE PointVector< T >& PointVector< T >::operator=( const T& ac_rFill )
@@ -105,12 +113,30 @@ INLINE PointVector< T >& PointVector< T >::
     return *this;
 }
 
+// Zero point
+template< typename T >
+INLINE PointVector< T > PointVector< T >::Zero()
+{
+    return PointVector(0);
+}
+
+// Unit points
+template< typename T >
+INLINE PointVector< T > PointVector< T >::Unit( unsigned int a_uiAxis )
+{
+    PointVector oUnit(0);
+    if( a_uiAxis < 3 )
+    {
+        oUnit[ a_uiAxis ] = (T)1;
+    }
+    return oUnit;
+}
+
 // Origin of the coordinate system
 template< typename T >
-INLINE const PointVector< T >& PointVector< T >::Origin()
+INLINE PointVector< T > PointVector< T >::Origin()
 {
-    static PointVector oOrigin = Zero();
-    return oOrigin;
+    return Zero();
 }
 
 }   // namespace Space
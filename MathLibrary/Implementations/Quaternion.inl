@@ -3,13 +3,15 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 3, 2014
  * Description:        Inline implementations for Quaternion functions.
- * Last Modified:      March 5, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Multiplying a quaternion by itself works.
  ******************************************************************************/
 
 #ifndef QUATERNION__INL
 #define QUATERNION__INL
 
+#include "../Declarations/AffineTransform.h"
+#include "../Declarations/FastFunctions.h"
 #include "../Declarations/Functions.h"
 #include "../Declarations/PointVector.h"
 #include "../Declarations/Quaternion.h"
@@ -20,67 +22,37 @@
 namespace Space
 {
 
+// Cosine of half the angle between two rotations above which Slerp
+// interpolates linearly instead
+const double SLERP_LINEAR_THRESHOLD = 0.9995;
+
 // Constructors
-INLINE Quaternion::Quaternion( const Quaternion& ac_roQuaternion )
-    : BaseType( ac_roQuaternion ),
-      w( m_aaData[0][0] ),
-      x( m_aaData[0][1] ),
-      y( m_aaData[0][2] ),
-      z( m_aaData[0][3] ) {}
 INLINE Quaternion::Quaternion( const BaseType& ac_roVector )
-    : BaseType( ac_roVector ),
-      w( m_aaData[0][0] ),
-      x( m_aaData[0][1] ),
-      y( m_aaData[0][2] ),
-      z( m_aaData[0][3] ) {}
+    : BaseType( ac_roVector ) {}
 INLINE Quaternion::Quaternion( double a_dAngle, const Point3D& ac_roAxis )
-    : w( m_aaData[0][0] ),
-      x( m_aaData[0][1] ),
-      y( m_aaData[0][2] ),
-      z( m_aaData[0][3] )
 {
     Set( a_dAngle, ac_roAxis );
 }
 INLINE Quaternion::Quaternion( const Point3D& ac_roForward,
                                const Point3D& ac_roUp )
-    : w( m_aaData[0][0] ),
-      x( m_aaData[0][1] ),
-      y( m_aaData[0][2] ),
-      z( m_aaData[0][3] )
 {
-    w = 1;
+    w() = 1;
     Set( ac_roForward, ac_roUp );
 }
 INLINE Quaternion::Quaternion( double a_dYaw, double a_dPitch, double a_dRoll )
-    : w( m_aaData[0][0] ),
-      x( m_aaData[0][1] ),
-      y( m_aaData[0][2] ),
-      z( m_aaData[0][3] )
 {
     Set( a_dYaw, a_dPitch, a_dRoll );
 }
 INLINE Quaternion::Quaternion( double a_dW, double a_dX,
                                double a_dY, double a_dZ )
-    : w( m_aaData[0][0] ),
-      x( m_aaData[0][1] ),
-      y( m_aaData[0][2] ),
-      z( m_aaData[0][3] )
 {
-    w = a_dW;
-    x = a_dX;
-    y = a_dY;
-    z = a_dZ;
+    w() = a_dW;
+    x() = a_dX;
+    y() = a_dY;
+    z() = a_dZ;
 }
 
-// Destructor
-INLINE Quaternion::~Quaternion() {}
-
 // Assignment
-INLINE Quaternion& Quaternion::operator=( const Quaternion& ac_roQuaternion )
-{
-    BaseType::operator=( ac_roQuaternion );
-    return *this;
-}
 INLINE Quaternion& Quaternion::operator=( const BaseType& ac_roVector )
 {
     BaseType::operator=( ac_roVector );
@@ -126,14 +98,16 @@ INLINE Quaternion
 }
 INLINE Quaternion& Quaternion::operator*=( const Quaternion& ac_roQuaternion )
 {
-    w = ( w * ac_roQuaternion.w ) - ( x * ac_roQuaternion.x )
-        - ( y * ac_roQuaternion.y ) - ( z * ac_roQuaternion.z );
-    x = ( w * ac_roQuaternion.x ) + ( x * ac_roQuaternion.w )
-        + ( y * ac_roQuaternion.z ) - ( z * ac_roQuaternion.y );
-    y = ( w * ac_roQuaternion.y ) - ( x * ac_roQuaternion.z )
-        + ( y * ac_roQuaternion.w ) + ( z * ac_roQuaternion.x );
-    w = ( w * ac_roQuaternion.z ) + ( x * ac_roQuaternion.y )
-        - ( y * ac_roQuaternion.x ) + ( z * ac_roQuaternion.w );
+    // copy the values of both factors first, since every element of the
+    // product depends on every element of both, and the right factor may be
+    // this quaternion
+    double dW = w(), dX = x(), dY = y(), dZ = z();
+    double dQW = ac_roQuaternion.w(), dQX = ac_roQuaternion.x(),
+           dQY = ac_roQuaternion.y(), dQZ = ac_roQuaternion.z();
+    w() = ( dW * dQW ) - ( dX * dQX ) - ( dY * dQY ) - ( dZ * dQZ );
+    x() = ( dW * dQX ) + ( dX * dQW ) + ( dY * dQZ ) - ( dZ * dQY );
+    y() = ( dW * dQY ) - ( dX * dQZ ) + ( dY * dQW ) + ( dZ * dQX );
+    z() = ( dW * dQZ ) + ( dX * dQY ) - ( dY * dQX ) + ( dZ * dQW );
     return Normalize();
 }
 INLINE Quaternion
@@ -150,11 +124,11 @@ INLINE Quaternion& Quaternion::operator/=( const Quaternion& ac_roQuaternion )
 // Get properties
 INLINE double Quaternion::GetAngle() const
 {
-    return 2 * std::acos( w );
+    return 2 * std::acos( w() );
 }
 INLINE Point3D Quaternion::GetAxis() const
 {
-    return Point3D( x, y, z ).Normalize();
+    return Point3D( x(), y(), z() ).Normalize();
 }
 
 // Conversions from quaternion to Tait-Bryan angles taken from section 3.4.10 of
@@ -162,22 +136,22 @@ INLINE Point3D Quaternion::GetAxis() const
 INLINE double Quaternion::GetYaw() const
 {
     // calculate sine of pitch
-    double dSinP = -2 * ( x*z - w*y );
+    double dSinP = -2 * ( x()*z() - w()*y() );
 
     // singularity at pitch = PI/2
     if( 1.0 <= dSinP )
     {
-        return -std::atan2( x*y - w*z, x*z + w*y );
+        return -std::atan2( x()*y() - w()*z(), x()*z() + w()*y() );
     }
 
     // singularity at pitch = -PI/2
     if( -1.0 >= dSinP )
     {
-        return std::atan2( x*y - w*z, x*z + w*y );
+        return std::atan2( x()*y() - w()*z(), x()*z() + w()*y() );
     }
 
     // non-singularity case
-    return std::atan2( x*y + w*z, 0.5 - ( y*y + z*z ) );
+    return std::atan2( x()*y() + w()*z(), 0.5 - ( y()*y() + z()*z() ) );
 }
 
 // Conversions from quaternion to Tait-Bryan angles taken from section 3.4.10 of
@@ -185,7 +159,7 @@ INLINE double Quaternion::GetYaw() const
 INLINE double Quaternion::GetPitch() const
 {
     // calculate sine of pitch
-    double dSinP = -2 * ( x*z - w*y );
+    double dSinP = -2 * ( x()*z() - w()*y() );
 
     // singularity at pitch = PI/2
     if( 1.0 <= dSinP )
@@ -209,7 +183,7 @@ INLINE double Quaternion::GetRoll() const
 {
     // calculate sine of pitch
     Quaternion oUnit = Normal();
-    double dSinP = -2 * ( x*z - w*y );
+    double dSinP = -2 * ( x()*z() - w()*y() );
 
     // singularity at pitch = +/-PI/2
     if( 1.0 <= dSinP || -1.0 >= dSinP )
@@ -218,7 +192,7 @@ INLINE double Quaternion::GetRoll() const
     }
 
     // non-singularity case
-    return std::atan2( y*z + w*x , 0.5 - ( x*x + y*y ) );
+    return std::atan2( y()*z() + w()*x() , 0.5 - ( x()*x() + y()*y() ) );
 }
 
 // Conversions from quaternion to Tait-Bryan angles taken from section 3.4.10 of
@@ -228,14 +202,14 @@ INLINE void Quaternion::GetTaitBryanAngles( double& a_rdYaw,
                                             double& a_rdRoll ) const
 {
     // calculate sine of pitch
-    long double dSinP = -2 * ( x*z - w*y );
+    long double dSinP = -2 * ( x()*z() - w()*y() );
 
     // singularity at pitch = PI/2
     if( 1.0 <= dSinP )
     {
         a_rdRoll = 0.0;
         a_rdPitch = Math::HALF_PI;
-        a_rdYaw = -std::atan2( x*y - w*z, x*z + w*y );
+        a_rdYaw = -std::atan2( x()*y() - w()*z(), x()*z() + w()*y() );
         return;
     }
 
@@ -244,14 +218,14 @@ INLINE void Quaternion::GetTaitBryanAngles( double& a_rdYaw,
     {
         a_rdRoll = 0.0;
         a_rdPitch = -Math::HALF_PI;
-        a_rdYaw = std::atan2( x*y - w*z, x*z + w*y );
+        a_rdYaw = std::atan2( x()*y() - w()*z(), x()*z() + w()*y() );
         return;
     }
 
     // non-singularity case
-    a_rdRoll = std::atan2( y*z + w*x, 0.5 - ( x*x + y*y ) );
+    a_rdRoll = std::atan2( y()*z() + w()*x(), 0.5 - ( x()*x() + y()*y() ) );
     a_rdPitch = std::asin( dSinP );
-    a_rdYaw = std::atan2( x*y + w*z, 0.5 - ( y*y + z*z ) );
+    a_rdYaw = std::atan2( x()*y() + w()*z(), 0.5 - ( y()*y() + z()*z() ) );
 }
 
 // Set properties
@@ -287,11 +261,11 @@ INLINE Quaternion& Quaternion::Set( double a_dAngle, const Point3D& ac_roAxis )
 {
     double dSin = std::sin( a_dAngle / 2 );
     Point3D oAxis = ac_roAxis.Normal();
-    w = ( 1 == dSin || -1 == dSin ? 0 : std::cos( a_dAngle / 2 ) );
-    dSin = ( 1 == w || -1 == w ? 0 : dSin );
-    x = dSin * oAxis.x;
-    y = dSin * oAxis.y;
-    z = dSin * oAxis.z;
+    w() = ( 1 == dSin || -1 == dSin ? 0 : std::cos( a_dAngle / 2 ) );
+    dSin = ( 1 == w() || -1 == w() ? 0 : dSin );
+    x() = dSin * oAxis.x();
+    y() = dSin * oAxis.y();
+    z() = dSin * oAxis.z();
     return *this;
 }
 INLINE Quaternion& Quaternion::Set( const Point3D& ac_roForward,
@@ -335,7 +309,7 @@ INLINE Quaternion& Quaternion::Set( const Point3D& ac_roForward,
     // Find the axis (in the rotated coordinate system) closest to the up axis
     // on the (rotated) YZ plane
     Point3D oUp = oRotation.Inverse().AppliedTo( ac_roUp );
-    oUp.x = 0;
+    oUp.x() = 0;
 
     // if no vector on the rotated YZ plane is closer to the up vector than any
     // other, use existing roll
@@ -347,7 +321,7 @@ INLINE Quaternion& Quaternion::Set( const Point3D& ac_roForward,
     // Otherwise, calculate the roll neccessary to rotate the already-rotated
     // x-axis into the previously-calculated position
     double dRoll = std::acos( Point3D::Unit(2).Dot( oUp.Normalize() ) ) *
-                   ( oUp.y > 0.0 ? -1 : 1 );
+                   ( oUp.y() > 0.0 ? -1 : 1 );
     return operator=( oRotation.SetRoll( dRoll ) ).Normalize();
 }
 INLINE Quaternion&
@@ -365,10 +339,36 @@ INLINE Quaternion&
     dCosR = ( 1 == dSinR || -1 == dSinR ? 0 : dCosR );
 
     // set elements
-    w = dCosR*dCosP*dCosY - dSinR*dSinP*dSinY;
-    x = dSinR*dCosP*dCosY + dCosR*dSinP*dSinY;
-    y = dCosR*dSinP*dCosY - dSinR*dCosP*dSinY;
-    z = dCosR*dCosP*dSinY + dSinR*dSinP*dCosY;
+    w() = dCosR*dCosP*dCosY - dSinR*dSinP*dSinY;
+    x() = dSinR*dCosP*dCosY + dCosR*dSinP*dSinY;
+    y() = dCosR*dSinP*dCosY - dSinR*dCosP*dSinY;
+    z() = dCosR*dCosP*dSinY + dSinR*dSinP*dCosY;
+    return *this;
+}
+INLINE Quaternion& Quaternion::SetFast( double a_dAngle,
+                                        const Point3D& ac_roAxis )
+{
+    double dSin, dCos;
+    Math::Fast::SinCos( a_dAngle / 2, dSin, dCos );
+    Point3D oAxis( ac_roAxis );
+    oAxis.NormalizeFast();
+    w() = dCos;
+    x() = dSin * oAxis.x();
+    y() = dSin * oAxis.y();
+    z() = dSin * oAxis.z();
+    return *this;
+}
+INLINE Quaternion&
+    Quaternion::SetFast( double a_dYaw, double a_dPitch, double a_dRoll )
+{
+    double dSinY, dCosY, dSinP, dCosP, dSinR, dCosR;
+    Math::Fast::SinCos( a_dYaw / 2, dSinY, dCosY );
+    Math::Fast::SinCos( a_dPitch / 2, dSinP, dCosP );
+    Math::Fast::SinCos( a_dRoll / 2, dSinR, dCosR );
+    w() = dCosR*dCosP*dCosY - dSinR*dSinP*dSinY;
+    x() = dSinR*dCosP*dCosY + dCosR*dSinP*dSinY;
+    y() = dCosR*dSinP*dCosY - dSinR*dCosP*dSinY;
+    z() = dCosR*dCosP*dSinY + dSinR*dSinP*dCosY;
     return *this;
 }
 
@@ -387,10 +387,10 @@ INLINE Point3D& Quaternion::ApplyTo( Point3D& a_roPoint ) const
     }
 
     // Calculate rotated point
-    Point3D oQVector( x, y, z );
+    Point3D oQVector( x(), y(), z() );
     a_roPoint = 2 * oQVector.Dot(a_roPoint) * oQVector
-                + ( w*w - oQVector.MagnitudeSquared() ) * a_roPoint
-                + 2 * w * oQVector.Cross( a_roPoint );
+                + ( w()*w() - oQVector.MagnitudeSquared() ) * a_roPoint
+                + 2 * w() * oQVector.Cross( a_roPoint );
     return a_roPoint;
 }
 
@@ -404,15 +404,15 @@ INLINE Point3D& Quaternion::ApplyTo( Point3D& a_roPoint ) const
 //  or simply multiplying the quaternion by -1.
 INLINE Quaternion Quaternion::Clamped() const
 {
-    if( w < 0.0 )
+    if( w() < 0.0 )
     {
-        return Quaternion( -w, -x, -y, -z );
+        return Quaternion( -w(), -x(), -y(), -z() );
     }
     return *this;
 }
 INLINE Quaternion& Quaternion::Clamp()
 {
-    if( w < 0.0 )
+    if( w() < 0.0 )
     {
         BaseType::operator*=( -1 );
     }
@@ -422,13 +422,13 @@ INLINE Quaternion& Quaternion::Clamp()
 // Inversion
 INLINE Quaternion Quaternion::Inverse() const
 {
-    return Quaternion( w, -x, -y, -z );
+    return Quaternion( w(), -x(), -y(), -z() );
 }
 INLINE Quaternion& Quaternion::Invert()
 {
-    x = -x;
-    y = -y;
-    z = -z;
+    x() = -x();
+    y() = -y();
+    z() = -z();
     return *this;
 }
 
@@ -459,9 +459,32 @@ INLINE Quaternion& Quaternion::Slerp( const Quaternion& ac_roQuaternion,
         return operator=( ac_roQuaternion );
     }
 
-    // Slerp
-    Quaternion oDifference = ( ac_roQuaternion / (*this) ).Clamp();
-    operator=( ( oDifference ^ a_dProgress ) * (*this) );
+    // Q and -Q are the same rotation, so if the target is more than halfway
+    // around the 4D sphere, head for its negation instead
+    const Quaternion& roQ = ac_roQuaternion;
+    double dCos = w()*roQ.w() + x()*roQ.x() + y()*roQ.y() + z()*roQ.z();
+    double dSign = ( dCos < 0.0 ? -1.0 : 1.0 );
+    dCos *= dSign;
+
+    // Weight each end by the sine of the remaining angle, or just linearly if
+    // the angle is too small
+    double dFrom = 1.0 - a_dProgress;
+    double dTo = a_dProgress;
+    if( dCos < SLERP_LINEAR_THRESHOLD )
+    {
+        double dAngle = std::acos( dCos );
+        double dSin = std::sqrt( 1.0 - dCos*dCos );
+        dFrom = std::sin( dFrom * dAngle ) / dSin;
+        dTo = std::sin( dTo * dAngle ) / dSin;
+    }
+    dTo *= dSign;
+
+    // Each element only depends on the same element of each end, so this is
+    // safe even if the target is this quaternion
+    w() = dFrom * w() + dTo * roQ.w();
+    x() = dFrom * x() + dTo * roQ.x();
+    y() = dFrom * y() + dTo * roQ.y();
+    z() = dFrom * z() + dTo * roQ.z();
     return Normalize();
 }
 INLINE Quaternion Quaternion::Slerped( const Quaternion& ac_roQuaternion,
@@ -486,9 +509,12 @@ INLINE Quaternion& Quaternion::Slerp( const Quaternion& ac_roQuaternion,
         return *this;
     }
 
-    // Get the rotation to apply to this one
-    Quaternion oDifference = ( ac_roQuaternion / (*this) ).Clamp();
-    double dRadians = oDifference.GetAngle();
+    // Get the angle of the rotation between this one and the target, the
+    // shorter way around
+    const Quaternion& roQ = ac_roQuaternion;
+    double dCos = std::abs( w()*roQ.w() + x()*roQ.x() +
+                            y()*roQ.y() + z()*roQ.z() );
+    double dRadians = 2 * std::acos( dCos < 1.0 ? dCos : 1.0 );
     double dDistance = a_dRadiansPerSecond * a_dSeconds;
 
     // If clamped (stopping at the target instead of spinning past), check for
@@ -508,7 +534,46 @@ INLINE Quaternion& Quaternion::Slerp( const Quaternion& ac_roQuaternion,
     }
 
     // Slerp
-    operator=( ( oDifference ^ ( dDistance / dRadians ) ) * (*this) );
+    return Slerp( ac_roQuaternion, dDistance / dRadians );
+}
+
+// Polynomial approximation of spherical linear interpolation
+INLINE Quaternion Quaternion::SlerpedFast( const Quaternion& ac_roQuaternion,
+                                           double a_dProgress ) const
+{
+    Quaternion oCopy( *this );
+    return oCopy.SlerpFast( ac_roQuaternion, a_dProgress );
+}
+INLINE Quaternion& Quaternion::SlerpFast( const Quaternion& ac_roQuaternion,
+                                          double a_dProgress )
+{
+    // Same sign handling as Slerp
+    const Quaternion& roQ = ac_roQuaternion;
+    double dCos = w()*roQ.w() + x()*roQ.x() + y()*roQ.y() + z()*roQ.z();
+    double dSign = ( dCos < 0.0 ? -1.0 : 1.0 );
+    double dCosMinusOne = dCos * dSign - 1.0;
+
+    // Evaluate both weights' polynomials from the innermost term out
+    double dFrom = 1.0 - a_dProgress;
+    double dTo = a_dProgress;
+    double dFromSquared = dFrom * dFrom;
+    double dToSquared = dTo * dTo;
+    double dFromFactor = 1.0;
+    double dToFactor = 1.0;
+    for( int i = (int)SLERP_FAST_TERMS - 1; i >= 0; --i )
+    {
+        dFromFactor = 1.0 + ( SLERP_FAST_U[i] * dFromSquared -
+                              SLERP_FAST_V[i] ) * dCosMinusOne * dFromFactor;
+        dToFactor = 1.0 + ( SLERP_FAST_U[i] * dToSquared -
+                            SLERP_FAST_V[i] ) * dCosMinusOne * dToFactor;
+    }
+    dFrom *= dFromFactor;
+    dTo *= dToFactor * dSign;
+
+    w() = dFrom * w() + dTo * roQ.w();
+    x() = dFrom * x() + dTo * roQ.x();
+    y() = dFrom * y() + dTo * roQ.y();
+    z() = dFrom * z() + dTo * roQ.z();
     return Normalize();
 }
 
@@ -521,11 +586,16 @@ INLINE Transform Quaternion::MakeTransform() const
 }
 INLINE void Quaternion::MakeTransform( Transform& a_roTransform ) const
 {
+    double dW = w(), dX = x(), dY = y(), dZ = z();
     double adData[4][4] =
-    { { 1 - 2*( y*y + z*z ), 2*x*y + 2*w*z,       2*x*z - 2*w*y,       0.0 },
-      { 2*x*y - 2*w*z,       1 - 2*( x*x + z*z ), 2*y*z + 2*w*x,       0.0 },
-      { 2*x*z + 2*w*y,       2*y*z - 2*w*x,       1 - 2*( x*x + y*y ), 0.0 },
-      { 0.0,                 0.0,                 0.0,                 1.0 } };
+    { { 1 - 2*( dY*dY + dZ*dZ ), 2*dX*dY + 2*dW*dZ,
+        2*dX*dZ - 2*dW*dY,       0.0 },
+      { 2*dX*dY - 2*dW*dZ,       1 - 2*( dX*dX + dZ*dZ ),
+        2*dY*dZ + 2*dW*dX,       0.0 },
+      { 2*dX*dZ + 2*dW*dY,       2*dY*dZ - 2*dW*dX,
+        1 - 2*( dX*dX + dY*dY ), 0.0 },
+      { 0.0,                     0.0,
+        0.0,                     1.0 } };
     a_roTransform = adData;
 }
 INLINE PointTransform Quaternion::MakePointTransform() const
@@ -536,12 +606,20 @@ INLINE PointTransform Quaternion::MakePointTransform() const
 }
 INLINE void Quaternion::MakePointTransform( PointTransform& a_roTransform ) const
 {
+    double dW = w(), dX = x(), dY = y(), dZ = z();
     double adData[3][3] =
-    { { 1 - 2*( y*y + z*z ), 2*x*y + 2*w*z,       2*x*z - 2*w*y },
-      { 2*x*y - 2*w*z,       1 - 2*( x*x + z*z ), 2*y*z + 2*w*x },
-      { 2*x*z + 2*w*y,       2*y*z - 2*w*x,       1 - 2*( x*x + y*y ) } };
+    { { 1 - 2*( dY*dY + dZ*dZ ), 2*dX*dY + 2*dW*dZ,
+        2*dX*dZ - 2*dW*dY },
+      { 2*dX*dY - 2*dW*dZ,       1 - 2*( dX*dX + dZ*dZ ),
+        2*dY*dZ + 2*dW*dX },
+      { 2*dX*dZ + 2*dW*dY,       2*dY*dZ - 2*dW*dX,
+        1 - 2*( dX*dX + dY*dY ) } };
     a_roTransform = adData;
 }
+INLINE AffineTransform Quaternion::MakeAffineTransform() const
+{
+    return AffineTransform( MakePointTransform() );
+}
 
 //
 // Static functions
@@ -563,6 +641,56 @@ INLINE const Quaternion& Quaternion::None()
     return oNoRotation;
 }
 
+//
+// Composition with scale and translation
+//
+
+INLINE AffineTransform ComposeTRS( const Point& ac_roScale,
+                                   const Quaternion& ac_roRotation,
+                                   const Point& ac_roPosition )
+{
+    AffineTransform oTransform;
+    return ComposeTRS( ac_roScale, ac_roRotation, ac_roPosition, oTransform );
+}
+INLINE AffineTransform& ComposeTRS( const Point& ac_roScale,
+                                    const Quaternion& ac_roRotation,
+                                    const Point& ac_roPosition,
+                                    AffineTransform& a_roTransform )
+{
+    // With row vectors, scaling first just scales each row of the rotation
+    PointTransform oRotation;
+    ac_roRotation.MakePointTransform( oRotation );
+    double adScale[3] = { ac_roScale.x(), ac_roScale.y(), ac_roScale.z() };
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        a_roTransform[i][0] = adScale[i] * oRotation[i][0];
+        a_roTransform[i][1] = adScale[i] * oRotation[i][1];
+        a_roTransform[i][2] = adScale[i] * oRotation[i][2];
+    }
+    return a_roTransform.SetTranslation( ac_roPosition );
+}
+INLINE Transform& ComposeTRS( const Point& ac_roScale,
+                              const Quaternion& ac_roRotation,
+                              const Point& ac_roPosition,
+                              Transform& a_roTransform )
+{
+    PointTransform oRotation;
+    ac_roRotation.MakePointTransform( oRotation );
+    double adScale[3] = { ac_roScale.x(), ac_roScale.y(), ac_roScale.z() };
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        a_roTransform[i][0] = adScale[i] * oRotation[i][0];
+        a_roTransform[i][1] = adScale[i] * oRotation[i][1];
+        a_roTransform[i][2] = adScale[i] * oRotation[i][2];
+        a_roTransform[i][3] = 0.0;
+    }
+    a_roTransform[3][0] = ac_roPosition.x();
+    a_roTransform[3][1] = ac_roPosition.y();
+    a_roTransform[3][2] = ac_roPosition.z();
+    a_roTransform[3][3] = 1.0;
+    return a_roTransform;
+}
+
 }   // namespace Space
 
 #endif  // QUATERNION__INL
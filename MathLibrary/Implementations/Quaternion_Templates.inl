@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 3, 2014
  * Description:        Implementations for templated Quaternion functions.
- * Last Modified:      March 5, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Replaced element reference members with accessors.
  ******************************************************************************/
 
 #ifndef QUATERNION__TEMPLATES__INL
@@ -40,9 +40,9 @@ inline typename std::enable_if< std::is_scalar< T >::value, Quaternion& >::type
     // "Inverse" means rotate in the opposite direction, so just flip the axis
     if( (T)(-1) == ac_rScalar )
     {
-        x = -x;
-        y = -y;
-        z = -z;
+        x() = -x();
+        y() = -y();
+        z() = -z();
         return *this;
     }
     
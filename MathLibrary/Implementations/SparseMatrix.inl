@@ -0,0 +1,512 @@
+/******************************************************************************
+ * File:               SparseMatrix.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Function implementations for SparseMatrix and
+ *                      SparseBuilder.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  OpenMP pragmas only compile with OpenMP on.
+ ******************************************************************************/
+
+#ifndef SPARSE_MATRIX__INL
+#define SPARSE_MATRIX__INL
+
+#include "../Declarations/SparseMatrix.h"
+#include "../Declarations/DenseMatrix.h"
+#include "../Declarations/ElementKernels.h"
+#include <algorithm>    // for lower_bound and stable_sort
+#include <climits>      // for UINT_MAX
+#include <stdexcept>
+
+namespace Math
+{
+
+//
+// SparseBuilder
+//
+
+template< typename T >
+inline SparseBuilder< T >::SparseBuilder( unsigned int a_uiRows,
+                                          unsigned int a_uiColumns,
+                                          unsigned int a_uiCapacity )
+    : m_uiRows( a_uiRows ), m_uiColumns( a_uiColumns )
+{
+    m_oEntries.Reserve( a_uiCapacity );
+}
+
+// Make room for at least the given number of triplets
+template< typename T >
+inline SparseBuilder< T >& SparseBuilder< T >::
+    Reserve( unsigned int a_uiCapacity )
+{
+    m_oEntries.Reserve( a_uiCapacity );
+    return *this;
+}
+
+// Add a triplet - the entry array grows geometrically as it fills up
+template< typename T >
+inline SparseBuilder< T >& SparseBuilder< T >::Add( unsigned int a_uiRow,
+                                                    unsigned int a_uiColumn,
+                                                    const T& ac_rValue )
+{
+    if( a_uiRow >= m_uiRows || a_uiColumn >= m_uiColumns )
+    {
+        throw std::out_of_range( "Cannot access non-existent matrix element" );
+    }
+    m_oEntries.EmplaceBack( a_uiRow, a_uiColumn, ac_rValue );
+    return *this;
+}
+
+// Forget all triplets, keeping the dimensions and the memory
+template< typename T >
+inline SparseBuilder< T >& SparseBuilder< T >::Clear()
+{
+    m_oEntries.Clear();
+    return *this;
+}
+
+// Sort and combine the triplets into a matrix
+template< typename T >
+inline SparseMatrix< T > SparseBuilder< T >::Build() const
+{
+    return SparseMatrix< T >( m_uiRows, m_uiColumns,
+                              m_oEntries.Data(), m_oEntries.Size() );
+}
+
+//
+// SparseMatrix
+//
+
+// Orders the triplets within a row
+template< typename T >
+inline bool SparseColumnLess( const SparseEntry< T >& ac_roLeft,
+                              const SparseEntry< T >& ac_roRight )
+{
+    return ac_roLeft.uiColumn < ac_roRight.uiColumn;
+}
+
+// Empty matrix with no stored elements
+template< typename T >
+inline SparseMatrix< T >::SparseMatrix()
+    : m_uiRows( 0 ), m_uiColumns( 0 ), m_puiRowStart( nullptr ),
+      m_puiColumn( nullptr ), m_pValue( nullptr )
+{
+    Allocate( 0, 0, 0 );
+}
+template< typename T >
+inline SparseMatrix< T >::SparseMatrix( unsigned int a_uiRows,
+                                        unsigned int a_uiColumns )
+    : m_uiRows( 0 ), m_uiColumns( 0 ), m_puiRowStart( nullptr ),
+      m_puiColumn( nullptr ), m_pValue( nullptr )
+{
+    Allocate( a_uiRows, a_uiColumns, 0 );
+}
+
+// Bucket the triplets by row, keeping them in the order they were given, then
+// sort each row by column and add up the triplets that land on the same
+// element.  The stable sort means duplicates are always added in the same
+// order, so the same triplets always build exactly the same matrix.
+template< typename T >
+SparseMatrix< T >::SparseMatrix( unsigned int a_uiRows,
+                                 unsigned int a_uiColumns,
+                                 const SparseEntry< T >* ac_poEntries,
+                                 unsigned int a_uiCount )
+    : m_uiRows( 0 ), m_uiColumns( 0 ), m_puiRowStart( nullptr ),
+      m_puiColumn( nullptr ), m_pValue( nullptr )
+{
+    if( a_uiRows == UINT_MAX )
+    {
+        throw std::length_error( "Matrix dimensions are too large" );
+    }
+    DenseBuffer< unsigned int > oStart( a_uiRows + 1 );
+    unsigned int* puiStart = oStart.Data();
+    for( unsigned int i = 0; i <= a_uiRows; ++i )
+    {
+        puiStart[i] = 0;
+    }
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        if( ac_poEntries[i].uiRow >= a_uiRows ||
+            ac_poEntries[i].uiColumn >= a_uiColumns )
+        {
+            throw std::out_of_range(
+                "Cannot access non-existent matrix element" );
+        }
+        ++puiStart[ ac_poEntries[i].uiRow + 1 ];
+    }
+    for( unsigned int i = 0; i < a_uiRows; ++i )
+    {
+        puiStart[ i + 1 ] += puiStart[i];
+    }
+
+    // Bucket by row.  puiStart[i] ends up where row i + 1 starts, so shift
+    // it back afterward.
+    DenseBuffer< SparseEntry< T > > oSorted( a_uiCount );
+    SparseEntry< T >* poSorted = oSorted.Data();
+    for( unsigned int i = 0; i < a_uiCount; ++i )
+    {
+        poSorted[ puiStart[ ac_poEntries[i].uiRow ]++ ] = ac_poEntries[i];
+    }
+    for( unsigned int i = a_uiRows; i > 0; --i )
+    {
+        puiStart[i] = puiStart[ i - 1 ];
+    }
+    puiStart[0] = 0;
+
+    // Sort each row and combine duplicates in place
+    unsigned int uiCount = 0;
+    for( unsigned int i = 0; i < a_uiRows; ++i )
+    {
+        unsigned int uiBegin = puiStart[i];
+        unsigned int uiEnd = puiStart[ i + 1 ];
+        puiStart[i] = uiCount;
+        std::stable_sort( poSorted + uiBegin, poSorted + uiEnd,
+                          SparseColumnLess< T > );
+        for( unsigned int k = uiBegin; k < uiEnd; ++k )
+        {
+            if( uiCount > puiStart[i] &&
+                poSorted[ uiCount - 1 ].uiColumn == poSorted[k].uiColumn )
+            {
+                poSorted[ uiCount - 1 ].tValue += poSorted[k].tValue;
+            }
+            else
+            {
+                poSorted[ uiCount++ ] = poSorted[k];
+            }
+        }
+    }
+    puiStart[ a_uiRows ] = uiCount;
+
+    Allocate( a_uiRows, a_uiColumns, uiCount );
+    for( unsigned int i = 0; i <= a_uiRows; ++i )
+    {
+        m_puiRowStart[i] = puiStart[i];
+    }
+    for( unsigned int k = 0; k < uiCount; ++k )
+    {
+        m_puiColumn[k] = poSorted[k].uiColumn;
+        m_pValue[k] = poSorted[k].tValue;
+    }
+}
+
+// Store the non-zero elements of a dense matrix
+template< typename T >
+template< unsigned int M, unsigned int N >
+SparseMatrix< T >::SparseMatrix( const Matrix< T, M, N >& ac_roMatrix )
+    : m_uiRows( 0 ), m_uiColumns( 0 ), m_puiRowStart( nullptr ),
+      m_puiColumn( nullptr ), m_pValue( nullptr )
+{
+    const T* pData = ac_roMatrix.Data();
+    unsigned int uiCount = 0;
+    for( unsigned int k = 0; k < M*N; ++k )
+    {
+        uiCount += ( 0 != pData[k] ? 1 : 0 );
+    }
+    Allocate( M, N, uiCount );
+    uiCount = 0;
+    for( unsigned int i = 0; i < M; ++i )
+    {
+        m_puiRowStart[i] = uiCount;
+        for( unsigned int j = 0; j < N; ++j )
+        {
+            if( 0 != pData[ i*N + j ] )
+            {
+                m_puiColumn[ uiCount ] = j;
+                m_pValue[ uiCount++ ] = pData[ i*N + j ];
+            }
+        }
+    }
+    m_puiRowStart[M] = uiCount;
+}
+template< typename T >
+SparseMatrix< T >::SparseMatrix( const DenseMatrix< T >& ac_roMatrix )
+    : m_uiRows( 0 ), m_uiColumns( 0 ), m_puiRowStart( nullptr ),
+      m_puiColumn( nullptr ), m_pValue( nullptr )
+{
+    const unsigned int M = ac_roMatrix.Rows();
+    const unsigned int N = ac_roMatrix.Columns();
+    const T* pData = ac_roMatrix.Data();
+    unsigned int uiCount = 0;
+    for( unsigned int k = 0; k < M*N; ++k )
+    {
+        uiCount += ( 0 != pData[k] ? 1 : 0 );
+    }
+    Allocate( M, N, uiCount );
+    uiCount = 0;
+    for( unsigned int i = 0; i < M; ++i )
+    {
+        m_puiRowStart[i] = uiCount;
+        for( unsigned int j = 0; j < N; ++j )
+        {
+            if( 0 != pData[ i*N + j ] )
+            {
+                m_puiColumn[ uiCount ] = j;
+                m_pValue[ uiCount++ ] = pData[ i*N + j ];
+            }
+        }
+    }
+    m_puiRowStart[M] = uiCount;
+}
+
+// Copy and destroy
+template< typename T >
+inline SparseMatrix< T >::SparseMatrix( const SparseMatrix& ac_roMatrix )
+    : m_uiRows( 0 ), m_uiColumns( 0 ), m_puiRowStart( nullptr ),
+      m_puiColumn( nullptr ), m_pValue( nullptr )
+{
+    operator=( ac_roMatrix );
+}
+template< typename T >
+inline SparseMatrix< T >&
+    SparseMatrix< T >::operator=( const SparseMatrix& ac_roMatrix )
+{
+    if( &ac_roMatrix != this )
+    {
+        Allocate( ac_roMatrix.m_uiRows, ac_roMatrix.m_uiColumns,
+                  ac_roMatrix.NonZeros() );
+        ElementKernels< unsigned int >::Copy( ac_roMatrix.m_puiRowStart,
+                                              m_puiRowStart, m_uiRows + 1 );
+        ElementKernels< unsigned int >::Copy( ac_roMatrix.m_puiColumn,
+                                              m_puiColumn, NonZeros() );
+        ElementKernels< T >::Copy( ac_roMatrix.m_pValue, m_pValue,
+                                   NonZeros() );
+    }
+    return *this;
+}
+template< typename T >
+inline SparseMatrix< T >::~SparseMatrix()
+{
+    Free();
+}
+
+// Element at the given row and column, or 0 if it isn't stored
+template< typename T >
+inline T SparseMatrix< T >::At( unsigned int a_uiRow,
+                                unsigned int a_uiColumn ) const
+{
+    if( a_uiRow >= m_uiRows || a_uiColumn >= m_uiColumns )
+    {
+        throw std::out_of_range( "Cannot access non-existent matrix element" );
+    }
+    const unsigned int* puiBegin = m_puiColumn + m_puiRowStart[ a_uiRow ];
+    const unsigned int* puiEnd = m_puiColumn + m_puiRowStart[ a_uiRow + 1 ];
+    const unsigned int* puiFound = std::lower_bound( puiBegin, puiEnd,
+                                                     a_uiColumn );
+    return ( puiFound != puiEnd && *puiFound == a_uiColumn
+             ? m_pValue[ puiFound - m_puiColumn ] : T( 0 ) );
+}
+
+// Diagonal elements, including zeroes for ones that aren't stored
+template< typename T >
+inline DenseVector< T > SparseMatrix< T >::Diagonal() const
+{
+    DenseVector< T > oDiagonal( m_uiRows < m_uiColumns ? m_uiRows
+                                                        : m_uiColumns );
+    for( unsigned int i = 0; i < oDiagonal.Size(); ++i )
+    {
+        oDiagonal.Data()[i] = At( i, i );
+    }
+    return oDiagonal;
+}
+
+// Count the elements in each column, then copy rows in order so that each
+// transposed row comes out already sorted
+template< typename T >
+SparseMatrix< T > SparseMatrix< T >::Transpose() const
+{
+    SparseMatrix oResult;
+    oResult.Allocate( m_uiColumns, m_uiRows, NonZeros() );
+    unsigned int* puiStart = oResult.m_puiRowStart;
+    for( unsigned int j = 0; j <= m_uiColumns; ++j )
+    {
+        puiStart[j] = 0;
+    }
+    for( unsigned int k = 0; k < NonZeros(); ++k )
+    {
+        ++puiStart[ m_puiColumn[k] + 1 ];
+    }
+    for( unsigned int j = 0; j < m_uiColumns; ++j )
+    {
+        puiStart[ j + 1 ] += puiStart[j];
+    }
+    for( unsigned int i = 0; i < m_uiRows; ++i )
+    {
+        for( unsigned int k = m_puiRowStart[i]; k < m_puiRowStart[ i + 1 ];
+             ++k )
+        {
+            unsigned int uiIndex = puiStart[ m_puiColumn[k] ]++;
+            oResult.m_puiColumn[ uiIndex ] = i;
+            oResult.m_pValue[ uiIndex ] = m_pValue[k];
+        }
+    }
+    for( unsigned int j = m_uiColumns; j > 0; --j )
+    {
+        puiStart[j] = puiStart[ j - 1 ];
+    }
+    puiStart[0] = 0;
+    return oResult;
+}
+
+// All elements, including zeroes
+template< typename T >
+inline DenseMatrix< T > SparseMatrix< T >::ToDense() const
+{
+    DenseMatrix< T > oResult( m_uiRows, m_uiColumns );
+    T* pData = oResult.Data();
+    for( unsigned int i = 0; i < m_uiRows; ++i )
+    {
+        for( unsigned int k = m_puiRowStart[i]; k < m_puiRowStart[ i + 1 ];
+             ++k )
+        {
+            pData[ i * m_uiColumns + m_puiColumn[k] ] = m_pValue[k];
+        }
+    }
+    return oResult;
+}
+
+// Each row is a dot product with the gathered elements of x.  Rows only write
+// their own result element, so threads need no synchronization.
+template< typename T >
+inline void SparseMatrix< T >::Multiply( const T* ac_pVector,
+                                         T* a_pResult ) const
+{
+    const int iRows = (int)m_uiRows;
+    const unsigned int* pcuiStart = m_puiRowStart;
+    const unsigned int* pcuiColumn = m_puiColumn;
+    const T* pcValue = m_pValue;
+#ifdef _OPENMP
+#pragma omp parallel for schedule( dynamic, SPARSE_ROW_CHUNK ) \
+                         if( NonZeros() >= SPARSE_THREAD_WORK )
+#endif
+    for( int i = 0; i < iRows; ++i )
+    {
+        T tSum = 0;
+        for( unsigned int k = pcuiStart[i]; k < pcuiStart[ i + 1 ]; ++k )
+        {
+            tSum += pcValue[k] * ac_pVector[ pcuiColumn[k] ];
+        }
+        a_pResult[i] = tSum;
+    }
+}
+
+// Compute this * x, checking sizes
+template< typename T >
+inline DenseVector< T >
+    SparseMatrix< T >::operator*( const DenseVector< T >& ac_roVector ) const
+{
+    CheckColumns( ac_roVector.Size() );
+    DenseVector< T > oResult( m_uiRows );
+    Multiply( ac_roVector.Data(), oResult.Data() );
+    return oResult;
+}
+template< typename T >
+template< unsigned int N, bool t_bIsRow >
+inline DenseVector< T > SparseMatrix< T >::
+    operator*( const Vector< T, N, t_bIsRow >& ac_roVector ) const
+{
+    CheckColumns( N );
+    DenseVector< T > oResult( m_uiRows );
+    Multiply( ac_roVector.Data(), oResult.Data() );
+    return oResult;
+}
+template< typename T >
+template< unsigned int M, unsigned int N, bool t_bIsRow >
+inline void SparseMatrix< T >::
+    Multiply( const Vector< T, N, t_bIsRow >& ac_roVector,
+              Vector< T, M, t_bIsRow >& a_roResult ) const
+{
+    CheckColumns( N );
+    if( M != m_uiRows )
+    {
+        throw std::invalid_argument(
+            "Cannot multiply matrices with mismatched dimensions" );
+    }
+    if( (const void*)&ac_roVector == (const void*)&a_roResult )
+    {
+        Vector< T, N, t_bIsRow > oCopy( ac_roVector );
+        Multiply( oCopy.Data(), a_roResult.Data() );
+    }
+    else
+    {
+        Multiply( ac_roVector.Data(), a_roResult.Data() );
+    }
+}
+
+// Scalar multiplication and division of the stored elements
+template< typename T >
+template< typename U >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                SparseMatrix< T >& >::type
+    SparseMatrix< T >::operator*=( const U& ac_rScalar )
+{
+    ElementKernels< T >::Multiply( m_pValue, ac_rScalar, m_pValue,
+                                   NonZeros() );
+    return *this;
+}
+template< typename T >
+template< typename U >
+inline typename std::enable_if< std::is_scalar< U >::value,
+                                SparseMatrix< T >& >::type
+    SparseMatrix< T >::operator/=( const U& ac_rScalar )
+{
+    if( ac_rScalar == 0 )
+    {
+        throw std::invalid_argument( "Cannot divide by zero" );
+    }
+    ElementKernels< T >::Divide( m_pValue, ac_rScalar, m_pValue, NonZeros() );
+    return *this;
+}
+
+// Allocate arrays for the given dimensions and number of elements, freeing the
+// old ones only once the new ones exist
+template< typename T >
+void SparseMatrix< T >::Allocate( unsigned int a_uiRows,
+                                  unsigned int a_uiColumns,
+                                  unsigned int a_uiNonZeros )
+{
+    if( a_uiRows == UINT_MAX )
+    {
+        throw std::length_error( "Matrix dimensions are too large" );
+    }
+    DenseBuffer< unsigned int > oRowStart( a_uiRows + 1 );
+    DenseBuffer< unsigned int > oColumn( a_uiNonZeros );
+    T* pValue = DenseBuffer< T >::Allocate( a_uiNonZeros );
+    Free();
+    m_uiRows = a_uiRows;
+    m_uiColumns = a_uiColumns;
+    m_puiRowStart = oRowStart.Release();
+    m_puiColumn = oColumn.Release();
+    m_pValue = pValue;
+    m_puiRowStart[ a_uiRows ] = 0;
+    for( unsigned int i = 0; i < a_uiRows; ++i )
+    {
+        m_puiRowStart[i] = 0;
+    }
+}
+
+// Free arrays
+template< typename T >
+inline void SparseMatrix< T >::Free()
+{
+    DenseBuffer< unsigned int >::Free( m_puiRowStart );
+    DenseBuffer< unsigned int >::Free( m_puiColumn );
+    DenseBuffer< T >::Free( m_pValue );
+    m_puiRowStart = nullptr;
+    m_puiColumn = nullptr;
+    m_pValue = nullptr;
+}
+
+// Throw if the given vector size doesn't match the number of columns
+template< typename T >
+inline void SparseMatrix< T >::CheckColumns( unsigned int a_uiSize ) const
+{
+    if( a_uiSize != m_uiColumns )
+    {
+        throw std::invalid_argument(
+            "Cannot multiply matrices with mismatched dimensions" );
+    }
+}
+
+}   // namespace Math
+
+#endif  // SPARSE_MATRIX__INL
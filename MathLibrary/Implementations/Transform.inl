@@ -4,8 +4,8 @@
  * Date Created:       January 5, 2014
  * Description:        Inline function implementations for Transform.h.
  *                      Remember that this library uses row vectors, not column.
- * Last Modified:      June 26, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Closed-form transform about a point.
  ******************************************************************************/
 
 #ifndef TRANSFORM__INL
@@ -30,7 +30,57 @@ INLINE Transform
     {
         return ac_roTransform;
     }
-    return Translation( -ac_roOrigin ) * ac_roTransform * Translation( ac_roOrigin );
+
+    // Translating by -origin first only changes the last row, and translating
+    // by origin afterwards only adds a multiple of the origin to each row, so
+    // this is much cheaper than two full matrix multiplications.
+    Transform oResult = ac_roTransform;
+    for( unsigned int j = 0; j < 3; ++j )
+    {
+        for( unsigned int i = 0; i < 2; ++i )
+        {
+            oResult[2][j] -= ac_roOrigin[i] * ac_roTransform[i][j];
+        }
+    }
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        for( unsigned int j = 0; j < 2; ++j )
+        {
+            oResult[i][j] += oResult[i][2] * ac_roOrigin[j];
+        }
+    }
+    return oResult;
+}
+
+// Invert a transform that doesn't project
+INLINE bool AffineInverse( const Transform& ac_roTransform,
+                           Transform& a_roInverse )
+{
+    double aadTransform[3][3];
+    double aadInverse[3][3];
+    ac_roTransform.AssignTo( aadTransform );
+    if( !TransformInverse< double, 3 >::Affine( aadTransform, aadInverse ) )
+    {
+        return false;
+    }
+    a_roInverse = aadInverse;
+    return true;
+}
+INLINE Transform AffineInverse( const Transform& ac_roTransform )
+{
+    Transform oInverse;
+    return ( AffineInverse( ac_roTransform, oInverse ) ? oInverse
+                                                       : Transform::Zero() );
+}
+
+// Invert a transform that is only rotation and translation
+INLINE Transform RigidInverse( const Transform& ac_roTransform )
+{
+    double aadTransform[3][3];
+    double aadInverse[3][3];
+    ac_roTransform.AssignTo( aadTransform );
+    TransformInverse< double, 3 >::Rigid( aadTransform, aadInverse );
+    return Transform( aadInverse );
 }
 
 }   // namespace Plane
@@ -47,7 +97,57 @@ INLINE Transform
     {
         return ac_roTransform;
     }
-    return Translation( -ac_roOrigin ) * ac_roTransform * Translation( ac_roOrigin );
+
+    // Translating by -origin first only changes the last row, and translating
+    // by origin afterwards only adds a multiple of the origin to each row, so
+    // this is much cheaper than two full matrix multiplications.
+    Transform oResult = ac_roTransform;
+    for( unsigned int j = 0; j < 4; ++j )
+    {
+        for( unsigned int i = 0; i < 3; ++i )
+        {
+            oResult[3][j] -= ac_roOrigin[i] * ac_roTransform[i][j];
+        }
+    }
+    for( unsigned int i = 0; i < 4; ++i )
+    {
+        for( unsigned int j = 0; j < 3; ++j )
+        {
+            oResult[i][j] += oResult[i][3] * ac_roOrigin[j];
+        }
+    }
+    return oResult;
+}
+
+// Invert a transform that doesn't project
+INLINE bool AffineInverse( const Transform& ac_roTransform,
+                           Transform& a_roInverse )
+{
+    double aadTransform[4][4];
+    double aadInverse[4][4];
+    ac_roTransform.AssignTo( aadTransform );
+    if( !TransformInverse< double, 4 >::Affine( aadTransform, aadInverse ) )
+    {
+        return false;
+    }
+    a_roInverse = aadInverse;
+    return true;
+}
+INLINE Transform AffineInverse( const Transform& ac_roTransform )
+{
+    Transform oInverse;
+    return ( AffineInverse( ac_roTransform, oInverse ) ? oInverse
+                                                       : Transform::Zero() );
+}
+
+// Invert a transform that is only rotation and translation
+INLINE Transform RigidInverse( const Transform& ac_roTransform )
+{
+    double aadTransform[4][4];
+    double aadInverse[4][4];
+    ac_roTransform.AssignTo( aadTransform );
+    TransformInverse< double, 4 >::Rigid( aadTransform, aadInverse );
+    return Transform( aadInverse );
 }
 
 // Perspective project onto plane z = -nearDistance.  Remap coordinates from
@@ -70,9 +170,9 @@ INLINE Transform
     // z'/w' = far*(1 + near/z)/(far - near)
     double dDepth = a_dFarDistance - a_dNearDistance;
     double adProject[4][4] =
-    { { 1.0 / roSize.x, 0.0,            0.0,                        0.0 },
-      { 0.0,            1.0 / roSize.y, 0.0,                        0.0 },
-      { roCenter.x,     roCenter.y,     -a_dFarDistance / dDepth,   -1.0 },
+    { { 1.0 / roSize.x(), 0.0,            0.0,                        0.0 },
+      { 0.0,            1.0 / roSize.y(), 0.0,                        0.0 },
+      { roCenter.x(),     roCenter.y(),     -a_dFarDistance / dDepth,   -1.0 },
       { 0.0,            0.0,        -a_dFarDistance * a_dNearDistance / dDepth,
                                                                     0.0 } };
     return Transform( adProject );
@@ -95,10 +195,10 @@ INLINE Transform
     // z' = z'/w' = (-z - near)/(far - near)
     double dDepth = a_dFarDistance - a_dNearDistance;
     double adProject[4][4] =
-    { { 1.0 / roSize.x, 0.0,            0.0,                        0.0 },
-      { 0.0,            1.0 / roSize.y, 0.0,                        0.0 },
+    { { 1.0 / roSize.x(), 0.0,            0.0,                        0.0 },
+      { 0.0,            1.0 / roSize.y(), 0.0,                        0.0 },
       { 0.0,            0.0,            -1.0 / dDepth,              0.0 },
-      { -roCenter.x,    -roCenter.y,    -a_dNearDistance / dDepth,  1.0 } };
+      { -roCenter.x(),    -roCenter.y(),    -a_dNearDistance / dDepth,  1.0 } };
     return Transform( adProject );
 }
 
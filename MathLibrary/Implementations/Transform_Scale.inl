@@ -4,8 +4,8 @@
  * Date Created:       January 5, 2014
  * Description:        Inline function implementations for making scale
  *                      transformations.
- * Last Modified:      February 10, 2014
- * Last Modification:  Templatizing PointVector.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Build uniform scaling directly.
  ******************************************************************************/
 
 #ifndef TRANSFORM__SCALE__INL
@@ -20,13 +20,15 @@ namespace Plane
 // Scale by a given factor
 INLINE PointTransform PointScaling( double a_dFactor )
 {
-    return PointTransform::Identity() * a_dFactor;
+    double adScale[2][2] = { { a_dFactor, 0.0 }, { 0.0, a_dFactor } };
+    return PointTransform( adScale );
 }
 INLINE Transform Scaling( double a_dFactor, const Point& ac_roOrigin )
 {
-    Transform oScale = PointTransform::Identity() * a_dFactor;
-    oScale[2][2] = 1.0;
-    return TransformationAbout( oScale, ac_roOrigin );
+    double adScale[3][3] = { { a_dFactor, 0.0,       0.0 },
+                             { 0.0,       a_dFactor, 0.0 },
+                             { 0.0,       0.0,       1.0 } };
+    return TransformationAbout( Transform( adScale ), ac_roOrigin );
 }
 
 // Scale by the given factors along each axis
@@ -68,13 +70,18 @@ namespace Space
 // Scale by a given factor
 INLINE PointTransform PointScaling( double a_dFactor )
 {
-    return PointTransform::Identity() * a_dFactor;
+    double adScale[3][3] = { { a_dFactor, 0.0,       0.0 },
+                             { 0.0,       a_dFactor, 0.0 },
+                             { 0.0,       0.0,       a_dFactor } };
+    return PointTransform( adScale );
 }
 INLINE Transform Scaling( double a_dFactor, const Point& ac_roOrigin )
 {
-    Transform oScale = PointScaling( a_dFactor );
-    oScale[3][3] = 1.0;
-    return TransformationAbout( oScale, ac_roOrigin );
+    double adScale[4][4] = { { a_dFactor, 0.0,       0.0,       0.0 },
+                             { 0.0,       a_dFactor, 0.0,       0.0 },
+                             { 0.0,       0.0,       a_dFactor, 0.0 },
+                             { 0.0,       0.0,       0.0,       1.0 } };
+    return TransformationAbout( Transform( adScale ), ac_roOrigin );
 }
 
 // Scale by the given factors along each axis
@@ -5,8 +5,8 @@
  * Description:        Inline function implementations for translation and
  *                      rotation transformations.  Remember that this library
  *                      uses row vectors, not column.
- * Last Modified:      February 10, 2014
- * Last Modification:  Templatizing PointVector.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Point coordinates are now accessor functions.
  ******************************************************************************/
 
 #ifndef TRANSFORM__TRANSLATE_ROTATE__INL
@@ -31,7 +31,7 @@ INLINE Transform Translation( const Point& ac_roTranslation )
     double adTranslate[3][3] =
     { { 1.0,                0.0,                0.0 },
       { 0.0,                1.0,                0.0 },
-      { ac_roTranslation.x, ac_roTranslation.y, 1.0 } };
+      { ac_roTranslation.x(), ac_roTranslation.y(), 1.0 } };
     return Transform( adTranslate );
 }
 INLINE Transform Translation( double a_dTime,
@@ -108,7 +108,7 @@ INLINE Transform Translation( const Point& ac_roTranslation )
     { { 1.0,                0.0,                0.0,                0.0 },
       { 0.0,                1.0,                0.0,                0.0 },
       { 0.0,                0.0,                1.0,                0.0 },
-      { ac_roTranslation.x, ac_roTranslation.y, ac_roTranslation.z, 1.0 } };
+      { ac_roTranslation.x(), ac_roTranslation.y(), ac_roTranslation.z(), 1.0 } };
     return Transform( adTranslate );
 }
 INLINE Transform Translation( double a_dTime,
@@ -136,15 +136,15 @@ INLINE PointTransform
     double dSin = ( -1 == dCos || 1 == dCos ? 0 : std::sin( a_dRadians ) );
     dCos = ( -1 == dSin || 1 == dSin ? 0 : dCos );
     double adRotate[3][3] =
-    { { dCos + ( oN.x * oN.x * ( 1.0 - dCos ) ),
-        ( oN.y * oN.x * ( 1.0 - dCos ) ) + ( oN.z * dSin ),
-        ( oN.z * oN.x * ( 1.0 - dCos ) ) - ( oN.y * dSin ) },
-      { ( oN.x * oN.y * ( 1.0 - dCos ) ) - ( oN.z * dSin ),
-        dCos + ( oN.y * oN.y * ( 1.0 - dCos ) ),
-        ( oN.z * oN.y * ( 1.0 - dCos ) ) + ( oN.x * dSin ) },
-      { ( oN.x * oN.z * ( 1.0 - dCos ) ) + ( oN.y * dSin ),
-        ( oN.y * oN.z * ( 1.0 - dCos ) ) - ( oN.x * dSin ),
-        dCos + ( oN.z * oN.z * ( 1.0 - dCos ) ) } };
+    { { dCos + ( oN.x() * oN.x() * ( 1.0 - dCos ) ),
+        ( oN.y() * oN.x() * ( 1.0 - dCos ) ) + ( oN.z() * dSin ),
+        ( oN.z() * oN.x() * ( 1.0 - dCos ) ) - ( oN.y() * dSin ) },
+      { ( oN.x() * oN.y() * ( 1.0 - dCos ) ) - ( oN.z() * dSin ),
+        dCos + ( oN.y() * oN.y() * ( 1.0 - dCos ) ),
+        ( oN.z() * oN.y() * ( 1.0 - dCos ) ) + ( oN.x() * dSin ) },
+      { ( oN.x() * oN.z() * ( 1.0 - dCos ) ) + ( oN.y() * dSin ),
+        ( oN.y() * oN.z() * ( 1.0 - dCos ) ) - ( oN.x() * dSin ),
+        dCos + ( oN.z() * oN.z() * ( 1.0 - dCos ) ) } };
     return PointTransform( adRotate );
 }
 INLINE PointTransform
@@ -203,17 +203,17 @@ INLINE Transform Rotation( double a_dRadians,
     double dSin = ( -1 == dCos || 1 == dCos ? 0 : std::sin( a_dRadians ) );
     dCos = ( -1 == dSin || 1 == dSin ? 0 : dCos );
     double adRotate[4][4] =
-    { { dCos + ( oN.x * oN.x * ( 1.0 - dCos ) ),
-        ( oN.y * oN.x * ( 1.0 - dCos ) ) + ( oN.z * dSin ),
-        ( oN.z * oN.x * ( 1.0 - dCos ) ) - ( oN.y * dSin ),
+    { { dCos + ( oN.x() * oN.x() * ( 1.0 - dCos ) ),
+        ( oN.y() * oN.x() * ( 1.0 - dCos ) ) + ( oN.z() * dSin ),
+        ( oN.z() * oN.x() * ( 1.0 - dCos ) ) - ( oN.y() * dSin ),
         0.0 },
-      { ( oN.x * oN.y * ( 1.0 - dCos ) ) - ( oN.z * dSin ),
-        dCos + ( oN.y * oN.y * ( 1.0 - dCos ) ),
-        ( oN.z * oN.y * ( 1.0 - dCos ) ) + ( oN.x * dSin ),
+      { ( oN.x() * oN.y() * ( 1.0 - dCos ) ) - ( oN.z() * dSin ),
+        dCos + ( oN.y() * oN.y() * ( 1.0 - dCos ) ),
+        ( oN.z() * oN.y() * ( 1.0 - dCos ) ) + ( oN.x() * dSin ),
         0.0 },
-      { ( oN.x * oN.z * ( 1.0 - dCos ) ) + ( oN.y * dSin ),
-        ( oN.y * oN.z * ( 1.0 - dCos ) ) - ( oN.x * dSin ),
-        dCos + ( oN.z * oN.z * ( 1.0 - dCos ) ),
+      { ( oN.x() * oN.z() * ( 1.0 - dCos ) ) + ( oN.y() * dSin ),
+        ( oN.y() * oN.z() * ( 1.0 - dCos ) ) - ( oN.x() * dSin ),
+        dCos + ( oN.z() * oN.z() * ( 1.0 - dCos ) ),
         0.0 },
       { 0.0, 0.0, 0.0, 1.0 } };
     return TransformationAbout( Transform( adRotate ), ac_roOrigin );
@@ -3,14 +3,15 @@
  * Author:             Elizabeth Lowry
  * Date Created:       November 25, 2013
  * Description:        Inline and other function implementations for Vector.h.
- * Last Modified:      February 12, 2014
- * Last Modification:  Refactoring.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Unit vectors are returned by value.
  ******************************************************************************/
 
 #ifndef VECTOR__INL
 #define VECTOR__INL
 
 #include "../Declarations/Vector.h"
+#include "../Declarations/FastFunctions.h"
 #include "../Declarations/Functions.h"
 #include <cmath>    // for std::sqrt
 
@@ -31,20 +32,14 @@ const Vector< T, N, t_IsRow >& Vector< T, N, t_IsRow >::Zero()
 
 // Unit vector
 template< typename T, unsigned int N, bool t_IsRow >
-const Vector< T, N, t_IsRow >&
-    Vector< T, N, t_IsRow >::Unit( unsigned int a_uiAxis )
+Vector< T, N, t_IsRow > Vector< T, N, t_IsRow >::Unit( unsigned int a_uiAxis )
 {
-    static Vector aoUnits[N];
-    static bool abInitialized = false;
-    if( !abInitialized )
+    Vector oUnit(0);
+    if( a_uiAxis < N )
     {
-        for( unsigned int i = 0; i < N; ++i )
-        {
-            aoUnits[i] = Matrix< T, N >::Identity()[i];
-        }
-        abInitialized = true;
+        oUnit[ a_uiAxis ] = (T)1;
     }
-    return ( a_uiAxis < N ? aoUnits[a_uiAxis] : Zero() );
+    return oUnit;
 }
 
 // Assign to arrays
@@ -241,10 +236,12 @@ inline typename Vector< T, N, t_bIsRow >::TransposeType
 template< typename T, unsigned int N, bool t_bIsRow >
 inline T Vector< T, N, t_bIsRow >::Dot( const Vector& ac_roVector ) const
 {
+    const T* cpData = Data();
+    const T* cpOther = ac_roVector.Data();
     T tResult = 0;
     for( unsigned int i = 0; i < N; ++i )
     {
-        tResult += At(i) * ac_roVector[i];
+        tResult += cpData[i] * cpOther[i];
     }
     return tResult;
 }
@@ -314,10 +311,11 @@ inline typename InverseOf< T >::Type Vector< T, N, t_bIsRow >::Magnitude() const
 template< typename T, unsigned int N, bool t_bIsRow >
 inline T Vector< T, N, t_bIsRow >::MagnitudeSquared() const
 {
+    const T* cpData = Data();
     T result = 0;
     for( unsigned int i = 0; i < N; ++i )
     {
-        result += At(i) * At(i);
+        result += cpData[i] * cpData[i];
     }
     return result;
 }
@@ -325,9 +323,26 @@ template< typename T, unsigned int N, bool t_bIsRow >
 inline Vector< T, N, t_bIsRow >& Vector< T, N, t_bIsRow >::Normalize()
 {
     InverseT magnitude = Magnitude();
+    T* pData = Data();
     for( unsigned int i = 0; i < N; ++i )
     {
-        At(i) = (T)( At(i) / magnitude );
+        pData[i] = (T)( pData[i] / magnitude );
+    }
+    return *this;
+}
+template< typename T, unsigned int N, bool t_bIsRow >
+inline Vector< T, N, t_bIsRow >& Vector< T, N, t_bIsRow >::NormalizeFast()
+{
+    InverseT magnitudeSquared = MagnitudeSquared();
+    if( (InverseT)1.0 == magnitudeSquared )
+    {
+        return *this;
+    }
+    InverseT scale = (InverseT)Fast::Rsqrt( (double)magnitudeSquared );
+    T* pData = Data();
+    for( unsigned int i = 0; i < N; ++i )
+    {
+        pData[i] = (T)( pData[i] * scale );
     }
     return *this;
 }
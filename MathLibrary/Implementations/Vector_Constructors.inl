@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       December 17, 2013
  * Description:        Constructor implementations for Vector.h.
- * Last Modified:      January 5, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Removed destructor so vectors are trivially copyable.
  ******************************************************************************/
 
 #ifndef VECTOR__CONSTRUCTORS__INL
@@ -16,10 +16,6 @@
 namespace Math
 {
 
-// Destructor doesn't need to do anything
-template< typename T, unsigned int N, bool t_bIsRow >
-inline Vector< T, N, t_bIsRow >::~Vector() {}
-
 // Constructors that forward to base class constructors
 // Private so they can only be called by the friend child class
 template< typename T, unsigned int N, bool t_bIsRow >
@@ -92,7 +88,7 @@ inline Vector< T, N, t_bIsRow >& Vector< T, N, t_bIsRow >::
     {
         throw exception("Non-convertable input type");
     } /**/
-    if( ThisIsNot( ac_roVector ) )
+    if( (const void*)this != (const void*)&ac_roVector )
     {
         for( unsigned int i = 0; i < N && i < Q; ++i )
         {
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       December 17, 2013
  * Description:        Arithmatic operator implementations for Vector.h.
- * Last Modified:      February 12, 2014
- * Last Modification:  Refactoring.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Element-wise operators run as flat kernels.
  ******************************************************************************/
 
 #ifndef VECTOR__OPERATORS__INL
@@ -179,37 +179,31 @@ template< typename T, unsigned int N, bool t_bIsRow >
 inline Vector< T, N, t_bIsRow >&
     Vector< T, N, t_bIsRow >::operator+=( const Vector& ac_roVector )
 {
-    for( unsigned int i = 0; i < N; ++i )
-    {
-        At(i) += ac_roVector[i];
-    }
+    ElementKernels< T >::Add( Data(), ac_roVector.Data(), Data(), N );
     return *this;
 }
 template< typename T, unsigned int N, bool t_bIsRow >
 inline Vector< T, N, t_bIsRow >&
     Vector< T, N, t_bIsRow >::operator+=( const TransposeType& ac_roVector )
 {
-    for( unsigned int i = 0; i < N; ++i )
-    {
-        At(i) += ac_roVector[i];
-    }
+    ElementKernels< T >::Add( Data(), ac_roVector.Data(), Data(), N );
     return *this;
 }
 template< typename T, unsigned int N, bool t_bIsRow >
 inline Vector< T, N, t_bIsRow >
     Vector< T, N, t_bIsRow >::operator+( const Vector& ac_roVector ) const
 {
-    Vector oCopy(*this);
-    oCopy += ac_roVector;
-    return oCopy;
+    Vector oResult;
+    ElementKernels< T >::Add( Data(), ac_roVector.Data(), oResult.Data(), N );
+    return oResult;
 }
 template< typename T, unsigned int N, bool t_bIsRow >
 inline Vector< T, N, t_bIsRow > Vector< T, N, t_bIsRow >::
     operator+( const TransposeType& ac_roVector ) const
 {
-    Vector oCopy(*this);
-    oCopy += ac_roVector;
-    return oCopy;
+    Vector oResult;
+    ElementKernels< T >::Add( Data(), ac_roVector.Data(), oResult.Data(), N );
+    return oResult;
 }
 
 // Vector subtraction
@@ -217,37 +211,33 @@ template< typename T, unsigned int N, bool t_bIsRow >
 inline Vector< T, N, t_bIsRow >&
     Vector< T, N, t_bIsRow >::operator-=( const Vector& ac_roVector )
 {
-    for( unsigned int i = 0; i < N; ++i )
-    {
-        At(i) -= ac_roVector[i];
-    }
+    ElementKernels< T >::Subtract( Data(), ac_roVector.Data(), Data(), N );
     return *this;
 }
 template< typename T, unsigned int N, bool t_bIsRow >
 inline Vector< T, N, t_bIsRow >&
     Vector< T, N, t_bIsRow >::operator-=( const TransposeType& ac_roVector )
 {
-    for( unsigned int i = 0; i < N; ++i )
-    {
-        At(i) -= ac_roVector[i];
-    }
+    ElementKernels< T >::Subtract( Data(), ac_roVector.Data(), Data(), N );
     return *this;
 }
 template< typename T, unsigned int N, bool t_bIsRow >
 inline Vector< T, N, t_bIsRow >
     Vector< T, N, t_bIsRow >::operator-( const Vector& ac_roVector ) const
 {
-    Vector oCopy(*this);
-    oCopy -= ac_roVector;
-    return oCopy;
+    Vector oResult;
+    ElementKernels< T >::Subtract( Data(), ac_roVector.Data(), oResult.Data(),
+                                   N );
+    return oResult;
 }
 template< typename T, unsigned int N, bool t_bIsRow >
 inline Vector< T, N, t_bIsRow > Vector< T, N, t_bIsRow >::
     operator-( const TransposeType& ac_roVector ) const
 {
-    Vector oCopy(*this);
-    oCopy -= ac_roVector;
-    return oCopy;
+    Vector oResult;
+    ElementKernels< T >::Subtract( Data(), ac_roVector.Data(), oResult.Data(),
+                                   N );
+    return oResult;
 }
 
 }   // namespace Math
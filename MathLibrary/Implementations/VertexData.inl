@@ -0,0 +1,478 @@
+/******************************************************************************
+ * File:               VertexData.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Array versions of the packed element conversions.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef VERTEX_DATA__INL
+#define VERTEX_DATA__INL
+
+#include "../Declarations/VertexData.h"
+#include "../Declarations/ImExportMacro.h"
+#include "../Declarations/MatrixProduct.h"
+#include "../Declarations/SimdRegister.h"
+#include <type_traits>  // for is_same
+
+namespace Math
+{
+
+#ifdef SIMD_REGISTER_SSE2
+
+// Conversions between four floats or doubles and four 32-bit integer lanes
+// holding packed element values, doing the same steps as PackedElement.
+// These stay with SSE2 even when AVX is available, since AVX has no 256-bit
+// integer instructions.
+template< typename T >
+struct PackedLanes;
+
+// Half-float bits, sign-extended so that they pack without saturating
+template<>
+struct PackedLanes< Half >
+{
+    static __m128i Encode( const __m128& ac_roValues )
+    {
+        const __m128i coBits = _mm_castps_si128( ac_roValues );
+        const __m128i coSign =
+            _mm_and_si128( coBits, _mm_set1_epi32( (int)HALF_SIGN_MASK ) );
+        const __m128i coMagnitude = _mm_xor_si128( coBits, coSign );
+
+        // Infinity or NaN
+        __m128i oLarge = _mm_or_si128(
+            _mm_set1_epi32( HALF_INFINITY ),
+            _mm_and_si128( _mm_cmpgt_epi32(
+                               coMagnitude,
+                               _mm_set1_epi32( HALF_FLOAT_INFINITY ) ),
+                           _mm_set1_epi32( HALF_NAN ^ HALF_INFINITY ) ) );
+
+        // Denormal
+        const __m128i coMagic = _mm_set1_epi32( HALF_DENORMAL_MAGIC );
+        __m128i oSmall = _mm_sub_epi32(
+            _mm_castps_si128( _mm_add_ps( _mm_castsi128_ps( coMagnitude ),
+                                          _mm_castsi128_ps( coMagic ) ) ),
+            coMagic );
+
+        // Normal
+        __m128i oOdd = _mm_and_si128( _mm_srli_epi32( coMagnitude, 13 ),
+                                      _mm_set1_epi32( 1 ) );
+        __m128i oResult = _mm_srli_epi32(
+            _mm_add_epi32( _mm_add_epi32( coMagnitude, _mm_set1_epi32(
+                                              (int)HALF_REBIAS ) ),
+                           oOdd ), 13 );
+
+        __m128i oMask = _mm_cmplt_epi32(
+            coMagnitude, _mm_set1_epi32( HALF_NORMAL_MINIMUM ) );
+        oResult = _mm_or_si128( _mm_and_si128( oMask, oSmall ),
+                                _mm_andnot_si128( oMask, oResult ) );
+        oMask = _mm_cmpgt_epi32( coMagnitude,
+                                 _mm_set1_epi32( HALF_OVERFLOW - 1 ) );
+        oResult = _mm_or_si128( _mm_and_si128( oMask, oLarge ),
+                                _mm_andnot_si128( oMask, oResult ) );
+        return _mm_or_si128( oResult, _mm_srai_epi32( coSign, 16 ) );
+    }
+
+    // Round to odd, as RoundToOddFloat does, and then to half
+    static __m128i Encode( const __m128d& ac_roLow, const __m128d& ac_roHigh )
+    {
+        const __m128d coSign = _mm_set1_pd( -0.0 );
+        __m128 oFloats = _mm_movelh_ps( _mm_cvtpd_ps( ac_roLow ),
+                                        _mm_cvtpd_ps( ac_roHigh ) );
+        __m128d oLow = _mm_cvtps_pd( oFloats );
+        __m128d oHigh = _mm_cvtps_pd( _mm_movehl_ps( oFloats, oFloats ) );
+        __m128 oInexact = _mm_shuffle_ps(
+            _mm_castpd_ps( _mm_and_pd( _mm_cmpneq_pd( oLow, ac_roLow ),
+                                       _mm_cmpord_pd( ac_roLow, ac_roLow ) ) ),
+            _mm_castpd_ps( _mm_and_pd( _mm_cmpneq_pd( oHigh, ac_roHigh ),
+                                       _mm_cmpord_pd( ac_roHigh,
+                                                      ac_roHigh ) ) ),
+            _MM_SHUFFLE( 2, 0, 2, 0 ) );
+        __m128 oRoundedUp = _mm_shuffle_ps(
+            _mm_castpd_ps( _mm_cmpgt_pd( _mm_andnot_pd( coSign, oLow ),
+                                         _mm_andnot_pd( coSign,
+                                                        ac_roLow ) ) ),
+            _mm_castpd_ps( _mm_cmpgt_pd( _mm_andnot_pd( coSign, oHigh ),
+                                         _mm_andnot_pd( coSign,
+                                                        ac_roHigh ) ) ),
+            _MM_SHUFFLE( 2, 0, 2, 0 ) );
+        __m128i oBits = _mm_add_epi32( _mm_castps_si128( oFloats ),
+                                       _mm_castps_si128( oRoundedUp ) );
+        oBits = _mm_or_si128( oBits,
+                              _mm_and_si128( _mm_castps_si128( oInexact ),
+                                             _mm_set1_epi32( 1 ) ) );
+        return Encode( _mm_castsi128_ps( oBits ) );
+    }
+
+    static __m128 Decode( const __m128i& ac_roValues )
+    {
+        const __m128i coExponentMask = _mm_set1_epi32( HALF_EXPONENT_MASK );
+        const __m128i coAdjust = _mm_set1_epi32( HALF_EXPONENT_ADJUST );
+        __m128i oBits = _mm_slli_epi32(
+            _mm_and_si128( ac_roValues, _mm_set1_epi32( 0x7FFF ) ), 13 );
+        const __m128i coExponent = _mm_and_si128( oBits, coExponentMask );
+        oBits = _mm_add_epi32( oBits, coAdjust );
+
+        // Infinity or NaN
+        oBits = _mm_add_epi32( oBits, _mm_and_si128(
+            _mm_cmpeq_epi32( coExponent, coExponentMask ), coAdjust ) );
+
+        // Denormal
+        __m128i oSmall = _mm_castps_si128( _mm_sub_ps(
+            _mm_castsi128_ps( _mm_add_epi32( oBits,
+                                             _mm_set1_epi32( 1 << 23 ) ) ),
+            _mm_castsi128_ps( _mm_set1_epi32( HALF_NORMAL_MINIMUM ) ) ) );
+        __m128i oMask = _mm_cmpeq_epi32( coExponent, _mm_setzero_si128() );
+        oBits = _mm_or_si128( _mm_and_si128( oMask, oSmall ),
+                              _mm_andnot_si128( oMask, oBits ) );
+
+        return _mm_castsi128_ps( _mm_or_si128( oBits, _mm_slli_epi32(
+            _mm_and_si128( ac_roValues, _mm_set1_epi32( 0x8000 ) ), 16 ) ) );
+    }
+
+    // Conversion to double is exact either way
+    static __m128d DecodeLow( const __m128i& ac_roValues )
+    {
+        return _mm_cvtps_pd( Decode( ac_roValues ) );
+    }
+    static __m128d DecodeHigh( const __m128i& ac_roValues )
+    {
+        __m128 oFloats = Decode( ac_roValues );
+        return _mm_cvtps_pd( _mm_movehl_ps( oFloats, oFloats ) );
+    }
+};
+
+// Normalized integers
+template< typename T, int t_iMax, bool t_bIsSigned >
+struct NormalizedLanes
+{
+    static __m128i Encode( const __m128& ac_roValues )
+    {
+        const __m128 coSignMask = _mm_set1_ps( -0.0f );
+        __m128 oScaled = _mm_and_ps( ac_roValues,
+                                     _mm_cmpord_ps( ac_roValues,
+                                                    ac_roValues ) );
+        oScaled = _mm_mul_ps(
+            _mm_min_ps( _mm_max_ps( oScaled,
+                                    _mm_set1_ps( t_bIsSigned ? -1.0f
+                                                             : 0.0f ) ),
+                        _mm_set1_ps( 1.0f ) ),
+            _mm_set1_ps( (float)t_iMax ) );
+        const __m128 coSign = _mm_and_ps( oScaled, coSignMask );
+        oScaled = _mm_xor_ps( oScaled, coSign );
+        __m128i oResult = _mm_cvttps_epi32( oScaled );
+        oResult = _mm_sub_epi32( oResult, _mm_castps_si128( _mm_cmpge_ps(
+            _mm_sub_ps( oScaled, _mm_cvtepi32_ps( oResult ) ),
+            _mm_set1_ps( 0.5f ) ) ) );
+        const __m128i coNegative =
+            _mm_srai_epi32( _mm_castps_si128( coSign ), 31 );
+        return _mm_sub_epi32( _mm_xor_si128( oResult, coNegative ),
+                              coNegative );
+    }
+
+    // Rounded in double precision, leaving whole numbers that convert exactly
+    static __m128i Encode( const __m128d& ac_roLow, const __m128d& ac_roHigh )
+    {
+        return _mm_unpacklo_epi64( Encode( ac_roLow ), Encode( ac_roHigh ) );
+    }
+    static __m128i Encode( const __m128d& ac_roValues )
+    {
+        const __m128d coSignMask = _mm_set1_pd( -0.0 );
+        __m128d oScaled = _mm_and_pd( ac_roValues,
+                                      _mm_cmpord_pd( ac_roValues,
+                                                     ac_roValues ) );
+        oScaled = _mm_mul_pd(
+            _mm_min_pd( _mm_max_pd( oScaled,
+                                    _mm_set1_pd( t_bIsSigned ? -1.0 : 0.0 ) ),
+                        _mm_set1_pd( 1.0 ) ),
+            _mm_set1_pd( (double)t_iMax ) );
+        const __m128d coSign = _mm_and_pd( oScaled, coSignMask );
+        oScaled = _mm_xor_pd( oScaled, coSign );
+        __m128d oWhole = _mm_cvtepi32_pd( _mm_cvttpd_epi32( oScaled ) );
+        oWhole = _mm_add_pd( oWhole, _mm_and_pd(
+            _mm_cmpge_pd( _mm_sub_pd( oScaled, oWhole ), _mm_set1_pd( 0.5 ) ),
+            _mm_set1_pd( 1.0 ) ) );
+        return _mm_cvttpd_epi32( _mm_xor_pd( oWhole, coSign ) );
+    }
+
+    static __m128 Decode( const __m128i& ac_roValues )
+    {
+        __m128 oResult = _mm_div_ps( _mm_cvtepi32_ps( ac_roValues ),
+                                     _mm_set1_ps( (float)t_iMax ) );
+        return ( t_bIsSigned ? _mm_max_ps( oResult, _mm_set1_ps( -1.0f ) )
+                             : oResult );
+    }
+    static __m128d DecodeLow( const __m128i& ac_roValues )
+    {
+        __m128d oResult = _mm_div_pd( _mm_cvtepi32_pd( ac_roValues ),
+                                      _mm_set1_pd( (double)t_iMax ) );
+        return ( t_bIsSigned ? _mm_max_pd( oResult, _mm_set1_pd( -1.0 ) )
+                             : oResult );
+    }
+    static __m128d DecodeHigh( const __m128i& ac_roValues )
+    {
+        return DecodeLow( _mm_shuffle_epi32( ac_roValues,
+                                             _MM_SHUFFLE( 3, 2, 3, 2 ) ) );
+    }
+};
+template<>
+struct PackedLanes< uint8_t >
+    : public NormalizedLanes< uint8_t, 0xFF, false > {};
+template<>
+struct PackedLanes< uint16_t >
+    : public NormalizedLanes< uint16_t, 0xFFFF, false > {};
+template<>
+struct PackedLanes< int16_t >
+    : public NormalizedLanes< int16_t, 0x7FFF, true > {};
+
+// Move eight packed elements to and from two registers of 32-bit lanes
+template< typename T >
+struct PackedStorage
+{
+    // 16-bit elements, zero- or sign-extended.  Unsigned values above 0x7FFF
+    // are offset to pack without saturating.
+    static void Store( T* a_ptOut, const __m128i& ac_roLow,
+                       const __m128i& ac_roHigh )
+    {
+        __m128i oPacked;
+        if( std::is_same< T, uint16_t >::value )
+        {
+            const __m128i coOffset = _mm_set1_epi32( 0x8000 );
+            oPacked = _mm_xor_si128(
+                _mm_packs_epi32( _mm_sub_epi32( ac_roLow, coOffset ),
+                                 _mm_sub_epi32( ac_roHigh, coOffset ) ),
+                _mm_set1_epi16( (short)0x8000 ) );
+        }
+        else
+        {
+            oPacked = _mm_packs_epi32( ac_roLow, ac_roHigh );
+        }
+        _mm_storeu_si128( reinterpret_cast< __m128i* >( a_ptOut ), oPacked );
+    }
+    static void Load( const T* ac_ptIn, __m128i& a_roLow, __m128i& a_roHigh )
+    {
+        __m128i oPacked =
+            _mm_loadu_si128( reinterpret_cast< const __m128i* >( ac_ptIn ) );
+        if( std::is_same< T, int16_t >::value )
+        {
+            a_roLow = _mm_srai_epi32( _mm_unpacklo_epi16( oPacked, oPacked ),
+                                      16 );
+            a_roHigh = _mm_srai_epi32( _mm_unpackhi_epi16( oPacked, oPacked ),
+                                       16 );
+        }
+        else
+        {
+            a_roLow = _mm_unpacklo_epi16( oPacked, _mm_setzero_si128() );
+            a_roHigh = _mm_unpackhi_epi16( oPacked, _mm_setzero_si128() );
+        }
+    }
+};
+template<>
+struct PackedStorage< uint8_t >
+{
+    static void Store( uint8_t* a_pucOut, const __m128i& ac_roLow,
+                       const __m128i& ac_roHigh )
+    {
+        __m128i oPacked = _mm_packs_epi32( ac_roLow, ac_roHigh );
+        _mm_storel_epi64( reinterpret_cast< __m128i* >( a_pucOut ),
+                          _mm_packus_epi16( oPacked, oPacked ) );
+    }
+    static void Load( const uint8_t* ac_pucIn, __m128i& a_roLow,
+                      __m128i& a_roHigh )
+    {
+        const __m128i coZero = _mm_setzero_si128();
+        __m128i oPacked = _mm_unpacklo_epi8( _mm_loadl_epi64(
+            reinterpret_cast< const __m128i* >( ac_pucIn ) ), coZero );
+        a_roLow = _mm_unpacklo_epi16( oPacked, coZero );
+        a_roHigh = _mm_unpackhi_epi16( oPacked, coZero );
+    }
+};
+
+#endif  // SIMD_REGISTER_SSE2
+
+// Pack and unpack eight elements at a time with SSE2 and finish one at a time
+template< typename T >
+inline void PackArray( const float* ac_pfIn, T* a_ptOut,
+                       unsigned int a_uiCount )
+{
+    unsigned int uiDone = 0;
+#ifdef SIMD_REGISTER_SSE2
+    if( SIMD_SSE2 <= DetectedSimdLevel() )
+    {
+        uiDone = a_uiCount - a_uiCount % 8;
+        for( unsigned int i = 0; i < uiDone; i += 8 )
+        {
+            PackedStorage< T >::Store(
+                a_ptOut + i,
+                PackedLanes< T >::Encode( _mm_loadu_ps( ac_pfIn + i ) ),
+                PackedLanes< T >::Encode( _mm_loadu_ps( ac_pfIn + i + 4 ) ) );
+        }
+    }
+#endif
+    for( unsigned int i = uiDone; i < a_uiCount; ++i )
+    {
+        a_ptOut[i] = PackedElement< T >::Encode( ac_pfIn[i] );
+    }
+}
+template< typename T >
+inline void PackArray( const double* ac_pdIn, T* a_ptOut,
+                       unsigned int a_uiCount )
+{
+    unsigned int uiDone = 0;
+#ifdef SIMD_REGISTER_SSE2
+    if( SIMD_SSE2 <= DetectedSimdLevel() )
+    {
+        uiDone = a_uiCount - a_uiCount % 8;
+        for( unsigned int i = 0; i < uiDone; i += 8 )
+        {
+            const double* cpIn = ac_pdIn + i;
+            PackedStorage< T >::Store(
+                a_ptOut + i,
+                PackedLanes< T >::Encode( _mm_loadu_pd( cpIn ),
+                                          _mm_loadu_pd( cpIn + 2 ) ),
+                PackedLanes< T >::Encode( _mm_loadu_pd( cpIn + 4 ),
+                                          _mm_loadu_pd( cpIn + 6 ) ) );
+        }
+    }
+#endif
+    for( unsigned int i = uiDone; i < a_uiCount; ++i )
+    {
+        a_ptOut[i] = PackedElement< T >::Encode( ac_pdIn[i] );
+    }
+}
+template< typename T >
+inline void UnpackArray( const T* ac_ptIn, float* a_pfOut,
+                         unsigned int a_uiCount )
+{
+    unsigned int uiDone = 0;
+#ifdef SIMD_REGISTER_SSE2
+    if( SIMD_SSE2 <= DetectedSimdLevel() )
+    {
+        uiDone = a_uiCount - a_uiCount % 8;
+        __m128i oLow, oHigh;
+        for( unsigned int i = 0; i < uiDone; i += 8 )
+        {
+            PackedStorage< T >::Load( ac_ptIn + i, oLow, oHigh );
+            _mm_storeu_ps( a_pfOut + i, PackedLanes< T >::Decode( oLow ) );
+            _mm_storeu_ps( a_pfOut + i + 4,
+                           PackedLanes< T >::Decode( oHigh ) );
+        }
+    }
+#endif
+    for( unsigned int i = uiDone; i < a_uiCount; ++i )
+    {
+        a_pfOut[i] = PackedElement< T >::Decode( ac_ptIn[i] );
+    }
+}
+template< typename T >
+inline void UnpackArray( const T* ac_ptIn, double* a_pdOut,
+                         unsigned int a_uiCount )
+{
+    unsigned int uiDone = 0;
+#ifdef SIMD_REGISTER_SSE2
+    if( SIMD_SSE2 <= DetectedSimdLevel() )
+    {
+        typedef PackedLanes< T > Lanes;
+        uiDone = a_uiCount - a_uiCount % 8;
+        __m128i oLow, oHigh;
+        for( unsigned int i = 0; i < uiDone; i += 8 )
+        {
+            double* pOut = a_pdOut + i;
+            PackedStorage< T >::Load( ac_ptIn + i, oLow, oHigh );
+            _mm_storeu_pd( pOut, Lanes::DecodeLow( oLow ) );
+            _mm_storeu_pd( pOut + 2, Lanes::DecodeHigh( oLow ) );
+            _mm_storeu_pd( pOut + 4, Lanes::DecodeLow( oHigh ) );
+            _mm_storeu_pd( pOut + 6, Lanes::DecodeHigh( oHigh ) );
+        }
+    }
+#endif
+    for( unsigned int i = uiDone; i < a_uiCount; ++i )
+    {
+        a_pdOut[i] = PackedElement< T >::DecodeDouble( ac_ptIn[i] );
+    }
+}
+
+// Pack and unpack whole arrays of elements
+INLINE void Pack( const float* ac_pfIn, Half* a_poOut, unsigned int a_uiCount )
+{
+    PackArray( ac_pfIn, a_poOut, a_uiCount );
+}
+INLINE void Pack( const double* ac_pdIn, Half* a_poOut,
+                  unsigned int a_uiCount )
+{
+    PackArray( ac_pdIn, a_poOut, a_uiCount );
+}
+INLINE void Pack( const float* ac_pfIn, uint8_t* a_pucOut,
+                  unsigned int a_uiCount )
+{
+    PackArray( ac_pfIn, a_pucOut, a_uiCount );
+}
+INLINE void Pack( const double* ac_pdIn, uint8_t* a_pucOut,
+                  unsigned int a_uiCount )
+{
+    PackArray( ac_pdIn, a_pucOut, a_uiCount );
+}
+INLINE void Pack( const float* ac_pfIn, uint16_t* a_pusOut,
+                  unsigned int a_uiCount )
+{
+    PackArray( ac_pfIn, a_pusOut, a_uiCount );
+}
+INLINE void Pack( const double* ac_pdIn, uint16_t* a_pusOut,
+                  unsigned int a_uiCount )
+{
+    PackArray( ac_pdIn, a_pusOut, a_uiCount );
+}
+INLINE void Pack( const float* ac_pfIn, int16_t* a_psOut,
+                  unsigned int a_uiCount )
+{
+    PackArray( ac_pfIn, a_psOut, a_uiCount );
+}
+INLINE void Pack( const double* ac_pdIn, int16_t* a_psOut,
+                  unsigned int a_uiCount )
+{
+    PackArray( ac_pdIn, a_psOut, a_uiCount );
+}
+INLINE void Unpack( const Half* ac_poIn, float* a_pfOut,
+                    unsigned int a_uiCount )
+{
+    UnpackArray( ac_poIn, a_pfOut, a_uiCount );
+}
+INLINE void Unpack( const Half* ac_poIn, double* a_pdOut,
+                    unsigned int a_uiCount )
+{
+    UnpackArray( ac_poIn, a_pdOut, a_uiCount );
+}
+INLINE void Unpack( const uint8_t* ac_pucIn, float* a_pfOut,
+                    unsigned int a_uiCount )
+{
+    UnpackArray( ac_pucIn, a_pfOut, a_uiCount );
+}
+INLINE void Unpack( const uint8_t* ac_pucIn, double* a_pdOut,
+                    unsigned int a_uiCount )
+{
+    UnpackArray( ac_pucIn, a_pdOut, a_uiCount );
+}
+INLINE void Unpack( const uint16_t* ac_pusIn, float* a_pfOut,
+                    unsigned int a_uiCount )
+{
+    UnpackArray( ac_pusIn, a_pfOut, a_uiCount );
+}
+INLINE void Unpack( const uint16_t* ac_pusIn, double* a_pdOut,
+                    unsigned int a_uiCount )
+{
+    UnpackArray( ac_pusIn, a_pdOut, a_uiCount );
+}
+INLINE void Unpack( const int16_t* ac_psIn, float* a_pfOut,
+                    unsigned int a_uiCount )
+{
+    UnpackArray( ac_psIn, a_pfOut, a_uiCount );
+}
+INLINE void Unpack( const int16_t* ac_psIn, double* a_pdOut,
+                    unsigned int a_uiCount )
+{
+    UnpackArray( ac_psIn, a_pdOut, a_uiCount );
+}
+
+}   // namespace Math
+
+#endif  // VERTEX_DATA__INL
@@ -0,0 +1,325 @@
+/******************************************************************************
+ * File:               VertexData_Templates.inl
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Half-float conversions, packed element conversions, and
+ *                      PackedVector functions.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef VERTEX_DATA__TEMPLATES__INL
+#define VERTEX_DATA__TEMPLATES__INL
+
+#include "../Declarations/VertexData.h"
+#include <cmath>    // for abs
+#include <cstring>  // for memcpy
+#include <stdexcept>
+
+namespace Math
+{
+
+// Bit patterns used by the half-float conversions, which work on the bits of
+// single-precision floats.  The array versions do the same steps four floats
+// at a time.
+const uint32_t HALF_SIGN_MASK = 0x80000000;
+const uint32_t HALF_FLOAT_INFINITY = 0x7F800000;    // 255 << 23
+const uint32_t HALF_OVERFLOW = 0x47800000;          // 2^16 as a float
+const uint32_t HALF_NORMAL_MINIMUM = 0x38800000;    // 2^-14 as a float
+const uint32_t HALF_DENORMAL_MAGIC = 0x3F000000;    // 0.5f
+const uint32_t HALF_REBIAS = 0xC8000FFF;   // ( 15 - 127 ) << 23, plus 0xFFF
+const uint32_t HALF_EXPONENT_MASK = 0x0F800000;     // 0x7C00 << 13
+const uint32_t HALF_EXPONENT_ADJUST = 0x38000000;   // ( 127 - 15 ) << 23
+const uint16_t HALF_INFINITY = 0x7C00;
+const uint16_t HALF_NAN = 0x7E00;
+
+inline uint32_t FloatBits( float a_fValue )
+{
+    uint32_t uiBits;
+    std::memcpy( &uiBits, &a_fValue, sizeof( float ) );
+    return uiBits;
+}
+inline float FloatFromBits( uint32_t a_uiBits )
+{
+    float fValue;
+    std::memcpy( &fValue, &a_uiBits, sizeof( float ) );
+    return fValue;
+}
+
+// Round a float to the nearest half, ties to even.  Denormal halves come from
+// adding 0.5, which leaves the half's bits at the bottom of the float's
+// mantissa with the processor doing the rounding.  Normal halves are rebiased
+// with a rounding constant that carries into the exponent if need be.
+inline Half::Half( float a_fValue )
+{
+    uint32_t uiBits = FloatBits( a_fValue );
+    const uint32_t cuiSign = uiBits & HALF_SIGN_MASK;
+    uiBits ^= cuiSign;
+    if( uiBits >= HALF_OVERFLOW )
+    {
+        m_usBits = ( uiBits > HALF_FLOAT_INFINITY ? HALF_NAN : HALF_INFINITY );
+    }
+    else if( uiBits < HALF_NORMAL_MINIMUM )
+    {
+        m_usBits = (uint16_t)( FloatBits( FloatFromBits( uiBits ) +
+                                          FloatFromBits( HALF_DENORMAL_MAGIC ) )
+                               - HALF_DENORMAL_MAGIC );
+    }
+    else
+    {
+        uiBits += HALF_REBIAS + ( ( uiBits >> 13 ) & 1 );
+        m_usBits = (uint16_t)( uiBits >> 13 );
+    }
+    m_usBits |= (uint16_t)( cuiSign >> 16 );
+}
+
+// Round a double to a float with round-to-odd, so that rounding again to a
+// half gives the same result as rounding straight to one: truncate toward
+// zero and set the lowest bit if anything was lost.
+inline float RoundToOddFloat( double a_dValue )
+{
+    float fValue = (float)a_dValue;
+    if( (double)fValue != a_dValue && a_dValue == a_dValue )
+    {
+        uint32_t uiBits = FloatBits( fValue );
+        if( std::abs( (double)fValue ) > std::abs( a_dValue ) )
+        {
+            --uiBits;
+        }
+        fValue = FloatFromBits( uiBits | 1 );
+    }
+    return fValue;
+}
+inline Half::Half( double a_dValue )
+{
+    *this = Half( RoundToOddFloat( a_dValue ) );
+}
+
+// Exact conversion back to float.  Infinity and NaN need a bigger exponent
+// adjustment, and denormals are normalized by a float subtraction.
+inline Half::operator float() const
+{
+    uint32_t uiBits = ( (uint32_t)m_usBits & 0x7FFF ) << 13;
+    const uint32_t cuiExponent = uiBits & HALF_EXPONENT_MASK;
+    uiBits += HALF_EXPONENT_ADJUST;
+    if( HALF_EXPONENT_MASK == cuiExponent )
+    {
+        uiBits += HALF_EXPONENT_ADJUST;
+    }
+    else if( 0 == cuiExponent )
+    {
+        uiBits = FloatBits( FloatFromBits( uiBits + ( 1 << 23 ) ) -
+                            FloatFromBits( HALF_NORMAL_MINIMUM ) );
+    }
+    return FloatFromBits( uiBits | ( (uint32_t)( m_usBits & 0x8000 ) << 16 ) );
+}
+
+inline Half Half::FromBits( uint16_t a_usBits )
+{
+    Half oHalf;
+    oHalf.m_usBits = a_usBits;
+    return oHalf;
+}
+
+// Clamp, scale, and round to the nearest integer, halves away from zero.
+// The fraction is found by subtraction rather than by adding 0.5, which would
+// round up values just under one half.
+template< typename T, int t_iMax, bool t_bIsSigned >
+inline T NormalizedElement< T, t_iMax, t_bIsSigned >::Encode( float a_fValue )
+{
+    if( !( a_fValue == a_fValue ) )
+    {
+        return 0;
+    }
+    const float cfMinimum = ( t_bIsSigned ? -1.0f : 0.0f );
+    float fScaled = ( a_fValue < cfMinimum ? cfMinimum
+                      : a_fValue > 1.0f ? 1.0f : a_fValue ) * t_iMax;
+    const bool cbNegative = ( fScaled < 0.0f );
+    if( cbNegative )
+    {
+        fScaled = -fScaled;
+    }
+    int iResult = (int)fScaled;
+    if( fScaled - (float)iResult >= 0.5f )
+    {
+        ++iResult;
+    }
+    return (T)( cbNegative ? -iResult : iResult );
+}
+template< typename T, int t_iMax, bool t_bIsSigned >
+inline T NormalizedElement< T, t_iMax, t_bIsSigned >::Encode( double a_dValue )
+{
+    if( !( a_dValue == a_dValue ) )
+    {
+        return 0;
+    }
+    const double cdMinimum = ( t_bIsSigned ? -1.0 : 0.0 );
+    double dScaled = ( a_dValue < cdMinimum ? cdMinimum
+                       : a_dValue > 1.0 ? 1.0 : a_dValue ) * t_iMax;
+    const bool cbNegative = ( dScaled < 0.0 );
+    if( cbNegative )
+    {
+        dScaled = -dScaled;
+    }
+    int iResult = (int)dScaled;
+    if( dScaled - (double)iResult >= 0.5 )
+    {
+        ++iResult;
+    }
+    return (T)( cbNegative ? -iResult : iResult );
+}
+
+// Divide by the maximum.  The most negative signed value is one past -1, so
+// it decodes to -1 along with the value after it.
+template< typename T, int t_iMax, bool t_bIsSigned >
+inline float NormalizedElement< T, t_iMax, t_bIsSigned >::Decode( T a_tValue )
+{
+    float fResult = (float)a_tValue / t_iMax;
+    return ( t_bIsSigned && fResult < -1.0f ? -1.0f : fResult );
+}
+template< typename T, int t_iMax, bool t_bIsSigned >
+inline double NormalizedElement< T, t_iMax, t_bIsSigned >::
+    DecodeDouble( T a_tValue )
+{
+    double dResult = (double)a_tValue / t_iMax;
+    return ( t_bIsSigned && dResult < -1.0 ? -1.0 : dResult );
+}
+
+// All elements zero
+template< typename T, unsigned int N >
+inline PackedVector< T, N >::PackedVector()
+{
+    for( unsigned int i = 0; i < N; ++i )
+    {
+        m_atData[i] = T();
+    }
+}
+
+// Pack the elements of a vector of the same size
+template< typename T, unsigned int N >
+template< typename U, bool t_bIsRow >
+inline PackedVector< T, N >::
+    PackedVector( const Vector< U, N, t_bIsRow >& ac_roVector )
+{
+    operator=( ac_roVector );
+}
+template< typename T, unsigned int N >
+template< typename U, bool t_bIsRow >
+inline PackedVector< T, N >& PackedVector< T, N >::
+    operator=( const Vector< U, N, t_bIsRow >& ac_roVector )
+{
+    for( unsigned int i = 0; i < N; ++i )
+    {
+        m_atData[i] = ( sizeof( U ) > sizeof( float )
+                        ? PackedElement< T >::Encode( (double)ac_roVector[i] )
+                        : PackedElement< T >::Encode( (float)ac_roVector[i] ) );
+    }
+    return *this;
+}
+
+// Unpack into a vector of the same size, decoding in double precision for
+// double vectors
+template< typename T, unsigned int N >
+template< typename U, bool t_bIsRow >
+inline void PackedVector< T, N >::
+    AssignTo( Vector< U, N, t_bIsRow >& a_roVector ) const
+{
+    for( unsigned int i = 0; i < N; ++i )
+    {
+        a_roVector[i] = ( sizeof( U ) > sizeof( float )
+                          ? (U)PackedElement< T >::DecodeDouble( m_atData[i] )
+                          : (U)PackedElement< T >::Decode( m_atData[i] ) );
+    }
+}
+
+// Unpacked element access
+template< typename T, unsigned int N >
+inline float PackedVector< T, N >::operator[]( unsigned int a_uiIndex ) const
+{
+    if( a_uiIndex >= N )
+    {
+        throw std::out_of_range( "Cannot access non-existent vector element" );
+    }
+    return PackedElement< T >::Decode( m_atData[ a_uiIndex ] );
+}
+template< typename T, unsigned int N >
+inline PackedVector< T, N >& PackedVector< T, N >::Set( unsigned int a_uiIndex,
+                                                        float a_fValue )
+{
+    if( a_uiIndex >= N )
+    {
+        throw std::out_of_range( "Cannot access non-existent vector element" );
+    }
+    m_atData[ a_uiIndex ] = PackedElement< T >::Encode( a_fValue );
+    return *this;
+}
+
+// Element-by-element comparison of the packed values
+template< typename T, unsigned int N >
+inline bool PackedVector< T, N >::operator==( const PackedVector& ac_roVector )
+    const
+{
+    for( unsigned int i = 0; i < N; ++i )
+    {
+        if( m_atData[i] != ac_roVector.m_atData[i] )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+template< typename T, unsigned int N >
+inline bool PackedVector< T, N >::operator!=( const PackedVector& ac_roVector )
+    const
+{
+    return !operator==( ac_roVector );
+}
+
+// Points and colors are bare arrays of their elements, so whole arrays of them
+// pack and unpack as one long array
+template< typename T >
+inline void Pack( const Plane::Point* ac_paoIn, PackedVector< T, 2 >* a_paoOut,
+                  unsigned int a_uiCount )
+{
+    Pack( reinterpret_cast< const double* >( ac_paoIn ),
+          reinterpret_cast< T* >( a_paoOut ), 2 * a_uiCount );
+}
+template< typename T >
+inline void Pack( const Space::Point* ac_paoIn, PackedVector< T, 3 >* a_paoOut,
+                  unsigned int a_uiCount )
+{
+    Pack( reinterpret_cast< const double* >( ac_paoIn ),
+          reinterpret_cast< T* >( a_paoOut ), 3 * a_uiCount );
+}
+template< typename T >
+inline void Pack( const Color::ColorVector* ac_paoIn,
+                  PackedVector< T, 4 >* a_paoOut, unsigned int a_uiCount )
+{
+    Pack( reinterpret_cast< const float* >( ac_paoIn ),
+          reinterpret_cast< T* >( a_paoOut ), 4 * a_uiCount );
+}
+template< typename T >
+inline void Unpack( const PackedVector< T, 2 >* ac_paoIn,
+                    Plane::Point* a_paoOut, unsigned int a_uiCount )
+{
+    Unpack( reinterpret_cast< const T* >( ac_paoIn ),
+            reinterpret_cast< double* >( a_paoOut ), 2 * a_uiCount );
+}
+template< typename T >
+inline void Unpack( const PackedVector< T, 3 >* ac_paoIn,
+                    Space::Point* a_paoOut, unsigned int a_uiCount )
+{
+    Unpack( reinterpret_cast< const T* >( ac_paoIn ),
+            reinterpret_cast< double* >( a_paoOut ), 3 * a_uiCount );
+}
+template< typename T >
+inline void Unpack( const PackedVector< T, 4 >* ac_paoIn,
+                    Color::ColorVector* a_paoOut, unsigned int a_uiCount )
+{
+    Unpack( reinterpret_cast< const T* >( ac_paoIn ),
+            reinterpret_cast< float* >( a_paoOut ), 4 * a_uiCount );
+}
+
+}   // namespace Math
+
+#endif  // VERTEX_DATA__TEMPLATES__INL
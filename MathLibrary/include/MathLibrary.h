@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 5, 2014
  * Description:        All-inclusive header file for the Math library.
- * Last Modified:      March 5, 2014
- * Last Modification:  Disabled warning about extern template instantiation.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added atom headers.
  ******************************************************************************/
 
 #ifndef MATH__LIBRARY__H
@@ -19,24 +19,40 @@
 #pragma warning(push)
 #pragma warning (disable : 4231)
 
+#include "../Declarations/AffineTransform.h"
+#include "../Declarations/Atom.h"
+#include "../Declarations/AtomMap.h"
+#include "../Declarations/BatchTransform.h"
 #include "../Declarations/ColorConstants.h"
 #include "../Declarations/ColorVector.h"
 #include "../Declarations/Comparable.h"
+#include "../Declarations/ConjugateGradient.h"
+#include "../Declarations/Decomposition.h"
+#include "../Declarations/DenseMatrix.h"
+#include "../Declarations/DenseVector.h"
 #include "../Declarations/DumbString.h"
 #include "../Declarations/DynamicArray.h"
+#include "../Declarations/ElementKernels.h"
+#include "../Declarations/FastFunctions.h"
 #include "../Declarations/Functions.h"
 #include "../Declarations/Hashable.h"
 #include "../Declarations/Hex.h"
 #include "../Declarations/HomogeneousVector.h"
 #include "../Declarations/InitializeableSingleton.h"
 #include "../Declarations/Matrix.h"
+#include "../Declarations/MatrixExpression.h"
+#include "../Declarations/MatrixInverse.h"
+#include "../Declarations/MatrixProduct.h"
 #include "../Declarations/MostDerivedAddress.h"
 #include "../Declarations/NotCopyable.h"
 #include "../Declarations/PointVector.h"
 #include "../Declarations/Quaternion.h"
+#include "../Declarations/SimdRegister.h"
 #include "../Declarations/Singleton.h"
+#include "../Declarations/SparseMatrix.h"
 #include "../Declarations/Transform.h"
 #include "../Declarations/Vector.h"
+#include "../Declarations/VertexData.h"
 
 // reenable warnings
 #pragma warning(pop)
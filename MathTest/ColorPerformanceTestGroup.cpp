@@ -0,0 +1,337 @@
+/******************************************************************************
+ * File:               ColorPerformanceTestGroup.cpp
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares batch color operations and packed vertex data
+ *                      against working one element at a time and reports how
+ *                      long each takes.  Timings are only meaningful in
+ *                      release builds.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#include "ColorPerformanceTestGroup.h"
+#include "MathLibrary.h"
+#include "PerformanceTest.h"
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+using namespace Space;
+
+ColorPerformanceTestGroup::ColorPerformanceTestGroup()
+    : UnitTestGroup("Color and vertex data performance tests")
+{
+    AddTest( "Batch color conversion and blending against one at a time",
+             ColorBatch );
+    AddTest( "Packed vertex data against one element at a time", VertexData );
+}
+
+UnitTest::Result ColorPerformanceTestGroup::ColorBatch()
+{
+    using namespace Color;
+
+    // Colors slightly outside the valid range, to exercise clamping, and an
+    // odd count, to exercise the leftovers after the vectorized part
+    const unsigned int cuiCount = 10007;
+    std::vector< ColorVector > oColors( cuiCount ), oOther( cuiCount ),
+                               oBatch( cuiCount );
+    std::vector< Hex > oHex( cuiCount ), oOtherHex( cuiCount ),
+                       oSingleHex( cuiCount ), oBatchHex( cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        oColors[i] = ColorVector( ( i % 259 ) / 256.0f - 0.005f,
+                                  ( i % 97 ) / 96.0f,
+                                  ( i % 13 ) / 12.5f,
+                                  ( i % 31 ) / 30.0f );
+        oOther[i] = ColorVector( ( i % 7 ) / 6.0f, ( i % 101 ) / 100.0f,
+                                 ( i % 253 ) / 252.0f, ( i % 5 ) / 4.0f );
+        oHex[i] = Hex( (FourChannelInt)( i * 2654435761u ) );
+        oOtherHex[i] = Hex( (FourChannelInt)( i * 40503u + 12345u ) );
+    }
+
+    // Conversions should match the single-color ones exactly
+    ToHex( &oColors[0], &oBatchHex[0], cuiCount );
+    ToColors( &oHex[0], &oBatch[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        if( ( (Hex)oColors[i] ).i != oBatchHex[i].i )
+        {
+            return UnitTest::Fail( "ToHex differs from the Hex conversion" );
+        }
+        if( ColorVector( oHex[i] ) != oBatch[i] )
+        {
+            return UnitTest::Fail( "ToColors differs from the constructor" );
+        }
+    }
+
+    // So should blending, done the obvious way for floats and with correctly
+    // rounded division for hex values
+    const ColorVector coTint( 0.25f, 0.5f, 1.0f, 0.75f );
+    const Hex coHexTint( (FourChannelInt)0xC080FF40 );
+    Premultiply( &oColors[0], &oBatch[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        const ColorVector& croColor = oColors[i];
+        if( ColorVector( croColor.r() * croColor.a(),
+                         croColor.g() * croColor.a(),
+                         croColor.b() * croColor.a(),
+                         croColor.a() ) != oBatch[i] )
+        {
+            return UnitTest::Fail( "Premultiply differs" );
+        }
+    }
+    BlendOver( &oBatch[0], &oOther[0], &oBatch[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        const ColorVector& croColor = oColors[i];
+        const float cfRemaining = 1.0f - croColor.a();
+        if( ColorVector( croColor.r() * croColor.a() +
+                             oOther[i].r() * cfRemaining,
+                         croColor.g() * croColor.a() +
+                             oOther[i].g() * cfRemaining,
+                         croColor.b() * croColor.a() +
+                             oOther[i].b() * cfRemaining,
+                         croColor.a() + oOther[i].a() * cfRemaining )
+            != oBatch[i] )
+        {
+            return UnitTest::Fail( "BlendOver differs" );
+        }
+    }
+    Tint( &oColors[0], coTint, &oBatch[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        if( ColorVector( oColors[i].r() * coTint.r(),
+                         oColors[i].g() * coTint.g(),
+                         oColors[i].b() * coTint.b(),
+                         oColors[i].a() * coTint.a() ) != oBatch[i] )
+        {
+            return UnitTest::Fail( "Tint differs" );
+        }
+    }
+    Lerp( &oColors[0], &oOther[0], 0.3f, &oBatch[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        if( oColors[i] + ( oOther[i] - oColors[i] ) * 0.3f != oBatch[i] )
+        {
+            return UnitTest::Fail( "Lerp differs" );
+        }
+    }
+    Premultiply( &oHex[0], &oBatchHex[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        const Hex& croHex = oHex[i];
+        if( Hex( (Channel)Math::Round( croHex.r * croHex.a / 255.0 ),
+                 (Channel)Math::Round( croHex.g * croHex.a / 255.0 ),
+                 (Channel)Math::Round( croHex.b * croHex.a / 255.0 ),
+                 croHex.a ).i != oBatchHex[i].i )
+        {
+            return UnitTest::Fail( "Hex Premultiply differs" );
+        }
+    }
+    Tint( &oHex[0], coHexTint, &oBatchHex[0], cuiCount );
+    Lerp( &oHex[0], &oOtherHex[0], 100, &oSingleHex[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        for( unsigned int j = 0; j < 4; ++j )
+        {
+            if( (Channel)Math::Round( oHex[i].c[j] * coHexTint.c[j] / 255.0 )
+                != oBatchHex[i].c[j] )
+            {
+                return UnitTest::Fail( "Hex Tint differs" );
+            }
+            if( (Channel)Math::Round( ( oHex[i].c[j] * 155 +
+                                        oOtherHex[i].c[j] * 100 ) / 255.0 )
+                != oSingleHex[i].c[j] )
+            {
+                return UnitTest::Fail( "Hex Lerp differs" );
+            }
+        }
+    }
+
+    // Every sRGB value should survive decoding and encoding, and decoding
+    // should match the transfer function
+    Hex aoAll[ 256 ];
+    ColorVector aoLinear[ 256 ];
+    for( unsigned int i = 0; i < 256; ++i )
+    {
+        aoAll[i] = Hex( (Channel)i, (Channel)( 255 - i ), (Channel)i,
+                        (Channel)i );
+    }
+    SrgbToLinear( aoAll, aoLinear, 256 );
+    LinearToSrgb( aoLinear, &oBatchHex[0], 256 );
+    for( unsigned int i = 0; i < 256; ++i )
+    {
+        const double cdValue = i / 255.0;
+        const double cdLinear =
+            ( cdValue <= 0.04045 ? cdValue / 12.92
+                                 : std::pow( ( cdValue + 0.055 ) / 1.055,
+                                             2.4 ) );
+        if( aoLinear[i].r() != (float)cdLinear )
+        {
+            return UnitTest::Fail( "SrgbToLinear differs from pow" );
+        }
+        if( aoAll[i].i != oBatchHex[i].i )
+        {
+            return UnitTest::Fail( "LinearToSrgb didn't invert SrgbToLinear" );
+        }
+    }
+
+    // Time conversions and a premultiplied blend over the whole array
+    std::ostringstream oOut;
+    oOut << "Millions of colors per second, one at a time/batch -";
+    const unsigned int cuiRepeats = ( ITERATIONS * 10 ) / cuiCount;
+    const double cdColors = double( cuiCount ) * cuiRepeats / 1e6;
+    const double cdMinimum = 1.0 / CLOCKS_PER_SEC;
+    volatile unsigned int uiSum = 0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiCount; ++i )
+        {
+            oSingleHex[i] = (Hex)oColors[i];
+        }
+        uiSum += oSingleHex[ r % cuiCount ].i;
+    }
+    double dSingle = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        ToHex( &oColors[0], &oBatchHex[0], cuiCount );
+        uiSum += oBatchHex[ r % cuiCount ].i;
+    }
+    double dBatch = SecondsSince( iStart );
+    oOut << " to hex: " << cdColors / std::max( dSingle, cdMinimum ) << "/"
+         << cdColors / std::max( dBatch, cdMinimum );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiCount; ++i )
+        {
+            oBatch[i] = oColors[i] + oOther[i] * ( 1.0f - oColors[i].a() );
+        }
+        uiSum += (unsigned int)oBatch[ r % cuiCount ].r();
+    }
+    dSingle = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        BlendOver( &oColors[0], &oOther[0], &oBatch[0], cuiCount );
+        uiSum += (unsigned int)oBatch[ r % cuiCount ].r();
+    }
+    dBatch = SecondsSince( iStart );
+    oOut << "; blend: " << cdColors / std::max( dSingle, cdMinimum ) << "/"
+         << cdColors / std::max( dBatch, cdMinimum );
+    return UnitTest::Pass( oOut.str() );
+}
+
+UnitTest::Result ColorPerformanceTestGroup::VertexData()
+{
+    using Math::Half;
+    using Math::PackedElement;
+
+    // Every half except NaN should survive unpacking and repacking, and
+    // halfway points between neighbors should round to the even one
+    for( unsigned int i = 0; i < 0x10000; ++i )
+    {
+        const Half coHalf = Half::FromBits( (uint16_t)i );
+        const float cfValue = coHalf;
+        if( cfValue == cfValue && Half( cfValue ) != coHalf )
+        {
+            return UnitTest::Fail( "Half didn't survive a round trip" );
+        }
+        if( 0 == ( i & 0x7C00 ) || 0x7C00 <= ( i & 0x7FFF ) + 1 )
+        {
+            continue;   // skip denormals and the largest values
+        }
+        const float cfNext = Half::FromBits( (uint16_t)( i + 1 ) );
+        const Half coEven = Half::FromBits( (uint16_t)( i + ( i & 1 ) ) );
+        if( Half( ( cfValue + cfNext ) / 2 ) != coEven ||
+            Half( ( (double)cfValue + cfNext ) / 2 ) != coEven )
+        {
+            return UnitTest::Fail( "Half doesn't round ties to even" );
+        }
+    }
+    if( (float)Half( 65520.0f ) != std::numeric_limits< float >::infinity() ||
+        (float)Half( 65519.0 ) != 65504.0f || Half( 1e-8f ) != Half() )
+    {
+        return UnitTest::Fail( "Half doesn't overflow and underflow properly" );
+    }
+
+    // Normalized integers round halves away from zero and clamp
+    if( PackedElement< uint8_t >::Encode( 0.5f / 255 ) != 1 ||
+        PackedElement< uint8_t >::Encode( 2.0f ) != 0xFF ||
+        PackedElement< uint16_t >::Encode( -1.0 ) != 0 ||
+        PackedElement< int16_t >::Encode( -0.5 / 0x7FFF ) != -1 ||
+        PackedElement< int16_t >::Decode( -0x8000 ) != -1.0f )
+    {
+        return UnitTest::Fail( "Normalized integers round incorrectly" );
+    }
+
+    // Array conversions of texture coordinates should match one at a time
+    const unsigned int cuiCount = 10007;
+    std::vector< Point2D > oUVs( cuiCount ), oBack( cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        oUVs[i] = Point2D( ( i % 1021 ) / 1020.0, 1.0 - ( i % 97 ) / 96.5 );
+    }
+    std::vector< Math::Half2 > oHalves( cuiCount );
+    std::vector< Math::NormalizedUShort2 > oShorts( cuiCount );
+    Math::Pack( &oUVs[0], &oHalves[0], cuiCount );
+    Math::Pack( &oUVs[0], &oShorts[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        if( Math::Half2( oUVs[i] ) != oHalves[i] )
+        {
+            return UnitTest::Fail( "Pack to half differs" );
+        }
+        if( Math::NormalizedUShort2( oUVs[i] ) != oShorts[i] )
+        {
+            return UnitTest::Fail( "Pack to normalized integers differs" );
+        }
+    }
+    Math::Unpack( &oShorts[0], &oBack[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        Point2D oExpected;
+        oShorts[i].AssignTo( oExpected );
+        if( oExpected != oBack[i] ||
+            std::abs( oBack[i].x() - oUVs[i].x() ) > 0.5 / 0xFFFF + 1e-12 )
+        {
+            return UnitTest::Fail( "Unpack from normalized integers differs" );
+        }
+    }
+
+    // Time packing texture coordinates into halves
+    const unsigned int cuiRepeats = ( ITERATIONS * 10 ) / cuiCount;
+    const double cdValues = double( cuiCount ) * cuiRepeats / 1e6;
+    const double cdMinimum = 1.0 / CLOCKS_PER_SEC;
+    volatile unsigned int uiSum = 0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiCount; ++i )
+        {
+            oHalves[i] = Math::Half2( oUVs[i] );
+        }
+        uiSum += oHalves[ r % cuiCount ].Data()[0].Bits();
+    }
+    double dSingle = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        Math::Pack( &oUVs[0], &oHalves[0], cuiCount );
+        uiSum += oHalves[ r % cuiCount ].Data()[0].Bits();
+    }
+    double dBatch = SecondsSince( iStart );
+    std::ostringstream oOut;
+    oOut << "Millions of points packed to halves per second, one at a "
+         << "time/batch - " << cdValues / std::max( dSingle, cdMinimum )
+         << "/" << cdValues / std::max( dBatch, cdMinimum ) << "; bytes "
+         << "per point " << sizeof( Point2D ) << " -> "
+         << sizeof( Math::Half2 );
+    return UnitTest::Pass( oOut.str() );
+}
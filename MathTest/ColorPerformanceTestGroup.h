@@ -0,0 +1,30 @@
+/******************************************************************************
+ * File:               ColorPerformanceTestGroup.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares batch color operations and packed vertex data
+ *                      against working one element at a time and reports how
+ *                      long each takes.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef COLOR_PERFORMANCE_TEST_GROUP__H
+#define COLOR_PERFORMANCE_TEST_GROUP__H
+
+#include "UnitTestGroup.h"
+
+class ColorPerformanceTestGroup : public UnitTestGroup
+{
+public:
+
+    ColorPerformanceTestGroup();
+
+private:
+
+    static UnitTest::Result ColorBatch();
+    static UnitTest::Result VertexData();
+
+};
+
+#endif  // COLOR_PERFORMANCE_TEST_GROUP__H
@@ -0,0 +1,336 @@
+/******************************************************************************
+ * File:               DenseMatrixPerformanceTestGroup.cpp
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares blocked dense products and sparse solvers
+ *                      against the straightforward versions and reports how
+ *                      long each takes.  Timings are only meaningful in
+ *                      release builds.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Solves with and without preconditioning.
+ ******************************************************************************/
+
+#include "DenseMatrixPerformanceTestGroup.h"
+#include "MathLibrary.h"
+#include "PerformanceTest.h"
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <sstream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Space;
+
+// Straightforward triple loop, summing each element's terms in order
+template< typename T >
+static Math::DenseMatrix< T >
+    LoopProduct( const Math::DenseMatrix< T >& ac_roLeft,
+                 const Math::DenseMatrix< T >& ac_roRight )
+{
+    Math::DenseMatrix< T > oResult( ac_roLeft.Rows(), ac_roRight.Columns() );
+    for( unsigned int i = 0; i < ac_roLeft.Rows(); ++i )
+    {
+        for( unsigned int j = 0; j < ac_roRight.Columns(); ++j )
+        {
+            T tSum = ac_roLeft[i][0] * ac_roRight[0][j];
+            for( unsigned int k = 1; k < ac_roLeft.Columns(); ++k )
+            {
+                tSum += ac_roLeft[i][k] * ac_roRight[k][j];
+            }
+            oResult[i][j] = tSum;
+        }
+    }
+    return oResult;
+}
+
+// Matrix with varied, repeatable elements
+template< typename T >
+static Math::DenseMatrix< T > DenseFill( unsigned int a_uiRows,
+                                         unsigned int a_uiColumns,
+                                         unsigned int a_uiSeed )
+{
+    Math::DenseMatrix< T > oMatrix( a_uiRows, a_uiColumns );
+    for( unsigned int i = 0; i < oMatrix.Size(); ++i )
+    {
+        oMatrix.Data()[i] = T( ( ( i + a_uiSeed ) * 7919 ) % 2001 ) / T( 1000 )
+                            - T( 1 );
+    }
+    return oMatrix;
+}
+
+// Check a blocked product against the triple loop, then time both versions
+// on square matrices of the given size and report GFLOP/s.  Returns false on
+// any difference.
+template< typename T >
+static bool CheckDenseProduct( std::ostream& a_roOut, unsigned int a_uiSize )
+{
+    // Dimensions that aren't multiples of any tile or block size
+    Math::DenseMatrix< T > oLeft = DenseFill< T >( 67, 259, 1 );
+    Math::DenseMatrix< T > oRight = DenseFill< T >( 259, 45, 2 );
+    if( oLeft * oRight != LoopProduct( oLeft, oRight ) )
+    {
+        a_roOut << "67x259 * 259x45 differs from the triple loop";
+        return false;
+    }
+
+    oLeft = DenseFill< T >( a_uiSize, a_uiSize, 3 );
+    oRight = DenseFill< T >( a_uiSize, a_uiSize, 4 );
+    std::clock_t iStart = std::clock();
+    Math::DenseMatrix< T > oLoop = LoopProduct( oLeft, oRight );
+    double dOld = SecondsSince( iStart );
+    iStart = std::clock();
+    Math::DenseMatrix< T > oBlocked = oLeft * oRight;
+    double dNew = SecondsSince( iStart );
+    if( oLoop != oBlocked )
+    {
+        a_roOut << a_uiSize << "x" << a_uiSize
+                << " product differs from the triple loop";
+        return false;
+    }
+    double dFlops = 2.0 * a_uiSize * a_uiSize * a_uiSize / 1e9;
+    a_roOut << a_uiSize << ": " << dFlops / std::max( dOld, 1e-6 ) << "/"
+            << dFlops / std::max( dNew, 1e-6 );
+    return true;
+}
+
+// Scale for unknown i of a badly scaled system, between 1 and 10
+static double UnknownScale( unsigned int a_uiIndex, bool a_bScaled )
+{
+    return a_bScaled ? 1.0 + 0.75 * ( ( 7 * a_uiIndex ) % 13 ) : 1.0;
+}
+
+// Five-point Laplacian on a square grid, the kind of system relaxation
+// solvers build: symmetric positive definite, with at most five elements in
+// each row.  Scaled, unknown i is measured in units UnknownScale(i) times
+// larger, so row and column i are both multiplied by that scale.  The result
+// is still symmetric positive definite, but its diagonal is no longer
+// constant, which is what Jacobi preconditioning undoes.
+static Math::SparseMatrix< double > Laplacian( unsigned int a_uiGrid,
+                                               bool a_bScaled = false )
+{
+    const unsigned int cuiSize = a_uiGrid * a_uiGrid;
+    Math::SparseBuilder< double > oBuilder( cuiSize, cuiSize, 5 * cuiSize );
+    for( unsigned int y = 0; y < a_uiGrid; ++y )
+    {
+        for( unsigned int x = 0; x < a_uiGrid; ++x )
+        {
+            unsigned int i = y * a_uiGrid + x;
+            double dScale = UnknownScale( i, a_bScaled );
+            oBuilder.Add( i, i, 4.0 * dScale * dScale );
+            if( x > 0 )
+            {
+                oBuilder.Add( i, i - 1,
+                              -dScale * UnknownScale( i - 1, a_bScaled ) );
+            }
+            if( x + 1 < a_uiGrid )
+            {
+                oBuilder.Add( i, i + 1,
+                              -dScale * UnknownScale( i + 1, a_bScaled ) );
+            }
+            if( y > 0 )
+            {
+                oBuilder.Add( i, i - a_uiGrid,
+                              -dScale * UnknownScale( i - a_uiGrid,
+                                                      a_bScaled ) );
+            }
+            if( y + 1 < a_uiGrid )
+            {
+                oBuilder.Add( i, i + a_uiGrid,
+                              -dScale * UnknownScale( i + a_uiGrid,
+                                                      a_bScaled ) );
+            }
+        }
+    }
+    return oBuilder.Build();
+}
+
+// Solve for a known answer with the given preconditioner and report the
+// iterations and time taken.  Returns false if the solver misses the answer.
+static bool CheckSolve( std::ostream& a_roOut,
+                        const Math::SparseMatrix< double >& ac_roMatrix,
+                        Math::Preconditioner a_ePreconditioner )
+{
+    Math::DenseVector< double > oExpected( ac_roMatrix.Rows() );
+    for( unsigned int i = 0; i < oExpected.Size(); ++i )
+    {
+        oExpected[i] = std::sin( i * 0.37 );
+    }
+    Math::DenseVector< double > oRight = ac_roMatrix * oExpected;
+    Math::DenseVector< double > oSolution;
+    Math::ConjugateGradient< double > oSolver( 5000, 1e-10,
+                                               a_ePreconditioner );
+    std::clock_t iStart = std::clock();
+    bool bConverged = oSolver.Solve( ac_roMatrix, oRight, oSolution );
+    double dSolve = SecondsSince( iStart );
+    if( !bConverged || ( oSolution - oExpected ).Magnitude() >
+                       1e-6 * oExpected.Magnitude() )
+    {
+        return false;
+    }
+    a_roOut << oSolver.Iterations() << " iterations/" << dSolve << "s";
+    return true;
+}
+
+DenseMatrixPerformanceTestGroup::DenseMatrixPerformanceTestGroup()
+    : UnitTestGroup("Dense and sparse matrix performance tests")
+{
+    AddTest( "Blocked dense products against a triple loop", DenseProduct );
+    AddTest( "Sparse products and conjugate gradient across threads",
+             SparseSolve );
+}
+
+UnitTest::Result DenseMatrixPerformanceTestGroup::DenseProduct()
+{
+    std::ostringstream oDouble, oFloat;
+    const unsigned int cauiSizes[] = { 64, 256, 512 };
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        oDouble << ( 0 == i ? "" : ", " );
+        oFloat << ( 0 == i ? "" : ", " );
+        if( !CheckDenseProduct< double >( oDouble, cauiSizes[i] ) ||
+            !CheckDenseProduct< float >( oFloat, cauiSizes[i] ) )
+        {
+            return UnitTest::Fail( oDouble.str() + oFloat.str() );
+        }
+    }
+
+    // A diagonally dominant matrix is well conditioned, so its inverse times
+    // itself should come out very close to the identity
+    const unsigned int cuiSize = 200;
+    Math::DenseMatrix< double > oMatrix = DenseFill< double >( cuiSize,
+                                                               cuiSize, 5 );
+    for( unsigned int i = 0; i < cuiSize; ++i )
+    {
+        oMatrix[i][i] += cuiSize;
+    }
+    std::clock_t iStart = std::clock();
+    bool bInvertable = false;
+    Math::DenseMatrix< double > oInverse = oMatrix.Inverse( bInvertable );
+    double dInverse = SecondsSince( iStart );
+    Math::DenseMatrix< double > oProduct = oMatrix * oInverse;
+    double dError = 0;
+    for( unsigned int i = 0; i < cuiSize; ++i )
+    {
+        for( unsigned int j = 0; j < cuiSize; ++j )
+        {
+            double dExpected = ( i == j ? 1.0 : 0.0 );
+            dError = std::max( dError,
+                               std::abs( oProduct[i][j] - dExpected ) );
+        }
+    }
+    if( !bInvertable || dError > 1e-12 )
+    {
+        std::ostringstream oFailure;
+        oFailure << cuiSize << "x" << cuiSize << " inverse is off by "
+                 << dError;
+        return UnitTest::Fail( oFailure.str() );
+    }
+
+    std::ostringstream oOut;
+    oOut << "GFLOP/s, triple loop/blocked - double " << oDouble.str()
+         << "; float " << oFloat.str() << "; " << cuiSize << "x" << cuiSize
+         << " inverse " << dInverse << "s";
+    return UnitTest::Pass( oOut.str() );
+}
+
+UnitTest::Result DenseMatrixPerformanceTestGroup::SparseSolve()
+{
+    // The sparse product should match the dense one, since the elements it
+    // skips are all zero
+    Math::SparseMatrix< double > oSmall = Laplacian( 24 );
+    Math::DenseMatrix< double > oColumn( oSmall.Columns(), 1 );
+    for( unsigned int i = 0; i < oColumn.Rows(); ++i )
+    {
+        oColumn[i][0] = std::sin( i * 0.37 );
+    }
+    Math::DenseMatrix< double > oDense = oSmall.ToDense() * oColumn;
+    Math::DenseVector< double > oSparse =
+        oSmall * Math::DenseVector< double >( oColumn.Data(),
+                                              oColumn.Rows() );
+    for( unsigned int i = 0; i < oSparse.Size(); ++i )
+    {
+        if( std::abs( oSparse[i] - oDense[i][0] ) > 1e-12 )
+        {
+            return UnitTest::Fail( "Sparse product differs from dense" );
+        }
+    }
+
+    // Time products at each size with 1, 2, 4, ... threads
+    std::ostringstream oOut;
+    int iMaxThreads = 1;
+#ifdef _OPENMP
+    iMaxThreads = omp_get_max_threads();
+#endif
+    const unsigned int cauiGrids[] = { 128, 512, 1024 };
+    oOut << "ms per product, by threads -";
+    for( unsigned int g = 0; g < 3; ++g )
+    {
+        Math::SparseMatrix< double > oMatrix = Laplacian( cauiGrids[g] );
+        Math::DenseVector< double > oIn( oMatrix.Columns(), 1.0 );
+        Math::DenseVector< double > oOutVector( oMatrix.Rows() );
+        const unsigned int cuiRepeats =
+            std::max( 1u, ( ITERATIONS * 20 ) / oMatrix.NonZeros() );
+        oOut << ( 0 == g ? " " : "; " ) << oMatrix.Rows() << " rows:";
+        for( int iThreads = 1; iThreads <= iMaxThreads; iThreads *= 2 )
+        {
+#ifdef _OPENMP
+            omp_set_num_threads( iThreads );
+#endif
+            std::clock_t iStart = std::clock();
+            for( unsigned int i = 0; i < cuiRepeats; ++i )
+            {
+                oMatrix.Multiply( oIn.Data(), oOutVector.Data() );
+            }
+            oOut << " " << iThreads << "/"
+                 << 1000 * SecondsSince( iStart ) / cuiRepeats;
+        }
+    }
+#ifdef _OPENMP
+    omp_set_num_threads( iMaxThreads );
+#endif
+
+    // A diagonal that isn't positive should stop Jacobi preconditioning
+    // before iterating, with a zero result and a residual of 1
+    Math::SparseBuilder< double > oBadBuilder( 2, 2, 2 );
+    oBadBuilder.Add( 0, 0, -1.0 );
+    oBadBuilder.Add( 1, 1, 2.0 );
+    Math::DenseVector< double > oBadResult( 2, 5.0 );
+    Math::ConjugateGradient< double > oBadSolver;
+    if( oBadSolver.Solve( oBadBuilder.Build(),
+                          Math::DenseVector< double >( 2, 1.0 ),
+                          oBadResult ) ||
+        1.0 != oBadSolver.Residual() ||
+        0.0 != oBadResult[0] || 0.0 != oBadResult[1] )
+    {
+        return UnitTest::Fail( "Failed preconditioning reported success" );
+    }
+
+    // Solve for a known answer, with and without preconditioning.  The plain
+    // Laplacian's diagonal is constant, so Jacobi preconditioning only scales
+    // it and should take as many iterations; the badly scaled one is where
+    // it pays.
+    const bool cabScaled[] = { false, true };
+    const Math::Preconditioner caePreconditioners[] =
+        { Math::PRECONDITIONER_NONE, Math::PRECONDITIONER_JACOBI };
+    for( unsigned int s = 0; s < 2; ++s )
+    {
+        Math::SparseMatrix< double > oMatrix =
+            Laplacian( 128, cabScaled[s] );
+        oOut << "; " << oMatrix.Rows()
+             << ( cabScaled[s] ? " row scaled solve" : " row solve" )
+             << ", none/Jacobi: ";
+        for( unsigned int p = 0; p < 2; ++p )
+        {
+            oOut << ( 0 == p ? "" : ", " );
+            if( !CheckSolve( oOut, oMatrix, caePreconditioners[p] ) )
+            {
+                return UnitTest::Fail(
+                    "Conjugate gradient missed the solution" );
+            }
+        }
+    }
+    return UnitTest::Pass( oOut.str() );
+}
@@ -0,0 +1,30 @@
+/******************************************************************************
+ * File:               DenseMatrixPerformanceTestGroup.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares blocked dense products and sparse solvers
+ *                      against the straightforward versions and reports how
+ *                      long each takes.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef DENSE_MATRIX_PERFORMANCE_TEST_GROUP__H
+#define DENSE_MATRIX_PERFORMANCE_TEST_GROUP__H
+
+#include "UnitTestGroup.h"
+
+class DenseMatrixPerformanceTestGroup : public UnitTestGroup
+{
+public:
+
+    DenseMatrixPerformanceTestGroup();
+
+private:
+
+    static UnitTest::Result DenseProduct();
+    static UnitTest::Result SparseSolve();
+
+};
+
+#endif  // DENSE_MATRIX_PERFORMANCE_TEST_GROUP__H
@@ -0,0 +1,185 @@
+/******************************************************************************
+ * File:               FunctionPerformanceTestGroup.cpp
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares the fast math functions against the standard
+ *                      library and reports how long each takes.  Timings are
+ *                      only meaningful in release builds.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Sine and cosine tested out to |x| = 1e6.
+ ******************************************************************************/
+
+#include "FunctionPerformanceTestGroup.h"
+#include "MathLibrary.h"
+#include "PerformanceTest.h"
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <sstream>
+#include <vector>
+
+using namespace Space;
+
+// One-argument functions, one at a time or over an array
+typedef double (*ScalarFunction)( double );
+typedef void (*ArrayFunction)( const double*, double*, unsigned int );
+
+// The straightforward way to calculate 1/sqrt(x)
+static double StandardRsqrt( double a_dX )
+{
+    return 1.0 / std::sqrt( a_dX );
+}
+
+// Time the standard, fast, and fast array versions of a function over the
+// given inputs and add the results to the report
+static void TimeFunction( std::ostream& a_roOut, const char* ac_pcName,
+                          ScalarFunction a_pStandard, ScalarFunction a_pFast,
+                          ArrayFunction a_pArray,
+                          const std::vector< double >& ac_roIn )
+{
+    const unsigned int cuiCount = ac_roIn.size();
+    const unsigned int cuiRepeats = ITERATIONS / cuiCount;
+    std::vector< double > oOut( cuiCount );
+    volatile double dSum = 0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiCount; ++i )
+        {
+            oOut[i] = a_pStandard( ac_roIn[i] );
+        }
+        dSum += oOut[ r % cuiCount ];
+    }
+    double dStandard = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiCount; ++i )
+        {
+            oOut[i] = a_pFast( ac_roIn[i] );
+        }
+        dSum += oOut[ r % cuiCount ];
+    }
+    double dFast = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        a_pArray( &ac_roIn[0], &oOut[0], cuiCount );
+        dSum += oOut[ r % cuiCount ];
+    }
+    double dArray = SecondsSince( iStart );
+    a_roOut << "; " << ac_pcName << " - std: " << dStandard << "s, fast: "
+            << dFast << "s, array: " << dArray << "s";
+}
+
+FunctionPerformanceTestGroup::FunctionPerformanceTestGroup()
+    : UnitTestGroup("Fast math function performance tests")
+{
+    AddTest( "Fast math functions against the standard library",
+             FastFunctions );
+}
+
+UnitTest::Result FunctionPerformanceTestGroup::FastFunctions()
+{
+    // Inputs spread over each function's domain, including atan2( 0, 0 ).
+    // Angles grow with the cube of the offset, so they're dense near zero but
+    // still reach the 1e6 limit of the sine and cosine error bound.
+    const unsigned int cuiCount = 1001;
+    std::vector< double > oAngle, oY, oX, oCosine, oPositive, oPower;
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        double dOffset = i - ( cuiCount - 1 ) / 2.0;
+        oAngle.push_back( dOffset * dOffset * dOffset * 1.999 / 250 );
+        oY.push_back( std::sin( i * 0.7 ) * ( i % 9 ) );
+        oX.push_back( std::cos( i * 0.3 ) * ( i % 7 ) );
+        oCosine.push_back( dOffset / 500 );
+        oPositive.push_back( std::pow( 10.0, dOffset / 50 ) );
+        oPower.push_back( dOffset * 1.4 );
+    }
+
+    // Largest error of each function against the standard library - absolute
+    // for the trig functions, relative for rsqrt and exp
+    const unsigned int cuiFunctions = 6;
+    const char* const acpcNames[ cuiFunctions ] =
+        { "sin", "cos", "atan2", "acos", "rsqrt", "exp" };
+    const double cadBounds[ cuiFunctions ] =
+        { 4e-16, 4e-16, 5e-16, 5e-16, 4e-11, 5e-16 };
+    double adErrors[ cuiFunctions ] = { 0, 0, 0, 0, 0, 0 };
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        double dSin, dCos;
+        Math::Fast::SinCos( oAngle[i], dSin, dCos );
+        if( Math::Fast::Sin( oAngle[i] ) != dSin ||
+            Math::Fast::Cos( oAngle[i] ) != dCos )
+        {
+            return UnitTest::Fail( "SinCos differs from Sin and Cos" );
+        }
+        double adCurrent[ cuiFunctions ] =
+        {
+            std::abs( dSin - std::sin( oAngle[i] ) ),
+            std::abs( dCos - std::cos( oAngle[i] ) ),
+            std::abs( Math::Fast::Atan2( oY[i], oX[i] ) -
+                      std::atan2( oY[i], oX[i] ) ),
+            std::abs( Math::Fast::Acos( oCosine[i] ) -
+                      std::acos( oCosine[i] ) ),
+            std::abs( Math::Fast::Rsqrt( oPositive[i] ) *
+                      std::sqrt( oPositive[i] ) - 1 ),
+            std::abs( Math::Fast::Exp( oPower[i] ) / std::exp( oPower[i] ) -
+                      1 )
+        };
+        for( unsigned int j = 0; j < cuiFunctions; ++j )
+        {
+            adErrors[j] = std::max( adErrors[j], adCurrent[j] );
+        }
+    }
+    for( unsigned int j = 0; j < cuiFunctions; ++j )
+    {
+        if( adErrors[j] > cadBounds[j] )
+        {
+            std::ostringstream oOut;
+            oOut << "Fast " << acpcNames[j] << " is off by " << adErrors[j];
+            return UnitTest::Fail( oOut.str() );
+        }
+    }
+
+    // The array versions should give exactly the same results
+    std::vector< double > oSin( cuiCount ), oCos( cuiCount ),
+                          oAtan2( cuiCount ), oAcos( cuiCount ),
+                          oRsqrt( cuiCount ), oExp( cuiCount );
+    Math::Fast::SinCos( &oAngle[0], &oSin[0], &oCos[0], cuiCount );
+    Math::Fast::Atan2( &oY[0], &oX[0], &oAtan2[0], cuiCount );
+    Math::Fast::Acos( &oCosine[0], &oAcos[0], cuiCount );
+    Math::Fast::Rsqrt( &oPositive[0], &oRsqrt[0], cuiCount );
+    Math::Fast::Exp( &oPower[0], &oExp[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        if( Math::Fast::Sin( oAngle[i] ) != oSin[i] ||
+            Math::Fast::Cos( oAngle[i] ) != oCos[i] ||
+            Math::Fast::Atan2( oY[i], oX[i] ) != oAtan2[i] ||
+            Math::Fast::Acos( oCosine[i] ) != oAcos[i] ||
+            Math::Fast::Rsqrt( oPositive[i] ) != oRsqrt[i] ||
+            Math::Fast::Exp( oPower[i] ) != oExp[i] )
+        {
+            std::ostringstream oOut;
+            oOut << "Array results differ at element " << i;
+            return UnitTest::Fail( oOut.str() );
+        }
+    }
+
+    // Report errors and time each version of each function
+    std::ostringstream oOut;
+    oOut << "Errors -";
+    for( unsigned int j = 0; j < cuiFunctions; ++j )
+    {
+        oOut << " " << acpcNames[j] << ": " << adErrors[j];
+    }
+    TimeFunction( oOut, "sin", std::sin, Math::Fast::Sin, Math::Fast::Sin,
+                  oAngle );
+    TimeFunction( oOut, "acos", std::acos, Math::Fast::Acos,
+                  Math::Fast::Acos, oCosine );
+    TimeFunction( oOut, "rsqrt", StandardRsqrt, Math::Fast::Rsqrt,
+                  Math::Fast::Rsqrt, oPositive );
+    TimeFunction( oOut, "exp", std::exp, Math::Fast::Exp, Math::Fast::Exp,
+                  oPower );
+    return UnitTest::Pass( oOut.str() );
+}
@@ -0,0 +1,28 @@
+/******************************************************************************
+ * File:               FunctionPerformanceTestGroup.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares the fast math functions against the standard
+ *                      library and reports how long each takes.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef FUNCTION_PERFORMANCE_TEST_GROUP__H
+#define FUNCTION_PERFORMANCE_TEST_GROUP__H
+
+#include "UnitTestGroup.h"
+
+class FunctionPerformanceTestGroup : public UnitTestGroup
+{
+public:
+
+    FunctionPerformanceTestGroup();
+
+private:
+
+    static UnitTest::Result FastFunctions();
+
+};
+
+#endif  // FUNCTION_PERFORMANCE_TEST_GROUP__H
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       January 5, 2014
  * Description:        3x3 Matrix tests.
- * Last Modified:      February 5, 2014
- * Last Modification:  Refactoring.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added element-wise expression test.
  ******************************************************************************/
 
 #include "Matrix3x3TestGroup.h"
@@ -22,6 +22,7 @@ Matrix3x3TestGroup::Matrix3x3TestGroup()
     AddTest( "Point scale transformation", PointScale );
     AddTest( "Point rotation", PointRotate );
     AddTest( "Matrix multiplication", Multiply );
+    AddTest( "Element-wise expressions", ElementWise );
 }
 
 UnitTest::Result Matrix3x3TestGroup::Scale()
@@ -407,4 +408,48 @@ UnitTest::Result Matrix3x3TestGroup::Multiply()
     }
 
     return UnitTest::PASS;
-}
\ No newline at end of file
+}
+
+UnitTest::Result Matrix3x3TestGroup::ElementWise()
+{
+    double aadA[3][3] = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 } };
+    double aadB[3][3] = { { 9, -8, 7 }, { -6, 5, -4 }, { 3, -2, 1 } };
+    Matrix< double, 3 > oA( aadA ), oB( aadB ), oC( 0.5 );
+
+    // A fused chain should match the same operators applied one at a time
+    Matrix< double, 3 > oFused = Math::Lazy( oA ) + Math::Lazy( oB ) * 3 - oC;
+    Matrix< double, 3 > oExpected = oA + oB * 3 - oC;
+    if( oFused != oExpected )
+    {
+        return UnitTest::Fail( "Fused chain differs from separate operators" );
+    }
+    oFused = -( 2 * Math::Lazy( oA ) - oB ) / 4;
+    if( oFused != -( 2 * oA - oB ) / 4 )
+    {
+        return UnitTest::Fail( "Fused negation and division differ" );
+    }
+
+    // Assigning an expression to one of its own operands
+    oExpected = oA * 2 + oB;
+    ( Math::Lazy( oA ) * 2 + oB ).AssignTo( oA );
+    if( oA != oExpected )
+    {
+        return UnitTest::Fail( "Assigning expression to its own operand" );
+    }
+
+    // Integer results are truncated after each operation, as before
+    int aaiData[3][3] = { { 7, -7, 9 }, { 10, 11, 12 }, { 13, 14, 15 } };
+    Matrix< int, 3 > oInt( aaiData );
+    if( Matrix< int, 3 >( Math::Lazy( oInt ) % 4 * 0.5 ) != oInt % 4 * 0.5 )
+    {
+        return UnitTest::Fail( "Integer modulo and multiplication differ" );
+    }
+
+    // Interpolation
+    Matrix< double, 3 > oMidpoint = Math::Interpolate( oC, oB, 0.5f );
+    if( oMidpoint != oC + ( oB - oC ) * 0.5f )
+    {
+        return UnitTest::Fail( "Interpolation differs from separate math" );
+    }
+    return UnitTest::PASS;
+}
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       January 5, 2014
  * Description:        3x3 Matrix tests.
- * Last Modified:      January 5, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added element-wise expression test.
  ******************************************************************************/
 
 #ifndef MATRIX_3X3_TEST_GROUP__H
@@ -26,6 +26,7 @@ private:
     static UnitTest::Result PointScale();
     static UnitTest::Result PointRotate();
     static UnitTest::Result Multiply();
+    static UnitTest::Result ElementWise();
 
 };
 
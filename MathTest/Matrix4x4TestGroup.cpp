@@ -3,12 +3,14 @@
  * Author:             Elizabeth Lowry
  * Date Created:       January 5, 2014
  * Description:        4x4 Matrix tests.
- * Last Modified:      June 26, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Failed affine inverses return zeroes.
  ******************************************************************************/
 
 #include "Matrix4x4TestGroup.h"
 #include "MathLibrary.h"
+#include <cmath>
+#include <cstring>
 #include <sstream>
 
 using namespace Space;
@@ -24,6 +26,10 @@ Matrix4x4TestGroup::Matrix4x4TestGroup()
     AddTest( "Point scale transformation", PointScale );
     AddTest( "Point rotation", PointRotate );
     AddTest( "Matrix multiplication", Multiply );
+    AddTest( "SIMD multiplication matches scalar", SimdMultiply );
+    AddTest( "Affine and rigid inverse", AffineInverse );
+    AddTest( "Affine3D matches Transform3D", AffineCompose );
+    AddTest( "Transform about a point", TransformAbout );
 }
 
 UnitTest::Result Matrix4x4TestGroup::Project()
@@ -635,4 +641,223 @@ UnitTest::Result Matrix4x4TestGroup::Multiply()
     }
     
     return UnitTest::PASS;
-}
\ No newline at end of file
+}
+
+UnitTest::Result Matrix4x4TestGroup::SimdMultiply()
+{
+    // Values that don't multiply out exactly, so any difference in the order
+    // terms are summed would show up in the low bits
+    double aadLeft[4][4];
+    double aadRight[4][4];
+    float aafLeft[4][4];
+    float aafRight[4][4];
+    for( unsigned int i = 0; i < 16; ++i )
+    {
+        aadLeft[i/4][i%4] = 1.0 / ( i + 3 ) - 0.1 * ( i % 5 );
+        aadRight[i/4][i%4] = std::sqrt( i + 2.0 ) * ( i % 2 ? 1 : -1 );
+        aafLeft[i/4][i%4] = (float)aadLeft[i/4][i%4];
+        aafRight[i/4][i%4] = (float)aadRight[i/4][i%4];
+    }
+    double aadExpected[4][4];
+    float aafExpected[4][4];
+    Math::UnrolledProduct( aadLeft, aadRight, aadExpected );
+    Math::UnrolledProduct( aafLeft, aafRight, aafExpected );
+
+    Math::SimdLevel aeLevels[3] = { Math::SIMD_NONE,
+                                    Math::SIMD_SSE2,
+                                    Math::SIMD_AVX };
+    for( unsigned int i = 0; i < 3; ++i )
+    {
+        double aadResult[4][4];
+        float aafResult[4][4];
+        Math::SimdProduct( aadLeft, aadRight, aadResult, aeLevels[i] );
+        Math::SimdProduct( aafLeft, aafRight, aafResult, aeLevels[i] );
+        if( 0 != std::memcmp( aadExpected, aadResult, sizeof( aadResult ) ) )
+        {
+            std::ostringstream oOut;
+            oOut << "Double product at SIMD level " << aeLevels[i]
+                 << " differs from scalar product";
+            return UnitTest::Fail( oOut.str() );
+        }
+        if( 0 != std::memcmp( aafExpected, aafResult, sizeof( aafResult ) ) )
+        {
+            std::ostringstream oOut;
+            oOut << "Float product at SIMD level " << aeLevels[i]
+                 << " differs from scalar product";
+            return UnitTest::Fail( oOut.str() );
+        }
+    }
+
+    // Matrix operator should give the same result
+    Matrix< double, 4 > oProduct =
+        Matrix< double, 4 >( aadLeft ) * Matrix< double, 4 >( aadRight );
+    if( Matrix< double, 4 >( aadExpected ) != oProduct )
+    {
+        return UnitTest::Fail( "Matrix product differs from scalar product" );
+    }
+    return UnitTest::PASS;
+}
+
+UnitTest::Result Matrix4x4TestGroup::AffineInverse()
+{
+    // Rigid transform - right-angle rotations have exact zeros and ones, so
+    // the inverse should be exact
+    Transform3D oRigid = Rotation( Math::PI / 2, Point3D::Unit(0) ) *
+                         Translation( 1, 2, 3 ) *
+                         Rotation( Math::PI / 2, Point3D::Unit(2) );
+    Transform3D oInverse = RigidInverse( oRigid );
+    if( Transform3D::Identity() != oRigid * oInverse ||
+        Transform3D::Identity() != oInverse * oRigid )
+    {
+        std::ostringstream oOut;
+        oOut << "Rigid inverse of " << oRigid << " was " << oInverse;
+        return UnitTest::Fail( oOut.str() );
+    }
+    if( oRigid.Inverse() != oInverse )
+    {
+        return UnitTest::Fail( "Rigid inverse differs from general inverse" );
+    }
+
+    // Affine transform - powers of two keep this exact too
+    Transform3D oAffine = Scaling( 2, 4, 0.5 ) * oRigid;
+    if( !Space::AffineInverse( oAffine, oInverse ) )
+    {
+        return UnitTest::Fail( "Affine transform reported as not invertable" );
+    }
+    if( Transform3D::Identity() != oAffine * oInverse )
+    {
+        std::ostringstream oOut;
+        oOut << "Affine inverse of " << oAffine << " was " << oInverse;
+        return UnitTest::Fail( oOut.str() );
+    }
+    if( oAffine.Inverse() != oInverse )
+    {
+        return UnitTest::Fail( "Affine inverse differs from general inverse" );
+    }
+
+    // Non-invertable affine transform shouldn't change the result
+    Transform3D oFlat = Scaling( 1, 0, 1 ) * Translation( 1, 2, 3 );
+    if( Space::AffineInverse( oFlat, oInverse ) ||
+        oAffine.Inverse() != oInverse )
+    {
+        return UnitTest::Fail( "Affine inverse of flattening transform" );
+    }
+    return UnitTest::PASS;
+}
+
+UnitTest::Result Matrix4x4TestGroup::AffineCompose()
+{
+    // Right-angle rotations and powers of two keep everything exact
+    Affine3D oAffine = AffineScaling( 2, 4, 0.5 ) *
+                       AffineRotation( Math::PI / 2, Point3D::Unit(0) ) *
+                       AffineTranslation( 1, 2, 3 ) *
+                       AffineRotation( Math::PI / 2, Point3D::Unit(2) );
+    Transform3D oFull = Scaling( 2, 4, 0.5 ) *
+                        Rotation( Math::PI / 2, Point3D::Unit(0) ) *
+                        Translation( 1, 2, 3 ) *
+                        Rotation( Math::PI / 2, Point3D::Unit(2) );
+    if( oAffine.MakeTransform() != oFull || Affine3D( oFull ) != oAffine )
+    {
+        std::ostringstream oOut;
+        oOut << "Affine composition " << oAffine.MakeTransform()
+             << " should be " << oFull;
+        return UnitTest::Fail( oOut.str() );
+    }
+    Point3D oOrigin( 1, 1, 0 );
+    Affine3D oAbout = AffineRotation( Math::PI / 2, Point3D::Unit(2), oOrigin );
+    if( oAbout.MakeTransform() !=
+            Rotation( Math::PI / 2, Point3D::Unit(2), oOrigin ) ||
+        AffineScaling( 2, oOrigin ).MakeTransform() != Scaling( 2, oOrigin ) )
+    {
+        return UnitTest::Fail( "Affine transform about a point" );
+    }
+
+    // Mixed products
+    if( oAffine * oFull != oFull * oFull || oFull * oAffine != oFull * oFull )
+    {
+        return UnitTest::Fail( "Product of affine and full transforms" );
+    }
+
+    // Points are translated, directions aren't
+    Point3D oPoint( 1, -2, 3 );
+    if( HVector3D( oAffine.AppliedTo( oPoint ) ) !=
+            HVector3D( oPoint ) * oFull ||
+        HVector3D( oAffine.AppliedToDirection( oPoint ), 0 ) !=
+            HVector3D( oPoint, 0 ) * oFull )
+    {
+        return UnitTest::Fail( "Affine transform applied to point" );
+    }
+
+    // Inverses
+    if( oAffine * oAffine.Inverse() != Affine3D::Identity() ||
+        oAffine.Inverse().MakeTransform() != Space::AffineInverse( oFull ) )
+    {
+        return UnitTest::Fail( "Affine3D inverse" );
+    }
+    Affine3D oRigid = AffineRotation( Math::PI / 2, Point3D::Unit(0) ) *
+                      AffineTranslation( 1, 2, 3 );
+    if( oRigid.RigidInverse() != oRigid.Inverse() )
+    {
+        return UnitTest::Fail( "Affine3D rigid inverse" );
+    }
+    Affine3D oFlat = AffineScaling( 1, 0, 1 );
+    if( oFlat.Invert() || oFlat != AffineScaling( 1, 0, 1 ) )
+    {
+        return UnitTest::Fail( "Inverting flattening transform" );
+    }
+
+    // Both kinds of affine inverse return zeroes if not invertable
+    double aadZero[4][3] = { { 0 } };
+    if( oFlat.Inverse() != Affine3D( aadZero ) ||
+        Space::AffineInverse( oFlat.MakeTransform() ) != Transform3D::Zero() )
+    {
+        return UnitTest::Fail( "Inverse of flattening transform isn't zero" );
+    }
+    return UnitTest::PASS;
+}
+
+UnitTest::Result Matrix4x4TestGroup::TransformAbout()
+{
+    // Integer elements keep the comparison exact
+    double aadTransform[4][4] = { { 2, 1, 0, 0 },
+                                  { -1, 3, 0, 0 },
+                                  { 0, 0, 4, 0 },
+                                  { 5, -2, 1, 1 } };
+    Transform3D oTransform( aadTransform );
+    Point3D oOrigin( 3, -1, 2 );
+    Transform3D oExpected = Translation( -oOrigin ) * oTransform *
+                            Translation( oOrigin );
+    if( Space::TransformationAbout( oTransform, oOrigin ) != oExpected )
+    {
+        std::ostringstream oOut;
+        oOut << "Transform about a point "
+             << Space::TransformationAbout( oTransform, oOrigin )
+             << " should be " << oExpected;
+        return UnitTest::Fail( oOut.str() );
+    }
+    if( Space::TransformationAbout( oTransform ) != oTransform )
+    {
+        return UnitTest::Fail( "Transform about the origin should not change" );
+    }
+
+    // Point constants match the vector constants they hide, and unit
+    // vectors past the last axis are zero
+    const Point3D caoUnits[4] = { Point3D( 1, 0, 0 ), Point3D( 0, 1, 0 ),
+                                  Point3D( 0, 0, 1 ), Point3D( 0.0 ) };
+    for( unsigned int i = 0; i < 4; ++i )
+    {
+        if( Point3D::Unit(i) != caoUnits[i] ||
+            Math::Vector< double, 3 >::Unit(i) != caoUnits[i] ||
+            Math::Vector< double, 3, false >::Unit(i) !=
+                caoUnits[i].Transpose() )
+        {
+            return UnitTest::Fail( "Point unit vectors don't match" );
+        }
+    }
+    if( Point3D::Zero() != Math::Vector< double, 3 >::Zero() ||
+        Point3D::Origin() != Point3D( 0.0 ) )
+    {
+        return UnitTest::Fail( "Point zero and origin don't match" );
+    }
+    return UnitTest::PASS;
+}
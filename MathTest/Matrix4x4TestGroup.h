@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       January 5, 2014
  * Description:        4x4 Matrix tests.
- * Last Modified:      January 5, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added transform-about-a-point test.
  ******************************************************************************/
 
 #ifndef MATRIX_4X4_TEST_GROUP__H
@@ -27,6 +27,10 @@ private:
     static UnitTest::Result PointScale();
     static UnitTest::Result PointRotate();
     static UnitTest::Result Multiply();
+    static UnitTest::Result SimdMultiply();
+    static UnitTest::Result AffineInverse();
+    static UnitTest::Result AffineCompose();
+    static UnitTest::Result TransformAbout();
 
 };
 
@@ -0,0 +1,469 @@
+/******************************************************************************
+ * File:               MatrixPerformanceTestGroup.cpp
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares closed-form inverses, determinants, element-
+ *                      wise operators, and reusable decompositions against the
+ *                      straightforward versions they replaced and reports how
+ *                      long each takes.  Timings are only meaningful in
+ *                      release builds.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#include "MatrixPerformanceTestGroup.h"
+#include "MathLibrary.h"
+#include "PerformanceTest.h"
+#include <cmath>
+#include <ctime>
+#include <sstream>
+#include <vector>
+
+using namespace Space;
+using Math::Matrix;
+
+// The recursive cofactor expansion the matrix library used to use for
+// determinants and inverses, kept here as a reference.
+template< unsigned int N >
+struct Cofactor
+{
+    static double Determinant( const Matrix< double, N >& ac_roMatrix )
+    {
+        double dDeterminant = 0;
+        for( unsigned int i = 0; i < N; ++i )
+        {
+            dDeterminant += ac_roMatrix[0][i] * ( i % 2 == 0 ? 1 : -1 ) *
+                Cofactor< N - 1 >::Determinant(
+                    ac_roMatrix.MinusRowAndColumn( 0, i ) );
+        }
+        return dDeterminant;
+    }
+    static Matrix< double, N > Inverse( const Matrix< double, N >& ac_roMatrix )
+    {
+        Matrix< double, N > oInverse;
+        for( unsigned int i = 0; i < N*N; ++i )
+        {
+            oInverse[i%N][i/N] = ( ( (i/N) + (i%N) ) % 2 == 0 ? 1 : -1 ) *
+                Cofactor< N - 1 >::Determinant(
+                    ac_roMatrix.MinusRowAndColumn( i/N, i%N ) );
+        }
+        return oInverse / Determinant( ac_roMatrix );
+    }
+};
+template<>
+struct Cofactor< 1 >
+{
+    static double Determinant( const Matrix< double, 1 >& ac_roMatrix )
+    {
+        return ac_roMatrix[0][0];
+    }
+};
+
+// The element-wise loops the matrix operators used to run, with an integer
+// divide and modulo and a bounds-checked row access for every element, kept
+// here as a reference.  Each operation works on the first matrix and returns
+// an element so the timing loops can't be optimized away.
+template< typename T, unsigned int M, unsigned int N >
+struct IndexedElements
+{
+    typedef Matrix< T, M, N > MatrixType;
+    static T Equal( MatrixType& a_roMatrix, const MatrixType& ac_roOther )
+    {
+        bool bResult = true;
+        for( unsigned int i = 0; bResult && i < M*N; ++i )
+        {
+            bResult = ( a_roMatrix[i/N][i%N] == ac_roOther[i/N][i%N] );
+        }
+        return T( bResult );
+    }
+    static T NotEqual( MatrixType& a_roMatrix, const MatrixType& ac_roOther )
+    {
+        bool bResult = false;
+        for( unsigned int i = 0; !bResult && i < M*N; ++i )
+        {
+            bResult = ( a_roMatrix[i/N][i%N] != ac_roOther[i/N][i%N] );
+        }
+        return T( bResult );
+    }
+    static T Add( MatrixType& a_roMatrix, const MatrixType& ac_roOther )
+    {
+        for( unsigned int i = 0; i < M*N; ++i )
+        {
+            a_roMatrix[i/N][i%N] =
+                T( a_roMatrix[i/N][i%N] + ac_roOther[i/N][i%N] );
+        }
+        return a_roMatrix[M-1][N-1];
+    }
+    static T Subtract( MatrixType& a_roMatrix, const MatrixType& ac_roOther )
+    {
+        for( unsigned int i = 0; i < M*N; ++i )
+        {
+            a_roMatrix[i/N][i%N] =
+                T( a_roMatrix[i/N][i%N] - ac_roOther[i/N][i%N] );
+        }
+        return a_roMatrix[M-1][N-1];
+    }
+    static T Multiply( MatrixType& a_roMatrix, const MatrixType& )
+    {
+        for( unsigned int i = 0; i < M*N; ++i )
+        {
+            a_roMatrix[i/N][i%N] = T( a_roMatrix[i/N][i%N] * T( 1.0001 ) );
+        }
+        return a_roMatrix[M-1][N-1];
+    }
+    static T Divide( MatrixType& a_roMatrix, const MatrixType& )
+    {
+        for( unsigned int i = 0; i < M*N; ++i )
+        {
+            a_roMatrix[i/N][i%N] = T( a_roMatrix[i/N][i%N] / T( 1.0001 ) );
+        }
+        return a_roMatrix[M-1][N-1];
+    }
+    static T Negate( MatrixType& a_roMatrix, const MatrixType& )
+    {
+        for( unsigned int i = 0; i < M*N; ++i )
+        {
+            a_roMatrix[i/N][i%N] = T( a_roMatrix[i/N][i%N] * -1 );
+        }
+        return a_roMatrix[M-1][N-1];
+    }
+    static T Transpose( MatrixType& a_roMatrix, const MatrixType& )
+    {
+        Matrix< T, N, M > oTranspose;
+        for( unsigned int i = 0; i < M*N; ++i )
+        {
+            oTranspose[i%N][i/N] = a_roMatrix[i/N][i%N];
+        }
+        return oTranspose[N-1][0];
+    }
+};
+
+// The same operations through the matrix operators
+template< typename T, unsigned int M, unsigned int N >
+struct OperatorElements
+{
+    typedef Matrix< T, M, N > MatrixType;
+    static T Equal( MatrixType& a_roMatrix, const MatrixType& ac_roOther )
+    {
+        return T( a_roMatrix == ac_roOther );
+    }
+    static T NotEqual( MatrixType& a_roMatrix, const MatrixType& ac_roOther )
+    {
+        return T( a_roMatrix != ac_roOther );
+    }
+    static T Add( MatrixType& a_roMatrix, const MatrixType& ac_roOther )
+    {
+        return ( a_roMatrix += ac_roOther )[M-1][N-1];
+    }
+    static T Subtract( MatrixType& a_roMatrix, const MatrixType& ac_roOther )
+    {
+        return ( a_roMatrix -= ac_roOther )[M-1][N-1];
+    }
+    static T Multiply( MatrixType& a_roMatrix, const MatrixType& )
+    {
+        return ( a_roMatrix *= T( 1.0001 ) )[M-1][N-1];
+    }
+    static T Divide( MatrixType& a_roMatrix, const MatrixType& )
+    {
+        return ( a_roMatrix /= T( 1.0001 ) )[M-1][N-1];
+    }
+    static T Negate( MatrixType& a_roMatrix, const MatrixType& )
+    {
+        a_roMatrix = -a_roMatrix;
+        return a_roMatrix[M-1][N-1];
+    }
+    static T Transpose( MatrixType& a_roMatrix, const MatrixType& )
+    {
+        return a_roMatrix.Transpose()[N-1][0];
+    }
+};
+
+// Check each operator against the reference loops on an MxN matrix of type T,
+// then time both versions if requested.  Returns false on any difference.
+template< typename T, unsigned int M, unsigned int N >
+static bool CheckElementOperators( std::ostream& a_roOut, bool a_bTime )
+{
+    typedef Matrix< T, M, N > MatrixType;
+    typedef T (*Operation)( MatrixType&, const MatrixType& );
+    const unsigned int cuiOperations = 8;
+    const char* const acpcNames[ cuiOperations ] =
+        { "==", "!=", "+=", "-=", "*=", "/=", "-", "Transpose" };
+    const Operation acpOld[ cuiOperations ] =
+        { IndexedElements< T, M, N >::Equal,
+          IndexedElements< T, M, N >::NotEqual,
+          IndexedElements< T, M, N >::Add,
+          IndexedElements< T, M, N >::Subtract,
+          IndexedElements< T, M, N >::Multiply,
+          IndexedElements< T, M, N >::Divide,
+          IndexedElements< T, M, N >::Negate,
+          IndexedElements< T, M, N >::Transpose };
+    const Operation acpNew[ cuiOperations ] =
+        { OperatorElements< T, M, N >::Equal,
+          OperatorElements< T, M, N >::NotEqual,
+          OperatorElements< T, M, N >::Add,
+          OperatorElements< T, M, N >::Subtract,
+          OperatorElements< T, M, N >::Multiply,
+          OperatorElements< T, M, N >::Divide,
+          OperatorElements< T, M, N >::Negate,
+          OperatorElements< T, M, N >::Transpose };
+
+    // Equal matrices, so comparisons have to look at every element
+    MatrixType oStart, oOther;
+    for( unsigned int i = 0; i < M*N; ++i )
+    {
+        oStart[i/N][i%N] = T( 1 + i * 0.37 );
+        oOther[i/N][i%N] = oStart[i/N][i%N];
+    }
+    for( unsigned int k = 0; k < cuiOperations; ++k )
+    {
+        MatrixType oOld( oStart ), oNew( oStart );
+        T tOld = acpOld[k]( oOld, oOther );
+        T tNew = acpNew[k]( oNew, oOther );
+        bool bSame = ( tOld == tNew );
+        for( unsigned int i = 0; bSame && i < M*N; ++i )
+        {
+            bSame = ( oOld[i/N][i%N] == oNew[i/N][i%N] );
+        }
+        if( !bSame )
+        {
+            a_roOut << M << "x" << N << " " << acpcNames[k]
+                    << " differs from the indexed loop";
+            return false;
+        }
+    }
+    if( !a_bTime )
+    {
+        return true;
+    }
+
+    volatile double dSum = 0;
+    for( unsigned int k = 0; k < cuiOperations; ++k )
+    {
+        MatrixType oMatrix( oStart );
+        std::clock_t iStart = std::clock();
+        for( unsigned int i = 0; i < ITERATIONS; ++i )
+        {
+            dSum += acpOld[k]( oMatrix, oOther );
+        }
+        double dOld = SecondsSince( iStart );
+        oMatrix = oStart;
+        iStart = std::clock();
+        for( unsigned int i = 0; i < ITERATIONS; ++i )
+        {
+            dSum += acpNew[k]( oMatrix, oOther );
+        }
+        double dNew = SecondsSince( iStart );
+        a_roOut << ( 0 == k ? "" : ", " ) << acpcNames[k] << " " << dOld
+                << "s/" << dNew << "s";
+    }
+    return true;
+}
+
+MatrixPerformanceTestGroup::MatrixPerformanceTestGroup()
+    : UnitTestGroup("Matrix performance tests")
+{
+    AddTest( "4x4 inverse against cofactor expansion", Inverse4x4 );
+    AddTest( "6x6 determinant against cofactor expansion", Determinant6x6 );
+    AddTest( "Flat element-wise operators against indexed loops",
+             ElementOperators );
+    AddTest( "Reused decompositions against inverting for every solve",
+             Decompositions );
+}
+
+UnitTest::Result MatrixPerformanceTestGroup::Inverse4x4()
+{
+    Transform3D oRigid = Rotation( 0.3, Point3D( 1, 2, 3 ) ) *
+                         Translation( 4, -5, 6 );
+    Transform3D oAffine = Scaling( 1.5, 2, 0.75 ) * oRigid;
+    Transform3D oExpected = Cofactor< 4 >::Inverse( oAffine );
+    if( !Close( oExpected, oAffine.Inverse() ) )
+    {
+        return UnitTest::Fail( "Closed-form inverse differs from cofactors" );
+    }
+    if( !Close( oExpected, AffineInverse( oAffine ) ) )
+    {
+        return UnitTest::Fail( "Affine inverse differs from cofactors" );
+    }
+    if( !Close( Cofactor< 4 >::Inverse( oRigid ), RigidInverse( oRigid ) ) )
+    {
+        return UnitTest::Fail( "Rigid inverse differs from cofactors" );
+    }
+
+    // Sum a result element so the loops can't be optimized away
+    volatile double dSum = 0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int i = 0; i < ITERATIONS; ++i )
+    {
+        dSum += Cofactor< 4 >::Inverse( oAffine )[3][0];
+    }
+    double dCofactor = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int i = 0; i < ITERATIONS; ++i )
+    {
+        dSum += oAffine.Inverse()[3][0];
+    }
+    double dClosedForm = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int i = 0; i < ITERATIONS; ++i )
+    {
+        dSum += AffineInverse( oAffine )[3][0];
+    }
+    double dAffine = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int i = 0; i < ITERATIONS; ++i )
+    {
+        dSum += RigidInverse( oRigid )[3][0];
+    }
+    double dRigid = SecondsSince( iStart );
+
+    std::ostringstream oOut;
+    oOut << ITERATIONS << " inverses - cofactor: " << dCofactor
+         << "s, closed form: " << dClosedForm << "s, affine: " << dAffine
+         << "s, rigid: " << dRigid << "s";
+    return UnitTest::Pass( oOut.str() );
+}
+
+UnitTest::Result MatrixPerformanceTestGroup::Determinant6x6()
+{
+    double aadData[6][6];
+    for( unsigned int i = 0; i < 36; ++i )
+    {
+        aadData[i/6][i%6] = std::sin( i + 1.0 ) * ( i % 7 + 1 );
+    }
+    Matrix< double, 6 > oMatrix( aadData );
+    double dExpected = Cofactor< 6 >::Determinant( oMatrix );
+    double dActual = oMatrix.Determinant();
+    if( std::abs( dExpected - dActual ) > 1e-9 * std::abs( dExpected ) )
+    {
+        std::ostringstream oOut;
+        oOut << "LU determinant " << dActual << " differs from cofactor "
+             << dExpected;
+        return UnitTest::Fail( oOut.str() );
+    }
+    if( !Close( Matrix< double, 6 >::Identity(),
+                oMatrix * oMatrix.Inverse(), 1e-9 ) )
+    {
+        return UnitTest::Fail( "LU inverse times matrix isn't identity" );
+    }
+
+    volatile double dSum = 0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int i = 0; i < ITERATIONS / 100; ++i )
+    {
+        dSum += Cofactor< 6 >::Determinant( oMatrix );
+    }
+    double dCofactor = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int i = 0; i < ITERATIONS / 100; ++i )
+    {
+        dSum += oMatrix.Determinant();
+    }
+    double dLU = SecondsSince( iStart );
+
+    std::ostringstream oOut;
+    oOut << ITERATIONS / 100 << " determinants - cofactor: " << dCofactor
+         << "s, LU: " << dLU << "s";
+    return UnitTest::Pass( oOut.str() );
+}
+
+UnitTest::Result MatrixPerformanceTestGroup::ElementOperators()
+{
+    // 3x3 leaves a remainder after the SIMD registers for both types
+    std::ostringstream oFloat, oDouble, oFailure;
+    if( !CheckElementOperators< double, 3, 3 >( oFailure, false ) ||
+        !CheckElementOperators< float, 3, 3 >( oFailure, false ) ||
+        !CheckElementOperators< double, 4, 4 >( oDouble, true ) ||
+        !CheckElementOperators< float, 4, 4 >( oFloat, true ) )
+    {
+        return UnitTest::Fail( oFailure.str() + oDouble.str() + oFloat.str() );
+    }
+    std::ostringstream oOut;
+    oOut << ITERATIONS << " 4x4 operations, indexed/flat - double: "
+         << oDouble.str() << "; float: " << oFloat.str();
+    return UnitTest::Pass( oOut.str() );
+}
+
+UnitTest::Result MatrixPerformanceTestGroup::Decompositions()
+{
+    // A^T * A plus a multiple of the identity is symmetric positive definite,
+    // so LU and Cholesky should both be able to solve against it
+    double aadData[8][8];
+    for( unsigned int i = 0; i < 64; ++i )
+    {
+        aadData[i/8][i%8] = std::sin( i + 1.0 ) * ( i % 5 + 1 );
+    }
+    Matrix< double, 8 > oMatrix( aadData );
+    oMatrix = oMatrix.Transpose() * oMatrix + Matrix< double, 8 >( 8.0, 0.0 );
+    Math::LU< double, 8 > oLU( oMatrix );
+    Math::Cholesky< double, 8 > oCholesky( oMatrix );
+    if( !oLU.IsInvertable() || !oCholesky.IsPositiveDefinite() )
+    {
+        return UnitTest::Fail( "Failed to factor 8x8 matrix" );
+    }
+
+    const unsigned int cuiCount = ITERATIONS / 10;
+    std::vector< Matrix< double, 8, 1 > > oRight( cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        for( unsigned int j = 0; j < 8; ++j )
+        {
+            oRight[i][j][0] = std::cos( i * 8.0 + j );
+        }
+    }
+    std::vector< Matrix< double, 8, 1 > > oInverted( cuiCount );
+    std::vector< Matrix< double, 8, 1 > > oSolvedLU( cuiCount );
+    std::vector< Matrix< double, 8, 1 > > oSolvedCholesky( cuiCount );
+
+    std::clock_t iStart = std::clock();
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        oInverted[i] = oMatrix.Inverse() * oRight[i];
+    }
+    double dInverse = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        oLU.Solve( oRight[i], oSolvedLU[i] );
+    }
+    double dLU = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        oCholesky.Solve( oRight[i], oSolvedCholesky[i] );
+    }
+    double dCholesky = SecondsSince( iStart );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        if( !Close( oInverted[i], oSolvedLU[i], 1e-9 ) ||
+            !Close( oInverted[i], oSolvedCholesky[i], 1e-9 ) )
+        {
+            return UnitTest::Fail( "Decomposition solves differ from"
+                                   " multiplying by the inverse" );
+        }
+    }
+
+    // Least-squares solutions from QR should match the normal equations for
+    // a well-conditioned tall matrix
+    double aadTall[12][4];
+    for( unsigned int i = 0; i < 48; ++i )
+    {
+        aadTall[i/4][i%4] = std::sin( i * 0.7 + 0.3 ) + ( i % 5 == 0 ? 2 : 0 );
+    }
+    Matrix< double, 12, 4 > oTall( aadTall );
+    Matrix< double, 4, 12 > oTranspose = oTall.Transpose();
+    Matrix< double, 4, 12 > oNormal =
+        ( oTranspose * oTall ).Inverse() * oTranspose;
+    Math::QR< double, 12, 4 > oQR( oTall );
+    Matrix< double, 4, 12 > oPseudoInverse;
+    if( !oQR.LeftInverse( oPseudoInverse ) ||
+        !Close( oNormal, oPseudoInverse, 1e-9 ) )
+    {
+        return UnitTest::Fail( "QR pseudo-inverse differs from the normal"
+                               " equations" );
+    }
+
+    std::ostringstream oOut;
+    oOut << cuiCount << " 8x8 solves - inverse: " << dInverse << "s, LU: "
+         << dLU << "s, Cholesky: " << dCholesky << "s";
+    return UnitTest::Pass( oOut.str() );
+}
@@ -0,0 +1,33 @@
+/******************************************************************************
+ * File:               MatrixPerformanceTestGroup.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares closed-form inverses, determinants, element-
+ *                      wise operators, and reusable decompositions against the
+ *                      straightforward versions they replaced and reports how
+ *                      long each takes.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef MATRIX_PERFORMANCE_TEST_GROUP__H
+#define MATRIX_PERFORMANCE_TEST_GROUP__H
+
+#include "UnitTestGroup.h"
+
+class MatrixPerformanceTestGroup : public UnitTestGroup
+{
+public:
+
+    MatrixPerformanceTestGroup();
+
+private:
+
+    static UnitTest::Result Inverse4x4();
+    static UnitTest::Result Determinant6x6();
+    static UnitTest::Result ElementOperators();
+    static UnitTest::Result Decompositions();
+
+};
+
+#endif  // MATRIX_PERFORMANCE_TEST_GROUP__H
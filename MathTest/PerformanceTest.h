@@ -0,0 +1,51 @@
+/******************************************************************************
+ * File:               PerformanceTest.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Timing and comparison helpers shared by the performance
+ *                      test groups.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef PERFORMANCE_TEST__H
+#define PERFORMANCE_TEST__H
+
+#include "MathLibrary.h"
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+
+// Number of times to repeat each timed operation
+static const unsigned int ITERATIONS = 100000;
+
+// Seconds elapsed since the given clock reading
+inline double SecondsSince( std::clock_t a_iStart )
+{
+    return double( std::clock() - a_iStart ) / CLOCKS_PER_SEC;
+}
+
+// True if every element of the two matrices is within the given fraction of
+// the largest element of the expected matrix
+template< unsigned int M, unsigned int N >
+inline bool Close( const Math::Matrix< double, M, N >& ac_roExpected,
+                   const Math::Matrix< double, M, N >& ac_roActual,
+                   double a_dTolerance = 1e-12 )
+{
+    double dScale = 0;
+    for( unsigned int i = 0; i < M*N; ++i )
+    {
+        dScale = std::max( dScale, std::abs( ac_roExpected[i/N][i%N] ) );
+    }
+    for( unsigned int i = 0; i < M*N; ++i )
+    {
+        if( std::abs( ac_roExpected[i/N][i%N] - ac_roActual[i/N][i%N] ) >
+            a_dTolerance * dScale )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif  // PERFORMANCE_TEST__H
@@ -0,0 +1,157 @@
+/******************************************************************************
+ * File:               QuaternionPerformanceTestGroup.cpp
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares direct, fast, and batch quaternion operations
+ *                      against the versions they replaced and reports how long
+ *                      each takes.  Timings are only meaningful in release
+ *                      builds.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#include "QuaternionPerformanceTestGroup.h"
+#include "MathLibrary.h"
+#include "PerformanceTest.h"
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <sstream>
+#include <vector>
+
+using namespace Space;
+
+// Largest difference between elements of two quaternions, allowing for Q and
+// -Q representing the same rotation
+static double Distance( const Quaternion& ac_roA, const Quaternion& ac_roB )
+{
+    double dSame = 0;
+    double dOpposite = 0;
+    for( unsigned int i = 0; i < 4; ++i )
+    {
+        dSame = std::max( dSame, std::abs( ac_roA[i] - ac_roB[i] ) );
+        dOpposite = std::max( dOpposite, std::abs( ac_roA[i] + ac_roB[i] ) );
+    }
+    return std::min( dSame, dOpposite );
+}
+
+QuaternionPerformanceTestGroup::QuaternionPerformanceTestGroup()
+    : UnitTestGroup("Quaternion performance tests")
+{
+    AddTest( "Direct and batch slerp against quaternion powers", Slerp );
+}
+
+UnitTest::Result QuaternionPerformanceTestGroup::Slerp()
+{
+    // Pairs of rotations about different axes, by different angles, some more
+    // than halfway around from each other and some close together
+    const unsigned int cuiCount = 1001;
+    std::vector< Quaternion > oFrom, oTo, oFast, oBatch;
+    std::vector< double > oProgress;
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        oFrom.push_back( Quaternion( i * 0.37, Point3D( 1, i % 7, -2 ) ) );
+        oTo.push_back( Quaternion( i * 0.37 + ( i % 11 ) * 0.6 + 0.001,
+                                   Point3D( i % 5, 1, 3 ) ) );
+        oProgress.push_back( ( i % 13 ) / 12.0 );
+    }
+
+    // Compare the direct slerp with the old trig round trip, the polynomial
+    // approximation with the direct slerp, and the batch versions with their
+    // one-at-a-time equivalents
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        Quaternion oPower = ( ( ( oTo[i] / oFrom[i] ).Clamp() ^ oProgress[i] ) *
+                              oFrom[i] ).Normalize();
+        Quaternion oDirect = oFrom[i].Slerped( oTo[i], oProgress[i] );
+        oFast.push_back( oFrom[i].SlerpedFast( oTo[i], oProgress[i] ) );
+        if( Distance( oPower, oDirect ) > 1e-6 ||
+            Distance( oDirect, oFast[i] ) > 5e-5 )
+        {
+            std::ostringstream oOut;
+            oOut << "Slerp " << i << " differs - power: " << oPower.GetAngle()
+                 << ", direct: " << oDirect.GetAngle() << ", fast: "
+                 << oFast[i].GetAngle() << " radians";
+            return UnitTest::Fail( oOut.str() );
+        }
+    }
+    oBatch.resize( cuiCount );
+    SlerpMany( &oFrom[0], &oTo[0], &oProgress[0], &oBatch[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        if( Distance( oFast[i], oBatch[i] ) > 1e-12 )
+        {
+            return UnitTest::Fail( "SlerpMany differs from SlerpFast" );
+        }
+    }
+    MultiplyMany( &oFrom[0], &oTo[0], &oBatch[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        if( Distance( oFrom[i] * oTo[i], oBatch[i] ) > 1e-12 )
+        {
+            return UnitTest::Fail( "MultiplyMany differs from operator*" );
+        }
+    }
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        oBatch[i] = oFrom[i];
+        oBatch[i][ i % 4 ] += 0.5;
+    }
+    std::vector< Quaternion > oNormal( oBatch );
+    NormalizeMany( &oBatch[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        if( Distance( oNormal[i].Normalize(), oBatch[i] ) > 1e-12 )
+        {
+            return UnitTest::Fail( "NormalizeMany differs from Normalize" );
+        }
+    }
+
+    // Time each way of slerping every pair
+    const unsigned int cuiRepeats = ITERATIONS / cuiCount;
+    volatile double dSum = 0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiCount; ++i )
+        {
+            oBatch[i] = ( ( ( oTo[i] / oFrom[i] ).Clamp() ^ oProgress[i] ) *
+                          oFrom[i] ).Normalize();
+        }
+        dSum += oBatch[ r % cuiCount ][0];
+    }
+    double dPower = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiCount; ++i )
+        {
+            oBatch[i] = oFrom[i].Slerped( oTo[i], oProgress[i] );
+        }
+        dSum += oBatch[ r % cuiCount ][0];
+    }
+    double dDirect = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiCount; ++i )
+        {
+            oBatch[i] = oFrom[i].SlerpedFast( oTo[i], oProgress[i] );
+        }
+        dSum += oBatch[ r % cuiCount ][0];
+    }
+    double dFast = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        SlerpMany( &oFrom[0], &oTo[0], &oProgress[0], &oBatch[0], cuiCount );
+        dSum += oBatch[ r % cuiCount ][0];
+    }
+    double dBatch = SecondsSince( iStart );
+
+    std::ostringstream oOut;
+    oOut << cuiRepeats * cuiCount << " slerps - powers: " << dPower
+         << "s, direct: " << dDirect << "s, fast: " << dFast
+         << "s, batch: " << dBatch << "s";
+    return UnitTest::Pass( oOut.str() );
+}
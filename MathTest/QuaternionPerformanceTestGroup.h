@@ -0,0 +1,29 @@
+/******************************************************************************
+ * File:               QuaternionPerformanceTestGroup.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares direct, fast, and batch quaternion operations
+ *                      against the versions they replaced and reports how long
+ *                      each takes.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef QUATERNION_PERFORMANCE_TEST_GROUP__H
+#define QUATERNION_PERFORMANCE_TEST_GROUP__H
+
+#include "UnitTestGroup.h"
+
+class QuaternionPerformanceTestGroup : public UnitTestGroup
+{
+public:
+
+    QuaternionPerformanceTestGroup();
+
+private:
+
+    static UnitTest::Result Slerp();
+
+};
+
+#endif  // QUATERNION_PERFORMANCE_TEST_GROUP__H
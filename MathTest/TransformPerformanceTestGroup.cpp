@@ -0,0 +1,431 @@
+/******************************************************************************
+ * File:               TransformPerformanceTestGroup.cpp
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares fused, single precision, and batch transforms
+ *                      against the matrix products they replaced and reports
+ *                      how long each takes.  Timings are only meaningful in
+ *                      release builds.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Reported thread counts for batch timings.
+ ******************************************************************************/
+
+#include "TransformPerformanceTestGroup.h"
+#include "MathLibrary.h"
+#include "PerformanceTest.h"
+#include <algorithm>
+#include <cmath>
+#include <ctime>
+#include <sstream>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Space;
+
+TransformPerformanceTestGroup::TransformPerformanceTestGroup()
+    : UnitTestGroup("Transform performance tests")
+{
+    AddTest( "Fused model matrix against matrix products", ModelMatrix );
+    AddTest( "Single against double precision transforms", FloatTransform );
+    AddTest( "Batch point transforms against one at a time", BatchTransform );
+    AddTest( "Batch transform products against operator*",
+             TransformProducts );
+}
+
+UnitTest::Result TransformPerformanceTestGroup::ModelMatrix()
+{
+    Point3D oScale( 1.5, 2, 0.75 );
+    Point3D oPosition( 4, -5, 6 );
+    Rotation3D oRotation( 0.3, Point3D( 1, 2, 3 ) );
+    Transform3D oBefore = Rotation( 0.2, Point3D::Unit(1) );
+    Transform3D oExpected = Scaling( oScale ) * oRotation.MakeTransform() *
+                            Translation( oPosition );
+    Transform3D oFused;
+    ComposeTRS( oScale, oRotation, oPosition, oFused );
+    if( !Close( oExpected, oFused ) ||
+        !Close( oExpected,
+                ComposeTRS( oScale, oRotation, oPosition ).MakeTransform() ) )
+    {
+        return UnitTest::Fail( "Fused composition differs from products" );
+    }
+    if( !Close( oBefore * oExpected,
+                oBefore * ComposeTRS( oScale, oRotation, oPosition ) ) )
+    {
+        return UnitTest::Fail( "Product with fused composition differs" );
+    }
+
+    volatile double dSum = 0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int i = 0; i < ITERATIONS; ++i )
+    {
+        dSum += ( Transform3D::Identity() * Scaling( oScale ) *
+                  oRotation.MakeTransform() * Translation( oPosition ) *
+                  Transform3D::Identity() )[3][0];
+    }
+    double dProducts = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int i = 0; i < ITERATIONS; ++i )
+    {
+        dSum += ComposeTRS( oScale, oRotation, oPosition, oFused )[3][0];
+    }
+    double dFused = SecondsSince( iStart );
+
+    std::ostringstream oOut;
+    oOut << ITERATIONS << " model matrices - products: " << dProducts
+         << "s, fused: " << dFused << "s";
+    return UnitTest::Pass( oOut.str() );
+}
+
+UnitTest::Result TransformPerformanceTestGroup::FloatTransform()
+{
+    // The same model-view and projection matrices the engine would compose
+    // before each draw call
+    Transform3D oModelView = Translation( 4, -5, 6 ) *
+                             Rotation( 0.3, Point3D( 1, 2, 3 ) ) *
+                             Scaling( 1.5, 2, 0.75 );
+    Transform3D oProjection =
+        PerspectiveProjection( 1, 100, Point2D( 800, 600 ) );
+    Transform3D oDouble = oModelView * oProjection;
+    FloatTransform3D oFloat = FloatTransform3D( oModelView ) *
+                              FloatTransform3D( oProjection );
+    if( !Close( oDouble, Transform3D( oFloat ), 1e-6 ) )
+    {
+        std::ostringstream oOut;
+        oOut << "Single precision product " << oFloat
+             << " should be close to " << oDouble;
+        return UnitTest::Fail( oOut.str() );
+    }
+
+    // Time composing and narrowing each way.  The shader side of the
+    // comparison needs a GPU, so it can't be measured here - on most
+    // consumer GPUs, double-precision math runs at 1/32 the rate of single.
+    volatile double dSum = 0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int i = 0; i < ITERATIONS; ++i )
+    {
+        oDouble = oModelView * oProjection;
+        dSum += oDouble[3][0];
+    }
+    double dDouble = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int i = 0; i < ITERATIONS; ++i )
+    {
+        oFloat = FloatTransform3D( oModelView ) *
+                 FloatTransform3D( oProjection );
+        dSum += oFloat[3][0];
+    }
+    double dSingle = SecondsSince( iStart );
+
+    std::ostringstream oOut;
+    oOut << ITERATIONS << " model-view-projection matrices - double: "
+         << dDouble << "s, single: " << dSingle << "s ("
+         << sizeof( Transform3D ) << " vs " << sizeof( FloatTransform3D )
+         << " bytes uploaded per draw)";
+    return UnitTest::Pass( oOut.str() );
+}
+
+UnitTest::Result TransformPerformanceTestGroup::BatchTransform()
+{
+    // An odd count, so every SIMD path leaves a remainder to finish one at a
+    // time, and a projection, so the divide is exercised too
+    const unsigned int cuiCount = 10007;
+    const unsigned int cuiRepeats = 100;
+    Transform3D oModel = Translation( 4, -5, 6 ) *
+                         Rotation( 0.3, Point3D( 1, 2, 3 ) ) *
+                         Scaling( 1.5, 2, 0.75 );
+    Transform3D oTransform = oModel * Translation( 0, 0, -50 ) *
+        PerspectiveProjection( 1, 100, Point2D( 800, 600 ) );
+    Rotation3D oRotation( 0.7, Point3D( -1, 0.5, 2 ) );
+    std::vector< Point3D > oPoints( cuiCount );
+    std::vector< float > oFloats( 3 * cuiCount );
+    std::vector< double > oX( cuiCount ), oY( cuiCount ), oZ( cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        oPoints[i] = Point3D( std::sin( i * 0.1 ) * 10,
+                              std::cos( i * 0.37 ) * 10,
+                              ( i % 97 ) * 0.2 - 10 );
+        oX[i] = oPoints[i].x();
+        oY[i] = oPoints[i].y();
+        oZ[i] = oPoints[i].z();
+        for( unsigned int j = 0; j < 3; ++j )
+        {
+            oFloats[ 3*i + j ] = float( oPoints[i][j] );
+        }
+    }
+
+    // Compare each layout and type against the per-point operations
+    std::vector< Point3D > oExpected( oPoints ), oActual( oPoints );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        oExpected[i] = ( HVector3D( oPoints[i] ) * oTransform ).Homogenize();
+    }
+    TransformPoints( oTransform, &oActual[0], &oActual[0], cuiCount );
+    TransformPoints( oTransform, &oX[0], &oY[0], &oZ[0],
+                     &oX[0], &oY[0], &oZ[0], cuiCount );
+    TransformPoints( oTransform, &oFloats[0], &oFloats[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        Point3D oSeparate( oX[i], oY[i], oZ[i] );
+        Point3D oFloat( oFloats[ 3*i ], oFloats[ 3*i + 1 ],
+                        oFloats[ 3*i + 2 ] );
+        if( !Close( oExpected[i], oActual[i] ) ||
+            !Close( oExpected[i], oSeparate ) ||
+            !Close( oExpected[i], oFloat, 1e-5 ) )
+        {
+            std::ostringstream oOut;
+            oOut << "Point " << i << " transformed to " << oActual[i] << ", "
+                 << oSeparate << ", and " << oFloat << " instead of "
+                 << oExpected[i];
+            return UnitTest::Fail( oOut.str() );
+        }
+    }
+    TransformDirections( oModel, &oPoints[0], &oActual[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        if( !Close( Point3D( HVector3D( oPoints[i], 0 ) * oModel ),
+                    oActual[i] ) )
+        {
+            return UnitTest::Fail( "Batch direction transform differs" );
+        }
+    }
+    RotatePoints( oRotation, &oPoints[0], &oActual[0], cuiCount );
+    for( unsigned int i = 0; i < cuiCount; ++i )
+    {
+        if( !Close( oRotation.AppliedTo( oPoints[i] ), oActual[i] ) )
+        {
+            return UnitTest::Fail( "Batch rotation differs from quaternion" );
+        }
+    }
+
+    // Time each way of transforming the same points
+    volatile double dSum = 0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiCount; ++i )
+        {
+            oActual[i] = ( HVector3D( oPoints[i] ) * oTransform ).Homogenize();
+        }
+        dSum += oActual[ r ].x();
+    }
+    double dSingle = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        TransformPoints( oTransform, &oPoints[0], &oActual[0], cuiCount );
+        dSum += oActual[ r ].x();
+    }
+    double dBatch = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        TransformPoints( oTransform, &oX[0], &oY[0], &oZ[0],
+                         &oX[0], &oY[0], &oZ[0], cuiCount );
+        dSum += oX[ r ];
+    }
+    double dSeparate = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        TransformPoints( oTransform, &oFloats[0], &oFloats[0], cuiCount );
+        dSum += oFloats[ r ];
+    }
+    double dFloat = SecondsSince( iStart );
+
+    // Batches this large are split across threads, so check and time them
+    // too
+    const unsigned int cuiLargeCount = 100003;
+    const unsigned int cuiLargeRepeats = 10;
+    std::vector< Point3D > oLarge( cuiLargeCount ),
+                           oLargeExpected( cuiLargeCount ),
+                           oLargeActual( cuiLargeCount );
+    for( unsigned int i = 0; i < cuiLargeCount; ++i )
+    {
+        oLarge[i] = oPoints[ i % cuiCount ] + Point3D( 0, 0, i * 1e-4 );
+        oLargeExpected[i] =
+            ( HVector3D( oLarge[i] ) * oTransform ).Homogenize();
+    }
+    TransformPoints( oTransform, &oLarge[0], &oLargeActual[0],
+                     cuiLargeCount );
+    for( unsigned int i = 0; i < cuiLargeCount; ++i )
+    {
+        if( !Close( oLargeExpected[i], oLargeActual[i] ) )
+        {
+            std::ostringstream oOut;
+            oOut << "Threaded batch transformed point " << i << " to "
+                 << oLargeActual[i] << " instead of " << oLargeExpected[i];
+            return UnitTest::Fail( oOut.str() );
+        }
+    }
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiLargeRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiLargeCount; ++i )
+        {
+            oLargeActual[i] =
+                ( HVector3D( oLarge[i] ) * oTransform ).Homogenize();
+        }
+        dSum += oLargeActual[ r ].x();
+    }
+    double dLargeSingle = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiLargeRepeats; ++r )
+    {
+        TransformPoints( oTransform, &oLarge[0], &oLargeActual[0],
+                         cuiLargeCount );
+        dSum += oLargeActual[ r ].x();
+    }
+    double dLargeBatch = SecondsSince( iStart );
+    int iThreads = 1;
+#ifdef _OPENMP
+    iThreads = omp_get_max_threads();
+#endif
+
+    // Points per second, guarding against clock resolution.  std::clock
+    // measures wall time with Visual Studio, so threaded batches show their
+    // speedup.
+    const double cdPoints = double( cuiCount ) * cuiRepeats;
+    const double cdLargePoints = double( cuiLargeCount ) * cuiLargeRepeats;
+    const double cdMinimum = 1.0 / CLOCKS_PER_SEC;
+    std::ostringstream oOut;
+    oOut << "Points per second - one at a time: "
+         << cdPoints / std::max( dSingle, cdMinimum )
+         << ", batch: " << cdPoints / std::max( dBatch, cdMinimum )
+         << ", separate arrays: "
+         << cdPoints / std::max( dSeparate, cdMinimum )
+         << ", single precision: "
+         << cdPoints / std::max( dFloat, cdMinimum )
+         << "; " << cuiLargeCount << " points on " << iThreads
+         << " threads - one at a time: "
+         << cdLargePoints / std::max( dLargeSingle, cdMinimum )
+         << ", batch: " << cdLargePoints / std::max( dLargeBatch, cdMinimum );
+    return UnitTest::Pass( oOut.str() );
+}
+
+UnitTest::Result TransformPerformanceTestGroup::TransformProducts()
+{
+    // Rigid transforms with a little scaling, like the local transforms of a
+    // scene graph
+    const unsigned int cuiMax = 100000;
+    std::vector< Transform3D > oLeft( cuiMax ), oRight( cuiMax ),
+                               oSingle( cuiMax ), oBatch( cuiMax );
+    for( unsigned int i = 0; i < cuiMax; ++i )
+    {
+        oLeft[i] = Rotation( i * 0.37, Point3D( 1, i % 7, -2 ) ) *
+                   Translation( i % 5, -1.5, i * 0.01 );
+        oRight[i] = Scaling( 1 + ( i % 3 ) * 0.25 ) *
+                    Rotation( i * 0.11, Point3D( i % 5, 1, 3 ) );
+    }
+
+    // Check every overload against operator*, which should match exactly
+    const unsigned int cuiCheck = 1001;
+    MultiplyMany( &oLeft[0], &oRight[0], &oBatch[0], cuiCheck );
+    for( unsigned int i = 0; i < cuiCheck; ++i )
+    {
+        if( oLeft[i] * oRight[i] != oBatch[i] )
+        {
+            return UnitTest::Fail( "MultiplyMany differs from operator*" );
+        }
+    }
+    MultiplyMany( &oLeft[0], oRight[0], &oBatch[0], cuiCheck );
+    for( unsigned int i = 0; i < cuiCheck; ++i )
+    {
+        if( oLeft[i] * oRight[0] != oBatch[i] )
+        {
+            return UnitTest::Fail( "Shared right-hand transform differs" );
+        }
+    }
+    MultiplyMany( oLeft[0], &oRight[0], &oBatch[0], cuiCheck );
+    for( unsigned int i = 0; i < cuiCheck; ++i )
+    {
+        if( oLeft[0] * oRight[i] != oBatch[i] )
+        {
+            return UnitTest::Fail( "Shared left-hand transform differs" );
+        }
+    }
+    std::vector< FloatTransform3D > oFloatLeft, oFloatRight;
+    for( unsigned int i = 0; i < cuiCheck; ++i )
+    {
+        oFloatLeft.push_back( FloatTransform3D( oLeft[i] ) );
+        oFloatRight.push_back( FloatTransform3D( oRight[i] ) );
+    }
+    std::vector< FloatTransform3D > oFloatBatch( oFloatLeft );
+    MultiplyMany( &oFloatBatch[0], &oFloatRight[0], &oFloatBatch[0],
+                  cuiCheck );
+    for( unsigned int i = 0; i < cuiCheck; ++i )
+    {
+        if( oFloatLeft[i] * oFloatRight[i] != oFloatBatch[i] )
+        {
+            return UnitTest::Fail( "Single precision MultiplyMany differs" );
+        }
+    }
+
+    // A chain with a branch: 0 <- 1 <- 2 <- 3 and 1 <- 4, plus a second root
+    const unsigned int cauiParent[] = { 0, 0, 1, 2, 1, 5 };
+    Transform3D aoWorld[6];
+    ComposeHierarchy( &oLeft[0], cauiParent, aoWorld, 6 );
+    Transform3D aoExpected[6] = { oLeft[0] };
+    for( unsigned int i = 1; i < 6; ++i )
+    {
+        aoExpected[i] = ( cauiParent[i] < i )
+                        ? oLeft[i] * aoExpected[ cauiParent[i] ] : oLeft[i];
+        if( aoExpected[i] != aoWorld[i] )
+        {
+            return UnitTest::Fail( "ComposeHierarchy differs from operator*" );
+        }
+    }
+
+    // Time products of 1k, 10k, and 100k transforms, repeated so that each
+    // size does the same total work.  The two larger sizes are split across
+    // threads.
+    const unsigned int cauiCounts[] = { 1000, 10000, 100000 };
+    int iThreads = 1;
+#ifdef _OPENMP
+    iThreads = omp_get_max_threads();
+#endif
+    std::ostringstream oOut;
+    oOut << "Millions of products per second on " << iThreads
+         << " threads, one at a time/batch -";
+    volatile double dSum = 0;
+    for( unsigned int c = 0; c < 3; ++c )
+    {
+        const unsigned int cuiCount = cauiCounts[c];
+        const unsigned int cuiRepeats = ( ITERATIONS * 10 ) / cuiCount;
+        std::clock_t iStart = std::clock();
+        for( unsigned int r = 0; r < cuiRepeats; ++r )
+        {
+            for( unsigned int i = 0; i < cuiCount; ++i )
+            {
+                oSingle[i] = oLeft[i] * oRight[i];
+            }
+            dSum += oSingle[ r % cuiCount ][0][0];
+        }
+        double dSingle = SecondsSince( iStart );
+        iStart = std::clock();
+        for( unsigned int r = 0; r < cuiRepeats; ++r )
+        {
+            MultiplyMany( &oLeft[0], &oRight[0], &oBatch[0], cuiCount );
+            dSum += oBatch[ r % cuiCount ][0][0];
+        }
+        double dBatch = SecondsSince( iStart );
+        for( unsigned int i = 0; i < cuiCount; ++i )
+        {
+            if( oSingle[i] != oBatch[i] )
+            {
+                std::ostringstream oError;
+                oError << "MultiplyMany of " << cuiCount
+                       << " transforms differs at element " << i;
+                return UnitTest::Fail( oError.str() );
+            }
+        }
+        const double cdProducts = double( cuiCount ) * cuiRepeats / 1e6;
+        const double cdMinimum = 1.0 / CLOCKS_PER_SEC;
+        oOut << ( 0 == c ? " " : "; " ) << cuiCount << ": "
+             << cdProducts / std::max( dSingle, cdMinimum ) << "/"
+             << cdProducts / std::max( dBatch, cdMinimum );
+    }
+    return UnitTest::Pass( oOut.str() );
+}
@@ -0,0 +1,32 @@
+/******************************************************************************
+ * File:               TransformPerformanceTestGroup.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares fused, single precision, and batch transforms
+ *                      against the matrix products they replaced and reports
+ *                      how long each takes.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef TRANSFORM_PERFORMANCE_TEST_GROUP__H
+#define TRANSFORM_PERFORMANCE_TEST_GROUP__H
+
+#include "UnitTestGroup.h"
+
+class TransformPerformanceTestGroup : public UnitTestGroup
+{
+public:
+
+    TransformPerformanceTestGroup();
+
+private:
+
+    static UnitTest::Result ModelMatrix();
+    static UnitTest::Result FloatTransform();
+    static UnitTest::Result BatchTransform();
+    static UnitTest::Result TransformProducts();
+
+};
+
+#endif  // TRANSFORM_PERFORMANCE_TEST_GROUP__H
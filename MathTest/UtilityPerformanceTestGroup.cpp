@@ -0,0 +1,439 @@
+/******************************************************************************
+ * File:               UtilityPerformanceTestGroup.cpp
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares dynamic arrays, borrowed strings, and interned
+ *                      atoms against the standard library and reports how long
+ *                      each takes.  Timings are only meaningful in release
+ *                      builds.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Atom counts don't depend on earlier tests.
+ ******************************************************************************/
+
+#include "UtilityPerformanceTestGroup.h"
+#include "MathLibrary.h"
+#include "PerformanceTest.h"
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+using namespace Space;
+
+UtilityPerformanceTestGroup::UtilityPerformanceTestGroup()
+    : UnitTestGroup("Utility performance tests")
+{
+    AddTest( "Dynamic array appends and copies against std::vector",
+             ArrayGrowth );
+    AddTest( "Borrowed string lookups against copying the key", StringLookup );
+    AddTest( "Interned atom lookups against string keys", AtomLookup );
+}
+
+UnitTest::Result UtilityPerformanceTestGroup::ArrayGrowth()
+{
+    using Utility::DynamicArray;
+
+    // Appending should grow geometrically and keep every element, including
+    // copies of elements already in the array
+    DynamicArray< unsigned int > oNumbers;
+    unsigned int uiReallocations = 0;
+    for( unsigned int i = 0; i < 10000; ++i )
+    {
+        const unsigned int cuiCapacity = oNumbers.Capacity();
+        if( 0 == i % 100 && 0 < i )
+        {
+            oNumbers.PushBack( oNumbers[ i - 1 ] );
+            ++oNumbers.Unchecked( i );
+        }
+        else
+        {
+            oNumbers.PushBack( i );
+        }
+        uiReallocations += ( cuiCapacity != oNumbers.Capacity() ? 1 : 0 );
+    }
+    for( unsigned int i = 0; i < 10000; ++i )
+    {
+        if( oNumbers.Unchecked( i ) != i )
+        {
+            return UnitTest::Fail( "Appended numbers differ" );
+        }
+    }
+    if( uiReallocations > 30 )
+    {
+        return UnitTest::Fail( "Appending doesn't grow geometrically" );
+    }
+
+    // Shrinking keeps the memory, and copies and moves keep the elements
+    const unsigned int cuiCapacity = oNumbers.Capacity();
+    oNumbers.SetSize( 10 );
+    DynamicArray< unsigned int > oCopy( oNumbers );
+    DynamicArray< unsigned int > oMoved( std::move( oCopy ) );
+    if( oNumbers.Capacity() != cuiCapacity || 0 != oCopy.Size() ||
+        10 != oMoved.Size() || 9 != oMoved[9] )
+    {
+        return UnitTest::Fail( "Array didn't survive shrinking and moving" );
+    }
+
+    // Elements that aren't trivially copyable still get copied one by one
+    DynamicArray< std::string > oNames( 3, "name" );
+    for( unsigned int i = 0; i < 100; ++i )
+    {
+        oNames.PushBack( oNames[ i ] + "s" );
+    }
+    DynamicArray< std::string > oOtherNames( 200, "other" );
+    oOtherNames = oNames;
+    oNames.EmplaceBack( 3, 'x' );
+    if( 103 != oOtherNames.Size() || "names" != oOtherNames[3] ||
+        oOtherNames[102] != oNames[102] || "xxx" != oNames[103] )
+    {
+        return UnitTest::Fail( "Strings didn't survive appending and copying" );
+    }
+    bool bThrown = false;
+    try
+    {
+        oOtherNames[103];
+    }
+    catch( std::out_of_range& )
+    {
+        bThrown = true;
+    }
+    if( !bThrown )
+    {
+        return UnitTest::Fail( "Index outside array bounds didn't throw" );
+    }
+
+    // Time appending one element at a time
+    const unsigned int cuiCount = 10000;
+    const unsigned int cuiRepeats = ITERATIONS / 100;
+    const double cdValues = double( cuiCount ) * cuiRepeats / 1e6;
+    const double cdMinimum = 1.0 / CLOCKS_PER_SEC;
+    volatile unsigned int uiSum = 0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        std::vector< unsigned int > oVector;
+        for( unsigned int i = 0; i < cuiCount; ++i )
+        {
+            oVector.push_back( i ^ r );
+        }
+        uiSum += oVector[ r % cuiCount ];
+    }
+    double dVector = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        DynamicArray< unsigned int > oArray;
+        for( unsigned int i = 0; i < cuiCount; ++i )
+        {
+            oArray.PushBack( i ^ r );
+        }
+        uiSum += oArray.Unchecked( r % cuiCount );
+    }
+    double dArray = SecondsSince( iStart );
+    std::ostringstream oOut;
+    oOut << "Millions of elements per second, std::vector/DynamicArray - "
+         << "append: " << cdValues / std::max( dVector, cdMinimum ) << "/"
+         << cdValues / std::max( dArray, cdMinimum );
+
+    // Time copying whole arrays
+    std::vector< unsigned int > oVectorSource( cuiCount, 7 ), oVectorCopy;
+    DynamicArray< unsigned int > oArraySource( cuiCount, 7 ), oArrayCopy;
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        oVectorSource[ r % cuiCount ] = r;
+        oVectorCopy = oVectorSource;
+        uiSum += oVectorCopy[ r % cuiCount ];
+    }
+    dVector = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        oArraySource.Unchecked( r % cuiCount ) = r;
+        oArrayCopy = oArraySource;
+        uiSum += oArrayCopy.Unchecked( r % cuiCount );
+    }
+    dArray = SecondsSince( iStart );
+    oOut << "; copy: " << cdValues / std::max( dVector, cdMinimum ) << "/"
+         << cdValues / std::max( dArray, cdMinimum );
+    return UnitTest::Pass( oOut.str() );
+}
+
+UnitTest::Result UtilityPerformanceTestGroup::StringLookup()
+{
+    using Utility::DumbString;
+    using Utility::DumbStringView;
+
+    // Symbol names and shader paths should fit in the local buffer
+    static const char* const sc_apcNames[] =
+    {
+        "quot", "amp", "lt", "gt", "euro", "hellip", "dagger", "permil",
+        "lsquo", "rsquo", "ldquo", "rdquo", "bull", "ndash", "mdash", "trade",
+        "nbsp", "iexcl", "cent", "pound", "yen", "sect", "copy", "laquo",
+        "reg", "deg", "plusmn", "micro", "para", "middot", "frac12", "iquest",
+        "Agrave", "Eacute", "Ntilde", "Ouml", "szlig", "eacute", "ntilde",
+        "divide", "oslash", "uuml", "yuml", "spades", "clubs", "hearts",
+        "diams", "resources/shaders/SpriteVertex.glsl",
+        "resources/shaders/SpriteFragmentDouble.glsl",
+        "resources/shaders/QuadVertexDouble.glsl"
+    };
+    const unsigned int cuiNames = sizeof( sc_apcNames ) / sizeof( char* );
+    unsigned int uiHeapKeys = 0;
+    for( unsigned int i = 0; i < cuiNames; ++i )
+    {
+        const DumbString coName( sc_apcNames[i] );
+        uiHeapKeys +=
+            ( coName.Capacity() > DumbString::LOCAL_CAPACITY ? 1 : 0 );
+    }
+    if( 0 < uiHeapKeys )
+    {
+        return UnitTest::Fail( "Short strings used heap memory" );
+    }
+
+    // Views of part of a larger string hash and compare like whole strings,
+    // and borrowed strings point at the original characters
+    const char* const cpcText = "I &hearts; NY";
+    DumbStringView oView( cpcText + 3, 6 );
+    const DumbString& croBorrowed = DumbString::Borrow( oView );
+    DumbString oHearts( "hearts" );
+    if( oView.Hash() != oHearts.Hash() || oView != DumbStringView( oHearts ) ||
+        croBorrowed.Hash() != oHearts.Hash() || croBorrowed != oHearts ||
+        cpcText + 3 != croBorrowed.CString() || 0 != croBorrowed.Capacity() )
+    {
+        return UnitTest::Fail( "Views don't match whole strings" );
+    }
+
+    // Moving a long string hands over its memory, and appending past the
+    // local buffer keeps what was there
+    DumbString oLong;
+    for( unsigned int i = 0; i < 200; ++i )
+    {
+        oLong += (char)( 'a' + i % 26 );
+    }
+    const char* const cpcLong = oLong.CString();
+    DumbString oMoved( std::move( oLong ) );
+    if( 200 != oMoved.Size() || 'z' != oMoved[25] || 'r' != oMoved[199] ||
+        cpcLong != oMoved.CString() || !oLong.IsEmpty() )
+    {
+        return UnitTest::Fail( "Long string didn't survive moving" );
+    }
+    oHearts[0] = 'H';
+    if( oHearts.Hash() == oView.Hash() )
+    {
+        return UnitTest::Fail( "Cached hash wasn't updated" );
+    }
+
+    // Time looking up names by literal
+    std::unordered_map< DumbString, unsigned int > oDumbMap;
+    std::unordered_map< std::string, unsigned int > oStdMap;
+    for( unsigned int i = 0; i < cuiNames; ++i )
+    {
+        oDumbMap[ sc_apcNames[i] ] = i;
+        oStdMap[ sc_apcNames[i] ] = i;
+    }
+    const unsigned int cuiRepeats = ITERATIONS / 10;
+    const double cdLookups = double( cuiNames ) * cuiRepeats / 1e6;
+    const double cdMinimum = 1.0 / CLOCKS_PER_SEC;
+    volatile unsigned int uiSum = 0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiNames; ++i )
+        {
+            uiSum += oStdMap.find( sc_apcNames[i] )->second;
+        }
+    }
+    double dStd = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiNames; ++i )
+        {
+            uiSum += oDumbMap.find( DumbString( sc_apcNames[i] ) )->second;
+        }
+    }
+    double dCopied = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiNames; ++i )
+        {
+            const DumbString& croName = DumbString::Borrow( sc_apcNames[i] );
+            uiSum += oDumbMap.find( croName )->second;
+        }
+    }
+    double dBorrowed = SecondsSince( iStart );
+    std::ostringstream oOut;
+    oOut << "Millions of lookups per second, std::string/copied/borrowed - "
+         << cdLookups / std::max( dStd, cdMinimum ) << "/"
+         << cdLookups / std::max( dCopied, cdMinimum ) << "/"
+         << cdLookups / std::max( dBorrowed, cdMinimum ) << "; keys needing "
+         << "heap memory, before/after - " << cuiNames << "/" << uiHeapKeys;
+    return UnitTest::Pass( oOut.str() );
+}
+
+UnitTest::Result UtilityPerformanceTestGroup::AtomLookup()
+{
+    using Utility::Atom;
+    using Utility::AtomMap;
+    using Utility::DumbString;
+
+    static const char* const sc_apcNames[] =
+    {
+        "quot", "amp", "lt", "gt", "euro", "hellip", "dagger", "permil",
+        "lsquo", "rsquo", "ldquo", "rdquo", "bull", "ndash", "mdash", "trade",
+        "nbsp", "iexcl", "cent", "pound", "yen", "sect", "copy", "laquo",
+        "reg", "deg", "plusmn", "micro", "para", "middot", "frac12", "iquest",
+        "resources/shaders/SpriteVertex.glsl",
+        "resources/shaders/SpriteFragmentDouble.glsl",
+        "resources/shaders/QuadVertexDouble.glsl"
+    };
+    const unsigned int cuiNames = sizeof( sc_apcNames ) / sizeof( char* );
+
+    // Looking for a string that was never interned doesn't add it, and
+    // interning it adds exactly one atom.  Atoms are never removed, so count
+    // up until a name turns up that nothing has interned yet.
+    std::string oUnused;
+    Atom oFound;
+    for( unsigned int i = 0;
+         oUnused.empty() || Atom::Find( oUnused.c_str(), oFound ); ++i )
+    {
+        std::ostringstream oName;
+        oName << "AtomLookup unused name " << i;
+        oUnused = oName.str();
+    }
+    const Atom coMarker( "hearts" );
+    oFound = coMarker;
+    const unsigned int cuiCountBefore = Atom::Count();
+    if( Atom::Find( oUnused.c_str(), oFound ) || oFound != coMarker ||
+        cuiCountBefore != Atom::Count() )
+    {
+        return UnitTest::Fail( "Finding an atom changed the pool" );
+    }
+    const Atom coUnused( oUnused.c_str() );
+    if( cuiCountBefore + 1 != Atom::Count() ||
+        !Atom::Find( oUnused.c_str(), oFound ) || oFound != coUnused ||
+        !Atom().IsEmpty() || Atom( "" ) != Atom() )
+    {
+        return UnitTest::Fail( "Interning a new string didn't add one atom" );
+    }
+
+    // Equal strings get the same ID and the same characters, no matter where
+    // they come from or which thread interns them first
+    std::vector< Atom > oAtoms( cuiNames );
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for( int i = 0; i < (int)( 4 * cuiNames ); ++i )
+    {
+        const unsigned int cuiName = i % cuiNames;
+        const std::string coCopy( sc_apcNames[ cuiName ] );
+        const Atom coAtom( coCopy.c_str() );
+        if( i < (int)cuiNames )
+        {
+            oAtoms[ cuiName ] = coAtom;
+        }
+    }
+    for( unsigned int i = 0; i < cuiNames; ++i )
+    {
+        Atom oFound;
+        if( !Atom::Find( sc_apcNames[i], oFound ) || oFound != oAtoms[i] ||
+            oAtoms[i] != Atom( std::string( sc_apcNames[i] ).c_str() ) ||
+            oAtoms[i].CString() != Atom( sc_apcNames[i] ).CString() ||
+            std::string( sc_apcNames[i] ) != oAtoms[i].CString() ||
+            std::strlen( sc_apcNames[i] ) != oAtoms[i].Size() ||
+            Atom::FromID( oAtoms[i].ID() ) != oAtoms[i] ||
+            ( 0 < i && oAtoms[i] == oAtoms[i - 1] ) )
+        {
+            return UnitTest::Fail( "Equal strings interned differently" );
+        }
+    }
+
+    // Flat maps keep their keys sorted and find what was put in them
+    AtomMap< unsigned int > oAtomMap;
+    for( unsigned int i = cuiNames; 0 < i; --i )
+    {
+        oAtomMap[ oAtoms[i - 1] ] = i - 1;
+    }
+    oAtomMap.Remove( oAtoms[0] );
+    if( cuiNames - 1 != oAtomMap.Size() || oAtomMap.Has( oAtoms[0] ) ||
+        oAtomMap.Remove( oAtoms[0] ) || nullptr != oAtomMap.Find( Atom() ) )
+    {
+        return UnitTest::Fail( "Flat atom map has the wrong entries" );
+    }
+    for( unsigned int i = 1; i < oAtomMap.Size(); ++i )
+    {
+        if( !( oAtomMap.KeyAt( i - 1 ) < oAtomMap.KeyAt( i ) ) ||
+            oAtoms[ oAtomMap.ValueAt( i ) ] != oAtomMap.KeyAt( i ) )
+        {
+            return UnitTest::Fail( "Flat atom map isn't sorted" );
+        }
+    }
+    oAtomMap[ oAtoms[0] ] = 0;
+
+    // Time looking up names already in hand, as atoms and as strings
+    std::unordered_map< DumbString, unsigned int > oDumbMap;
+    std::vector< DumbString > oStrings;
+    for( unsigned int i = 0; i < cuiNames; ++i )
+    {
+        oDumbMap[ sc_apcNames[i] ] = i;
+        oStrings.push_back( DumbString( sc_apcNames[i] ) );
+    }
+    const unsigned int cuiRepeats = ITERATIONS / 10;
+    const double cdLookups = double( cuiNames ) * cuiRepeats / 1e6;
+    const double cdMinimum = 1.0 / CLOCKS_PER_SEC;
+    volatile unsigned int uiSum = 0;
+    std::clock_t iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiNames; ++i )
+        {
+            uiSum += oDumbMap.find( oStrings[i] )->second;
+        }
+    }
+    double dString = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiNames; ++i )
+        {
+            uiSum += *oAtomMap.Find( oAtoms[i] );
+        }
+    }
+    double dAtom = SecondsSince( iStart );
+
+    // Time comparing names for equality
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiNames; ++i )
+        {
+            uiSum += ( 0 == oStrings[i].Compare( oStrings[ r % cuiNames ] )
+                       ? 1 : 0 );
+        }
+    }
+    double dStringEqual = SecondsSince( iStart );
+    iStart = std::clock();
+    for( unsigned int r = 0; r < cuiRepeats; ++r )
+    {
+        for( unsigned int i = 0; i < cuiNames; ++i )
+        {
+            uiSum += ( oAtoms[i] == oAtoms[ r % cuiNames ] ? 1 : 0 );
+        }
+    }
+    double dAtomEqual = SecondsSince( iStart );
+    std::ostringstream oOut;
+    oOut << "Millions per second, strings/atoms - lookups: "
+         << cdLookups / std::max( dString, cdMinimum ) << "/"
+         << cdLookups / std::max( dAtom, cdMinimum ) << "; comparisons: "
+         << cdLookups / std::max( dStringEqual, cdMinimum ) << "/"
+         << cdLookups / std::max( dAtomEqual, cdMinimum );
+    return UnitTest::Pass( oOut.str() );
+}
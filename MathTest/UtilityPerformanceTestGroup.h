@@ -0,0 +1,31 @@
+/******************************************************************************
+ * File:               UtilityPerformanceTestGroup.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Compares dynamic arrays, borrowed strings, and interned
+ *                      atoms against the standard library and reports how long
+ *                      each takes.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef UTILITY_PERFORMANCE_TEST_GROUP__H
+#define UTILITY_PERFORMANCE_TEST_GROUP__H
+
+#include "UnitTestGroup.h"
+
+class UtilityPerformanceTestGroup : public UnitTestGroup
+{
+public:
+
+    UtilityPerformanceTestGroup();
+
+private:
+
+    static UnitTest::Result ArrayGrowth();
+    static UnitTest::Result StringLookup();
+    static UnitTest::Result AtomLookup();
+
+};
+
+#endif  // UTILITY_PERFORMANCE_TEST_GROUP__H
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       January 5, 2014
  * Description:        Vector2 tests.
- * Last Modified:      February 5, 2014
- * Last Modification:  Refactoring.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Point coordinates are now accessor functions.
  ******************************************************************************/
 
 #include "Vector2TestGroup.h"
@@ -50,7 +50,7 @@ UnitTest::Result Vector2TestGroup::DotProduct()
     // times said other's magnitude
     Point2D oXAxis( 2, 0 );
     dDot = oVector.Dot( oXAxis );
-    if( dDot != oVector.x * oXAxis.Magnitude() )
+    if( dDot != oVector.x() * oXAxis.Magnitude() )
     {
         return UnitTest::Fail( "Dot product of two vectors not equal to"
                                " projection of first onto second times"
@@ -3,12 +3,13 @@
  * Author:             Elizabeth Lowry
  * Date Created:       January 5, 2014
  * Description:        Vector4 tests.
- * Last Modified:      February 25, 2014
- * Last Modification:  Changed ColorVector from 8-bit Channel to float.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added quaternion self-multiplication test.
  ******************************************************************************/
 
 #include "Vector4TestGroup.h"
 #include "MathLibrary.h"
+#include <cmath>
 
 Vector4TestGroup::Vector4TestGroup()
     : UnitTestGroup("Vector4 tests")
@@ -16,17 +17,19 @@ Vector4TestGroup::Vector4TestGroup()
     AddTest( "Create from color Hex constant", ColorConstInit );
     AddTest( "Create from color Hex integer", ColorHexInit );
     AddTest( "Bitwise operation on color vector", ColorBitwiseOp );
+    AddTest( "Copy color vector", ColorCopy );
     AddTest( "Normalization and magnitude", Normalization );
+    AddTest( "Multiply quaternion by itself", QuaternionSelfMultiply );
 }
 
 UnitTest::Result Vector4TestGroup::ColorConstInit()
 {
     Color::ColorVector oColor( Color::VGA::GREEN );
-    if( oColor.a != 1.0f )
+    if( oColor.a() != 1.0f )
     {
         return UnitTest::Fail( "Wrong alpha value" );
     }
-    if( oColor.r != 0.0f )
+    if( oColor.r() != 0.0f )
     {
         return UnitTest::Fail( "Wrong red value" );
     }
@@ -44,11 +47,11 @@ UnitTest::Result Vector4TestGroup::ColorConstInit()
 UnitTest::Result Vector4TestGroup::ColorHexInit()
 {
     Color::ColorVector oColor( 0xFF007F00 );
-    if( oColor.a != 1.0f )
+    if( oColor.a() != 1.0f )
     {
         return UnitTest::Fail( "Wrong alpha value" );
     }
-    if( oColor.r != 0.0f )
+    if( oColor.r() != 0.0f )
     {
         return UnitTest::Fail( "Wrong red value" );
     }
@@ -67,11 +70,11 @@ UnitTest::Result Vector4TestGroup::ColorBitwiseOp()
 {
     Color::ColorVector oColor( 0xFF000000 );
     oColor |= 0x00007F00;
-    if( oColor.a != 1.0f )
+    if( oColor.a() != 1.0f )
     {
         return UnitTest::Fail( "Wrong alpha value" );
     }
-    if( oColor.r != 0.0f )
+    if( oColor.r() != 0.0f )
     {
         return UnitTest::Fail( "Wrong red value" );
     }
@@ -86,6 +89,28 @@ UnitTest::Result Vector4TestGroup::ColorBitwiseOp()
     return UnitTest::PASS;
 }
 
+UnitTest::Result Vector4TestGroup::ColorCopy()
+{
+    Color::ColorVector oColor( Color::VGA::GREEN );
+    Color::ColorVector oCopy( oColor );
+    oCopy.r() = 0.5f;
+    if( oColor.r() != 0.0f )
+    {
+        return UnitTest::Fail( "Copy shares channels with original" );
+    }
+    if( oCopy.r() != 0.5f || oCopy.g() != oColor.g() ||
+        oCopy.b() != oColor.b() || oCopy.a() != oColor.a() )
+    {
+        return UnitTest::Fail( "Wrong copied channel values" );
+    }
+    oColor = oCopy;
+    if( oColor != oCopy )
+    {
+        return UnitTest::Fail( "Assignment did not copy all channels" );
+    }
+    return UnitTest::PASS;
+}
+
 UnitTest::Result Vector4TestGroup::Normalization()
 {
     double adData[4] = { 1.0, 2.0, 3.0, 4.0 };
@@ -109,3 +134,25 @@ UnitTest::Result Vector4TestGroup::Normalization()
     }
     return UnitTest::PASS;
 }
+
+UnitTest::Result Vector4TestGroup::QuaternionSelfMultiply()
+{
+    Space::Quaternion oRotation( 0.6, Space::Point3D( 1.0, 2.0, -2.0 ) );
+    Space::Quaternion oCopy( oRotation );
+    Space::Quaternion oExpected = oCopy * oRotation;
+    oRotation *= oRotation;
+    if( oRotation != oExpected )
+    {
+        return UnitTest::Fail( "Self-multiplication differs from multiplying "
+                               "by a copy" );
+    }
+    Space::Quaternion oDouble( 1.2, Space::Point3D( 1.0, 2.0, -2.0 ) );
+    for( unsigned int i = 0; i < 4; ++i )
+    {
+        if( std::abs( oRotation[i] - oDouble[i] ) > 1e-12 )
+        {
+            return UnitTest::Fail( "Squared rotation isn't twice the angle" );
+        }
+    }
+    return UnitTest::PASS;
+}
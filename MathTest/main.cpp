@@ -3,14 +3,21 @@
  * Author:             Elizabeth Lowry
  * Date Created:       January 5, 2014
  * Description:        Runs a list of unit test groups.
- * Last Modified:      January 5, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Split performance tests by area.
  ******************************************************************************/
 
 #include "UnitTester.h"
+#include "ColorPerformanceTestGroup.h"
+#include "DenseMatrixPerformanceTestGroup.h"
+#include "FunctionPerformanceTestGroup.h"
 #include "MathTestGroup.h"
 #include "Matrix3x3TestGroup.h"
 #include "Matrix4x4TestGroup.h"
+#include "MatrixPerformanceTestGroup.h"
+#include "QuaternionPerformanceTestGroup.h"
+#include "TransformPerformanceTestGroup.h"
+#include "UtilityPerformanceTestGroup.h"
 #include "Vector2TestGroup.h"
 #include "Vector3TestGroup.h"
 #include "Vector4TestGroup.h"
@@ -28,6 +35,13 @@ int main(int argc, char* argv[])
     oTester.AddTestGroup( Vector3TestGroup() );
     oTester.AddTestGroup( Vector4TestGroup() );
     oTester.AddTestGroup( MathTestGroup() );
+    oTester.AddTestGroup( MatrixPerformanceTestGroup() );
+    oTester.AddTestGroup( DenseMatrixPerformanceTestGroup() );
+    oTester.AddTestGroup( TransformPerformanceTestGroup() );
+    oTester.AddTestGroup( QuaternionPerformanceTestGroup() );
+    oTester.AddTestGroup( FunctionPerformanceTestGroup() );
+    oTester.AddTestGroup( ColorPerformanceTestGroup() );
+    oTester.AddTestGroup( UtilityPerformanceTestGroup() );
 
     // run
     oTester( std::cout );
@@ -3,13 +3,14 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 21, 2014
  * Description:        Class mapping character symbols or codes to char values.
- * Last Modified:      March 21, 2014
- * Last Modification:  Creation.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Names are interned, with overloads taking atoms.
  ******************************************************************************/
 
 #ifndef CHARACTER_MAP__H
 #define CHARACTER_MAP__H
 
+#include "MathLibrary.h"
 #include "MyFirstEngineMacros.h"
 
 namespace MyFirstEngine
@@ -29,6 +30,12 @@ public:
     char& operator[]( const char* ac_pcName );
     const char& operator[]( const char* ac_pcName ) const;
 
+    // Names are interned, so looking up by atom skips hashing the name
+    bool Has( Utility::Atom a_oName ) const;
+    CharacterMap& Remove( Utility::Atom a_oName );
+    char& operator[]( Utility::Atom a_oName );
+    const char& operator[]( Utility::Atom a_oName ) const;
+
     // returned by const operator[] for symbols not in the map
     static const char ABSENT_CHARACTER = 0;
 
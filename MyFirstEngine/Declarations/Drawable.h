@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 24, 2014
  * Description:        Base class for drawable objects.
- * Last Modified:      March 12, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Model matrix cache is only allocated when needed.
  ******************************************************************************/
 
 #ifndef DRAWABLE__H
@@ -34,7 +34,7 @@ public:
     Drawable& operator=( const Drawable& ac_roObject );
 
     // Destructor deallocates the dynamically stored modelview transform cache
-    // and flag.
+    // (if it was ever allocated) and flag.
     virtual ~Drawable();
 
     // Draw the object to the screen
@@ -51,15 +51,28 @@ public:
     bool IsVisible() const { return m_bVisible; }
 
     // Get rotation properties
-    double GetPitch() const { return m_oRotation.GetPitch(); }
-    double GetRoll() const { return m_oRotation.GetRoll(); }
-    double GetYaw() const { return m_oRotation.GetYaw(); }
-    double GetRotationAngle() const { return m_oRotation.GetAngle(); }
-    Point3D GetRotationAxis() const { return m_oRotation.GetAxis(); }
-    const Rotation3D& GetRotation() const { return m_oRotation; }
+    double GetPitch() const { return GetRotation().GetPitch(); }
+    double GetRoll() const { return GetRotation().GetRoll(); }
+    double GetYaw() const { return GetRotation().GetYaw(); }
+    double GetRotationAngle() const { return GetRotation().GetAngle(); }
+    Point3D GetRotationAxis() const { return GetRotation().GetAxis(); }
+    Rotation3D GetRotation() const;
     void GetTaitBryanAngles( double& a_rdYaw, double& a_rdPitch,
                              double& a_rdRoll ) const
-    { m_oRotation.GetTaitBryanAngles( a_rdYaw, a_rdPitch, a_rdRoll ); }
+    { GetRotation().GetTaitBryanAngles( a_rdYaw, a_rdPitch, a_rdRoll ); }
+
+    // Planar mode, for objects that stay flat on the XY plane.  Rotation is
+    // kept as a unit complex number (cosine, sine) about the z-axis and the
+    // model matrix as a 2D affine transform, which is only expanded when the
+    // object is drawn.  The z position still sets the depth, but the z scale
+    // is ignored.  Turning planar mode on keeps only the direction the x-axis
+    // points in on the XY plane.  Setting a rotation about any other axis
+    // turns planar mode off again.
+    bool IsPlanar() const { return m_bPlanar; }
+    Drawable& SetPlanar( bool a_bPlanar = true );
+    double GetPlanarAngle() const;
+    Point2D GetPlanarRotation() const;
+    Drawable& SetPlanarAngle( double a_dRadians = 0.0 ); // turns planar mode on
 
     // Get the cached model view transformation resulting from this object's
     // scale/rotation/position/etc.  If any of those properties have changed
@@ -161,6 +174,32 @@ protected:
     // takes place.
     virtual void DrawComponents() const = 0;
 
+    // Compute the complete model transformation into the given matrix,
+    // optionally preceded by another transformation.  Before and after
+    // transformations are skipped when they are identity.  In planar mode
+    // with no before transformation, the cached planar matrix is used, so
+    // anything that comes first must already be part of it.
+    void ComposeModelMatrix( Transform3D& a_roResult,
+                             const Affine3D* ac_cpoFirst = nullptr ) const;
+
+    // Get the cached model matrix, allocating it the first time and marking it
+    // as needing to be calculated
+    Transform3D& ModelMatrixCache() const;
+
+    // Get the cached planar model transformation, recalculating it if needed.
+    // Only call this in planar mode.  Before and after transformations aren't
+    // included.
+    virtual const Affine2D& GetPlanarMatrix() const;
+
+    // Compute the planar model transformation into the given matrix,
+    // optionally preceded by another transformation
+    void ComposePlanarMatrix( Affine2D& a_roResult,
+                              const Affine2D* ac_cpoFirst = nullptr ) const;
+
+    // Switch back to full 3D rotation before changing the rotation in a way
+    // that planar mode can't represent
+    void LeavePlanar();
+
     // Default color for everything
     Color::ColorVector m_oColor;
 
@@ -177,15 +216,37 @@ protected:
     // due to the above properties
     Transform3D m_oBeforeTransform;
 
+    // Most objects have no additional transformations, so keep track of that
+    // to skip multiplying by identity matrices
+    bool m_bAfterIsIdentity;
+    bool m_bBeforeIsIdentity;
+
     // Is this object even visible?
     bool m_bVisible;
 
     // Cache the complete transformation for cases when it doesn't change.
     // When it does change, set a flag indicating that the cached matrix should
     // be recalculated.  These are pointers to values instead of actual values
-    // as a cheat that lets them be updated even in const functions.
+    // as a cheat that lets them be updated even in const functions.  The
+    // matrix isn't allocated until GetModelMatrix needs it, so planar objects
+    // that are only ever drawn never allocate it.
     bool* m_pbUpdateModelMatrix;
-    Transform3D* m_poModelMatrix;
+    mutable Transform3D* m_poModelMatrix;
+
+    // Planar mode rotation and cached model matrix.  The rotation above isn't
+    // kept up to date in planar mode.  The planar matrix shares the update
+    // flag above, and when it's recalculated, the other flag marks the cached
+    // 4x4 matrix as needing to be expanded from it again.
+    bool m_bPlanar;
+    mutable bool m_bExpandPlanarMatrix;
+    Point2D m_oPlanarRotation;
+    mutable Affine2D m_oPlanarMatrix;
+
+private:
+
+    // Expand a planar matrix to 3D, at the object's depth
+    void ExpandPlanarMatrix( const Affine2D& ac_roPlanar,
+                             Affine3D& a_roResult ) const;
 
 };  // class Drawable
 
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 11, 2014
  * Description:        Class representing a frame within a texture.
- * Last Modified:      March 12, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added Affine2D display area transform.
  ******************************************************************************/
 
 #ifndef FRAME__H
@@ -88,6 +88,8 @@ struct IMEXPORT_CLASS Frame
     Transform3D DisplayAreaVertexTransform() const
     { Transform3D oResult; return DisplayAreaVertexTransform( oResult ); }
     Transform3D& DisplayAreaVertexTransform( Transform3D& a_roTransform ) const;
+    Affine3D& DisplayAreaVertexTransform( Affine3D& a_roTransform ) const;
+    Affine2D& DisplayAreaVertexTransform( Affine2D& a_roTransform ) const;
 
     // Does this frame contain any drawable pixels?
     bool HasDisplayArea() const;
@@ -97,9 +99,9 @@ struct IMEXPORT_CLASS Frame
     Point2D SliceOffsetUV( int a_iTextureWidth, int a_iTextureHeight ) const;
     Point2D SliceSizeUV( int a_iTextureWidth, int a_iTextureHeight ) const;
     Point2D SliceOffsetUV( const IntPoint2D& ac_roTextureSize ) const
-    { return SliceOffsetUV( ac_roTextureSize.x, ac_roTextureSize.y ); }
+    { return SliceOffsetUV( ac_roTextureSize.x(), ac_roTextureSize.y() ); }
     Point2D SliceSizeUV( const IntPoint2D& ac_roTextureSize ) const
-    { return SliceSizeUV( ac_roTextureSize.x, ac_roTextureSize.y ); }
+    { return SliceSizeUV( ac_roTextureSize.x(), ac_roTextureSize.y() ); }
 
     IntPoint2D framePixels;     // size of the frame in texture pixels
     IntPoint2D centerOffset;    // pixel location of the center of the
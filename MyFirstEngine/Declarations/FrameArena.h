@@ -0,0 +1,216 @@
+/******************************************************************************
+ * File:               FrameArena.h
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Linear allocator for memory that lasts one frame.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#ifndef FRAME_ARENA__H
+#define FRAME_ARENA__H
+
+#include "GameEngine.h"
+#include <cstddef>  // for size_t and ptrdiff_t
+#include <new>      // for placement new
+#include <utility>  // for forward
+
+#include "MyFirstEngineMacros.h"
+
+namespace MyFirstEngine
+{
+
+// Allocating just moves a pointer forward, and freeing does nothing -
+// everything is released at once when the arena is reset, which GameEngine::Run
+// does for the engine's arena at the start of every frame.  Memory comes in
+// blocks that never move, so pointers stay valid until the reset.  If a frame
+// needs more than one block, the reset replaces them all with a single block
+// big enough for the whole frame.
+//
+// Destructors aren't called on reset, so only put objects in the arena if they
+// don't need destroying or are destroyed before the frame ends.  Arenas aren't
+// thread-safe, so the engine's arena is only for the main thread.
+class IMEXPORT_CLASS GameEngine::FrameArena
+{
+    struct Block;
+
+public:
+
+    static const std::size_t DEFAULT_BLOCK_SIZE = 65536;
+    static const std::size_t DEFAULT_ALIGNMENT = 16;
+
+    // No memory is allocated until it's needed
+    explicit FrameArena( std::size_t a_uiBlockSize = DEFAULT_BLOCK_SIZE );
+    ~FrameArena();
+
+    // Uninitialized memory aligned to the given power of two
+    void* Allocate( std::size_t a_uiSize,
+                    std::size_t a_uiAlignment = DEFAULT_ALIGNMENT )
+    {
+        char* pcData = AlignUp( m_pcNext, a_uiAlignment );
+        if( pcData > m_pcEnd || a_uiSize > (std::size_t)( m_pcEnd - pcData ) )
+        {
+            return AllocateFromNextBlock( a_uiSize, a_uiAlignment );
+        }
+        m_uiUsed += ( pcData + a_uiSize ) - m_pcNext;
+        m_pcNext = pcData + a_uiSize;
+        if( m_uiUsed > m_uiHighWater )
+        {
+            m_uiHighWater = m_uiUsed;
+        }
+        return pcData;
+    }
+    template< typename T >
+    T* Allocate( std::size_t a_uiCount = 1 )
+    {
+        return static_cast< T* >( Allocate( a_uiCount * sizeof( T ),
+                                            __alignof( T ) ) );
+    }
+
+    // Release everything allocated so far, keeping the memory for reuse
+    void Reset();
+
+    // Bytes in use, including alignment padding
+    std::size_t Used() const { return m_uiUsed; }
+
+    // The most bytes in use at once since the last reset, during the frame
+    // before that, and during any frame so far
+    std::size_t HighWater() const { return m_uiHighWater; }
+    std::size_t LastHighWater() const { return m_uiLastHighWater; }
+    std::size_t PeakHighWater() const
+    { return ( m_uiHighWater > m_uiPeakHighWater ? m_uiHighWater
+                                                 : m_uiPeakHighWater ); }
+
+    // Bytes in all the blocks allocated so far
+    std::size_t Capacity() const;
+
+    // Remembers how much of the arena is in use, and releases everything
+    // allocated after that when it goes out of scope or is released early,
+    // whichever comes first.  Does nothing if the arena has been reset since
+    // the marker was created.
+    class IMEXPORT_CLASS Marker
+    {
+    public:
+        explicit Marker( FrameArena& a_roArena = GameEngine::Arena() );
+        ~Marker() { Release(); }
+        void Release();
+    private:
+        Marker( const Marker& ac_roMarker );
+        Marker& operator=( const Marker& ac_roMarker );
+        FrameArena& m_roArena;
+        Block* m_poBlock;
+        char* m_pcNext;
+        std::size_t m_uiUsed;
+        unsigned int m_uiResets;
+        bool m_bReleased;
+    };
+
+    // Standard allocator, for containers that are destroyed before the arena
+    // is reset
+    template< typename T >
+    class Allocator;
+
+private:
+
+    // Blocks form a list, each starting with one of these
+    struct Block
+    {
+        Block* poNext;
+        std::size_t uiSize;
+        char* Begin() { return reinterpret_cast< char* >( this + 1 ); }
+        char* End() { return Begin() + uiSize; }
+    };
+
+    // Disallow copying
+    FrameArena( const FrameArena& ac_roArena );
+    FrameArena& operator=( const FrameArena& ac_roArena );
+
+    // Round the given address up to a multiple of the given power of two
+    static char* AlignUp( char* a_pcAddress, std::size_t a_uiAlignment )
+    {
+        const std::size_t cuiMask = a_uiAlignment - 1;
+        return reinterpret_cast< char* >(
+            ( reinterpret_cast< std::size_t >( a_pcAddress ) + cuiMask )
+            & ~cuiMask );
+    }
+
+    // Move on to the next block, adding one if the next isn't big enough
+    void* AllocateFromNextBlock( std::size_t a_uiSize,
+                                 std::size_t a_uiAlignment );
+
+    // Make the given block the one being allocated from
+    void UseBlock( Block* a_poBlock );
+
+    // Free all the blocks
+    void FreeBlocks();
+
+    Block* m_poFirst;
+    Block* m_poCurrent;
+    char* m_pcNext;
+    char* m_pcEnd;
+    std::size_t m_uiBlockSize;
+    std::size_t m_uiUsed;
+    std::size_t m_uiHighWater;
+    std::size_t m_uiLastHighWater;
+    std::size_t m_uiPeakHighWater;
+    unsigned int m_uiResets;
+
+};  // class GameEngine::FrameArena
+
+// Allocates from an arena and never frees.  The default constructor uses the
+// engine's arena.
+template< typename T >
+class GameEngine::FrameArena::Allocator
+{
+public:
+
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+    template< typename U >
+    struct rebind { typedef Allocator< U > other; };
+
+    Allocator() : m_poArena( &GameEngine::Arena() ) {}
+    explicit Allocator( FrameArena& a_roArena ) : m_poArena( &a_roArena ) {}
+    template< typename U >
+    Allocator( const Allocator< U >& ac_roAllocator )
+        : m_poArena( &ac_roAllocator.Arena() ) {}
+
+    pointer address( reference a_rValue ) const { return &a_rValue; }
+    const_pointer address( const_reference ac_rValue ) const
+    { return &ac_rValue; }
+    size_type max_size() const { return size_type( -1 ) / sizeof( T ); }
+
+    pointer allocate( size_type a_uiCount, const void* = nullptr )
+    { return m_poArena->Allocate< T >( a_uiCount ); }
+    void deallocate( pointer, size_type ) {}
+
+    void construct( pointer a_pValue, const T& ac_rValue )
+    { ::new( (void*)a_pValue ) T( ac_rValue ); }
+    template< typename U >
+    void construct( pointer a_pValue, U&& a_rrValue )
+    { ::new( (void*)a_pValue ) T( std::forward< U >( a_rrValue ) ); }
+    void destroy( pointer a_pValue ) { a_pValue->~T(); }
+
+    FrameArena& Arena() const { return *m_poArena; }
+
+    template< typename U >
+    bool operator==( const Allocator< U >& ac_roAllocator ) const
+    { return m_poArena == &ac_roAllocator.Arena(); }
+    template< typename U >
+    bool operator!=( const Allocator< U >& ac_roAllocator ) const
+    { return m_poArena != &ac_roAllocator.Arena(); }
+
+private:
+
+    FrameArena* m_poArena;
+
+};  // class GameEngine::FrameArena::Allocator
+
+}   // namespace MyFirstEngine
+
+#endif  // FRAME_ARENA__H
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 5, 2014
  * Description:        Singleton class representing the game engine as a whole.
- * Last Modified:      March 17, 2014
- * Last Modification:  Adding replacement for deprecated OpenGL matrix stack.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added frame arena.
  ******************************************************************************/
 
 #ifndef GAME_ENGINE__H
@@ -45,6 +45,14 @@ public:
     static bool IsInitialized() { return Instance().m_bInitialized; }
     static void Terminate();
 
+    // Precision of the transforms uploaded to the built-in shaders.  Single
+    // precision is the default, since most GPUs run double-precision math at
+    // a small fraction of the speed.  Use double precision only if a large
+    // world needs it.  The shaders are compiled during initialization, so
+    // changing this afterwards does nothing.
+    static bool UsesDoublePrecision() { return Instance().m_bDoublePrecision; }
+    static void UseDoublePrecision( bool a_bDoublePrecision = true );
+
     // State management
     static GameState& CurrentState();
     static void PopState();
@@ -54,6 +62,8 @@ public:
 
     // Replaces the now-deprecated OpenGL matrix stack
     static Transform3D ModelViewProjection();
+    static FloatTransform3D&
+        ModelViewProjection( FloatTransform3D& a_roResult );
     static Transform3D& ModelView();
     static Transform3D& Projection();
     static Transform3D& SetModelView( const Transform3D& ac_roMatrix );
@@ -61,6 +71,7 @@ public:
     static Transform3D& ApplyAfterModelView( const Transform3D& ac_roMatrix );
     static Transform3D& ApplyAfterProjection( const Transform3D& ac_roMatrix );
     static Transform3D& ApplyBeforeModelView( const Transform3D& ac_roMatrix );
+    static Transform3D& ApplyBeforeModelView( const Affine3D& ac_roMatrix );
     static Transform3D& ApplyBeforeProjection( const Transform3D& ac_roMatrix );
     static void ClearModelView();
     static void ClearProjection();
@@ -85,6 +96,12 @@ public:
     // Get the main game window
     static GameWindow& MainWindow() { return Instance().m_oMainWindow; }
 
+    // Memory for objects that only last until the end of the frame, released
+    // at the start of each pass through Run.  Its high water marks tell how
+    // much each frame used.
+    class FrameArena;
+    static FrameArena& Arena() { return *( Instance().m_poFrameArena ); }
+
 private:
 
     // PIMPLE idiom - these classes are only defined in the cpp, so inheritance
@@ -106,6 +123,9 @@ private:
     // Is the engine initialized?
     bool m_bInitialized;
 
+    // Do the built-in shaders use double-precision transforms?
+    bool m_bDoublePrecision;
+
     // result of previous DeltaTime() call
     double m_dLastDeltaTime;
 
@@ -120,6 +140,9 @@ private:
     TransformStack* m_poModelView;
     TransformStack* m_poProjection;
 
+    // memory released at the start of each frame
+    FrameArena* m_poFrameArena;
+
     // Main game window
     GameWindow m_oMainWindow;
 
@@ -127,6 +150,7 @@ private:
 
 }   // namespace MyFirstEngine
 
+#include "FrameArena.h"
 #include "GameState.h"
 
 #endif  // GAME_ENGINE__H
\ No newline at end of file
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 11, 2014
  * Description:        Class representing a game state (load, menu, play, etc).
- * Last Modified:      February 24, 2014
- * Last Modification:  Moved base classes to Utility namespace in MathLibrary.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Documented frame arena lifetime.
  ******************************************************************************/
 
 #ifndef GAME_STATE__H
@@ -74,7 +74,9 @@ protected:
     { GameEngine::ClearStates(); }
 
     // Called by GameEngine::Run() before calling on GLFW to update.  Default
-    // behavior is to do nothing.
+    // behavior is to do nothing.  Memory from GameEngine::Arena(), whether
+    // directly or through a FrameArena::Allocator, lasts through Draw and is
+    // released when the next frame starts.
     virtual void OnUpdate( double a_dDeltaTime ) {}
 
     // Called by Clear, Pop, Push, and ReplaceCurrent as states are added to,
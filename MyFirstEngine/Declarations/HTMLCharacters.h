@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 21, 2014
  * Description:        Constants and character map for html extended ASCII.
- * Last Modified:      March 21, 2014
- * Last Modification:  Creation.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added lookup without the character map.
  ******************************************************************************/
 
 #ifndef HTML_CHARACTERS__H
@@ -20,9 +20,19 @@ namespace HTML
 
 // Map for ASCII and ANSI extended ASCII characters mapped to their actual char
 // values ("&" for '&'), numbers ("#38" or "x26" for '&'), and, if present, HTML
-// names ("amp" for '&')
+// names ("amp" for '&').  The map is only built the first time it's asked for -
+// Find looks up the same keys without it.
 IMEXPORT const MyFirstEngine::CharacterMap& Map();
 
+// Look up a character by any key the map would have, without allocating.
+// Returns false, leaving the character unchanged, if there's no such key.
+IMEXPORT bool Find( const char* ac_pcName, char& a_rcCharacter );
+
+// Parse a character number - decimal ("#38") or hexadecimal ("#x26" or "x26").
+// Returns false, leaving the character unchanged, for anything else, including
+// numbers over 255.
+IMEXPORT bool ParseNumber( const char* ac_pcName, char& a_rcCharacter );
+
 const char quot = '"';
 const char amp = '&';
 const char apos = '\'';
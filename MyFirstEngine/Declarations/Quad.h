@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 13, 2014
  * Description:        Class representing an untextured rectangle.
- * Last Modified:      March 12, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Leave planar mode when setting dimensions.
  ******************************************************************************/
 
 #ifndef QUAD__H
@@ -60,6 +60,9 @@ public:
                          const Point3D& ac_roUpperRightCorner,
                          const Point3D& ac_roForward = Point3D::Unit(0) )
     {
+        // The rotation this sets generally isn't about the z-axis
+        LeavePlanar();
+
         // Set position
         Point3D oDiagonal = ac_roUpperRightCorner - ac_roLowerLeftCorner;
         m_oPosition = ( oDiagonal / 2 ) + ac_roLowerLeftCorner;
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 26, 2014
  * Description:        Shader program for Quad objects.
- * Last Modified:      February 27, 2014
- * Last Modification:  Overriding virtual functions added to parent class.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added single-precision shader variants.
  ******************************************************************************/
 
 #ifndef QUAD_SHADER_PROGRAM__H
@@ -47,6 +47,7 @@ public:
 
     // default quad shader source code files
     static const char* const QUAD_VERTEX_SHADER_FILE;
+    static const char* const QUAD_DOUBLE_VERTEX_SHADER_FILE;
     static const char* const QUAD_FRAGMENT_SHADER_FILE;
 
     // The positions of the four corners of an unscaled, unrotated Quad on the
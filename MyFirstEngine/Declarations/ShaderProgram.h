@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 13, 2014
  * Description:        Represents a GLSL shader program.
- * Last Modified:      March 12, 2014
- * Last Modification:  Refactoring.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Upload transforms at engine precision.
  ******************************************************************************/
 
 #ifndef SHADER_PROGRAM__H
@@ -92,6 +92,10 @@ protected:
     // Bind vertex arrays, etc.
     virtual void UseData() const {}
 
+    // Upload the current model-view-projection matrix to a uniform variable
+    // at the precision chosen with GameEngine::UseDoublePrecision()
+    static void SetModelViewProjection( GLint a_iLocation );
+
     // ID of the GL shader program
     GLuint m_uiID;
 
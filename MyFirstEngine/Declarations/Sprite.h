@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 27, 2014
  * Description:        Class representing an textured rectangle, or sprite.
- * Last Modified:      March 13, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added planar model matrix.
  ******************************************************************************/
 
 #ifndef SPRITE__H
@@ -127,6 +127,10 @@ protected:
 
     // Draw the sprite
     virtual void DrawComponents() const override;
+
+    // Get the cached planar model transformation, including the frame's
+    // display area
+    virtual const Affine2D& GetPlanarMatrix() const override;
     
     // Default constructor creates null frame list, null texture
     const Frame::Array* m_pcoFrameList;
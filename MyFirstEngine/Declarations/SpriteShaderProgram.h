@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 12, 2014
  * Description:        Shader program for Sprite objects.
- * Last Modified:      March 17, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added single-precision shader variants.
  ******************************************************************************/
 
 #ifndef SPRITE_SHADER_PROGRAM__H
@@ -49,6 +49,8 @@ public:
     // default sprite shader source code files
     static const char* const SPRITE_VERTEX_SHADER_FILE;
     static const char* const SPRITE_FRAGMENT_SHADER_FILE;
+    static const char* const SPRITE_DOUBLE_VERTEX_SHADER_FILE;
+    static const char* const SPRITE_DOUBLE_FRAGMENT_SHADER_FILE;
 
     // The texture coordinates of the four corners of a sprite with a frame
     // showing the entire texture within itself with no offsets
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 22, 2014
  * Description:        Class for managing the projection matrix.
- * Last Modified:      June 26, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Point coordinates are now accessor functions.
  ******************************************************************************/
 
 #include "../Declarations/Camera.h"
@@ -104,7 +104,7 @@ void Camera::SetAngleOfView( double a_dRadians )
     {
         SetFocalLength( 0 );
     }
-    SetFocalLength( Instance().m_oScreenSize.x *
+    SetFocalLength( Instance().m_oScreenSize.x() *
                     std::cos( a_dRadians / 2 ) / std::sin( a_dRadians / 2 ) );
 }
 void Camera::SetDepthOfView( double a_dDepth )   // far plane (near is zero)
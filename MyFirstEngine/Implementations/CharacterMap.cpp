@@ -3,25 +3,24 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 21, 2014
  * Description:        Class mapping character symbols or codes to char values.
- * Last Modified:      March 21, 2014
- * Last Modification:  Creation.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Names are interned and looked up in a flat map.
  ******************************************************************************/
 
 #include "../Declarations/CharacterMap.h"
 #include "MathLibrary.h"
-#include <unordered_map>
 
 namespace MyFirstEngine
 {
 
+using Utility::Atom;
+
 // PIMPLE idiom - this class is only defined in the cpp, so inheritance from
-// an stl container won't result in warnings.
-class CharacterMap::CharacterLookup
-    : public std::unordered_map< Utility::DumbString, char >
+// a template container won't result in warnings.
+class CharacterMap::CharacterLookup : public Utility::AtomMap< char >
 {
 public:
-    typedef std::unordered_map< Utility::DumbString, char > BaseType;
-    typedef BaseType::value_type ValueType;
+    typedef Utility::AtomMap< char > BaseType;
     CharacterLookup() {}
     CharacterLookup( const CharacterLookup& ac_roLookup )
         : BaseType( ac_roLookup ) {}
@@ -49,42 +48,63 @@ CharacterMap& CharacterMap::operator=( const CharacterMap& ac_roMap )
 {
     if( this != &ac_roMap )
     {
-        m_poLookup->clear();
-        for each( CharacterLookup::ValueType oPair in *(ac_roMap.m_poLookup) )
-        {
-            (*m_poLookup)[ oPair.first ] = oPair.second;
-        }
+        *m_poLookup = *( ac_roMap.m_poLookup );
     }
     return *this;
 }
 
 // Does this character map associate the given symbol name with a character?
+// Names that have never been interned can't be in any map, and checking
+// doesn't intern them.
 bool CharacterMap::Has( const char* ac_pcName ) const
 {
-    return ( 0 < m_poLookup->count( ac_pcName ) );
+    Atom oName;
+    return ( Atom::Find( ac_pcName, oName ) && Has( oName ) );
+}
+bool CharacterMap::Has( Atom a_oName ) const
+{
+    return m_poLookup->Has( a_oName );
 }
 
 // Remove this map's association of the given symbol name with a character
 CharacterMap& CharacterMap::Remove( const char* ac_pcName )
 {
-    m_poLookup->erase( ac_pcName );
+    Atom oName;
+    return ( Atom::Find( ac_pcName, oName ) ? Remove( oName ) : *this );
+}
+CharacterMap& CharacterMap::Remove( Atom a_oName )
+{
+    m_poLookup->Remove( a_oName );
     return *this;
 }
 
 // Get/Set character mappings directly
 char& CharacterMap::operator[]( const char* ac_pcName )
 {
-    if( !Has( ac_pcName ) )
+    return operator[]( Atom( ac_pcName ) );
+}
+const char& CharacterMap::operator[]( const char* ac_pcName ) const
+{
+    Atom oName;
+    return ( Atom::Find( ac_pcName, oName ) ? operator[]( oName )
+                                            : ABSENT_CHARACTER );
+}
+char& CharacterMap::operator[]( Atom a_oName )
+{
+    char* pcCharacter = m_poLookup->Find( a_oName );
+    if( nullptr != pcCharacter )
     {
-        m_poLookup->emplace( CharacterLookup::ValueType( ac_pcName ,
-                                                         ABSENT_CHARACTER ) );
+        return *pcCharacter;
     }
-    return m_poLookup->at( ac_pcName );
+    char& rcCharacter = ( *m_poLookup )[ a_oName ];
+    rcCharacter = ABSENT_CHARACTER;
+    return rcCharacter;
 }
-const char& CharacterMap::operator[]( const char* ac_pcName ) const
+const char& CharacterMap::operator[]( Atom a_oName ) const
 {
-    const CharacterLookup& croLookup = *m_poLookup;
-    return ( Has( ac_pcName ) ? croLookup.at( ac_pcName ) : ABSENT_CHARACTER );
+    const char* pccCharacter =
+        static_cast< const CharacterLookup& >( *m_poLookup ).Find( a_oName );
+    return ( nullptr == pccCharacter ? ABSENT_CHARACTER : *pccCharacter );
 }
 
 }   // namespace MyFirstEngine
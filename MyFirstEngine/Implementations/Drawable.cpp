@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 24, 2014
  * Description:        Implementations for Drawable member functions.
- * Last Modified:      March 17, 2014
- * Last Modification:  Adding replacement for deprecated OpenGL matrix stack.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Model matrix cache is only allocated when needed.
  ******************************************************************************/
 
 #include "../Declarations/Drawable.h"
@@ -14,6 +14,22 @@
 namespace MyFirstEngine
 {
 
+// Direction the x-axis points in on the XY plane after the given rotation, as
+// a unit complex number.  This is the first row of the rotation matrix.
+static Point2D PlanarRotationOf( const Rotation3D& ac_roRotation )
+{
+    double dW = ac_roRotation.w(), dX = ac_roRotation.x(),
+           dY = ac_roRotation.y(), dZ = ac_roRotation.z();
+    Point2D oResult( 1 - 2*( dY*dY + dZ*dZ ), 2*dX*dY + 2*dW*dZ );
+    double dMagnitude = oResult.Magnitude();
+    if( 0.0 == dMagnitude )
+    {
+        return Point2D::Unit(0);    // x-axis points straight up or down
+    }
+    oResult /= dMagnitude;
+    return oResult;
+}
+
 //
 // Class functions
 //
@@ -26,8 +42,12 @@ Drawable::Drawable( const Color::ColorVector& ac_roColor,
     : m_oColor( ac_roColor ), m_oScale( ac_roScale ),
       m_oPosition( ac_roPosition ), m_oRotation( ac_roRotation ),
       m_oAfterTransform( Transform3D::Identity() ),
-      m_oBeforeTransform( Transform3D::Identity() ), m_bVisible( true ),
-      m_pbUpdateModelMatrix( new bool ), m_poModelMatrix( new Transform3D )
+      m_oBeforeTransform( Transform3D::Identity() ),
+      m_bAfterIsIdentity( true ), m_bBeforeIsIdentity( true ),
+      m_bVisible( true ),
+      m_pbUpdateModelMatrix( new bool ), m_poModelMatrix( nullptr ),
+      m_bPlanar( false ), m_bExpandPlanarMatrix( false ),
+      m_oPlanarRotation( Point2D::Unit(0) )
 {
     UpdateModelMatrix();  // cached modelview transform hasn't been generated
 }
@@ -37,7 +57,11 @@ Drawable::Drawable( const Drawable& ac_roObject )
       m_bVisible( ac_roObject.m_bVisible ),
       m_oAfterTransform( ac_roObject.m_oAfterTransform ),
       m_oBeforeTransform( ac_roObject.m_oBeforeTransform ),
-      m_pbUpdateModelMatrix( new bool ), m_poModelMatrix( new Transform3D )
+      m_bAfterIsIdentity( ac_roObject.m_bAfterIsIdentity ),
+      m_bBeforeIsIdentity( ac_roObject.m_bBeforeIsIdentity ),
+      m_pbUpdateModelMatrix( new bool ), m_poModelMatrix( nullptr ),
+      m_bPlanar( ac_roObject.m_bPlanar ), m_bExpandPlanarMatrix( false ),
+      m_oPlanarRotation( ac_roObject.m_oPlanarRotation )
 {
     UpdateModelMatrix();  // cached modelview transform hasn't been generated
 }
@@ -50,12 +74,16 @@ Drawable& Drawable::operator=( const Drawable& ac_roObject )
     m_bVisible = ac_roObject.m_bVisible;
     m_oAfterTransform = ac_roObject.m_oAfterTransform;
     m_oBeforeTransform = ac_roObject.m_oBeforeTransform;
+    m_bAfterIsIdentity = ac_roObject.m_bAfterIsIdentity;
+    m_bBeforeIsIdentity = ac_roObject.m_bBeforeIsIdentity;
+    m_bPlanar = ac_roObject.m_bPlanar;
+    m_oPlanarRotation = ac_roObject.m_oPlanarRotation;
     UpdateModelMatrix();
     return *this;
 }
 
 // Destructor deallocates the dynamically stored modelview transform cache
-// and flag.
+// (if it was ever allocated) and flag.
 Drawable::~Drawable()
 {
     delete m_pbUpdateModelMatrix;
@@ -71,9 +99,19 @@ void Drawable::Draw() const
         return;
     }
 
-    // Set modelview matrix
+    // Set modelview matrix.  Planar objects with no other transformations
+    // skip building a full 4x4 model matrix.
     GameEngine::PushModelView();
-    GameEngine::ApplyBeforeModelView( GetModelMatrix() );
+    if( m_bPlanar && m_bBeforeIsIdentity && m_bAfterIsIdentity )
+    {
+        Affine3D oModel;
+        ExpandPlanarMatrix( GetPlanarMatrix(), oModel );
+        GameEngine::ApplyBeforeModelView( oModel );
+    }
+    else
+    {
+        GameEngine::ApplyBeforeModelView( GetModelMatrix() );
+    }
 
     // Draw the components of this drawable object - points, lines, other
     // drawable objects, etc.
@@ -86,18 +124,189 @@ void Drawable::Draw() const
 // Apply transformations to the current matrix
 const Transform3D& Drawable::GetModelMatrix() const
 {
+    // Planar objects with nothing between the planar matrix and whatever comes
+    // first only expand the planar matrix again when it changes
+    Transform3D& roModelMatrix = ModelMatrixCache();
+    if( m_bPlanar && m_bBeforeIsIdentity )
+    {
+        GetPlanarMatrix();
+        if( m_bExpandPlanarMatrix )
+        {
+            ComposeModelMatrix( roModelMatrix );
+            m_bExpandPlanarMatrix = false;
+        }
+        return roModelMatrix;
+    }
+
     // If One of the transformation properties has been updated,
     if( *m_pbUpdateModelMatrix )
     {
         // Recompute the modelview matrix
-        *m_poModelMatrix = m_oBeforeTransform * Space::Scaling( m_oScale ) *
-                           m_oRotation.MakeTransform() *
-                           Space::Translation( m_oPosition ) * m_oAfterTransform;
+        ComposeModelMatrix( roModelMatrix );
         *m_pbUpdateModelMatrix = false;
     }
+    return roModelMatrix;
+}
+
+// Allocate the model matrix cache the first time it's needed.  Marking it as
+// changed also makes a planar object expand its planar matrix into it.
+Transform3D& Drawable::ModelMatrixCache() const
+{
+    if( nullptr == m_poModelMatrix )
+    {
+        m_poModelMatrix = new Transform3D;
+        *m_pbUpdateModelMatrix = true;
+    }
     return *m_poModelMatrix;
 }
 
+// Compute the model matrix straight from scale, rotation, and position,
+// multiplying by other transformations only when they do something
+void Drawable::ComposeModelMatrix( Transform3D& a_roResult,
+                                   const Affine3D* ac_cpoFirst ) const
+{
+    // The cached planar matrix already includes whatever comes first, so it
+    // can only be used if the before transformation doesn't go in between
+    if( m_bPlanar && m_bBeforeIsIdentity )
+    {
+        Affine3D oPlanar;
+        ExpandPlanarMatrix( GetPlanarMatrix(), oPlanar );
+        oPlanar.MakeTransform( a_roResult );
+    }
+    else if( !m_bPlanar && nullptr == ac_cpoFirst && m_bBeforeIsIdentity )
+    {
+        Space::ComposeTRS( m_oScale, m_oRotation, m_oPosition, a_roResult );
+    }
+    else
+    {
+        Affine3D oTRS;
+        if( m_bPlanar )
+        {
+            Affine2D oPlanar;
+            ComposePlanarMatrix( oPlanar );
+            ExpandPlanarMatrix( oPlanar, oTRS );
+        }
+        else
+        {
+            Space::ComposeTRS( m_oScale, m_oRotation, m_oPosition, oTRS );
+        }
+        if( m_bBeforeIsIdentity )
+        {
+            ( *ac_cpoFirst * oTRS ).MakeTransform( a_roResult );
+        }
+        else if( nullptr == ac_cpoFirst )
+        {
+            a_roResult = m_oBeforeTransform * oTRS;
+        }
+        else
+        {
+            a_roResult = *ac_cpoFirst * m_oBeforeTransform * oTRS;
+        }
+    }
+    if( !m_bAfterIsIdentity )
+    {
+        a_roResult *= m_oAfterTransform;
+    }
+}
+
+// Get the cached planar model transformation, recalculating it if needed
+const Affine2D& Drawable::GetPlanarMatrix() const
+{
+    if( *m_pbUpdateModelMatrix )
+    {
+        ComposePlanarMatrix( m_oPlanarMatrix );
+        *m_pbUpdateModelMatrix = false;
+        m_bExpandPlanarMatrix = true;
+    }
+    return m_oPlanarMatrix;
+}
+
+// Scale, rotate, and translate on the XY plane: 6 multiplications, compared to
+// the quaternion conversion and 9 multiplications of ComposeTRS
+void Drawable::ComposePlanarMatrix( Affine2D& a_roResult,
+                                   const Affine2D* ac_cpoFirst ) const
+{
+    double dCos = m_oPlanarRotation.x();
+    double dSin = m_oPlanarRotation.y();
+    a_roResult[0][0] = m_oScale.x() * dCos;
+    a_roResult[0][1] = m_oScale.x() * dSin;
+    a_roResult[1][0] = -m_oScale.y() * dSin;
+    a_roResult[1][1] = m_oScale.y() * dCos;
+    a_roResult[2][0] = m_oPosition.x();
+    a_roResult[2][1] = m_oPosition.y();
+    if( nullptr != ac_cpoFirst )
+    {
+        a_roResult = *ac_cpoFirst * a_roResult;
+    }
+}
+
+// Expand a planar matrix to 3D, at the object's depth
+void Drawable::ExpandPlanarMatrix( const Affine2D& ac_roPlanar,
+                                   Affine3D& a_roResult ) const
+{
+    a_roResult[0][0] = ac_roPlanar[0][0];
+    a_roResult[0][1] = ac_roPlanar[0][1];
+    a_roResult[0][2] = 0.0;
+    a_roResult[1][0] = ac_roPlanar[1][0];
+    a_roResult[1][1] = ac_roPlanar[1][1];
+    a_roResult[1][2] = 0.0;
+    a_roResult[2][0] = 0.0;
+    a_roResult[2][1] = 0.0;
+    a_roResult[2][2] = 1.0;
+    a_roResult[3][0] = ac_roPlanar[2][0];
+    a_roResult[3][1] = ac_roPlanar[2][1];
+    a_roResult[3][2] = m_oPosition.z();
+}
+
+// Get rotation, which has to be built from the planar rotation in planar mode
+Rotation3D Drawable::GetRotation() const
+{
+    return ( m_bPlanar ? Rotation3D( GetPlanarAngle(), Point3D::Unit(2) )
+                       : m_oRotation );
+}
+
+// Planar mode
+Drawable& Drawable::SetPlanar( bool a_bPlanar )
+{
+    if( !a_bPlanar )
+    {
+        LeavePlanar();
+    }
+    else if( !m_bPlanar )
+    {
+        m_oPlanarRotation = PlanarRotationOf( m_oRotation );
+        m_bPlanar = true;
+        UpdateModelMatrix();
+    }
+    return *this;
+}
+double Drawable::GetPlanarAngle() const
+{
+    Point2D oRotation = GetPlanarRotation();
+    return std::atan2( oRotation.y(), oRotation.x() );
+}
+Point2D Drawable::GetPlanarRotation() const
+{
+    return ( m_bPlanar ? m_oPlanarRotation : PlanarRotationOf( m_oRotation ) );
+}
+Drawable& Drawable::SetPlanarAngle( double a_dRadians )
+{
+    SetPlanar();
+    m_oPlanarRotation.x() = std::cos( a_dRadians );
+    m_oPlanarRotation.y() = std::sin( a_dRadians );
+    UpdateModelMatrix();
+    return *this;
+}
+void Drawable::LeavePlanar()
+{
+    if( m_bPlanar )
+    {
+        m_oRotation = GetRotation();
+        m_bPlanar = false;
+        UpdateModelMatrix();
+    }
+}
+
 // Set color
 Drawable& Drawable::SetColor( const Color::ColorVector& ac_roColor )
 {
@@ -107,10 +316,10 @@ Drawable& Drawable::SetColor( const Color::ColorVector& ac_roColor )
 Drawable& Drawable::SetColor( float a_fRed, float a_fGreen, float a_fBlue,
                               float a_fAlpha )
 {
-    m_oColor.r = a_fRed;
-    m_oColor.g = a_fGreen;
-    m_oColor.b = a_fBlue;
-    m_oColor.a = a_fAlpha;
+    m_oColor.r() = a_fRed;
+    m_oColor.g() = a_fGreen;
+    m_oColor.b() = a_fBlue;
+    m_oColor.a() = a_fAlpha;
     return *this;
 }
 Drawable& Drawable::SetColor( Color::Channel a_ucRed,
@@ -128,24 +337,41 @@ Drawable& Drawable::SetColor( Color::Channel a_ucRed,
 // Set rotation properties
 Drawable& Drawable::SetPitch( double a_dPitch )
 {
+    LeavePlanar();
     m_oRotation.SetPitch( a_dPitch );
     UpdateModelMatrix();
     return *this;
 }
 Drawable& Drawable::SetRoll( double a_dRoll )
 {
+    LeavePlanar();
     m_oRotation.SetRoll( a_dRoll );
     UpdateModelMatrix();
     return *this;
 }
 Drawable& Drawable::SetYaw( double a_dYaw )
 {
+    LeavePlanar();
     m_oRotation.SetYaw( a_dYaw );
     UpdateModelMatrix();
     return *this;
 }
 Drawable& Drawable::SetRotation( const Rotation3D& ac_roRotation )
 {
+    // A rotation about the z-axis keeps an object planar.  The x-axis ends up
+    // pointing at ( w^2 - z^2, 2wz ), so there's no need for trigonometry.
+    if( m_bPlanar )
+    {
+        if( 0.0 == ac_roRotation.x() && 0.0 == ac_roRotation.y() )
+        {
+            double dW = ac_roRotation.w(), dZ = ac_roRotation.z();
+            m_oPlanarRotation =
+                Point2D( dW*dW - dZ*dZ, 2*dW*dZ ).Normalize();
+            UpdateModelMatrix();
+            return *this;
+        }
+        LeavePlanar();
+    }
     if( m_oRotation != ac_roRotation )
     {
         m_oRotation = ac_roRotation;
@@ -155,24 +381,39 @@ Drawable& Drawable::SetRotation( const Rotation3D& ac_roRotation )
 }
 Drawable& Drawable::SetRotation( double a_dAngle, const Point3D& ac_roAxis )
 {
+    if( m_bPlanar )
+    {
+        if( 0.0 == ac_roAxis.x() && 0.0 == ac_roAxis.y() &&
+            0.0 != ac_roAxis.z() )
+        {
+            return SetPlanarAngle( 0.0 < ac_roAxis.z() ? a_dAngle : -a_dAngle );
+        }
+        LeavePlanar();
+    }
     m_oRotation.Set( a_dAngle, ac_roAxis );
     UpdateModelMatrix();
     return *this;
 }
 Drawable& Drawable::SetRotationAngle( double a_dAngle )
 {
+    if( m_bPlanar )
+    {
+        return SetPlanarAngle( a_dAngle );
+    }
     m_oRotation.SetAngle( a_dAngle );
     UpdateModelMatrix();
     return *this;
 }
 Drawable& Drawable::SetRotationAxis( const Point3D& ac_roAxis )
 {
+    LeavePlanar();
     m_oRotation.SetAxis( ac_roAxis );
     UpdateModelMatrix();
     return *this;
 }
 Drawable& Drawable::SetTaitBryanAngles( double a_dYaw, double a_dPitch, double a_dRoll )
 {
+    LeavePlanar();
     m_oRotation.Set( a_dYaw, a_dPitch, a_dRoll );
     UpdateModelMatrix();
     return *this;
@@ -187,6 +428,7 @@ Drawable& Drawable::RotateTowardDirection( const Point3D& ac_roForward,
     if( 0.0 != a_dAmount &&
         ( Point3D::Zero() != ac_roForward || Point3D::Zero() != ac_roUp ) )
     {
+        LeavePlanar();
         Rotation3D oTarget( m_oRotation );
         oTarget.Set( ac_roForward, ac_roUp );
         m_oRotation.Slerp( oTarget, a_dAmount );
@@ -216,14 +458,14 @@ Drawable& Drawable::RotateToward( const HVector3D& ac_roHVector,
                                   const Point3D& ac_roUp,
                                   double a_dAmount )
 {
-    return ac_roHVector.h == 0
+    return ac_roHVector.h() == 0
         ? RotateTowardDirection( ac_roHVector, ac_roUp, a_dAmount )
         : RotateTowardPoint( ac_roHVector, ac_roUp, a_dAmount );
 }
 Drawable& Drawable::RotateToward( const HVector3D& ac_roHVector,
                                   double a_dAmount )
 {
-    return ac_roHVector.h == 0
+    return ac_roHVector.h() == 0
         ? RotateTowardDirection( ac_roHVector, Point3D::Zero(), a_dAmount )
         : RotateTowardPoint( ac_roHVector, Point3D::Zero(), a_dAmount );
 }
@@ -236,6 +478,7 @@ Drawable& Drawable::RotateTowardDirection( const Point3D& ac_roForward,
     if( 0.0 != a_dRadiansPerSecond && 0.0 != a_dSeconds &&
         ( Point3D::Zero() != ac_roForward || Point3D::Zero() != ac_roUp ) )
     {
+        LeavePlanar();
         Rotation3D oTarget( m_oRotation );
         oTarget.Set( ac_roForward, ac_roUp );
         m_oRotation.Slerp( oTarget, a_dRadiansPerSecond, a_dSeconds, a_bClamp );
@@ -274,7 +517,7 @@ Drawable& Drawable::RotateToward( const HVector3D& ac_roHVector,
                                   double a_dSeconds,
                                   bool a_bClamp )
 {
-    return ac_roHVector.h == 0
+    return ac_roHVector.h() == 0
         ? RotateTowardDirection( ac_roHVector, ac_roUp,
                                  a_dRadiansPerSecond, a_dSeconds, a_bClamp )
         : RotateTowardPoint( ac_roHVector, ac_roUp,
@@ -285,7 +528,7 @@ Drawable& Drawable::RotateToward( const HVector3D& ac_roHVector,
                                   double a_dSeconds,
                                   bool a_bClamp)
 {
-    return ac_roHVector.h == 0
+    return ac_roHVector.h() == 0
         ? RotateTowardDirection( ac_roHVector, Point3D::Zero(),
                                  a_dRadiansPerSecond, a_dSeconds, a_bClamp )
         : RotateTowardPoint( ac_roHVector, Point3D::Zero(),
@@ -305,11 +548,11 @@ Drawable& Drawable::
 }
 Drawable& Drawable::SetPosition( double a_dX, double a_dY, double a_dZ )
 {
-    if( a_dX != m_oPosition.x || a_dY != m_oPosition.y || a_dZ != m_oPosition.z )
+    if( a_dX != m_oPosition.x() || a_dY != m_oPosition.y() || a_dZ != m_oPosition.z() )
     {
-        m_oPosition.x = a_dX;
-        m_oPosition.y = a_dY;
-        m_oPosition.z = a_dZ;
+        m_oPosition.x() = a_dX;
+        m_oPosition.y() = a_dY;
+        m_oPosition.z() = a_dZ;
         UpdateModelMatrix();
     }
     return *this;
@@ -325,24 +568,24 @@ Drawable& Drawable::SetScale( const Point3D& ac_roScale )
 }
 Drawable& Drawable::SetScale( double a_dX, double a_dY, double a_dZ )
 {
-    if( a_dX != m_oScale.x || a_dY != m_oScale.y || a_dZ != m_oScale.z )
+    if( a_dX != m_oScale.x() || a_dY != m_oScale.y() || a_dZ != m_oScale.z() )
     {
-        m_oScale.x = a_dX;
-        m_oScale.y = a_dY;
-        m_oScale.z = a_dZ;
+        m_oScale.x() = a_dX;
+        m_oScale.y() = a_dY;
+        m_oScale.z() = a_dZ;
         UpdateModelMatrix();
     }
     return *this;
 }
 Drawable& Drawable::SetScale( double a_dFactor )
 {
-    if( a_dFactor != m_oScale.x ||
-        a_dFactor != m_oScale.y ||
-        a_dFactor != m_oScale.z )
+    if( a_dFactor != m_oScale.x() ||
+        a_dFactor != m_oScale.y() ||
+        a_dFactor != m_oScale.z() )
     {
-        m_oScale.x = a_dFactor;
-        m_oScale.y = a_dFactor;
-        m_oScale.z = a_dFactor;
+        m_oScale.x() = a_dFactor;
+        m_oScale.y() = a_dFactor;
+        m_oScale.z() = a_dFactor;
         UpdateModelMatrix();
     }
     return *this;
@@ -354,6 +597,7 @@ Drawable& Drawable::SetAfterTransform( const Transform3D& ac_roTransform )
     if( ac_roTransform != m_oAfterTransform )
     {
         m_oAfterTransform = ac_roTransform;
+        m_bAfterIsIdentity = ( Transform3D::Identity() == ac_roTransform );
         UpdateModelMatrix();
     }
     return *this;
@@ -363,6 +607,7 @@ Drawable& Drawable::SetBeforeTransform( const Transform3D& ac_roTransform )
     if( ac_roTransform != m_oBeforeTransform )
     {
         m_oBeforeTransform = ac_roTransform;
+        m_bBeforeIsIdentity = ( Transform3D::Identity() == ac_roTransform );
         UpdateModelMatrix();
     }
     return *this;
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 19, 2014
  * Description:        Class representing a font.
- * Last Modified:      March 21, 2014
- * Last Modification:  Refactoring and debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  HTML names are found without the character map.
  ******************************************************************************/
 
 #include "../Declarations/Font.h"
@@ -23,15 +23,9 @@ namespace MyFirstEngine
 Font::Font( Texture& a_roTexture, const Frame::Array& ac_roFrameList,
             const char* ac_pcFrameCharacters, unsigned int a_uiLeading,
             unsigned int a_uiEm, char a_cUnknown )
-    : m_poTexture( &a_roTexture ), m_oFrameList( 256 ),
+    : m_poTexture( &a_roTexture ), m_oFrameList( 256, Frame::ZERO ),
       m_uiLeading( a_uiLeading ), m_uiEm( a_uiEm ), m_cUnknown( a_cUnknown )
 {
-    // Zero out all frame dimensions
-    for( unsigned int ui = 0; ui < 256; ++ui )
-    {
-        m_oFrameList[ ui ] = Frame::ZERO;
-    }
-
     // Map provided characters to provided frame dimensions
     if( nullptr != ac_pcFrameCharacters )
     {
@@ -46,15 +40,9 @@ Font::Font( Texture& a_roTexture, const Frame::Array& ac_roFrameList,
 }
 Font::Font( Texture& a_roTexture, unsigned int a_uiLeading,
             unsigned int a_uiEm, char a_cUnknown )
-    : m_poTexture( &a_roTexture ), m_oFrameList( 256 ),
+    : m_poTexture( &a_roTexture ), m_oFrameList( 256, Frame::ZERO ),
       m_uiLeading( a_uiLeading ), m_uiEm( a_uiEm ), m_cUnknown( a_cUnknown )
 {
-    // Zero out all frame dimensions
-    for( unsigned int ui = 0; ui < 256; ++ui )
-    {
-        m_oFrameList[ ui ] = Frame::ZERO;
-    }
-
     // Map ' ' to an empty frame 1/2 em wide and leading pixels high with a
     // baseline halfway between the center and bottom of the frame.
     unsigned int uiWidth = ( 0 != a_uiEm ? a_uiEm : a_uiLeading ) / 2;
@@ -68,9 +56,9 @@ Font::Font( Texture& a_roTexture, unsigned int a_uiLeading,
 unsigned int Font::Em() const
 {
     return ( 0 != m_uiEm ? m_uiEm :
-             Has( 'M' ) ? operator[]( 'M' ).framePixels.x :
-             Has( m_cUnknown ) ? operator[]( m_cUnknown ).framePixels.x :
-             Has( ' ' ) ? operator[]( ' ' ).framePixels.x :
+             Has( 'M' ) ? operator[]( 'M' ).framePixels.x() :
+             Has( m_cUnknown ) ? operator[]( m_cUnknown ).framePixels.x() :
+             Has( ' ' ) ? operator[]( ' ' ).framePixels.x() :
              m_uiLeading );
 }
 
@@ -81,16 +69,18 @@ bool Font::Has( char a_cCharacter ) const
 }
 bool Font::Has( const char* ac_pcCharacterName ) const
 {
+    char cCharacter = 0;
     return ( m_oMap.Has( ac_pcCharacterName )
                 ? Has( m_oMap[ ac_pcCharacterName ] ) :
-             HTML::Map().Has( ac_pcCharacterName )
-                ? Has( HTML::Map()[ ac_pcCharacterName ] ) : false );
+             HTML::Find( ac_pcCharacterName, cCharacter )
+                ? Has( cCharacter ) : false );
 }
 char Font::GetCharacter( const char* ac_pcCharacterName ) const
 {
+    char cCharacter = m_cUnknown;
     return ( m_oMap.Has( ac_pcCharacterName ) ? m_oMap[ ac_pcCharacterName ] :
-             HTML::Map().Has( ac_pcCharacterName )
-                ? HTML::Map()[ ac_pcCharacterName ] : m_cUnknown );
+             HTML::Find( ac_pcCharacterName, cCharacter )
+                ? cCharacter : m_cUnknown );
 }
 
 // for getting and setting character frames directly
@@ -99,13 +89,14 @@ Frame& Font::operator[]( const char* ac_pcCharacterName )
     // If the symbol is mapped in the font's character map, return frame
     if( m_oMap.Has( ac_pcCharacterName ) )
     {
-        return m_oFrameList[ m_oMap[ ac_pcCharacterName ] ];
+        return m_oFrameList[ ((unsigned int)m_oMap[ ac_pcCharacterName ]) % 256 ];
     }
 
-    // Otherwise, check HTML character map
-    if( HTML::Map().Has( ac_pcCharacterName ) )
+    // Otherwise, check HTML character names and numbers
+    char cCharacter = 0;
+    if( HTML::Find( ac_pcCharacterName, cCharacter ) )
     {
-        return m_oFrameList[ HTML::Map()[ ac_pcCharacterName ] ];
+        return m_oFrameList[ ((unsigned int)cCharacter) % 256 ];
     }
 
     // If neither map has the symbol, return a reference to a static frame not
@@ -122,10 +113,11 @@ const Frame& Font::operator[]( const char* ac_pcCharacterName ) const
         return m_oFrameList[ ((unsigned int)m_oMap[ ac_pcCharacterName ]) % 256 ];
     }
 
-    // Otherwise, check HTML character map
-    if( HTML::Map().Has( ac_pcCharacterName ) )
+    // Otherwise, check HTML character names and numbers
+    char cCharacter = 0;
+    if( HTML::Find( ac_pcCharacterName, cCharacter ) )
     {
-        return m_oFrameList[ ((unsigned int)HTML::Map()[ ac_pcCharacterName ]) % 256 ];
+        return m_oFrameList[ ((unsigned int)cCharacter) % 256 ];
     }
 
     // If neither map has the symbol, return a reference to the zero frame
@@ -143,8 +135,8 @@ Font& Font::Map( char a_cCharacter,
                  const IntPoint2D& ac_roSliceLocation,
                  int a_iDescenderHeight )
 {
-    IntPoint2D oCenterOffset( -ac_roSlicePixels.x / 2,
-                              ac_roSlicePixels.y / 2 - a_iDescenderHeight );
+    IntPoint2D oCenterOffset( -ac_roSlicePixels.x() / 2,
+                              ac_roSlicePixels.y() / 2 - a_iDescenderHeight );
     Frame oFrame( ac_roSlicePixels, ac_roSliceLocation, oCenterOffset );
     return Map( a_cCharacter, oFrame );
 }
@@ -205,7 +197,7 @@ Sprite& Font::SetSlug( Sprite& a_roSlug, char a_cCharacter ) const
     a_roSlug.SetTexture( *m_poTexture );
     a_roSlug.SetFrameList( m_oFrameList );
     a_roSlug.SetFrameNumber( (unsigned int)cCharacter );
-    a_roSlug.SetScale( a_roSlug.GetScale().y ); // in case previous slug was tab
+    a_roSlug.SetScale( a_roSlug.GetScale().y() ); // in case previous slug was tab
     return a_roSlug;
 }
 Sprite& Font::SetSlug( Sprite& a_roSlug, char a_cCharacter,
@@ -230,7 +222,7 @@ Sprite& Font::SetTabSlug( Sprite& a_roSlug, double a_dTabDisplaySize,
                           char a_cTabCharacter ) const
 {
     SetSlug( a_roSlug, a_cTabCharacter );
-    a_roSlug.SetDisplaySize( a_dTabDisplaySize, a_roSlug.DisplaySize().y );
+    a_roSlug.SetDisplaySize( a_dTabDisplaySize, a_roSlug.DisplaySize().y() );
     return a_roSlug;
 }
 Sprite& Font::SetTabSlug( Sprite& a_roSlug, double a_dTabDisplaySize,
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 12, 2014
  * Description:        Function implementations for Frame functions.
- * Last Modified:      March 12, 2014
- * Last Modification:  Moving code out of Frame.h.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added Affine2D display area transform.
  ******************************************************************************/
 
 #define FRAME__CPP
@@ -24,9 +24,9 @@ static void IntersectionCorners( const MyFirstEngine::Frame& ac_roFrame,
     // If areas do not intersect, there is no display area
     IntPoint2D oSliceBottomRight = ac_roFrame.slicePixels
                                    + ac_roFrame.sliceOffset;
-    if( oSliceBottomRight.x <= 0 || oSliceBottomRight.y <= 0 ||
-        ac_roFrame.sliceOffset.x >= ac_roFrame.framePixels.x ||
-        ac_roFrame.sliceOffset.y >= ac_roFrame.framePixels.y )
+    if( oSliceBottomRight.x() <= 0 || oSliceBottomRight.y() <= 0 ||
+        ac_roFrame.sliceOffset.x() >= ac_roFrame.framePixels.x() ||
+        ac_roFrame.sliceOffset.y() >= ac_roFrame.framePixels.y() )
     {
         a_roTopLeft = IntPoint2D::Zero();
         a_roBottomRight = IntPoint2D::Zero();
@@ -34,14 +34,14 @@ static void IntersectionCorners( const MyFirstEngine::Frame& ac_roFrame,
     }
 
     // Otherwise, compute corners
-    a_roTopLeft.x = ( 0 >= ac_roFrame.sliceOffset.x
-                      ? 0 : ac_roFrame.sliceOffset.x );
-    a_roTopLeft.y = ( 0 >= ac_roFrame.sliceOffset.y
-                      ? 0 : ac_roFrame.sliceOffset.y );
-    a_roBottomRight.x = ( ac_roFrame.framePixels.x <= oSliceBottomRight.x
-                          ? ac_roFrame.framePixels.x : oSliceBottomRight.x );
-    a_roBottomRight.y = ( ac_roFrame.framePixels.y <= oSliceBottomRight.y
-                          ? ac_roFrame.framePixels.y : oSliceBottomRight.y );
+    a_roTopLeft.x() = ( 0 >= ac_roFrame.sliceOffset.x()
+                      ? 0 : ac_roFrame.sliceOffset.x() );
+    a_roTopLeft.y() = ( 0 >= ac_roFrame.sliceOffset.y()
+                      ? 0 : ac_roFrame.sliceOffset.y() );
+    a_roBottomRight.x() = ( ac_roFrame.framePixels.x() <= oSliceBottomRight.x()
+                          ? ac_roFrame.framePixels.x() : oSliceBottomRight.x() );
+    a_roBottomRight.y() = ( ac_roFrame.framePixels.y() <= oSliceBottomRight.y()
+                          ? ac_roFrame.framePixels.y() : oSliceBottomRight.y() );
 }
 
 // compute pixel coordinates of corners of union of frame and slice areas
@@ -52,14 +52,14 @@ static void UnionCorners( const MyFirstEngine::Frame& ac_roFrame,
 {
     IntPoint2D oSliceBottomRight = ac_roFrame.slicePixels
                                    + ac_roFrame.sliceOffset;
-    a_roTopLeft.x = ( 0 <= ac_roFrame.sliceOffset.x
-                      ? 0 : ac_roFrame.sliceOffset.x );
-    a_roTopLeft.y = ( 0 <= ac_roFrame.sliceOffset.y
-                      ? 0 : ac_roFrame.sliceOffset.y );
-    a_roBottomRight.x = ( ac_roFrame.framePixels.x >= oSliceBottomRight.x
-                          ? ac_roFrame.framePixels.x : oSliceBottomRight.x );
-    a_roBottomRight.y = ( ac_roFrame.framePixels.y >= oSliceBottomRight.y
-                          ? ac_roFrame.framePixels.y : oSliceBottomRight.y );
+    a_roTopLeft.x() = ( 0 <= ac_roFrame.sliceOffset.x()
+                      ? 0 : ac_roFrame.sliceOffset.x() );
+    a_roTopLeft.y() = ( 0 <= ac_roFrame.sliceOffset.y()
+                      ? 0 : ac_roFrame.sliceOffset.y() );
+    a_roBottomRight.x() = ( ac_roFrame.framePixels.x() >= oSliceBottomRight.x()
+                          ? ac_roFrame.framePixels.x() : oSliceBottomRight.x() );
+    a_roBottomRight.y() = ( ac_roFrame.framePixels.y() >= oSliceBottomRight.y()
+                          ? ac_roFrame.framePixels.y() : oSliceBottomRight.y() );
 }
 
 namespace MyFirstEngine
@@ -294,13 +294,13 @@ bool Frame::HasDisplayArea() const
 
     case CROP_TO_SLICE:
     {
-        bResult = ( 0 != slicePixels.x && 0 != slicePixels.y );
+        bResult = ( 0 != slicePixels.x() && 0 != slicePixels.y() );
         break;
     }
     
     case CROP_TO_FRAME:
     {
-        bResult = ( 0 != framePixels.x && 0 != framePixels.y );
+        bResult = ( 0 != framePixels.x() && 0 != framePixels.y() );
         break;
     }
 
@@ -308,8 +308,8 @@ bool Frame::HasDisplayArea() const
     {
         IntPoint2D oTopLeft, oBottomRight;
         IntersectionCorners( *this, oTopLeft, oBottomRight );
-        bResult = ( oTopLeft.x != oBottomRight.x &&
-                    oTopLeft.y != oBottomRight.y );
+        bResult = ( oTopLeft.x() != oBottomRight.x() &&
+                    oTopLeft.y() != oBottomRight.y() );
         break;
     }
 
@@ -317,8 +317,8 @@ bool Frame::HasDisplayArea() const
     {
         IntPoint2D oTopLeft, oBottomRight;
         UnionCorners( *this, oTopLeft, oBottomRight );
-        bResult = ( oTopLeft.x != oBottomRight.x &&
-                    oTopLeft.y != oBottomRight.y );
+        bResult = ( oTopLeft.x() != oBottomRight.x() &&
+                    oTopLeft.y() != oBottomRight.y() );
         break;
     }
 
@@ -338,14 +338,16 @@ Transform2D& Frame::
     Point2D oDisplayArea = DisplayAreaPixels();
     Point2D oSliceArea = slicePixels;
     Point2D oOffset = DisplayAreaSliceOffset();
-    a_roTransform = Plane::Scaling( 0 == oSliceArea.x
-                                    ? 0 : oDisplayArea.x / oSliceArea.x,
-                                    0 == oSliceArea.y
-                                    ? 0 : oDisplayArea.y / oSliceArea.y ) *
-                    Plane::Translation( 0 == oSliceArea.x
-                                        ? 0 : -oOffset.x / oSliceArea.x,
-                                        0 == oSliceArea.y
-                                        ? 0 : -oOffset.y / oSliceArea.y );
+    Affine2D oTransform =
+        Plane::AffineScaling( 0 == oSliceArea.x()
+                              ? 0 : oDisplayArea.x() / oSliceArea.x(),
+                              0 == oSliceArea.y()
+                              ? 0 : oDisplayArea.y() / oSliceArea.y() ) *
+        Plane::AffineTranslation( 0 == oSliceArea.x()
+                                  ? 0 : -oOffset.x() / oSliceArea.x(),
+                                  0 == oSliceArea.y()
+                                  ? 0 : -oOffset.y() / oSliceArea.y() );
+    oTransform.MakeTransform( a_roTransform );
     return a_roTransform;
 }
 
@@ -354,11 +356,25 @@ Transform2D& Frame::
 // area
 Transform3D& Frame::
     DisplayAreaVertexTransform( Transform3D& a_roTransform ) const
+{
+    Affine3D oTransform;
+    DisplayAreaVertexTransform( oTransform ).MakeTransform( a_roTransform );
+    return a_roTransform;
+}
+Affine3D& Frame::DisplayAreaVertexTransform( Affine3D& a_roTransform ) const
 {
     Point3D oDisplayArea = DisplayAreaPixels();
     Point3D oOffset = DisplayAreaOffset();
-    a_roTransform = Space::Scaling( oDisplayArea ) *
-                    Space::Translation( oOffset.x, -oOffset.y );
+    a_roTransform = Space::AffineScaling( oDisplayArea ) *
+                    Space::AffineTranslation( oOffset.x(), -oOffset.y(), 0.0 );
+    return a_roTransform;
+}
+Affine2D& Frame::DisplayAreaVertexTransform( Affine2D& a_roTransform ) const
+{
+    IntPoint2D oDisplayArea = DisplayAreaPixels();
+    IntPoint2D oOffset = DisplayAreaOffset();
+    a_roTransform = Plane::AffineScaling( oDisplayArea.x(), oDisplayArea.y() ) *
+                    Plane::AffineTranslation( oOffset.x(), -oOffset.y() );
     return a_roTransform;
 }
 
@@ -368,15 +384,15 @@ Point2D Frame::SliceOffsetUV( int a_iTextureWidth, int a_iTextureHeight ) const
 {
     return ( ( 0 == a_iTextureWidth || 0 == a_iTextureHeight )
              ? Point2D::Zero()
-             : Point2D( (double)( sliceLocation.x ) / a_iTextureWidth,
-                        (double)( sliceLocation.y ) / a_iTextureHeight ) );
+             : Point2D( (double)( sliceLocation.x() ) / a_iTextureWidth,
+                        (double)( sliceLocation.y() ) / a_iTextureHeight ) );
 }
 Point2D Frame::SliceSizeUV( int a_iTextureWidth, int a_iTextureHeight ) const
 {
     return ( ( 0 == a_iTextureWidth || 0 == a_iTextureHeight )
              ? Point2D::Zero()
-             : Point2D( (double)( slicePixels.x ) / a_iTextureWidth,
-                        (double)( slicePixels.y ) / a_iTextureHeight ) );
+             : Point2D( (double)( slicePixels.x() ) / a_iTextureWidth,
+                        (double)( slicePixels.y() ) / a_iTextureHeight ) );
 }
 
 }   // namespace MyFirstEngine
@@ -0,0 +1,137 @@
+/******************************************************************************
+ * File:               FrameArena.cpp
+ * Author:             Elizabeth Lowry
+ * Date Created:       October 17, 2026
+ * Description:        Function implementations for the FrameArena class.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Creation.
+ ******************************************************************************/
+
+#include "..\Declarations\FrameArena.h"
+
+namespace MyFirstEngine
+{
+
+// No memory is allocated until it's needed
+GameEngine::FrameArena::FrameArena( std::size_t a_uiBlockSize )
+    : m_poFirst( nullptr ), m_poCurrent( nullptr ), m_pcNext( nullptr ),
+      m_pcEnd( nullptr ), m_uiBlockSize( a_uiBlockSize ), m_uiUsed( 0 ),
+      m_uiHighWater( 0 ), m_uiLastHighWater( 0 ), m_uiPeakHighWater( 0 ),
+      m_uiResets( 0 ) {}
+
+// Free all the blocks
+GameEngine::FrameArena::~FrameArena()
+{
+    FreeBlocks();
+}
+
+// Release everything allocated so far, keeping the memory for reuse.  If the
+// frame needed more than one block, replace them with one that holds them all.
+void GameEngine::FrameArena::Reset()
+{
+    m_uiLastHighWater = m_uiHighWater;
+    m_uiPeakHighWater = PeakHighWater();
+    m_uiHighWater = 0;
+    m_uiUsed = 0;
+    ++m_uiResets;
+    if( nullptr != m_poFirst && nullptr != m_poFirst->poNext )
+    {
+        m_uiBlockSize = Capacity();
+        FreeBlocks();
+    }
+    UseBlock( m_poFirst );
+}
+
+// Bytes in all the blocks allocated so far
+std::size_t GameEngine::FrameArena::Capacity() const
+{
+    std::size_t uiCapacity = 0;
+    for( Block* poBlock = m_poFirst; nullptr != poBlock;
+         poBlock = poBlock->poNext )
+    {
+        uiCapacity += poBlock->uiSize;
+    }
+    return uiCapacity;
+}
+
+// Move on to the next block, adding one if the next isn't big enough.  Blocks
+// after the current one are only there if a marker released them.
+void* GameEngine::FrameArena::AllocateFromNextBlock( std::size_t a_uiSize,
+                                                     std::size_t a_uiAlignment )
+{
+    const std::size_t cuiNeeded = a_uiSize + a_uiAlignment - 1;
+    Block* poNext =
+        ( nullptr == m_poCurrent ? m_poFirst : m_poCurrent->poNext );
+    if( nullptr == poNext || poNext->uiSize < cuiNeeded )
+    {
+        const std::size_t cuiSize =
+            ( cuiNeeded > m_uiBlockSize ? cuiNeeded : m_uiBlockSize );
+        Block* poBlock =
+            reinterpret_cast< Block* >( new char[ sizeof( Block ) + cuiSize ] );
+        poBlock->poNext = poNext;
+        poBlock->uiSize = cuiSize;
+        if( nullptr == m_poCurrent )
+        {
+            m_poFirst = poBlock;
+        }
+        else
+        {
+            m_poCurrent->poNext = poBlock;
+        }
+        poNext = poBlock;
+    }
+
+    // Skipping the rest of the current block doesn't count as use
+    UseBlock( poNext );
+    return Allocate( a_uiSize, a_uiAlignment );
+}
+
+// Make the given block the one being allocated from
+void GameEngine::FrameArena::UseBlock( Block* a_poBlock )
+{
+    m_poCurrent = a_poBlock;
+    m_pcNext = ( nullptr == a_poBlock ? nullptr : a_poBlock->Begin() );
+    m_pcEnd = ( nullptr == a_poBlock ? nullptr : a_poBlock->End() );
+}
+
+// Free all the blocks
+void GameEngine::FrameArena::FreeBlocks()
+{
+    while( nullptr != m_poFirst )
+    {
+        Block* poBlock = m_poFirst;
+        m_poFirst = poBlock->poNext;
+        delete[] reinterpret_cast< char* >( poBlock );
+    }
+    UseBlock( nullptr );
+}
+
+//
+// Marker
+//
+
+// Remember how much of the arena is in use
+GameEngine::FrameArena::Marker::Marker( FrameArena& a_roArena )
+    : m_roArena( a_roArena ), m_poBlock( a_roArena.m_poCurrent ),
+      m_pcNext( a_roArena.m_pcNext ), m_uiUsed( a_roArena.m_uiUsed ),
+      m_uiResets( a_roArena.m_uiResets ), m_bReleased( false ) {}
+
+// Release everything allocated since the marker was created, unless the arena
+// has been reset since then or this already happened
+void GameEngine::FrameArena::Marker::Release()
+{
+    if( m_bReleased || m_uiResets != m_roArena.m_uiResets ||
+        m_uiUsed > m_roArena.m_uiUsed )
+    {
+        return;
+    }
+    m_bReleased = true;
+    m_roArena.UseBlock( m_poBlock );
+    if( nullptr != m_poBlock )
+    {
+        m_roArena.m_pcNext = m_pcNext;
+    }
+    m_roArena.m_uiUsed = m_uiUsed;
+}
+
+}   // namespace MyFirstEngine
@@ -3,11 +3,12 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 5, 2014
  * Description:        Implementations of GameEngine functions.
- * Last Modified:      March 25, 2014
- * Last Modification:  Hooking up mouse and keyboard event handling.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Frame arena is reset at the start of each frame.
  ******************************************************************************/
 
 #include "..\Declarations\Camera.h"
+#include "..\Declarations\FrameArena.h"
 #include "..\Declarations\GameEngine.h"
 #include "..\Declarations\GameState.h"
 #include "..\Declarations\GameWindow.h"
@@ -19,6 +20,7 @@
 #include "..\Declarations\ShaderProgram.h"
 #include "..\Declarations\SpriteShaderProgram.h"
 #include <iostream>
+#include <vector>
 
 namespace MyFirstEngine
 {
@@ -30,7 +32,10 @@ class GameEngine::StateStack : public std::stack< GameState* >
 public:
     virtual ~StateStack() {}
 };
-class GameEngine::TransformStack : public std::stack< Transform3D >
+// transforms are kept in a vector, which holds on to its memory, since every
+// drawable pushes and pops one each frame
+class GameEngine::TransformStack
+    : public std::stack< Transform3D, std::vector< Transform3D > >
 {
 public:
     virtual ~TransformStack() {}
@@ -39,10 +44,10 @@ public:
 // Default constructor is only used by the base Singleton class's Instance()
 // function.  The user never instantiates a GameEngine object directly.
 GameEngine::GameEngine()
-    : m_bInitialized( false ), m_dLastTime( 0.0 ),
+    : m_bInitialized( false ), m_bDoublePrecision( false ), m_dLastTime( 0.0 ),
       m_poModelView( new TransformStack ),
       m_poProjection( new TransformStack ),
-      m_poStates( new StateStack ) {}
+      m_poStates( new StateStack ), m_poFrameArena( new FrameArena ) {}
 
 // Destructor is virtual, since inheritance is involved.
 GameEngine::~GameEngine()
@@ -50,6 +55,7 @@ GameEngine::~GameEngine()
     delete m_poStates;
     delete m_poModelView;
     delete m_poProjection;
+    delete m_poFrameArena;
 }
 
 // Returns the time since this function was last called.
@@ -70,6 +76,14 @@ Transform3D GameEngine::ModelViewProjection()
 {
     return ModelView() * Projection();
 }
+FloatTransform3D&
+    GameEngine::ModelViewProjection( FloatTransform3D& a_roResult )
+{
+    // Narrow each matrix first so the product uses the single-precision kernel
+    a_roResult = FloatTransform3D( ModelView() ) *
+                 FloatTransform3D( Projection() );
+    return a_roResult;
+}
 Transform3D& GameEngine::ModelView()
 {
     if( Instance().m_poModelView->empty() )
@@ -111,6 +125,11 @@ Transform3D& GameEngine::ApplyBeforeModelView( const Transform3D& ac_roMatrix )
     ModelView() = ac_roMatrix * ModelView();
     return ModelView();
 }
+Transform3D& GameEngine::ApplyBeforeModelView( const Affine3D& ac_roMatrix )
+{
+    ModelView() = ac_roMatrix * ModelView();
+    return ModelView();
+}
 Transform3D& GameEngine::ApplyBeforeProjection( const Transform3D& ac_roMatrix )
 {
     Projection() = ac_roMatrix * Projection();
@@ -217,6 +236,15 @@ bool GameEngine::Initialize( unsigned int a_uiWidth, unsigned int a_uiHeight,
                        ac_pcTitle, ac_roColor );
 }
 
+// Choose the precision of the built-in shaders' transforms
+void GameEngine::UseDoublePrecision( bool a_bDoublePrecision )
+{
+    if( !IsInitialized() )
+    {
+        Instance().m_bDoublePrecision = a_bDoublePrecision;
+    }
+}
+
 // Remove states
 void GameEngine::PopState()
 {
@@ -278,6 +306,7 @@ void GameEngine::Run()
     }
     while( GameState::End() != CurrentState() )
     {
+        Arena().Reset();
         Instance().DeltaTime();
         glfwPollEvents();
         if( GameState::End() == CurrentState() ) { break; }
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 10, 2014
  * Description:        Inline function implementations for the GameWindow class.
- * Last Modified:      March 25, 2014
- * Last Modification:  Hooking up mouse and keyboard event handling.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Point coordinates are now accessor functions.
  ******************************************************************************/
 
 #include "..\Declarations\GLFW.h"
@@ -93,20 +93,20 @@ GameWindow& GameWindow::SetClearColor( const ColorVector& ac_roColor )
     m_oColor = ac_roColor;
     if( IsCurrent() )
     {
-        glClearColor( m_oColor.r, m_oColor.g, m_oColor.b, m_oColor.a );
+        glClearColor( m_oColor.r(), m_oColor.g(), m_oColor.b(), m_oColor.a() );
     }
     return *this;
 }
 GameWindow& GameWindow::SetClearColor( float a_fRed, float a_fGreen,
                                        float a_fBlue, float a_fAlpha )
 {
-    m_oColor.r = a_fRed;
-    m_oColor.g = a_fGreen;
-    m_oColor.b = a_fBlue;
-    m_oColor.a = a_fAlpha;
+    m_oColor.r() = a_fRed;
+    m_oColor.g() = a_fGreen;
+    m_oColor.b() = a_fBlue;
+    m_oColor.a() = a_fAlpha;
     if( IsCurrent() )
     {
-        glClearColor( m_oColor.r, m_oColor.g, m_oColor.b, m_oColor.a );
+        glClearColor( m_oColor.r(), m_oColor.g(), m_oColor.b(), m_oColor.a() );
     }
     return *this;
 }
@@ -119,23 +119,23 @@ GameWindow& GameWindow::SetClearColor( Channel a_ucRed, Channel a_ucGreen,
     m_oColor.AlphaChannel( a_ucAlpha );
     if( IsCurrent() )
     {
-        glClearColor( m_oColor.r, m_oColor.g, m_oColor.b, m_oColor.a );
+        glClearColor( m_oColor.r(), m_oColor.g(), m_oColor.b(), m_oColor.a() );
     }
     return *this;
 }
 GameWindow& GameWindow::SetSize( unsigned int a_uiWidth,
                                  unsigned int a_uiHeight )
 {
-    m_oSize.x = a_uiWidth;
-    m_oSize.y = a_uiHeight;
+    m_oSize.x() = a_uiWidth;
+    m_oSize.y() = a_uiHeight;
     if( IsOpen() )
     {
         glfwSetWindowSize( m_poWindow,
-                           a_uiWidth + m_oFramePadding.x,
-                           a_uiHeight + m_oFramePadding.y );
+                           a_uiWidth + m_oFramePadding.x(),
+                           a_uiHeight + m_oFramePadding.y() );
         if( IsCurrent() )
         {
-            glViewport( 0, 0, m_oSize.x, m_oSize.y );
+            glViewport( 0, 0, m_oSize.x(), m_oSize.y() );
         }
     }
     return *this;
@@ -146,11 +146,11 @@ GameWindow& GameWindow::SetSize( const IntPoint2D& ac_roSize )
     if( IsOpen() )
     {
         glfwSetWindowSize( m_poWindow,
-                           ac_roSize.x + m_oFramePadding.x,
-                           ac_roSize.y + m_oFramePadding.y );
+                           ac_roSize.x() + m_oFramePadding.x(),
+                           ac_roSize.y() + m_oFramePadding.y() );
         if( IsCurrent() )
         {
-            glViewport( 0, 0, m_oSize.x, m_oSize.y );
+            glViewport( 0, 0, m_oSize.x(), m_oSize.y() );
         }
     }
     return *this;
@@ -222,8 +222,8 @@ bool GameWindow::Open()
 void GameWindow::CreateWindow()
 {
 	glfwWindowHint (GLFW_SAMPLES, 4);
-    m_poWindow = glfwCreateWindow( m_oSize.x + m_oFramePadding.x,
-                                    m_oSize.y + m_oFramePadding.y,
+    m_poWindow = glfwCreateWindow( m_oSize.x() + m_oFramePadding.x(),
+                                    m_oSize.y() + m_oFramePadding.y(),
                                     m_oTitle.CString(), nullptr, nullptr );
     if( nullptr != m_poWindow )
     {
@@ -236,13 +236,13 @@ void GameWindow::CreateWindow()
 void GameWindow::AdjustFramePadding()
 {
     IntPoint2D oBufferSize;
-    glfwGetFramebufferSize( m_poWindow, &( oBufferSize.x ), &( oBufferSize.y ) );
+    glfwGetFramebufferSize( m_poWindow, &( oBufferSize.x() ), &( oBufferSize.y() ) );
     if( m_oSize != oBufferSize )
     {
         m_oFramePadding = m_oSize - oBufferSize;
         glfwSetWindowSize( m_poWindow,
-                           m_oSize.x + m_oFramePadding.x,
-                           m_oSize.y + m_oFramePadding.y );
+                           m_oSize.x() + m_oFramePadding.x(),
+                           m_oSize.y() + m_oFramePadding.y() );
     }
 }
 
@@ -257,8 +257,8 @@ GameWindow& GameWindow::MakeCurrent()
     {
         Open();
         glfwMakeContextCurrent( m_poWindow );
-        glViewport( 0, 0, m_oSize.x, m_oSize.y );
-        glClearColor( m_oColor.r, m_oColor.g, m_oColor.b, m_oColor.a );
+        glViewport( 0, 0, m_oSize.x(), m_oSize.y() );
+        glClearColor( m_oColor.r(), m_oColor.g(), m_oColor.b(), m_oColor.a() );
     }
     return *this;
 }
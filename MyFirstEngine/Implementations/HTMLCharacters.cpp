@@ -2,182 +2,381 @@
  * File:               HTMLCharacters.cpp
  * Author:             Elizabeth Lowry
  * Date Created:       March 21, 2014
- * Description:        Initialization of HTML::Map.
- * Last Modified:      March 21, 2014
- * Last Modification:  Creation.
+ * Description:        Lookup of HTML character names and numbers.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Names are found through a constant perfect hash table.
  ******************************************************************************/
 
 #include "../Declarations/HTMLCharacters.h"
 #include "../Declarations/CharacterMap.h"
 #include "MathLibrary.h"
-#include <sstream>
+#include <cstring>
 
 namespace
 {
+
+// HTML names, placed so that each name's perfect hash is its index.  These are
+// constant data, so nothing has to run at startup to fill them in.
+//
+// A name's FNV-1a hash picks one of the displacements, and mixing the hash with
+// that displacement, modulo the name count, gives the name's index.  The
+// displacements were chosen bucket by bucket, largest bucket first, as the
+// smallest value sending every name in the bucket to an unused index.  Adding a
+// name means choosing new displacements and reordering the names -
+// PerformanceTestGroup::HTMLLookup checks that every name still finds itself.
+const unsigned int NAME_COUNT = 128;
+const unsigned int BUCKET_COUNT = 43;
+const unsigned int MAX_NAME_SIZE = 7;   // "Zscaron"
+struct NamedCharacter
+{
+    char acName[ MAX_NAME_SIZE + 1 ];
+    char cCharacter;
+};
+const unsigned char sc_aucDisplacements[ BUCKET_COUNT ] =
+{
+      4,  13,   0,   9,   2,  14,  11,  24,   7,   1,  25,   1,
+     10,   5,   1,   1,   6,   6,   6,   2,  10,   1,   2,   4,
+     21,  30,  28,   7,   6,  55, 101,  40,  78,   4,   4,  14,
+    110,  91, 189,   4, 214,  56, 210
+};
+const NamedCharacter sc_aoNamedCharacters[ NAME_COUNT ] =
+{
+    { "gt", HTML::gt },
+    { "rsquo", HTML::rsquo },
+    { "Auml", HTML::Auml },
+    { "tilde", HTML::tilde },
+    { "times", HTML::times },
+    { "bdquo", HTML::bdquo },
+    { "laquo", HTML::laquo },
+    { "atilde", HTML::atilde },
+    { "permil", HTML::permil },
+    { "uacute", HTML::uacute },
+    { "mdash", HTML::mdash },
+    { "Otilde", HTML::Otilde },
+    { "frac14", HTML::frac14 },
+    { "AElig", HTML::AElig },
+    { "ecirc", HTML::ecirc },
+    { "Aring", HTML::Aring },
+    { "Ntilde", HTML::Ntilde },
+    { "lsaquo", HTML::lsaquo },
+    { "ccedil", HTML::ccedil },
+    { "Scaron", HTML::Scaron },
+    { "igrave", HTML::igrave },
+    { "amp", HTML::amp },
+    { "plusmn", HTML::plusmn },
+    { "Atilde", HTML::Atilde },
+    { "iacute", HTML::iacute },
+    { "THORN", HTML::THORN },
+    { "aacute", HTML::aacute },
+    { "sect", HTML::sect },
+    { "oslash", HTML::oslash },
+    { "quot", HTML::quot },
+    { "shy", HTML::shy },
+    { "raquo", HTML::raquo },
+    { "eacute", HTML::eacute },
+    { "iuml", HTML::iuml },
+    { "lt", HTML::lt },
+    { "apos", HTML::apos },
+    { "thorn", HTML::thorn },
+    { "ouml", HTML::ouml },
+    { "deg", HTML::deg },
+    { "bull", HTML::bull },
+    { "ntilde", HTML::ntilde },
+    { "ordm", HTML::ordm },
+    { "ETH", HTML::ETH },
+    { "ndash", HTML::ndash },
+    { "sup1", HTML::sup1 },
+    { "uml", HTML::uml },
+    { "not", HTML::not },
+    { "middot", HTML::middot },
+    { "euro", HTML::euro },
+    { "reg", HTML::reg },
+    { "Zscaron", HTML::Zcaron },
+    { "dagger", HTML::dagger },
+    { "eth", HTML::eth },
+    { "uuml", HTML::uuml },
+    { "ldquo", HTML::ldquo },
+    { "ograve", HTML::ograve },
+    { "ocirc", HTML::ocirc },
+    { "para", HTML::para },
+    { "yen", HTML::yen },
+    { "divide", HTML::divide },
+    { "Uacute", HTML::Uacute },
+    { "copy", HTML::copy },
+    { "sup3", HTML::sup3 },
+    { "Ograve", HTML::Ograve },
+    { "cedil", HTML::cedil },
+    { "rsaquo", HTML::rsaquo },
+    { "aelig", HTML::aelig },
+    { "Eacute", HTML::Eacute },
+    { "Iuml", HTML::Iuml },
+    { "szlig", HTML::szlig },
+    { "trade", HTML::trade },
+    { "Ocirc", HTML::Ocirc },
+    { "acute", HTML::acute },
+    { "icirc", HTML::icirc },
+    { "agrave", HTML::agrave },
+    { "Yuml", HTML::Yuml },
+    { "circ", HTML::circ },
+    { "lsquo", HTML::lsquo },
+    { "Ucirc", HTML::Ucirc },
+    { "Agrave", HTML::Agrave },
+    { "ugrave", HTML::ugrave },
+    { "oelig", HTML::oelig },
+    { "Ugrave", HTML::Ugrave },
+    { "fnof", HTML::fnof },
+    { "curren", HTML::curren },
+    { "Iacute", HTML::Iacute },
+    { "pound", HTML::pound },
+    { "Oslash", HTML::Oslash },
+    { "yacute", HTML::yacute },
+    { "Icirc", HTML::Icirc },
+    { "Yacute", HTML::Yacute },
+    { "acirc", HTML::acirc },
+    { "Oacute", HTML::Oacute },
+    { "Ccedil", HTML::Ccedil },
+    { "yuml", HTML::yuml },
+    { "micro", HTML::micro },
+    { "frac12", HTML::frac12 },
+    { "oacute", HTML::oacute },
+    { "Igrave", HTML::Igrave },
+    { "Aacute", HTML::Aacute },
+    { "Egrave", HTML::Egrave },
+    { "sbquo", HTML::sbquo },
+    { "Ecirc", HTML::Ecirc },
+    { "iexcl", HTML::iexcl },
+    { "zcaron", HTML::zcaron },
+    { "ordf", HTML::ordf },
+    { "scaron", HTML::scaron },
+    { "macr", HTML::macr },
+    { "frac34", HTML::frac34 },
+    { "iquest", HTML::iquest },
+    { "nbsp", HTML::nbsp },
+    { "Dagger", HTML::Dagger },
+    { "Acirc", HTML::Acirc },
+    { "egrave", HTML::egrave },
+    { "Ouml", HTML::Ouml },
+    { "hellip", HTML::hellip },
+    { "auml", HTML::auml },
+    { "cent", HTML::cent },
+    { "euml", HTML::euml },
+    { "Euml", HTML::Euml },
+    { "Uuml", HTML::Uuml },
+    { "brvbar", HTML::brvbar },
+    { "aring", HTML::aring },
+    { "rdquo", HTML::rdquo },
+    { "OElig", HTML::OElig },
+    { "ucirc", HTML::ucirc },
+    { "otilde", HTML::otilde },
+    { "sup2", HTML::sup2 }
+};
+
+// FNV-1a hash of the given name, or false if it's too long to be in the table
+bool HashName( const char* ac_pcName,
+               unsigned int& a_ruiHash, unsigned int& a_ruiSize )
+{
+    unsigned int uiHash = 2166136261U;
+    unsigned int uiSize = 0;
+    for( ; '\0' != ac_pcName[ uiSize ]; ++uiSize )
+    {
+        if( MAX_NAME_SIZE == uiSize )
+        {
+            return false;
+        }
+        uiHash ^= (unsigned char)ac_pcName[ uiSize ];
+        uiHash *= 16777619U;
+    }
+    a_ruiHash = uiHash;
+    a_ruiSize = uiSize;
+    return true;
+}
+
+// Index of the name with the given hash, if that name is in the table
+unsigned int NameIndex( unsigned int a_uiHash )
+{
+    unsigned int uiMixed =
+        a_uiHash ^ sc_aucDisplacements[ a_uiHash % BUCKET_COUNT ];
+    uiMixed ^= uiMixed >> 16;
+    uiMixed *= 0x85EBCA6BU;
+    uiMixed ^= uiMixed >> 13;
+    return uiMixed % NAME_COUNT;
+}
+
+// Value of the given digit, or the base if it isn't a digit in that base
+unsigned int DigitValue( char a_cDigit, unsigned int a_uiBase )
+{
+    unsigned int uiValue = a_uiBase;
+    if( '0' <= a_cDigit && '9' >= a_cDigit )
+    {
+        uiValue = a_cDigit - '0';
+    }
+    else if( 'a' <= a_cDigit && 'f' >= a_cDigit )
+    {
+        uiValue = a_cDigit - 'a' + 10;
+    }
+    else if( 'A' <= a_cDigit && 'F' >= a_cDigit )
+    {
+        uiValue = a_cDigit - 'A' + 10;
+    }
+    return ( uiValue < a_uiBase ? uiValue : a_uiBase );
+}
+
+// Write the given number in the given base after the given prefix character
+void FormatNumber( char a_cPrefix, unsigned int a_uiNumber,
+                   unsigned int a_uiBase, char* a_pcBuffer )
+{
+    static const char sc_acDigits[] = "0123456789abcdef";
+    char acReversed[ 4 ];
+    unsigned int uiDigits = 0;
+    do
+    {
+        acReversed[ uiDigits++ ] = sc_acDigits[ a_uiNumber % a_uiBase ];
+        a_uiNumber /= a_uiBase;
+    } while( 0 < a_uiNumber );
+    *( a_pcBuffer++ ) = a_cPrefix;
+    while( 0 < uiDigits )
+    {
+        *( a_pcBuffer++ ) = acReversed[ --uiDigits ];
+    }
+    *a_pcBuffer = '\0';
+}
+
 // create a character map for all the displayable ascii characters, mapping each
 // character to itself, its hex code, its number code, and (if available) its
 // html code
-static MyFirstEngine::CharacterMap HTMLMap()
+MyFirstEngine::CharacterMap HTMLMap()
 {
     MyFirstEngine::CharacterMap oHTML;
-    std::stringstream oStream;
+    char acKey[ 5 ] = { 0 };
 
     // map all characters to their number codes( #___, x__ ) and to themselves
     for( unsigned int ui = 0; ui < 256; ++ui )
     {
-        oStream.clear();
-        oStream << std::ios::dec;
-        oStream << ui;
-        Utility::DumbString oNum( '#' );
-        oNum += oStream.str().c_str();
-        oStream.clear();
-        oStream << std::ios::hex;
-        oStream << ui;
-        oNum = oStream.str().c_str() + 1;
-        oHTML[ oNum ] =
-            oHTML[ Utility::DumbString( (char)ui ) ] = (char)ui;
+        FormatNumber( '#', ui, 10, acKey );
+        oHTML[ acKey ] = (char)ui;
+        FormatNumber( 'x', ui, 16, acKey );
+        oHTML[ acKey ] = (char)ui;
+        if( 0 < ui )
+        {
+            acKey[ 0 ] = (char)ui;
+            acKey[ 1 ] = '\0';
+            oHTML[ acKey ] = (char)ui;
+        }
     }
 
     // map HTML codes
-    oHTML[ "quot" ] = HTML::quot;
-    oHTML[ "amp" ] = HTML::amp;
-    oHTML[ "apos" ] = HTML::apos;
-    oHTML[ "lt" ] = HTML::lt;
-    oHTML[ "gt" ] = HTML::gt;
-    oHTML[ "euro" ] = HTML::euro;
-    oHTML[ "sbquo" ] = HTML::sbquo;
-    oHTML[ "fnof" ] = HTML::fnof;
-    oHTML[ "bdquo" ] = HTML::bdquo;
-    oHTML[ "hellip" ] = HTML::hellip;
-    oHTML[ "circ" ] = HTML::circ;
-    oHTML[ "dagger" ] = HTML::dagger;
-    oHTML[ "Dagger" ] = HTML::Dagger;
-    oHTML[ "permil" ] = HTML::permil;
-    oHTML[ "Scaron" ] = HTML::Scaron;
-    oHTML[ "lsaquo" ] = HTML::lsaquo;
-    oHTML[ "OElig" ] = HTML::OElig;
-    oHTML[ "Zscaron" ] = HTML::Zcaron;
-    oHTML[ "lsquo" ] = HTML::lsquo;
-    oHTML[ "rsquo" ] = HTML::rsquo;
-    oHTML[ "ldquo" ] = HTML::ldquo;
-    oHTML[ "rdquo" ] = HTML::rdquo;
-    oHTML[ "bull" ] = HTML::bull;
-    oHTML[ "ndash" ] = HTML::ndash;
-    oHTML[ "mdash" ] = HTML::mdash;
-    oHTML[ "tilde" ] = HTML::tilde;
-    oHTML[ "trade" ] = HTML::trade;
-    oHTML[ "scaron" ] = HTML::scaron;
-    oHTML[ "rsaquo" ] = HTML::rsaquo;
-    oHTML[ "oelig" ] = HTML::oelig;
-    oHTML[ "zcaron" ] = HTML::zcaron;
-    oHTML[ "Yuml" ] = HTML::Yuml;
-    oHTML[ "nbsp" ] = HTML::nbsp;
-    oHTML[ "iexcl" ] = HTML::iexcl;
-    oHTML[ "cent" ] = HTML::cent;
-    oHTML[ "pound" ] = HTML::pound;
-    oHTML[ "curren" ] = HTML::curren;
-    oHTML[ "yen" ] = HTML::yen;
-    oHTML[ "brvbar" ] = HTML::brvbar;
-    oHTML[ "sect" ] = HTML::sect;
-    oHTML[ "uml" ] = HTML::uml;
-    oHTML[ "copy" ] = HTML::copy;
-    oHTML[ "ordf" ] = HTML::ordf;
-    oHTML[ "laquo" ] = HTML::laquo;
-    oHTML[ "not" ] = HTML::not;
-    oHTML[ "shy" ] = HTML::shy;
-    oHTML[ "reg" ] = HTML::reg;
-    oHTML[ "macr" ] = HTML::macr;
-    oHTML[ "deg" ] = HTML::deg;
-    oHTML[ "plusmn" ] = HTML::plusmn;
-    oHTML[ "sup2" ] = HTML::sup2;
-    oHTML[ "sup3" ] = HTML::sup3;
-    oHTML[ "acute" ] = HTML::acute;
-    oHTML[ "micro" ] = HTML::micro;
-    oHTML[ "para" ] = HTML::para;
-    oHTML[ "middot" ] = HTML::middot;
-    oHTML[ "cedil" ] = HTML::cedil;
-    oHTML[ "sup1" ] = HTML::sup1;
-    oHTML[ "ordm" ] = HTML::ordm;
-    oHTML[ "raquo" ] = HTML::raquo;
-    oHTML[ "frac14" ] = HTML::frac14;
-    oHTML[ "frac12" ] = HTML::frac12;
-    oHTML[ "frac34" ] = HTML::frac34;
-    oHTML[ "iquest" ] = HTML::iquest;
-    oHTML[ "Agrave" ] = HTML::Agrave;
-    oHTML[ "Aacute" ] = HTML::Aacute;
-    oHTML[ "Acirc" ] = HTML::Acirc;
-    oHTML[ "Atilde" ] = HTML::Atilde;
-    oHTML[ "Auml" ] = HTML::Auml;
-    oHTML[ "Aring" ] = HTML::Aring;
-    oHTML[ "AElig" ] = HTML::AElig;
-    oHTML[ "Ccedil" ] = HTML::Ccedil;
-    oHTML[ "Egrave" ] = HTML::Egrave;
-    oHTML[ "Eacute" ] = HTML::Eacute;
-    oHTML[ "Ecirc" ] = HTML::Ecirc;
-    oHTML[ "Euml" ] = HTML::Euml;
-    oHTML[ "Igrave" ] = HTML::Igrave;
-    oHTML[ "Iacute" ] = HTML::Iacute;
-    oHTML[ "Icirc" ] = HTML::Icirc;
-    oHTML[ "Iuml" ] = HTML::Iuml;
-    oHTML[ "ETH" ] = HTML::ETH;
-    oHTML[ "Ntilde" ] = HTML::Ntilde;
-    oHTML[ "Ograve" ] = HTML::Ograve;
-    oHTML[ "Oacute" ] = HTML::Oacute;
-    oHTML[ "Ocirc" ] = HTML::Ocirc;
-    oHTML[ "Otilde" ] = HTML::Otilde;
-    oHTML[ "Ouml" ] = HTML::Ouml;
-    oHTML[ "times" ] = HTML::times;
-    oHTML[ "Oslash" ] = HTML::Oslash;
-    oHTML[ "Ugrave" ] = HTML::Ugrave;
-    oHTML[ "Uacute" ] = HTML::Uacute;
-    oHTML[ "Ucirc" ] = HTML::Ucirc;
-    oHTML[ "Uuml" ] = HTML::Uuml;
-    oHTML[ "Yacute" ] = HTML::Yacute;
-    oHTML[ "THORN" ] = HTML::THORN;
-    oHTML[ "szlig" ] = HTML::szlig;
-    oHTML[ "agrave" ] = HTML::agrave;
-    oHTML[ "aacute" ] = HTML::aacute;
-    oHTML[ "acirc" ] = HTML::acirc;
-    oHTML[ "atilde" ] = HTML::atilde;
-    oHTML[ "auml" ] = HTML::auml;
-    oHTML[ "aring" ] = HTML::aring;
-    oHTML[ "aelig" ] = HTML::aelig;
-    oHTML[ "ccedil" ] = HTML::ccedil;
-    oHTML[ "egrave" ] = HTML::egrave;
-    oHTML[ "eacute" ] = HTML::eacute;
-    oHTML[ "ecirc" ] = HTML::ecirc;
-    oHTML[ "euml" ] = HTML::euml;
-    oHTML[ "igrave" ] = HTML::igrave;
-    oHTML[ "iacute" ] = HTML::iacute;
-    oHTML[ "icirc" ] = HTML::icirc;
-    oHTML[ "iuml" ] = HTML::iuml;
-    oHTML[ "eth" ] = HTML::eth;
-    oHTML[ "ntilde" ] = HTML::ntilde;
-    oHTML[ "ograve" ] = HTML::ograve;
-    oHTML[ "oacute" ] = HTML::oacute;
-    oHTML[ "ocirc" ] = HTML::ocirc;
-    oHTML[ "otilde" ] = HTML::otilde;
-    oHTML[ "ouml" ] = HTML::ouml;
-    oHTML[ "divide" ] = HTML::divide;
-    oHTML[ "oslash" ] = HTML::oslash;
-    oHTML[ "ugrave" ] = HTML::ugrave;
-    oHTML[ "uacute" ] = HTML::uacute;
-    oHTML[ "ucirc" ] = HTML::ucirc;
-    oHTML[ "uuml" ] = HTML::uuml;
-    oHTML[ "yacute" ] = HTML::yacute;
-    oHTML[ "thorn" ] = HTML::thorn;
-    oHTML[ "yuml" ] = HTML::yuml;
+    for( unsigned int ui = 0; ui < NAME_COUNT; ++ui )
+    {
+        oHTML[ sc_aoNamedCharacters[ ui ].acName ] =
+            sc_aoNamedCharacters[ ui ].cCharacter;
+    }
 
     // return the resulting character map
     return oHTML;
 }   // HTMLMap()
+
 }   // namespace
 
 namespace HTML
 {
+
+// Built the first time it's asked for
 const MyFirstEngine::CharacterMap& Map()
 {
     static MyFirstEngine::CharacterMap soMap = HTMLMap();
     return soMap;
 }
-}
\ No newline at end of file
+
+// Single characters map to themselves, numbers are parsed, and names are looked
+// up in the perfect hash table
+bool Find( const char* ac_pcName, char& a_rcCharacter )
+{
+    if( nullptr == ac_pcName || '\0' == ac_pcName[ 0 ] )
+    {
+        return false;
+    }
+    if( '\0' == ac_pcName[ 1 ] )
+    {
+        a_rcCharacter = ac_pcName[ 0 ];
+        return true;
+    }
+
+    // No HTML names start with '#' or 'x'
+    if( '#' == ac_pcName[ 0 ] || 'x' == ac_pcName[ 0 ] )
+    {
+        return ParseNumber( ac_pcName, a_rcCharacter );
+    }
+
+    // A name is only in the table if it's in the slot its hash points to
+    unsigned int uiHash = 0;
+    unsigned int uiSize = 0;
+    if( !HashName( ac_pcName, uiHash, uiSize ) )
+    {
+        return false;
+    }
+    const NamedCharacter& croEntry =
+        sc_aoNamedCharacters[ NameIndex( uiHash ) ];
+    if( 0 != std::memcmp( croEntry.acName, ac_pcName, uiSize + 1 ) )
+    {
+        return false;
+    }
+    a_rcCharacter = croEntry.cCharacter;
+    return true;
+}
+
+// Parse "#" followed by decimal digits or "x" and hexadecimal digits, or "x"
+// followed by hexadecimal digits
+bool ParseNumber( const char* ac_pcName, char& a_rcCharacter )
+{
+    if( nullptr == ac_pcName )
+    {
+        return false;
+    }
+    const char* pcDigit = ac_pcName;
+    unsigned int uiBase = 16;
+    if( '#' == *pcDigit )
+    {
+        ++pcDigit;
+        if( 'x' == *pcDigit || 'X' == *pcDigit )
+        {
+            ++pcDigit;
+        }
+        else
+        {
+            uiBase = 10;
+        }
+    }
+    else if( 'x' == *pcDigit )
+    {
+        ++pcDigit;
+    }
+    else
+    {
+        return false;
+    }
+
+    // Need at least one digit, and stop as soon as the value is too big for a
+    // char, so it can't overflow
+    if( '\0' == *pcDigit )
+    {
+        return false;
+    }
+    unsigned int uiValue = 0;
+    for( ; '\0' != *pcDigit; ++pcDigit )
+    {
+        const unsigned int cuiDigit = DigitValue( *pcDigit, uiBase );
+        if( uiBase == cuiDigit )
+        {
+            return false;
+        }
+        uiValue = uiValue * uiBase + cuiDigit;
+        if( 255 < uiValue )
+        {
+            return false;
+        }
+    }
+    a_rcCharacter = (char)uiValue;
+    return true;
+}
+
+}   // namespace HTML
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 25, 2014
  * Description:        Class for managing mouse input
- * Last Modified:      March 25, 2014
- * Last Modification:  Creation.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Point coordinates are now accessor functions.
  ******************************************************************************/
 
 #include "../Declarations/Mouse.h"
@@ -130,9 +130,9 @@ Point2D Mouse::Position( GameWindow* a_poWindow )
         return Point2D::Origin();
     }
     Point2D oResult;
-    glfwGetCursorPos( a_poWindow->m_poWindow, &oResult.x, &oResult.y );
-    oResult.x -= a_poWindow->GetSize().x / 2;
-    oResult.y = a_poWindow->GetSize().y / 2 - oResult.y;
+    glfwGetCursorPos( a_poWindow->m_poWindow, &oResult.x(), &oResult.y() );
+    oResult.x() -= a_poWindow->GetSize().x() / 2;
+    oResult.y() = a_poWindow->GetSize().y() / 2 - oResult.y();
     return oResult;
 }
 
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 26, 2014
  * Description:        Function implementations for the QuadShaderProgram class.
- * Last Modified:      March 17, 2014
- * Last Modification:  Adding replacement for deprecated OpenGL matrix stack.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added single-precision shader variants.
  ******************************************************************************/
 
 #include "../Declarations/GameEngine.h"
@@ -19,6 +19,8 @@ namespace MyFirstEngine
 // default quad shader source code files
 const char* const QuadShaderProgram::QUAD_VERTEX_SHADER_FILE =
                                             "resources/shaders/QuadVertex.glsl";
+const char* const QuadShaderProgram::QUAD_DOUBLE_VERTEX_SHADER_FILE =
+                                      "resources/shaders/QuadVertexDouble.glsl";
 const char* const QuadShaderProgram::QUAD_FRAGMENT_SHADER_FILE =
                                           "resources/shaders/QuadFragment.glsl";
 
@@ -34,7 +36,10 @@ const unsigned int QuadShaderProgram::QUAD_ELEMENT_DATA[4] = { 0, 1, 3, 2 };
 QuadShaderProgram::QuadShaderProgram()
     : m_iModelViewProjectionID( 0 ), m_iColorID( 0 ), m_uiElementBufferID( 0 ),
       m_uiVertexArrayID ( 0 ), m_uiVertexBufferID( 0 ),
-      ShaderProgram( Shader( GL_VERTEX_SHADER, QUAD_VERTEX_SHADER_FILE ),
+      ShaderProgram( Shader( GL_VERTEX_SHADER,
+                             GameEngine::UsesDoublePrecision()
+                                ? QUAD_DOUBLE_VERTEX_SHADER_FILE
+                                : QUAD_VERTEX_SHADER_FILE ),
                      Shader( GL_FRAGMENT_SHADER, QUAD_FRAGMENT_SHADER_FILE ) ) {}
 
 // Destroy data used by the shader
@@ -60,7 +65,9 @@ void QuadShaderProgram::SetupData()
 {
     // Get location of uniform variables
     GLint iModelViewProjectionID =
-        glGetUniformLocation( m_uiID, "u_dm4ModelViewProjection" );
+        glGetUniformLocation( m_uiID, GameEngine::UsesDoublePrecision()
+                                      ? "u_dm4ModelViewProjection"
+                                      : "u_m4ModelViewProjection" );
     GLint iColorID = glGetUniformLocation( m_uiID, "u_v4Color" );
 
     // Create vertex array object
@@ -145,14 +152,8 @@ void QuadShaderProgram::DrawQuad( const Color::ColorVector& ac_roColor )
     const ShaderProgram& oPrevious = ShaderProgram::Current();
     Instance().Use();
 
-    // OpenGL uses column vectors, while the MathLibrary transforms are made for
-    // use with row vectors.  However, OpenGL stores matrix data in column-major
-    // order, while the MathLibrary matrices store data in row-major order, so
-    // feeding data from the latter to the former is an automatic transposition.
-    glUniformMatrix4dv( Instance().m_iModelViewProjectionID, 1, false,
-                        &( GameEngine::ModelViewProjection()[0][0] ) );
-    
-    // Set other uniforms and draw
+    // Set uniforms and draw
+    SetModelViewProjection( Instance().m_iModelViewProjectionID );
     glUniform4fv( Instance().m_iColorID, 1, &( ac_roColor[0] ) );
     DrawElements();
 
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 13, 2014
  * Description:        Function implementations for the Shader class.
- * Last Modified:      March 25, 2014
- * Last Modification:  Removing PIMPL static pointers from header.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Source names are interned.
  ******************************************************************************/
 
 #include "../Declarations/GameEngine.h"
@@ -22,15 +22,15 @@
 namespace
 {
     
-// looking up existing shaders and source text
+// looking up existing shaders and source text - source names are interned,
+// so shader lookups for each type are integer-keyed flat maps
 class ShaderLookup
-    : public std::unordered_map< GLenum, std::unordered_map< Utility::DumbString, GLuint > >,
+    : public std::unordered_map< GLenum, Utility::AtomMap< GLuint > >,
       public Utility::Singleton< ShaderLookup >
 {
     friend class Utility::Singleton< ShaderLookup >;
 public:
-    typedef std::unordered_map< Utility::DumbString, GLuint > InnerType;
-    typedef InnerType::value_type InnerValueType;
+    typedef Utility::AtomMap< GLuint > InnerType;
     typedef std::unordered_map< GLenum, InnerType > BaseType;
     typedef BaseType::value_type ValueType;
     virtual ~ShaderLookup() {}
@@ -38,12 +38,12 @@ private:
     ShaderLookup() {}
 };
 class SourceNameLookup
-    : public std::unordered_map< GLuint, Utility::DumbString >,
+    : public std::unordered_map< GLuint, Utility::Atom >,
       public Utility::Singleton< SourceNameLookup >
 {
     friend class Utility::Singleton< SourceNameLookup >;
 public:
-    typedef std::unordered_map< GLuint, Utility::DumbString > BaseType;
+    typedef std::unordered_map< GLuint, Utility::Atom > BaseType;
     typedef BaseType::value_type ValueType;
     virtual ~SourceNameLookup() {}
 private:
@@ -86,25 +86,26 @@ using namespace Utility;
 // If source name hasn't been loaded yet, do so and compile a new shader
 Shader::Shader( GLenum a_eType, const char* ac_pcSourceName, bool a_bRecompile )
 {
-    DumbString oSourceName( ac_pcSourceName );
+    Atom oSourceName( ac_pcSourceName );
     
     // If requesting the default shader of this type, use the specialized
     // Default function to make sure the default shader is loaded and compiled.
-    if( "" == oSourceName )
+    if( oSourceName.IsEmpty() )
     {
         m_uiID = Null().m_uiID;
     }
 
     // If a shader has already been compiled from source code with the given
     // name, reuse its ID.
-    else if( 0 < Lookup()[ a_eType ].count( oSourceName ) )
+    else if( Lookup()[ a_eType ].Has( oSourceName ) )
     {
         m_uiID = Lookup()[ a_eType ][ oSourceName ];
 
         // If the recompile flag is set to true, reload and recompile the shader
         if( a_bRecompile )
         {
-            CompileShader( DumbString::LoadFrom( oSourceName ), m_uiID );
+            CompileShader( DumbString::LoadFrom( oSourceName.CString() ),
+                           m_uiID );
         }
     }
 
@@ -112,7 +113,8 @@ Shader::Shader( GLenum a_eType, const char* ac_pcSourceName, bool a_bRecompile )
     // map.
     else
     {
-        m_uiID = CompileShader( a_eType, DumbString::LoadFrom( oSourceName ) );
+        m_uiID = CompileShader( a_eType,
+                                DumbString::LoadFrom( oSourceName.CString() ) );
         Lookup()[ a_eType ][ oSourceName ] = m_uiID;
         SourceLookup()[ m_uiID ] = oSourceName;
     }
@@ -125,22 +127,23 @@ Shader::Shader( GLenum a_eType, const char* ac_pcSourceName, bool a_bRecompile )
 Shader::Shader( GLenum a_eType, const char* ac_pcSourceName,
                 const char* ac_pcSourceText, bool a_bRecompile )
 {
-    DumbString oSourceName( ac_pcSourceName );
+    Atom oSourceName( ac_pcSourceName );
     DumbString oSourceText( ac_pcSourceText );
 
     // If requesting the default shader or an already-compiled shader, reuse the
     // existing ID.
-    if( "" == oSourceName || 0 < Lookup()[ a_eType ].count( oSourceName ) )
+    if( oSourceName.IsEmpty() || Lookup()[ a_eType ].Has( oSourceName ) )
     {
-        m_uiID = ( "" == oSourceName
+        m_uiID = ( oSourceName.IsEmpty()
                     ? Null().m_uiID : Lookup()[ a_eType ][ oSourceName ] );
 
         // If the recompile flag is set to true and either a file name or source
         // code is passed in, reload and recompile.
-        if( a_bRecompile && ( "" != oSourceName || "" != oSourceText ) )
+        if( a_bRecompile && ( !oSourceName.IsEmpty() || "" != oSourceText ) )
         {
             CompileShader( "" == oSourceText
-                            ? DumbString::LoadFrom( oSourceName ) : oSourceText,
+                            ? DumbString::LoadFrom( oSourceName.CString() )
+                            : oSourceText,
                            m_uiID );
         }
     }
@@ -148,9 +151,10 @@ Shader::Shader( GLenum a_eType, const char* ac_pcSourceName,
     // If there is no already-compiled shader, load and compile.
     else
     {
-        m_uiID = CompileShader( a_eType, "" == oSourceText
-                                         ? DumbString::LoadFrom( oSourceName )
-                                         : oSourceText );
+        m_uiID = CompileShader( a_eType,
+                                "" == oSourceText
+                                ? DumbString::LoadFrom( oSourceName.CString() )
+                                : oSourceText );
         Lookup()[ a_eType ][ oSourceName ] = m_uiID;
         SourceLookup()[ m_uiID ] = oSourceName;
     }
@@ -162,7 +166,7 @@ void Shader::Delete()
     if( 0 != m_uiID )
     {
         glDeleteShader( m_uiID );
-        Lookup()[ Type() ].erase( SourceLookup()[ m_uiID ] );
+        Lookup()[ Type() ].Remove( SourceLookup()[ m_uiID ] );
         SourceLookup().erase( m_uiID );
     }
 }
@@ -199,11 +203,12 @@ GLenum Shader::Type() const
 // Destroy all shaders
 void Shader::DestroyAll()
 {
-    for each( ShaderLookup::ValueType oPair in Lookup() )
+    for( ShaderLookup::iterator oIter = Lookup().begin();
+         Lookup().end() != oIter; ++oIter )
     {
-        for each( ShaderLookup::InnerValueType oInnerPair in oPair.second )
+        for( unsigned int ui = 0; ui < oIter->second.Size(); ++ui )
         {
-            glDeleteShader( oInnerPair.second );
+            glDeleteShader( oIter->second.ValueAt( ui ) );
         }
     }
     Lookup().clear();
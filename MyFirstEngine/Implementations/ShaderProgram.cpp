@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 24, 2014
  * Description:        Function implementations for the ShaderProgram class.
- * Last Modified:      March 12, 2014
- * Last Modification:  Refactoring.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Upload transforms at engine precision.
  ******************************************************************************/
 
 #include "../Declarations/GameEngine.h"
@@ -173,6 +173,27 @@ void ShaderProgram::Use() const
     UseData();
 }
 
+// Upload the current model-view-projection matrix at the engine's precision
+void ShaderProgram::SetModelViewProjection( GLint a_iLocation )
+{
+    // OpenGL uses column vectors, while the MathLibrary transforms are made for
+    // use with row vectors.  However, OpenGL stores matrix data in column-major
+    // order, while the MathLibrary matrices store data in row-major order, so
+    // feeding data from the latter to the former is an automatic transposition.
+    if( GameEngine::UsesDoublePrecision() )
+    {
+        glUniformMatrix4dv( a_iLocation, 1, false,
+                            &( GameEngine::ModelViewProjection()[0][0] ) );
+    }
+    else
+    {
+        FloatTransform3D oModelViewProjection;
+        GameEngine::ModelViewProjection( oModelViewProjection );
+        glUniformMatrix4fv( a_iLocation, 1, false,
+                            &( oModelViewProjection[0][0] ) );
+    }
+}
+
 // Get the first shader of the given type used by this program
 Shader ShaderProgram::GetShader( GLenum a_eType ) const
 {
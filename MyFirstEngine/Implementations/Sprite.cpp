@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 5, 2014
  * Description:        Implementations for Sprite functions.
- * Last Modified:      March 17, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Model matrix cache is only allocated when needed.
  ******************************************************************************/
 
 #include "../Declarations/Sprite.h"
@@ -162,17 +162,17 @@ const Frame& Sprite::operator[]( unsigned int a_uiFrameNumber ) const
 // Get/Set display size ( scale / framePixels )
 Point2D Sprite::DisplaySize() const
 {
-    return Point2D( m_oScale.x * FramePixels().x,
-                    m_oScale.y * FramePixels().y );
+    return Point2D( m_oScale.x() * FramePixels().x(),
+                    m_oScale.y() * FramePixels().y() );
 }
 Sprite& Sprite::SetDisplaySize( const Point2D& ac_roSize )
 {
-    return SetDisplaySize( ac_roSize.x, ac_roSize.y );
+    return SetDisplaySize( ac_roSize.x(), ac_roSize.y() );
 }
 Sprite& Sprite::SetDisplaySize( double a_dWidth, double a_dHeight )
 {
-    SetScale( ( 0 == FramePixels().x ? 0 : a_dWidth / FramePixels().x ),
-              ( 0 == FramePixels().y ? 0 : a_dHeight / FramePixels().y ) );
+    SetScale( ( 0 == FramePixels().x() ? 0 : a_dWidth / FramePixels().x() ),
+              ( 0 == FramePixels().y() ? 0 : a_dHeight / FramePixels().y() ) );
     return *this;
 }
 
@@ -251,18 +251,37 @@ Sprite& Sprite::SetTexture( Texture& a_roTexture )
 // have changed since the last time said transformation was calculated,
 // recalculate it.
 const Transform3D& Sprite::GetModelMatrix() const
+{
+    // In planar mode, the display area is part of the planar matrix unless
+    // the before transformation has to go between them
+    if( m_bPlanar && m_bBeforeIsIdentity )
+    {
+        return Quad::GetModelMatrix();
+    }
+    Transform3D& roModelMatrix = ModelMatrixCache();
+    if( *m_pbUpdateModelMatrix )
+    {
+        Affine3D oDisplayArea;
+        CurrentFrame().DisplayAreaVertexTransform( oDisplayArea );
+        ComposeModelMatrix( roModelMatrix, &oDisplayArea );
+        *m_pbUpdateModelMatrix = false;
+    }
+    return roModelMatrix;
+}
+
+// Get the cached planar model transformation, including the frame's display
+// area
+const Affine2D& Sprite::GetPlanarMatrix() const
 {
     if( *m_pbUpdateModelMatrix )
     {
-        CurrentFrame().DisplayAreaVertexTransform( *m_poModelMatrix );
-        *m_poModelMatrix *= m_oBeforeTransform *
-                            Space::Scaling( m_oScale ) *
-                            m_oRotation.MakeTransform() *
-                            Space::Translation( m_oPosition ) *
-                            m_oAfterTransform;
+        Affine2D oDisplayArea;
+        CurrentFrame().DisplayAreaVertexTransform( oDisplayArea );
+        ComposePlanarMatrix( m_oPlanarMatrix, &oDisplayArea );
         *m_pbUpdateModelMatrix = false;
+        m_bExpandPlanarMatrix = true;
     }
-    return *m_poModelMatrix;
+    return m_oPlanarMatrix;
 }
 
 // Get the cached texture coordinate transformation resulting from the
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 12, 2014
  * Description:        Implementation for SpriteShaderProgram functions.
- * Last Modified:      March 17, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added single-precision shader variants.
  ******************************************************************************/
 
 #include "../Declarations/GameEngine.h"
@@ -19,6 +19,10 @@ const char* const SpriteShaderProgram::SPRITE_VERTEX_SHADER_FILE =
                                           "resources/shaders/SpriteVertex.glsl";
 const char* const SpriteShaderProgram::SPRITE_FRAGMENT_SHADER_FILE =
                                         "resources/shaders/SpriteFragment.glsl";
+const char* const SpriteShaderProgram::SPRITE_DOUBLE_VERTEX_SHADER_FILE =
+                                    "resources/shaders/SpriteVertexDouble.glsl";
+const char* const SpriteShaderProgram::SPRITE_DOUBLE_FRAGMENT_SHADER_FILE =
+                                  "resources/shaders/SpriteFragmentDouble.glsl";
 
 // The texture coordinates of the four corners of a sprite with a frame showing
 // the entire texture within itself with no offsets
@@ -32,8 +36,14 @@ SpriteShaderProgram::SpriteShaderProgram()
     : m_iModelViewProjectionID( 0 ), m_iTexTransformID( 0 ), m_iColorID( 0 ),
       m_iTextureID( 0 ), m_iOffsetUVID( 0 ), m_iSizeUVID( 0 ), m_iClampXID( 0 ),
       m_iClampYID( 0 ), m_uiVertexArrayID ( 0 ), m_uiTexCoordinateBufferID( 0 ),
-      ShaderProgram( Shader( GL_VERTEX_SHADER, SPRITE_VERTEX_SHADER_FILE ),
-                     Shader( GL_FRAGMENT_SHADER, SPRITE_FRAGMENT_SHADER_FILE ) ) {}
+      ShaderProgram( Shader( GL_VERTEX_SHADER,
+                             GameEngine::UsesDoublePrecision()
+                                ? SPRITE_DOUBLE_VERTEX_SHADER_FILE
+                                : SPRITE_VERTEX_SHADER_FILE ),
+                     Shader( GL_FRAGMENT_SHADER,
+                             GameEngine::UsesDoublePrecision()
+                                ? SPRITE_DOUBLE_FRAGMENT_SHADER_FILE
+                                : SPRITE_FRAGMENT_SHADER_FILE ) ) {}
 
 // Destroy data used by the shader
 void SpriteShaderProgram::DestroyData()
@@ -61,13 +71,20 @@ void SpriteShaderProgram::DestroyData()
 void SpriteShaderProgram::SetupData()
 {
     // Get uniform variable locations
+    bool bDouble = GameEngine::UsesDoublePrecision();
     GLint iModelViewProjectionID =
-        glGetUniformLocation( m_uiID, "u_dm4ModelViewProjection" );
-    GLint iTexTransformID = glGetUniformLocation( m_uiID, "u_dm3TexTransform" );
+        glGetUniformLocation( m_uiID, bDouble ? "u_dm4ModelViewProjection"
+                                              : "u_m4ModelViewProjection" );
+    GLint iTexTransformID =
+        glGetUniformLocation( m_uiID, bDouble ? "u_dm3TexTransform"
+                                              : "u_m3TexTransform" );
     GLint iColorID = glGetUniformLocation( m_uiID, "u_v4Color" );
     GLint iTextureID = glGetUniformLocation( m_uiID, "u_t2dTexture" );
-    GLint iOffsetUVID = glGetUniformLocation( m_uiID, "u_dv2OffsetUV" );
-    GLint iSizeUVID = glGetUniformLocation( m_uiID, "u_dv2SizeUV" );
+    GLint iOffsetUVID =
+        glGetUniformLocation( m_uiID, bDouble ? "u_dv2OffsetUV"
+                                              : "u_v2OffsetUV" );
+    GLint iSizeUVID =
+        glGetUniformLocation( m_uiID, bDouble ? "u_dv2SizeUV" : "u_v2SizeUV" );
     GLint iClampXID = glGetUniformLocation( m_uiID, "u_bClampX" );
     GLint iClampYID = glGetUniformLocation( m_uiID, "u_bClampY" );
 
@@ -152,20 +169,29 @@ void SpriteShaderProgram::DrawSprite( Texture& a_roTexture,
     Instance().Use();
     a_roTexture.MakeCurrent();
 
-    // OpenGL uses column vectors, while the MathLibrary transforms are made for
-    // use with row vectors.  However, OpenGL stores matrix data in column-major
-    // order, while the MathLibrary matrices store data in row-major order, so
-    // feeding data from the latter to the former is an automatic transposition.
-    glUniformMatrix4dv( Instance().m_iModelViewProjectionID, 1, false,
-                        &( GameEngine::ModelViewProjection()[0][0] ) );
+    // Set transform uniforms at the engine's precision
+    SetModelViewProjection( Instance().m_iModelViewProjectionID );
+    if( GameEngine::UsesDoublePrecision() )
+    {
+        glUniformMatrix3dv( Instance().m_iTexTransformID, 1, false,
+                            &( ac_roTexTransform[0][0] ) );
+        glUniform2dv( Instance().m_iOffsetUVID, 1, &( ac_roOffsetUV[0] ) );
+        glUniform2dv( Instance().m_iSizeUVID, 1, &( ac_roSizeUV[0] ) );
+    }
+    else
+    {
+        FloatTransform2D oTexTransform( ac_roTexTransform );
+        glUniformMatrix3fv( Instance().m_iTexTransformID, 1, false,
+                            &( oTexTransform[0][0] ) );
+        glUniform2f( Instance().m_iOffsetUVID,
+                     (float)ac_roOffsetUV.x(), (float)ac_roOffsetUV.y() );
+        glUniform2f( Instance().m_iSizeUVID,
+                     (float)ac_roSizeUV.x(), (float)ac_roSizeUV.y() );
+    }
 
     // Set other uniforms
-    glUniformMatrix3dv( Instance().m_iTexTransformID, 1, false,
-                        &( ac_roTexTransform[0][0] ) );
     glUniform4fv( Instance().m_iColorID, 1, &( ac_roColor[0] ) );
     glUniform1i( Instance().m_iTextureID, 0 );
-    glUniform2dv( Instance().m_iOffsetUVID, 1, &( ac_roOffsetUV[0] ) );
-    glUniform2dv( Instance().m_iSizeUVID, 1, &( ac_roSizeUV[0] ) );
     glUniform1i( Instance().m_iClampXID,
                  GL_CLAMP_TO_EDGE == a_roTexture.WrapS() ? GL_TRUE : GL_FALSE );
     glUniform1i( Instance().m_iClampYID,
@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 6, 2014
  * Description:        Class representing an texture.
- * Last Modified:      March 17, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Point coordinates are now accessor functions.
  ******************************************************************************/
 
 #include "../Declarations/Texture.h"
@@ -107,7 +107,7 @@ void Texture::Destroy( bool a_bCache )
     {
         glActiveTexture( GL_TEXTURE0 );
         glBindTexture( GL_TEXTURE_2D, m_uiID );
-        m_paucData = new unsigned char [ m_oSize.x * m_oSize.y * 4 ];
+        m_paucData = new unsigned char [ m_oSize.x() * m_oSize.y() * 4 ];
         glGetTexImage( GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, m_paucData );
         glBindTexture( GL_TEXTURE_2D, 0 );
     }
@@ -140,15 +140,15 @@ void Texture::Load( bool a_bCache )
     // if there's data in the cache, load it
     if( nullptr != m_paucData )
     {
-        glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, m_oSize.x, m_oSize.y,
+        glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, m_oSize.x(), m_oSize.y(),
                       0, GL_RGBA, GL_UNSIGNED_BYTE, m_paucData );
     }
     else
     {
         // if there's no data in the cache, load using SOIL
         unsigned char* paucData =
-            SOIL_load_image( m_oFile, &m_oSize.x, &m_oSize.y, 0, SOIL_LOAD_RGBA );
-        glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, m_oSize.x, m_oSize.y,
+            SOIL_load_image( m_oFile, &m_oSize.x(), &m_oSize.y(), 0, SOIL_LOAD_RGBA );
+        glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA, m_oSize.x(), m_oSize.y(),
                       0, GL_RGBA, GL_UNSIGNED_BYTE, paucData );
         m_oFrame.framePixels = m_oSize;
         m_oFrame.slicePixels = m_oSize;
@@ -156,8 +156,8 @@ void Texture::Load( bool a_bCache )
         // if caching is required, copy to cache
         if( a_bCache )
         {
-            m_paucData = new unsigned char[ m_oSize.x * m_oSize.y * 4 ];
-            memcpy( m_paucData, paucData, m_oSize.x * m_oSize.y * 4 );
+            m_paucData = new unsigned char[ m_oSize.x() * m_oSize.y() * 4 ];
+            memcpy( m_paucData, paucData, m_oSize.x() * m_oSize.y() * 4 );
         }
 
         // Free data loaded with SOIL
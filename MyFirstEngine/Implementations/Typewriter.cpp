@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       March 22, 2014
  * Description:        Implementations for Typewriter class functions.
- * Last Modified:      March 22, 2014
- * Last Modification:  Creation.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Glyphs use planar mode.
  ******************************************************************************/
 
 #include "../Declarations/Typewriter.h"
@@ -16,23 +16,27 @@ namespace MyFirstEngine
 // Constructor
 Typewriter::Typewriter()
     : m_oStartPosition( 0 ), m_pcoFont( nullptr ), m_dFontSize( 1 ),
-      m_dLetterSpacing( 0 ), m_dLineSpacing( 1 ), m_dTabSize( 4 ) {}
+      m_dLetterSpacing( 0 ), m_dLineSpacing( 1 ), m_dTabSize( 4 )
+{
+    // Glyphs are always laid out flat, and move for every character
+    SetPlanar();
+}
 
 // Start a new line
 void Typewriter::DrawNewLine()
 {
     double dLead = m_pcoFont->Leading() * m_dFontSize * m_dLineSpacing / m_pcoFont->Em();
-    SetPosition( m_oStartPosition.x, m_oPosition.y - dLead );
+    SetPosition( m_oStartPosition.x(), m_oPosition.y() - dLead );
 }
 
 // Tab
 void Typewriter::DrawTab()
 {
     double dSize = m_dTabSize -
-        Math::Modulo( m_oPosition.x - m_oStartPosition.x, m_dTabSize );
+        Math::Modulo( m_oPosition.x() - m_oStartPosition.x(), m_dTabSize );
     m_pcoFont->SetTabSlug( *this, dSize, m_dFontSize );
     Draw();
-    SetPosition( m_oPosition.x + dSize, m_oPosition.y );
+    SetPosition( m_oPosition.x() + dSize, m_oPosition.y() );
 }
 
 // Draw a character
@@ -40,26 +44,26 @@ void Typewriter::DrawCharacter( char a_cCharacter )
 {
     m_pcoFont->SetSlug( *this, a_cCharacter, m_dFontSize );
     Draw();
-    SetPosition( m_oPosition.x + DisplaySize().x, m_oPosition.y );
+    SetPosition( m_oPosition.x() + DisplaySize().x(), m_oPosition.y() );
     double dSpace = m_dLetterSpacing * m_pcoFont->Em();
     if( 0.0 != dSpace )
     {
         m_pcoFont->SetTabSlug( *this, dSpace, m_dFontSize );
         Draw();
-        SetPosition( m_oPosition.x + dSpace, m_oPosition.y );
+        SetPosition( m_oPosition.x() + dSpace, m_oPosition.y() );
     }
 }
 void Typewriter::DrawSymbol( const char* ac_pcCharacterName )
 {
     m_pcoFont->SetSlug( *this, ac_pcCharacterName, m_dFontSize );
     Draw();
-    SetPosition( m_oPosition.x + DisplaySize().x, m_oPosition.y );
+    SetPosition( m_oPosition.x() + DisplaySize().x(), m_oPosition.y() );
     double dSpace = m_dLetterSpacing * m_pcoFont->Em();
     if( 0.0 != dSpace )
     {
         m_pcoFont->SetTabSlug( *this, dSpace, m_dFontSize );
         Draw();
-        SetPosition( m_oPosition.x + dSpace, m_oPosition.y );
+        SetPosition( m_oPosition.x() + dSpace, m_oPosition.y() );
     }
 }
 
@@ -131,9 +135,9 @@ void Typewriter::SetStartPosition( const Point3D& ac_roPosition )
 }
 void Typewriter::SetStartPosition( double a_dX, double a_dY, double a_dZ )
 {
-    Instance().m_oStartPosition.x = a_dX;
-    Instance().m_oStartPosition.y = a_dY;
-    Instance().m_oStartPosition.z = a_dZ;
+    Instance().m_oStartPosition.x() = a_dX;
+    Instance().m_oStartPosition.y() = a_dY;
+    Instance().m_oStartPosition.z() = a_dZ;
     Instance().SetPosition( a_dX, a_dY, a_dZ );
 }
 
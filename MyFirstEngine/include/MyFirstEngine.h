@@ -3,8 +3,8 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 4, 2014
  * Description:        All-inclusive header file for the MyFirstEngine library.
- * Last Modified:      February 25, 2014
- * Last Modification:  Adding includes for recently-implemented classes.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Added FrameArena.h.
  ******************************************************************************/
 
 #ifndef MY_FIRST_ENGINE__H
@@ -21,6 +21,7 @@
 #include "..\Declarations\Drawable.h"
 #include "..\Declarations\Font.h"
 #include "..\Declarations\Frame.h"
+#include "..\Declarations\FrameArena.h"
 #include "..\Declarations\GameEngine.h"
 #include "..\Declarations\GameState.h"
 #include "..\Declarations\GameWindow.h"
@@ -3,17 +3,17 @@
  * Author:             Elizabeth Lowry
  * Date Created:       February 25, 2014
  * Description:        Vertex shader for a solid Quad.
- * Last Modified:      June 26, 2014
- * Last Modification:  Debugging.
+ * Last Modified:      October 17, 2026
+ * Last Modification:  Single precision.
  ******************************************************************************/
 
 #version 410
 
-uniform dmat4 u_dm4ModelViewProjection;
+uniform mat4 u_m4ModelViewProjection;
 
 in vec2 i_v2Position;
 
 void main()
 {
-    gl_Position = vec4( u_dm4ModelViewProjection * vec4( i_v2Position, 0.0, 1.0 ));
+    gl_Position = u_m4ModelViewProjection * vec4( i_v2Position, 0.0, 1.0 );
 }